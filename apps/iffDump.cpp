@@ -33,6 +33,7 @@
 #include <cassert>
 
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 #include <swgLib/model.hpp>
 
 unsigned int numCols = 0;
@@ -2354,6 +2355,7 @@ std::size_t readRecord(
 
 int main(int argc, char** argv)
 {
+	ml::logger::setLevel(ml::logger::LOG_DEBUG);
 
 	if (2 > argc)
 	{
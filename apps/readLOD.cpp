@@ -23,6 +23,7 @@
 */
 
 #include <swgLib/lod.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <fstream>
@@ -31,6 +32,8 @@
 
 int main(int argc, char** argv)
 {
+	ml::logger::setLevel(ml::logger::LOG_DEBUG);
+
 	if (2 != argc)
 	{
 		std::cout << "readLOD <file>" << std::endl;
@@ -46,7 +49,15 @@ int main(int argc, char** argv)
 	}
 
 	ml::lod mesh;
-	mesh.readLOD(meshFile);
+	try
+	{
+		mesh.readLOD(meshFile);
+	}
+	catch (const ml::parseError& e)
+	{
+		std::cout << argv[1] << ": " << e.what() << std::endl;
+		return 1;
+	}
 
 	meshFile.close();
 
@@ -27,10 +27,12 @@
 #include <string>
 #include <cstdlib>
 
+#include <swgLib/logger.hpp>
 #include <swgLib/mesh.hpp>
 
 int main(int argc, char** argv)
 {
+	ml::logger::setLevel(ml::logger::LOG_DEBUG);
 
 	if (2 != argc)
 	{
@@ -47,7 +49,15 @@ int main(int argc, char** argv)
 	}
 
 	ml::mesh mesh;
-	mesh.readMESH(meshFile);
+	try
+	{
+		mesh.readMESH(meshFile);
+	}
+	catch (const ml::parseError& e)
+	{
+		std::cout << argv[1] << ": " << e.what() << std::endl;
+		return 1;
+	}
 
 	meshFile.close();
 
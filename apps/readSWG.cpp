@@ -41,6 +41,7 @@
 #include <swgLib/foot.hpp>
 #include <swgLib/ilf.hpp>
 #include <swgLib/lod.hpp>
+#include <swgLib/logger.hpp>
 #include <swgLib/mesh.hpp>
 #include <swgLib/mlod.hpp>
 #include <swgLib/peft.hpp>
@@ -64,7 +65,7 @@
 #include <swgLib/swts.hpp>
 #include <swgLib/ws.hpp>
 
-int main(int argc, char** argv)
+static int readSWG(int argc, char** argv)
 {
 	// Read
 	if (2 == argc)
@@ -364,3 +365,18 @@ int main(int argc, char** argv)
 
 	return 0;
 }
+
+int main(int argc, char** argv)
+{
+	ml::logger::setLevel(ml::logger::LOG_DEBUG);
+
+	try
+	{
+		return readSWG(argc, argv);
+	}
+	catch (const ml::parseError& e)
+	{
+		std::cout << "Parse error: " << e.what() << std::endl;
+	}
+	return 1;
+}
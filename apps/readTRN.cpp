@@ -22,6 +22,8 @@
  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
+#include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 #include <swgLib/ptat.hpp>
 
 #include <iostream>
@@ -31,6 +33,7 @@
 
 int main(int argc, char** argv)
 {
+	ml::logger::setLevel(ml::logger::LOG_DEBUG);
 
 	if (2 != argc)
 	{
@@ -47,7 +50,15 @@ int main(int argc, char** argv)
 	}
 
 	ml::ptat terrain;
-	terrain.read(terrainFile);
+	try
+	{
+		terrain.read(terrainFile);
+	}
+	catch (const ml::parseError& e)
+	{
+		std::cout << argv[1] << ": " << e.what() << std::endl;
+		return 1;
+	}
 
 	terrainFile.close();
 
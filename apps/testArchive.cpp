@@ -24,11 +24,14 @@
 */
 
 #include <treLib/treArchive.hpp>
+#include <swgLib/logger.hpp>
 #include <iostream>
 #include <cstdlib>
 
 int main(int argc, char** argv)
 {
+	ml::logger::setLevel(ml::logger::LOG_ERROR);
+
 	if (argc != 2)
 	{
 		std::cout << "Usage: " << argv[0] << " <path to tre directory>"
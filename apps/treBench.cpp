@@ -0,0 +1,591 @@
+/** -*-c++-*-
+ *  \file   treBench.cpp
+ *  \author Ken Sewell
+
+ treLib is used for the creation and deconstruction of .TRE files.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of treLib.
+
+ treLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ treLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with treLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <treLib/treArchive.hpp>
+#include <treLib/treClass.hpp>
+#include <treLib/treExtractor.hpp>
+#include <swgLib/logger.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <set>
+#include <sstream>
+#include <thread>
+
+#include <sys/stat.h> // For mkdir()
+#include <sys/types.h> // For mkdir()
+
+#ifdef WIN32
+#include <direct.h> // For _mkdir(), _rmdir(), _chdir(), _getcwd()
+#include <windows.h>
+#include <psapi.h> // For GetProcessMemoryInfo()
+#ifdef _MSC_VER
+#pragma comment(lib, "psapi.lib")
+#endif
+#else
+#include <sys/resource.h> // For getrusage()
+#include <unistd.h> // For rmdir(), chdir(), getcwd()
+#endif
+
+typedef std::chrono::steady_clock benchClock;
+
+/// One synthetic archive to generate and measure.
+class benchConfig
+{
+public:
+	const char* name;
+	uint32_t records;
+	uint32_t avgSize;
+	uint32_t compressedPercent;
+};
+
+static const benchConfig configs[] = {
+	{ "small", 1000, 4 * 1024, 75 },
+	{ "many", 20000, 512, 50 },
+	{ "large", 100, 1024 * 1024, 100 },
+	{ "raw", 1000, 32 * 1024, 0 },
+};
+
+class benchResult
+{
+public:
+	std::string config;
+	uint32_t records;
+	uint64_t bytes;
+	uint64_t archiveBytes;
+	double buildMBs;
+	double buildParallelMBs;
+	double loadMs;
+	double loadSidecarMs;
+	double seqLookupNs;
+	double randLookupNs;
+	double seqReadMBs;
+	double randReadMBs;
+	double extractMBs;
+	uint64_t peakRssKB;
+};
+
+/// Peak resident set size of this process so far, 0 if unknown.
+static uint64_t getPeakRSS()
+{
+#ifdef WIN32
+	PROCESS_MEMORY_COUNTERS counters;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+	{
+		return counters.PeakWorkingSetSize / 1024;
+	}
+	return 0;
+#else
+	struct rusage usage;
+	if (0 != getrusage(RUSAGE_SELF, &usage))
+	{
+		return 0;
+	}
+#ifdef __APPLE__
+	return usage.ru_maxrss / 1024;
+#else
+	return usage.ru_maxrss;
+#endif
+#endif
+}
+
+static double secondsSince(const benchClock::time_point& start)
+{
+	return std::chrono::duration<double>(benchClock::now() - start).count();
+}
+
+static double toMBs(const uint64_t& bytes, const double& seconds)
+{
+	return (seconds > 0.0) ? (double(bytes) / (1024.0 * 1024.0) / seconds) : 0.0;
+}
+
+/**
+   Add the parent directories of path, searching from offset from, to
+   dirs.  With create they are made and only the ones made are added,
+   so removeAll() leaves directories that already existed alone.
+*/
+static void addParents(const std::string& path, std::set<std::string>& dirs,
+	const bool create, const std::string::size_type from = 0)
+{
+	std::string::size_type end = path.find('/', from);
+	while (std::string::npos != end)
+	{
+		const std::string dir = path.substr(0, end);
+		if (!dir.empty() && (0 == dirs.count(dir)))
+		{
+			if (!create)
+			{
+				dirs.insert(dir);
+			}
+#ifdef WIN32
+			else if (0 == _mkdir(dir.c_str()))
+#else
+			else if (0 == mkdir(dir.c_str(), 0755))
+#endif
+			{
+				dirs.insert(dir);
+			}
+		}
+		end = path.find('/', end + 1);
+	}
+}
+
+/// Current working directory, empty on failure.
+static std::string currentDir()
+{
+	char buffer[4096];
+#ifdef WIN32
+	return (nullptr != _getcwd(buffer, sizeof(buffer))) ? buffer : "";
+#else
+	return (nullptr != getcwd(buffer, sizeof(buffer))) ? buffer : "";
+#endif
+}
+
+static bool changeDir(const std::string& dir)
+{
+#ifdef WIN32
+	return (0 == _chdir(dir.c_str()));
+#else
+	return (0 == chdir(dir.c_str()));
+#endif
+}
+
+static void removeAll(const std::vector<std::string>& files,
+	const std::set<std::string>& dirs)
+{
+	for (const auto& file : files)
+	{
+		std::remove(file.c_str());
+	}
+
+	// Children sort after their parents, remove deepest first
+	for (auto i = dirs.rbegin(); i != dirs.rend(); ++i)
+	{
+#ifdef WIN32
+		_rmdir(i->c_str());
+#else
+		rmdir(i->c_str());
+#endif
+	}
+}
+
+/**
+   Payload for one record.  Compressed records get text-like data that
+   deflates well, uncompressed ones random bytes like packed textures.
+*/
+static void makePayload(std::mt19937& rng, const uint32_t& size,
+	const bool compressible, std::string& data)
+{
+	static const char* words[] = {
+		"appearance", "mesh", "shader", "texture", "terrain", "object",
+		"static", "lod", "skeleton", "animation", "sound", "clientdata"
+	};
+
+	data.clear();
+	data.reserve(size);
+	if (compressible)
+	{
+		while (data.size() < size)
+		{
+			data += words[rng() % 12];
+			data += (0 == (rng() % 8)) ? '\n' : ' ';
+			data += std::to_string(rng() % 1000);
+			data += ' ';
+		}
+		data.resize(size);
+	}
+	else
+	{
+		while (data.size() < size)
+		{
+			data.push_back(static_cast<char>(rng() & 0xff));
+		}
+	}
+}
+
+static bool runConfig(const benchConfig& config, const std::string& workDir,
+	const unsigned int& threads, const bool keep, benchResult& result)
+{
+	std::mt19937 rng(12345);
+	std::set<std::string> dirs;
+	std::vector<std::string> files;
+
+	const std::string base = workDir + "/" + config.name;
+	addParents(base + "/", dirs, true);
+
+	// Generate input files, record names are relative to base...
+	std::vector<std::string> names;
+	std::vector<uint32_t> formats;
+	uint64_t totalBytes = 0;
+	std::string data;
+	for (uint32_t i = 0; i < config.records; ++i)
+	{
+		std::ostringstream name;
+		name << "src/d" << (i % 64) << "/s" << ((i / 64) % 16)
+			<< "/file_" << i << ".dat";
+		const std::string path = base + "/" + name.str();
+
+		const uint32_t size =
+			config.avgSize / 2 + uint32_t(rng() % (config.avgSize + 1));
+		const bool compressed = (rng() % 100) < config.compressedPercent;
+		makePayload(rng, size, compressed, data);
+
+		addParents(path, dirs, true, base.size() + 1);
+		std::ofstream out(path.c_str(), std::ios_base::binary);
+		out.write(data.data(), data.size());
+		if (!out.good())
+		{
+			std::cout << "Failed to write: " << path << std::endl;
+			removeAll(files, dirs);
+			return false;
+		}
+
+		names.push_back(name.str());
+		formats.push_back(compressed ? 2 : 0);
+		files.push_back(path);
+		totalBytes += size;
+	}
+
+	const std::string treName = base + "/bench.tre";
+	const std::string parallelName = base + "/bench_parallel.tre";
+	files.push_back(treName);
+	files.push_back(parallelName);
+	files.push_back(treName + ".idx");
+
+	// writeFile() reads inputs by record name, so build from base...
+	const std::string startDir = currentDir();
+	if (startDir.empty())
+	{
+		std::cout << "Failed to get the current directory" << std::endl;
+		removeAll(files, dirs);
+		return false;
+	}
+
+	// Build, serial and with all threads...
+	for (int pass = 0; pass < 2; ++pass)
+	{
+		treClass tre;
+		tre.setVersion("5000");
+		tre.setFileBlockCompression(2);
+		tre.setNameBlockCompression(2);
+		tre.setNumThreads((0 == pass) ? 1 : threads);
+		for (uint32_t i = 0; i < config.records; ++i)
+		{
+			treFileRecord record;
+			record.setFileName(names[i]);
+			record.setFormat(formats[i]);
+			tre.getFileRecordList().push_back(record);
+		}
+
+		if (!changeDir(base))
+		{
+			std::cout << "Failed to enter: " << base << std::endl;
+			removeAll(files, dirs);
+			return false;
+		}
+
+		const benchClock::time_point start = benchClock::now();
+		const bool written =
+			tre.writeFile((0 == pass) ? "bench.tre" : "bench_parallel.tre");
+		const double seconds = secondsSince(start);
+
+		if (!changeDir(startDir) || !written)
+		{
+			std::cout << "Build failed in " << config.name << std::endl;
+			removeAll(files, dirs);
+			return false;
+		}
+		if (0 == pass)
+		{
+			result.buildMBs = toMBs(totalBytes, seconds);
+		}
+		else
+		{
+			result.buildParallelMBs = toMBs(totalBytes, seconds);
+		}
+	}
+
+	std::ifstream archiveFile(treName.c_str(), std::ios_base::binary);
+	archiveFile.seekg(0, std::ios_base::end);
+	result.archiveBytes = static_cast<uint64_t>(archiveFile.tellg());
+	archiveFile.close();
+
+	// Index load, median of several, with and without the sidecar...
+	for (int sidecar = 0; sidecar < 2; ++sidecar)
+	{
+		if (sidecar)
+		{
+			// First load writes the sidecar
+			treClass warm;
+			warm.setIndexSidecar(true);
+			warm.readFile(treName);
+		}
+
+		std::vector<double> times;
+		for (int run = 0; run < 5; ++run)
+		{
+			treArchive archive;
+			archive.setIndexSidecar(0 != sidecar);
+			const benchClock::time_point start = benchClock::now();
+			archive.addFile(treName);
+			times.push_back(secondsSince(start) * 1000.0);
+		}
+		std::sort(times.begin(), times.end());
+		(sidecar ? result.loadSidecarMs : result.loadMs) = times[times.size() / 2];
+	}
+
+	treArchive archive;
+	archive.addFile(treName);
+
+	std::vector<std::string> shuffled(names);
+	std::shuffle(shuffled.begin(), shuffled.end(), rng);
+
+	// Lookup latency, enough passes for about a million lookups...
+	const uint32_t passes = std::max<uint32_t>(1, 1000000 / config.records);
+	for (int order = 0; order < 2; ++order)
+	{
+		const std::vector<std::string>& list = order ? shuffled : names;
+		uint32_t found = 0;
+		const benchClock::time_point start = benchClock::now();
+		for (uint32_t pass = 0; pass < passes; ++pass)
+		{
+			for (const auto& name : list)
+			{
+				found += archive.fileExists(name) ? 1 : 0;
+			}
+		}
+		const double ns = secondsSince(start) * 1e9 / (double(passes) * list.size());
+		(order ? result.randLookupNs : result.seqLookupNs) = ns;
+
+		if (found != passes * list.size())
+		{
+			std::cout << "Lookup failed in " << config.name << std::endl;
+		}
+	}
+
+	// Read and inflate everything, in archive order and shuffled...
+	for (int order = 0; order < 2; ++order)
+	{
+		const std::vector<std::string>& list = order ? shuffled : names;
+		uint64_t bytes = 0;
+		const benchClock::time_point start = benchClock::now();
+		for (const auto& name : list)
+		{
+			treDataBlock block;
+			if (archive.getFileData(name, block))
+			{
+				bytes += block.getUncompressedSize();
+			}
+		}
+		(order ? result.randReadMBs : result.seqReadMBs) =
+			toMBs(bytes, secondsSince(start));
+	}
+
+	// Extract to disk with the parallel extractor...
+	{
+		treClass tre;
+		tre.readFile(treName);
+		treExtractor extractor(tre);
+		extractor.setNumThreads(threads);
+		extractor.setOutputDir(base + "/out");
+
+		const benchClock::time_point start = benchClock::now();
+		const bool extracted = extractor.extract();
+		result.extractMBs = toMBs(extractor.getBytesWritten(), secondsSince(start));
+
+		addParents(base + "/out/", dirs, false, base.size() + 1);
+		for (const auto& name : names)
+		{
+			const std::string path = base + "/out/" + name;
+			addParents(path, dirs, false, base.size() + 1);
+			files.push_back(path);
+		}
+
+		if (!extracted || (0 != extractor.getNumFailed()))
+		{
+			std::cout << "Extract failed in " << config.name << ": "
+				<< extractor.getNumFailed() << " files" << std::endl;
+			removeAll(files, dirs);
+			return false;
+		}
+	}
+
+	result.config = config.name;
+	result.records = config.records;
+	result.bytes = totalBytes;
+	result.peakRssKB = getPeakRSS();
+
+	if (!keep)
+	{
+		removeAll(files, dirs);
+	}
+
+	return true;
+}
+
+static void printJSON(std::ostream& os, const std::vector<benchResult>& results)
+{
+	os << "{\n  \"benchmark\": \"treBench\",\n  \"format\": 1,\n"
+		<< "  \"results\": [\n";
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const benchResult& r = results[i];
+		os << "    {\"config\": \"" << r.config << "\""
+			<< ", \"records\": " << r.records
+			<< ", \"bytes\": " << r.bytes
+			<< ", \"archive_bytes\": " << r.archiveBytes
+			<< ", \"build_mb_s\": " << r.buildMBs
+			<< ", \"build_parallel_mb_s\": " << r.buildParallelMBs
+			<< ", \"load_ms\": " << r.loadMs
+			<< ", \"load_sidecar_ms\": " << r.loadSidecarMs
+			<< ", \"lookup_seq_ns\": " << r.seqLookupNs
+			<< ", \"lookup_rand_ns\": " << r.randLookupNs
+			<< ", \"read_seq_mb_s\": " << r.seqReadMBs
+			<< ", \"read_rand_mb_s\": " << r.randReadMBs
+			<< ", \"extract_mb_s\": " << r.extractMBs
+			<< ", \"peak_rss_kb\": " << r.peakRssKB
+			<< "}" << ((i + 1 < results.size()) ? "," : "") << "\n";
+	}
+	os << "  ]\n}" << std::endl;
+}
+
+static void printCSV(std::ostream& os, const std::vector<benchResult>& results)
+{
+	os << "config,records,bytes,archive_bytes,build_mb_s,"
+		<< "build_parallel_mb_s,load_ms,load_sidecar_ms,lookup_seq_ns,"
+		<< "lookup_rand_ns,read_seq_mb_s,read_rand_mb_s,extract_mb_s,"
+		<< "peak_rss_kb\n";
+	for (const auto& r : results)
+	{
+		os << r.config << "," << r.records << "," << r.bytes << ","
+			<< r.archiveBytes << "," << r.buildMBs << ","
+			<< r.buildParallelMBs << "," << r.loadMs << ","
+			<< r.loadSidecarMs << "," << r.seqLookupNs << ","
+			<< r.randLookupNs << "," << r.seqReadMBs << ","
+			<< r.randReadMBs << "," << r.extractMBs << ","
+			<< r.peakRssKB << "\n";
+	}
+	os.flush();
+}
+
+int main(int argc, char** argv)
+{
+	ml::logger::setLevel(ml::logger::LOG_ERROR);
+
+	bool csv = false;
+	bool quick = false;
+	bool keep = false;
+	unsigned int threads = std::max(1u, std::thread::hardware_concurrency());
+	std::string only;
+	std::string workDir("treBench.tmp");
+
+	// Parse options...
+	for (int arg = 1; arg < argc; ++arg)
+	{
+		if (0 == strcmp(argv[arg], "-c"))
+		{
+			csv = true;
+		}
+		else if (0 == strcmp(argv[arg], "-q"))
+		{
+			quick = true;
+		}
+		else if (0 == strcmp(argv[arg], "-k"))
+		{
+			keep = true;
+		}
+		else if ((0 == strcmp(argv[arg], "-j")) && (arg + 1 < argc))
+		{
+			threads = std::max(1, atoi(argv[++arg]));
+		}
+		else if ((0 == strcmp(argv[arg], "-o")) && (arg + 1 < argc))
+		{
+			only = argv[++arg];
+		}
+		else if ((0 == strcmp(argv[arg], "-w")) && (arg + 1 < argc))
+		{
+			workDir = argv[++arg];
+		}
+		else
+		{
+			std::cout << "Usage: treBench [-c] [-q] [-k] [-j threads] "
+				<< "[-o config] [-w workdir]\n"
+				<< "  -c          CSV output (default JSON)\n"
+				<< "  -q          Quick run, a tenth of the records\n"
+				<< "  -k          Keep generated files\n"
+				<< "  -j threads  Threads for parallel build/extract\n"
+				<< "  -o config   Only run one of: small many large raw\n"
+				<< "  -w workdir  Scratch directory (default treBench.tmp)\n"
+				<< "Peak RSS is for the whole process, run configs one at a\n"
+				<< "time with -o to compare them." << std::endl;
+			return 0;
+		}
+	}
+
+	std::vector<benchResult> results;
+	for (const auto& entry : configs)
+	{
+		if (!only.empty() && (only != entry.name))
+		{
+			continue;
+		}
+
+		benchConfig config = entry;
+		if (quick)
+		{
+			config.records = std::max<uint32_t>(10, config.records / 10);
+		}
+
+		benchResult result;
+		if (!runConfig(config, workDir, threads, keep, result))
+		{
+			std::cout << "Benchmark failed: " << config.name << std::endl;
+			return 1;
+		}
+		results.push_back(result);
+	}
+
+	if (results.empty())
+	{
+		std::cout << "Unknown config: " << only << std::endl;
+		return 1;
+	}
+
+	if (csv)
+	{
+		printCSV(std::cout, results);
+	}
+	else
+	{
+		printJSON(std::cout, results);
+	}
+
+	return 0;
+}
@@ -23,21 +23,75 @@
  */
 
 #include <treLib/treClass.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <fstream>
 #include <stdlib.h> // for atoi()
+#include <string.h> // for strcmp()
 
 int main( int argc, char **argv )
 {
+    ml::logger::setLevel(ml::logger::LOG_ERROR);
+
+    unsigned int numThreads = 1;
+    int level = -1;
+    bool dedup = false;
+    const char *baseName = NULL;
+
+    // Parse options...
+    while( (argc > 3) && ('-' == argv[1][0]) )
+    {
+	if( 0 == strcmp( argv[1], "-d" ) )
+	{
+	    dedup = true;
+	    --argc;
+	    ++argv;
+	    continue;
+	}
+	else if( 0 == strcmp( argv[1], "-j" ) )
+	{
+	    numThreads = atoi( argv[2] );
+	}
+	else if( 0 == strcmp( argv[1], "-l" ) )
+	{
+	    level = atoi( argv[2] );
+	}
+	else if( 0 == strcmp( argv[1], "-b" ) )
+	{
+	    baseName = argv[2];
+	}
+	else
+	{
+	    break;
+	}
+	argc -= 2;
+	argv += 2;
+    }
 
     if( 3 != argc )
     {
-	std::cout << "Usage: treBuild <filelist.txt> <file.tre>" << std::endl;
+	std::cout << "Usage: treBuild [-d] [-j threads] [-l level] "
+		  << "[-b base.tre] <filelist.txt> <file.tre>\n"
+		  << "  -d          Store identical files only once\n"
+		  << "  -j threads  Read/compress with this many threads\n"
+		  << "  -l level    zlib compression level 0-9 "
+		  << "(default -1, zlib default)\n"
+		  << "  -b base.tre Reuse unchanged compressed files "
+		  << "from base.tre" << std::endl;
 	return 0;
     }
 
     treClass tre;
+    tre.setNumThreads( numThreads );
+    tre.setCompressionLevel( level );
+    tre.setDeduplicate( dedup );
+
+    if( (NULL != baseName) && !tre.setBaseArchive( baseName ) )
+    {
+	std::cout << "Failed to read base archive: " << baseName << std::endl;
+	return 1;
+    }
 
     // Load file names...
     std::vector<std::string> fileList;
@@ -63,7 +117,25 @@ int main( int argc, char **argv )
     tre.setVersion( "5000" );
     tre.setFileBlockCompression( 2 );
     tre.setNameBlockCompression( 2 );
-    tre.writeFile( std::string( argv[2] ) );
+    if( !tre.writeFile( std::string( argv[2] ) ) )
+    {
+	std::cout << "Failed to write: " << argv[2] << std::endl;
+	return 1;
+    }
+
+    if( NULL != baseName )
+    {
+	std::cout << "Reused records: " << tre.getReusedRecords()
+		  << ", uncompressed bytes: " << tre.getReusedBytes()
+		  << std::endl;
+    }
+
+    if( dedup )
+    {
+	std::cout << "Duplicate records: " << tre.getDeduplicatedRecords()
+		  << ", bytes saved: " << tre.getDeduplicatedBytes()
+		  << std::endl;
+    }
 
     return 0;
 }
@@ -23,6 +23,8 @@
  */
 
 #include <treLib/treClass.hpp>
+#include <treLib/treExtractor.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <fstream>
@@ -31,15 +33,46 @@
 
 int main(int argc, char** argv)
 {
+	ml::logger::setLevel(ml::logger::LOG_INFO);
+
+	// Optional "-j N" selects the parallel extractor, "-v" checks MD5s...
+	int numThreads = -1;
+	bool verify = false;
+	while (argc > 2)
+	{
+		if (strncmp(argv[1], "-j", 2) == 0)
+		{
+			numThreads = atoi(argv[2]);
+			argc -= 2;
+			argv += 2;
+		}
+		else if (strncmp(argv[1], "-v", 2) == 0)
+		{
+			verify = true;
+			--argc;
+			++argv;
+		}
+		else
+		{
+			break;
+		}
+	}
+
 	if ((argc < 2) || (argc > 4)) {
 		std::cout
 			<< "Usage: treDump <file.tre>\n"
 			<< "or\n"
-			<< "       treDump <file.tre> <record #>\n"
+			<< "       treDump [-j N] [-v] <file.tre> <record #>\n"
+			<< "or\n"
+			<< "       treDump [-j N] [-v] <file.tre> all\n"
 			<< "or\n"
-			<< "       treDump <file.tre> all\n"
+			<< "       treDump [-j N] [-v] <file.tre> <start record #> <end record>\n"
 			<< "or\n"
-			<< "       treDump <file.tre> <start record #> <end record>\n";
+			<< "       treDump [-j N] <file.tre> scrub\n"
+			<< "\n"
+			<< "  -j N  Extract with N threads (0 = one per core)\n"
+			<< "  -v    Verify records against stored MD5 sums\n"
+			<< "  scrub Check every record's MD5, list mismatches\n";
 		return 0;
 	}
 
@@ -47,10 +80,69 @@ int main(int argc, char** argv)
 	if (!tre.readFile(std::string(argv[1])))
 	{
 		std::cout << "Failed to read file: " << argv[1] << "\n";
-		return 0;
+		return 1;
 	}
 
-	if (3 == argc)
+	if (verify)
+	{
+		tre.setMD5Mode(treClass::MD5_VERIFY);
+	}
+
+	if ((3 == argc) && (strncmp(argv[2], "scrub", 5) == 0))
+	{
+		tre.mapFile();
+
+		std::vector<uint32_t> mismatches;
+		const uint32_t checked =
+			tre.scrub(mismatches, (numThreads >= 0) ? numThreads : 0);
+		for (const auto& i : mismatches)
+		{
+			std::cout << "MD5 mismatch: " << i << ": "
+				<< tre.getFileRecordList()[i].getFileName() << "\n";
+		}
+		std::cout << "Checked " << checked << " records, "
+			<< mismatches.size() << " mismatched\n";
+
+		return (mismatches.empty() ? 0 : 1);
+	}
+
+	bool failed = false;
+	if ((numThreads >= 0) && (argc > 2))
+	{
+		uint32_t startRecord = 0;
+		uint32_t endRecord = 0;
+		if (3 == argc)
+		{
+			if (strncmp(argv[2], "all", 3) == 0)
+			{
+				if (0 == tre.getNumRecords()) { return 0; }
+				endRecord = tre.getNumRecords() - 1;
+			}
+			else
+			{
+				startRecord = endRecord = atoi(argv[2]);
+			}
+		}
+		else
+		{
+			startRecord = atoi(argv[2]);
+			endRecord = atoi(argv[3]);
+		}
+
+		treExtractor extractor(tre);
+		extractor.setNumThreads(numThreads);
+		const bool extracted = extractor.extract(startRecord, endRecord);
+
+		std::cout << "Extracted " << extractor.getNumExtracted()
+			<< " records (" << extractor.getBytesWritten() << " bytes), "
+			<< extractor.getNumFailed() << " failed\n";
+
+		if (!extracted || (extractor.getNumFailed() > 0))
+		{
+			return 1;
+		}
+	}
+	else if (3 == argc)
 	{
 		if (strncmp(argv[2], "all", 3) == 0)
 		{
@@ -58,14 +150,14 @@ int main(int argc, char** argv)
 			const int endRecord = tre.getNumRecords();
 			for (int i = startRecord; i < endRecord; ++i) {
 				// Save
-				tre.saveRecordAsFile(i);
+				failed |= !tre.saveRecordAsFile(i);
 			}
 		}
 		else
 		{
 			const int recordNum = atoi(argv[2]);
 			// Save
-			tre.saveRecordAsFile(recordNum);
+			failed = !tre.saveRecordAsFile(recordNum);
 		}
 	}
 	else if (4 == argc)
@@ -74,7 +166,7 @@ int main(int argc, char** argv)
 		const int endRecord = atoi(argv[3]);
 		for (int i = startRecord; i <= endRecord; ++i) {
 			// Save
-			tre.saveRecordAsFile(i);
+			failed |= !tre.saveRecordAsFile(i);
 		}
 	}
 	else
@@ -85,5 +177,5 @@ int main(int argc, char** argv)
 		tre.printNameBlock(std::cout);
 	}
 
-	return 0;
+	return (failed ? 1 : 0);
 }
@@ -0,0 +1,213 @@
+/** -*-c++-*-
+ *  \file   treLayout.cpp
+ *  \author Ken Sewell
+
+ treLib is used for the creation and deconstruction of .TRE files.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of treLib.
+
+ treLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ treLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with treLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <treLib/treClass.hpp>
+#include <swgLib/logger.hpp>
+#include <fstream>
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+/**
+   Bytes skipped (forwards or backwards) between consecutive reads
+   when records are read in the order given.
+*/
+static uint64_t getSeekDistance(const treClass& tre,
+	const std::vector<uint32_t>& reads,
+	const std::vector<uint32_t>& offsets)
+{
+	uint64_t distance = 0;
+	uint64_t position = 0;
+	for (size_t i = 0; i < reads.size(); ++i)
+	{
+		const uint64_t offset = offsets[reads[i]];
+		if (i > 0)
+		{
+			distance += (offset > position) ?
+				(offset - position) : (position - offset);
+		}
+		position = offset + tre.getStoredSize(reads[i]);
+	}
+
+	return distance;
+}
+
+int main(int argc, char** argv)
+{
+	ml::logger::setLevel(ml::logger::LOG_ERROR);
+
+	if (4 != argc)
+	{
+		std::cout << "Usage: " << argv[0] << " <trace.txt> <in.tre> <out.tre>\n"
+			<< "  Rewrites in.tre with the records named in trace.txt first,\n"
+			<< "  in the order they were first read, then the rest in their\n"
+			<< "  original order.  trace.txt is a treArchive::setTrace() log\n"
+			<< "  or one record name per line." << std::endl;
+		exit(0);
+	}
+
+	// beginWrite() truncates the output before the input is copied...
+	if (treClass::isSameFile(argv[2], argv[3]))
+	{
+		std::cout << "Output is the input: " << argv[3] << std::endl;
+		return 1;
+	}
+
+	treClass tre;
+	if (!tre.readFile(argv[2]))
+	{
+		std::cout << "Failed to read: " << argv[2] << std::endl;
+		return 1;
+	}
+
+	// First record with a name wins inside one archive...
+	const std::vector<treFileRecord>& records = tre.getFileRecordList();
+	std::unordered_map<std::string, uint32_t> byName;
+	for (uint32_t i = static_cast<uint32_t>(records.size()); i > 0; --i)
+	{
+		if (records[i - 1].getUncompressedSize() > 0)
+		{
+			byName[records[i - 1].getFileName()] = i - 1;
+		}
+	}
+
+	// Records in the order the trace first reads them...
+	std::ifstream trace(argv[1]);
+	if (!trace.is_open())
+	{
+		std::cout << "Failed to open: " << argv[1] << std::endl;
+		return 1;
+	}
+
+	std::vector<char> placed(records.size(), 0);
+	std::vector<uint32_t> order;
+	std::vector<uint32_t> reads;
+	std::string line;
+	while (std::getline(trace, line))
+	{
+		// Name is the third column of a trace line...
+		std::string name(line);
+		const size_t first = line.find('\t');
+		const size_t second = (std::string::npos == first) ?
+			std::string::npos : line.find('\t', first + 1);
+		if (std::string::npos != second)
+		{
+			const size_t third = line.find('\t', second + 1);
+			name = line.substr(second + 1, (std::string::npos == third) ?
+				std::string::npos : (third - second - 1));
+		}
+		if (!name.empty() && ('\r' == name.back()))
+		{
+			name.pop_back();
+		}
+
+		auto entry = byName.find(name);
+		if (byName.end() == entry)
+		{
+			continue;
+		}
+
+		reads.push_back(entry->second);
+		if (!placed[entry->second])
+		{
+			placed[entry->second] = 1;
+			order.push_back(entry->second);
+		}
+	}
+	const size_t numTraced = order.size();
+
+	// ...then everything else unchanged, shadowed duplicates included
+	for (uint32_t i = 0; i < records.size(); ++i)
+	{
+		if (!placed[i])
+		{
+			order.push_back(i);
+		}
+	}
+
+	treClass output;
+	output.setVersion("5000");
+	output.setFileBlockCompression(2);
+	output.setNameBlockCompression(2);
+	// Keeps records that shared data in the input sharing it, only
+	// after their stored bytes compare equal
+	output.setDeduplicate(true);
+
+	if (!output.beginWrite(argv[3]))
+	{
+		std::cout << "Failed to open: " << argv[3] << std::endl;
+		return 1;
+	}
+
+	std::vector<char> stored;
+	for (const auto& i : order)
+	{
+		const treFileRecord& record = records[i];
+		const uint32_t storedSize = tre.getStoredSize(i);
+
+		stored.resize(storedSize);
+		if (!tre.readStoredData(i, 0, stored.data(), storedSize) ||
+			!output.addStoredRecord(record.getFileName(),
+				stored.data(),
+				storedSize,
+				record.getUncompressedSize(),
+				record.getFormat()))
+		{
+			std::cout << "Failed to copy: " << record.getFileName() << std::endl;
+			output.endWrite();
+			return 1;
+		}
+	}
+
+	if (!output.endWrite())
+	{
+		std::cout << "Failed to write: " << argv[3] << std::endl;
+		return 1;
+	}
+
+	// Report how far the traced reads jump around before and after...
+	std::vector<uint32_t> oldOffsets(records.size());
+	for (uint32_t i = 0; i < records.size(); ++i)
+	{
+		oldOffsets[i] = records[i].getOffset();
+	}
+
+	std::vector<uint32_t> newOffsets(records.size());
+	const std::vector<treFileRecord>& written = output.getFileRecordList();
+	for (size_t n = 0; n < order.size(); ++n)
+	{
+		newOffsets[order[n]] = written[n].getOffset();
+	}
+
+	std::cout << "Records: " << records.size()
+		<< ", traced: " << numTraced
+		<< ", trace reads: " << reads.size() << "\n"
+		<< "Seek distance before: " << getSeekDistance(tre, reads, oldOffsets)
+		<< " bytes, after: " << getSeekDistance(tre, reads, newOffsets)
+		<< " bytes" << std::endl;
+
+	return 0;
+}
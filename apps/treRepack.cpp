@@ -0,0 +1,129 @@
+/** -*-c++-*-
+ *  \file   treRepack.cpp
+ *  \author Ken Sewell
+
+ treLib is used for the creation and deconstruction of .TRE files.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of treLib.
+
+ treLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ treLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with treLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <treLib/treArchive.hpp>
+#include <swgLib/logger.hpp>
+#include <fstream>
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+
+int main(int argc, char** argv)
+{
+	ml::logger::setLevel(ml::logger::LOG_ERROR);
+
+	bool dedup = false;
+	uint64_t maxSize = 0;
+	std::vector<std::string> inputs;
+
+	// Parse options...
+	int arg = 1;
+	while ((arg < argc) && ('-' == argv[arg][0]))
+	{
+		if (0 == strcmp(argv[arg], "-d"))
+		{
+			dedup = true;
+			++arg;
+		}
+		else if ((0 == strcmp(argv[arg], "-s")) && (arg + 1 < argc))
+		{
+			maxSize = uint64_t(atoi(argv[arg + 1])) * 1024 * 1024;
+			arg += 2;
+		}
+		else if ((0 == strcmp(argv[arg], "-f")) && (arg + 1 < argc))
+		{
+			// One .tre per line, lowest priority first...
+			std::ifstream list(argv[arg + 1]);
+			std::string name;
+			while (list >> name)
+			{
+				inputs.push_back(name);
+			}
+			arg += 2;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	if (arg >= argc)
+	{
+		std::cout << "Usage: " << argv[0]
+			<< " [-d] [-s MB] [-f tre_list.txt] <out.tre> [in.tre ...]\n"
+			<< "  Inputs are in load order, later files override earlier.\n"
+			<< "  -d          Store identical files only once\n"
+			<< "  -s MB       Split output into files of about MB megabytes\n"
+			<< "  -f list     Read input .tre names from list" << std::endl;
+		exit(0);
+	}
+
+	const std::string outName(argv[arg++]);
+	for (; arg < argc; ++arg)
+	{
+		inputs.push_back(argv[arg]);
+	}
+
+	treArchive archive;
+	for (const auto& input : inputs)
+	{
+		if (treClass::isSameFile(outName, input))
+		{
+			std::cout << "Output is also an input: " << input << std::endl;
+			return 1;
+		}
+
+		if (!archive.addFile(input))
+		{
+			std::cout << "Failed to add: " << input << std::endl;
+			return 1;
+		}
+	}
+	const uint32_t numRecords = archive.getNumRecords();
+	const uint32_t numEmpty = archive.getNumEmptyRecords();
+
+	std::vector<std::string> contents;
+	archive.getArchiveContents(contents);
+
+	std::vector<std::string> outputFiles;
+	if (!archive.repack(outName, outputFiles, maxSize, dedup))
+	{
+		std::cout << "Repack failed: " << outName << std::endl;
+		return 1;
+	}
+
+	std::cout << "Input files: " << inputs.size()
+		<< ", records: " << numRecords
+		<< ", kept: " << contents.size()
+		<< ", empty: " << numEmpty
+		<< ", dropped: " << (numRecords - numEmpty - contents.size())
+		<< std::endl;
+
+	for (const auto& output : outputFiles)
+	{
+		std::cout << "Wrote: " << output << std::endl;
+	}
+
+	return 0;
+}
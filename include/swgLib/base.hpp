@@ -26,9 +26,11 @@
 #include <fstream>
 #include <istream>
 #include <ostream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
+#include <swgLib/iffReader.hpp>
 #include <swgLib/vector3.hpp>
 #include <swgLib/matrix3.hpp>
 
@@ -63,6 +65,7 @@ namespace ml
 		bool operator==(const tag& t) const;
 
 		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 		std::size_t write(std::ostream& file) const;
 
 		const uint32_t& raw() const;
@@ -73,6 +76,32 @@ namespace ml
 		std::string _str;
 	};
 
+	/**
+	 * Thrown by the parsers on an unexpected tag, version or chunk size,
+	 * so a batch process can report the asset and carry on with the next.
+	 * getTag() is the chunk being read and getOffset() the stream or
+	 * buffer position where the problem was found, unknownOffset if the
+	 * position is not available.
+	 */
+	class parseError : public std::runtime_error
+	{
+	public:
+		static const std::size_t unknownOffset = ~std::size_t(0);
+
+		parseError(const std::string& tag,
+			const std::size_t& offset,
+			const std::string& message);
+
+		const std::string& getTag() const { return _tag; }
+		const std::size_t& getOffset() const { return _offset; }
+		const std::string& getMessage() const { return _message; }
+
+	protected:
+		std::string _tag;
+		std::size_t _offset;
+		std::string _message;
+	};
+
 	class base
 	{
 	public:
@@ -119,6 +148,16 @@ namespace ml
 
 		static std::size_t skip(std::istream& file, const std::size_t& skipBytes);
 
+		// Throw a parseError for tag at the current position of file.
+		[[noreturn]] static void fail(std::istream& file,
+			const std::string& tag,
+			const std::string& message);
+		[[noreturn]] static void fail(const iffReader& file,
+			const std::string& tag,
+			const std::string& message);
+		[[noreturn]] static void fail(const std::string& tag,
+			const std::string& message);
+
 		// ******************** String based Form headers ********************
 		static void peekHeader(std::istream& file,
 			std::string& form,
@@ -192,6 +231,107 @@ namespace ml
 
 		
 
+		// ******************** Buffer based reads ********************
+		// Same semantics as the istream versions above, but over a
+		// contiguous buffer. Parsers switch by taking an iffReader&.
+		template<typename T>
+		static std::size_t read(iffReader& file, T& data)
+		{
+			return file.read(data);
+		}
+
+		static std::size_t read(iffReader& file, bool& data)
+		{
+			uint8_t temp;
+			file.read(temp);
+			data = (0 != temp);
+			return sizeof(uint8_t);
+		}
+
+		static std::size_t read(iffReader& file, std::string& data, const std::size_t& length)
+		{
+			return file.read(data, length);
+		}
+
+		static std::size_t read(iffReader& file, std::string& data)
+		{
+			return file.read(data);
+		}
+
+		static std::size_t read(iffReader& file, vector3& vec);
+		static std::size_t read(iffReader& file, matrix3x3& mat);
+		static std::size_t read(iffReader& file, matrix3x4& mat);
+		static std::size_t read(iffReader& file, tag& t);
+
+		static std::size_t skip(iffReader& file, const std::size_t& skipBytes)
+		{
+			return file.skip(skipBytes);
+		}
+
+		static std::size_t readUnknown(iffReader& file,
+			const std::size_t size);
+
+		static void peekHeader(iffReader& file,
+			std::string& form,
+			std::size_t& size,
+			std::string& type);
+
+		static void peekHeader(iffReader& file,
+			uint32_t& form,
+			std::size_t& size,
+			uint32_t& type);
+
+		static std::size_t readFormHeader(iffReader& file,
+			std::string& form,
+			std::size_t& size,
+			std::string& type);
+
+		static std::size_t readFormHeader(iffReader& file,
+			std::string& type,
+			std::size_t& size);
+
+		static std::size_t readFormHeader(iffReader& file,
+			const std::string& expectedType,
+			std::size_t& size);
+
+		static std::size_t readFormHeader(iffReader& file,
+			uint32_t& form,
+			std::size_t& size,
+			uint32_t& type);
+
+		static std::size_t readFormHeader(iffReader& file,
+			uint32_t& type,
+			std::size_t& size);
+
+		static std::size_t readFormHeader(iffReader& file,
+			const uint32_t& expectedType,
+			std::size_t& size);
+
+		static std::size_t readRecordHeader(iffReader& file,
+			std::string& type,
+			std::size_t& size);
+
+		static std::size_t readRecordHeader(iffReader& file,
+			std::string& type);
+
+		static std::size_t readRecordHeader(iffReader& file,
+			const std::string& expectedType,
+			std::size_t& size);
+
+		static std::size_t readRecordHeader(iffReader& file,
+			const std::string& expectedType);
+
+		static std::size_t readRecordHeader(iffReader& file,
+			uint32_t& type,
+			std::size_t& size);
+
+		static std::size_t readRecordHeader(iffReader& file,
+			const uint32_t& expectedType,
+			std::size_t& size);
+
+		static std::size_t readRecordHeader(iffReader& file,
+			const uint32_t& expectedType);
+
 		static std::size_t writeFormHeader(std::ostream& file,
 			const std::size_t& size,
 			const std::string& type);
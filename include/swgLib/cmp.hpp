@@ -23,11 +23,14 @@
  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 #include <swgLib/appr.hpp>
+#include <swgLib/iffIndex.hpp>
 #include <swgLib/idtl.hpp>
 #include <swgLib/vector3.hpp>
 #include <swgLib/matrix3.hpp>
 
+#include <atomic>
 #include <fstream>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -51,8 +54,19 @@ namespace ml
 		cmp();
 		~cmp();
 
+		// Copies take the decoded parts under the source's lock.
+		cmp(const cmp& other);
+		cmp& operator=(const cmp& other);
+
 		std::size_t read(std::istream& file);
 
+		// Index the appearance without decoding it. Parts are decoded on
+		// first access, under a lock, so the getters of an opened cmp may
+		// be called from several threads.
+		bool open(std::istream& file);
+		bool open(const char* data, const std::size_t& size);
+
+		uint32_t getVersion() const;
 		uint32_t getNumParts() const;
 
 		const part &getPart(const uint32_t &index) const;
@@ -65,15 +79,25 @@ namespace ml
 		std::size_t readCMPv4(std::istream& file);
 		std::size_t readCMPv5(std::istream& file);
 		std::size_t readPART(std::istream& file);
+		std::size_t readPART(iffReader& file) const;
+		std::size_t readPARTv1(iffReader& file) const;
 		std::size_t readRADR(std::istream& file);
 
+		bool openIndex();
+		void loadParts() const;
+
 	private:
 		uint32_t _cmpVersion; // Valid values: [0001-0005]
 
-		std::vector<part> _parts;
+		mutable std::vector<part> _parts;
 
 		bool _hasRadar;
 		idtl _radar;
+
+		iffIndex _index;
+		uint32_t _versionChunk;
+		mutable std::atomic<bool> _partsLoaded;
+		mutable std::mutex _partsMutex;
 	};
 }
 #endif
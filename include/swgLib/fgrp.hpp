@@ -23,6 +23,8 @@
  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
+#include <swgLib/iffReader.hpp>
+
 #include <istream>
 #include <vector>
 
@@ -70,19 +72,19 @@ namespace ml
 		fgrp();
 		~fgrp();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 		const std::vector<family>& getFamily() const;
 
 	protected:
-		std::size_t readV1(std::istream& file);
-		std::size_t readV2(std::istream& file);
-		std::size_t readV3(std::istream& file);
-		std::size_t readV4(std::istream& file);
-		std::size_t readV5(std::istream& file);
-		std::size_t readV6(std::istream& file);
-		std::size_t readV7(std::istream& file);
-		std::size_t readV8(std::istream& file);
+		std::size_t readV1(iffReader& file);
+		std::size_t readV2(iffReader& file);
+		std::size_t readV3(iffReader& file);
+		std::size_t readV4(iffReader& file);
+		std::size_t readV5(iffReader& file);
+		std::size_t readV6(iffReader& file);
+		std::size_t readV7(iffReader& file);
+		std::size_t readV8(iffReader& file);
 
 	protected:
 		uint32_t _version;
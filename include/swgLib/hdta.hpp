@@ -23,6 +23,8 @@
  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
+#include <swgLib/iffReader.hpp>
+
 #include <istream>
 #include <vector>
 
@@ -45,11 +47,11 @@ namespace ml
 		hdta();
 		~hdta();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
-		static std::size_t read(std::istream& file, point& newPoint);
-		static std::size_t read(std::istream& file, segment& newSegment);
+		static std::size_t read(iffReader& file, point& newPoint);
+		static std::size_t read(iffReader& file, segment& newSegment);
 	protected:
 		std::vector<point>   _points;
 		std::vector<segment> _segments;
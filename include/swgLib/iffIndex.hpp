@@ -0,0 +1,129 @@
+/** -*-c++-*-
+ *  \class  iffIndex
+ *  \file   iffIndex.hpp
+ *  \author Ken Sewell
+
+ swgLib is used for the parsing and exporting SWG models.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of swgLib.
+
+ swgLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ swgLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with swgLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <swgLib/iffReader.hpp>
+
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifndef IFFINDEX_HPP
+#define IFFINDEX_HPP 1
+
+namespace ml
+{
+	/**
+	 * One pass index of every FORM and record in an IFF buffer. Only the
+	 * chunk headers are read; payloads are left for the format classes to
+	 * decode when they are first needed, through reader().
+	 *
+	 * Copies share the underlying buffer, so a format class can keep an
+	 * index (or a sub-index of one of its forms) without copying data.
+	 */
+	class iffIndex
+	{
+	public:
+		struct chunk
+		{
+			uint32_t tag;       // 'FORM' or the record tag
+			uint32_t type;      // FORM type, 0 for records
+			std::size_t offset; // Offset of the chunk header
+			std::size_t size;   // Size field from the chunk header
+			uint32_t parent;    // Enclosing FORM, npos at top level
+			uint32_t next;      // Next sibling, npos if last
+			uint32_t depth;
+
+			bool isForm() const { return (0x464f524d == tag); }
+			// FORM type for forms, tag for records.
+			uint32_t name() const { return (isForm() ? type : tag); }
+			std::size_t totalSize() const { return size + 8; }
+		};
+
+		static const uint32_t npos = 0xffffffff;
+
+	public:
+		iffIndex();
+		~iffIndex();
+
+		// Copy the next chunk of the stream and index it.
+		bool load(std::istream& file);
+
+		// Index memory owned by the caller.
+		bool build(const char* data, const std::size_t& size);
+
+		// Index one chunk of another index, sharing its buffer.
+		bool build(const iffIndex& parent, const uint32_t& chunk);
+
+		void clear();
+
+		// False if a chunk size ran past its parent or the buffer.
+		bool good() const { return _good; }
+		bool empty() const { return _chunks.empty(); }
+		uint32_t size() const { return uint32_t(_chunks.size()); }
+
+		const chunk& at(const uint32_t& index) const { return _chunks.at(index); }
+		const std::vector<chunk>& getChunks() const { return _chunks; }
+
+		const char* data() const { return _data; }
+		std::size_t dataSize() const { return _size; }
+
+		// Children of a FORM (or the top level with npos).
+		uint32_t firstChild(const uint32_t& parent) const;
+		uint32_t nextSibling(const uint32_t& index) const;
+		uint32_t findChild(const uint32_t& parent, const uint32_t& name) const;
+		uint32_t findChild(const uint32_t& parent, const std::string& name) const;
+		uint32_t countChildren(const uint32_t& parent, const uint32_t& name) const;
+
+		// First chunk matching a path of FORM types and record tags such
+		// as "PTAT/*/DATA". "*" matches any one level.
+		uint32_t find(const std::string& path) const;
+
+		// First chunk anywhere with this name.
+		uint32_t findAny(const uint32_t& name) const;
+
+		// Reader over the whole chunk, header included, as the format
+		// classes' read functions expect.
+		iffReader reader(const uint32_t& index) const;
+
+		static uint32_t tagFromStr(const std::string& tag);
+
+	protected:
+		void walk();
+		uint32_t findPath(const uint32_t& parent,
+			const std::vector<uint32_t>& names,
+			const std::size_t& level) const;
+
+	private:
+		std::shared_ptr<std::vector<char>> _buffer;
+		const char* _data;
+		std::size_t _size;
+		std::vector<chunk> _chunks;
+		bool _good;
+	};
+}
+
+#endif
@@ -0,0 +1,155 @@
+/** -*-c++-*-
+ *  \class  iffReader
+ *  \file   iffReader.hpp
+ *  \author Ken Sewell
+
+ swgLib is used for the parsing and exporting SWG models.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of swgLib.
+
+ swgLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ swgLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with swgLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#ifndef IFFREADER_HPP
+#define IFFREADER_HPP 1
+
+namespace ml
+{
+	/**
+	 * Cursor over a contiguous IFF buffer (a TRE record, a mapped file or
+	 * a chunk loaded from a stream). Scalar loads are inlined memcpy's and
+	 * every access is bounds-checked. Reading past the end zero-fills the
+	 * destination and sets a sticky fail flag instead of touching memory
+	 * outside the buffer; the returned sizes match the istream readers in
+	 * ml::base so existing size accounting is unchanged.
+	 */
+	class iffReader
+	{
+	public:
+		iffReader();
+		iffReader(const char* data, const std::size_t& size);
+		iffReader(iffReader&& reader);
+		iffReader& operator=(iffReader&& reader);
+		~iffReader();
+
+		iffReader(const iffReader&) = delete;
+		iffReader& operator=(const iffReader&) = delete;
+
+		// Copy the next IFF chunk (header and payload) of the stream into
+		// an owned buffer and rewind the cursor to its start.
+		bool load(std::istream& file);
+
+		// Read the rest of the stream into an owned buffer.
+		bool loadAll(std::istream& file);
+
+		// Next chunk of the stream, header included, into buffer. The
+		// declared size is not trusted: no more is allocated than the
+		// stream holds. False if the chunk is truncated; buffer is empty
+		// if even the header was missing.
+		static bool readChunk(std::istream& file, std::vector<char>& buffer);
+
+		// Reference external memory. The caller keeps it alive.
+		void assign(const char* data, const std::size_t& size);
+
+		// Reader over the next size bytes, advancing this cursor past them.
+		iffReader chunk(const std::size_t& size);
+
+		const char* data() const { return _data; }
+		const char* current() const { return _data + _position; }
+		std::size_t size() const { return _size; }
+		std::size_t tell() const { return _position; }
+		std::size_t remaining() const { return _size - _position; }
+		bool eof() const { return _position >= _size; }
+		bool fail() const { return _fail; }
+		void clear() { _fail = false; }
+
+		bool seek(const std::size_t& position);
+		std::size_t skip(const std::size_t& bytes);
+
+		std::size_t read(char* buffer, const std::size_t& size)
+		{
+			if (size > remaining())
+			{
+				std::memset(buffer, 0, size);
+				setFail();
+				return size;
+			}
+			std::memcpy(buffer, _data + _position, size);
+			_position += size;
+			return size;
+		}
+
+		// Little-endian load of a scalar.
+		template<typename T>
+		std::size_t read(T& data)
+		{
+			static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+				"iffReader::read requires a scalar type");
+			return read(reinterpret_cast<char*>(&data), sizeof(T));
+		}
+
+		std::size_t readBigEndian(uint32_t& data)
+		{
+			if (sizeof(data) > remaining())
+			{
+				data = 0;
+				setFail();
+				return sizeof(data);
+			}
+			const unsigned char* p =
+				reinterpret_cast<const unsigned char*>(_data + _position);
+			data = (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16)
+				| (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+			_position += sizeof(data);
+			return sizeof(data);
+		}
+
+		// Null terminated string.
+		std::size_t read(std::string& data);
+
+		// Fixed length string field.
+		std::size_t read(std::string& data, const std::size_t& length);
+
+		// Chunk headers. Tags are returned in the same big-endian
+		// uint32_t form as base::readRecordHeader/readFormHeader.
+		bool peekHeader(uint32_t& form, std::size_t& size, uint32_t& type) const;
+		std::size_t readRecordHeader(uint32_t& type, std::size_t& size);
+		std::size_t readFormHeader(uint32_t& form, std::size_t& size, uint32_t& type);
+
+	protected:
+		void setFail()
+		{
+			_fail = true;
+			_position = _size;
+		}
+
+	private:
+		std::vector<char> _buffer;
+		const char* _data;
+		std::size_t _size;
+		std::size_t _position;
+		bool _fail;
+	};
+}
+
+#endif
@@ -0,0 +1,155 @@
+/** -*-c++-*-
+ *  \class  iffWriter
+ *  \file   iffWriter.hpp
+ *  \author Ken Sewell
+
+ swgLib is used for the parsing and exporting SWG models.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of swgLib.
+
+ swgLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ swgLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with swgLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <swgLib/iffIndex.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#ifndef IFFWRITER_HPP
+#define IFFWRITER_HPP 1
+
+class treClass;
+
+namespace ml
+{
+	/**
+	 * Builds an IFF image in memory. FORMs and records are opened as
+	 * nested scopes and their big-endian sizes are patched in when each
+	 * scope is closed, so nothing has to be measured up front:
+	 *
+	 *   writer.beginForm("SKMG");
+	 *   writer.beginForm("0004");
+	 *   writer.beginRecord("INFO");
+	 *   writer.write(numBones);
+	 *   writer.endRecord();
+	 *   ...
+	 *   writer.endForm();
+	 *   writer.endForm();
+	 *
+	 * Headers and scalars go to an owned, growable buffer. append() only
+	 * references the caller's bytes (a TRE record, an iffIndex chunk) and
+	 * they are copied once, when the image is written out: to the stream,
+	 * the vector of copyTo(), or the new record's buffer for addTo(). The
+	 * caller keeps them alive until then.
+	 *
+	 * Misuse (closing the wrong kind of scope, a FORM inside a record, a
+	 * chunk over 4GB) sets a sticky fail flag and the output calls refuse
+	 * to write.
+	 */
+	class iffWriter
+	{
+	public:
+		iffWriter();
+		explicit iffWriter(const std::size_t& reserve);
+		~iffWriter();
+
+		void clear();
+
+		bool beginForm(const std::string& type);
+		bool beginForm(const uint32_t& type);
+		bool endForm();
+
+		bool beginRecord(const std::string& type);
+		bool beginRecord(const uint32_t& type);
+		bool endRecord();
+
+		// Whole record from a payload already in memory (not copied).
+		bool record(const std::string& type,
+			const char* data,
+			const std::size_t& size);
+
+		// Copy of the bytes.
+		std::size_t write(const char* data, const std::size_t& size);
+
+		// Little-endian store of a scalar, as base::write. Limited to
+		// scalars so write(std::ostream&) still takes derived streams.
+		template<typename T>
+		typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value,
+			std::size_t>::type write(const T& data)
+		{
+			return write(reinterpret_cast<const char*>(&data), sizeof(T));
+		}
+
+		std::size_t writeBigEndian(const uint32_t& data);
+
+		// Null terminated string, as base::write.
+		std::size_t write(const std::string& data);
+
+		// Reference to bytes owned by the caller (not copied).
+		std::size_t append(const char* data, const std::size_t& size);
+
+		// An existing chunk, header included, unchanged (not copied).
+		std::size_t append(const iffIndex& index, const uint32_t& chunk);
+
+		bool fail() const { return _fail; }
+		// Number of FORMs and records still open.
+		std::size_t depth() const { return _scopes.size(); }
+		// Bytes written so far, appended payloads included.
+		std::size_t size() const { return _size; }
+
+		// Finished image. False if a scope is still open or on failure.
+		bool write(std::ostream& file) const;
+		bool copyTo(std::vector<char>& data) const;
+		bool addTo(treClass& tre,
+			const std::string& name,
+			const uint32_t& format) const;
+
+	protected:
+		struct segment
+		{
+			const char* external; // nullptr for bytes in _buffer
+			std::size_t offset;   // Offset in _buffer for owned bytes
+			std::size_t size;
+		};
+
+		struct scope
+		{
+			std::size_t header; // Offset of the size field in _buffer
+			std::size_t start;  // Image offset just after the size field
+			bool isForm;
+		};
+
+		bool beginChunk(const uint32_t& tag, const uint32_t& type, const bool& isForm);
+		bool endChunk(const bool& isForm);
+		bool finished() const;
+		// Copy of the finished image, out holds size() bytes.
+		void gather(char* out) const;
+		void setFail() { _fail = true; }
+
+	private:
+		std::vector<char> _buffer;
+		std::vector<segment> _segments;
+		std::vector<scope> _scopes;
+		std::size_t _size;
+		bool _fail;
+	};
+}
+
+#endif
@@ -0,0 +1,97 @@
+/** -*-c++-*-
+ *  \class  logger
+ *  \file   logger.hpp
+ *  \author Ken Sewell
+
+ swgLib is used for the parsing and exporting SWG models.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of swgLib.
+
+ swgLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ swgLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with swgLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <atomic>
+#include <functional>
+#include <ostream>
+#include <string>
+
+#ifndef LOGGER_HPP
+#define LOGGER_HPP 1
+
+namespace ml
+{
+	/**
+	 * Diagnostic output of the parsers. Nothing is formatted unless the
+	 * level is enabled, and the default level is LOG_NONE, so library use
+	 * is silent. Tools that want the parsers' dumps call
+	 * logger::setLevel(logger::LOG_DEBUG).
+	 *
+	 * Each thread writes through its own stream, which keeps format state
+	 * (std::hex, width, ...) between statements like std::cout did. Text
+	 * reaches the sink a line at a time; the default sink is std::cout.
+	 * Set the level and sink before parsing starts.
+	 */
+	class logger
+	{
+	public:
+		enum level
+		{
+			LOG_NONE = 0,
+			LOG_ERROR,
+			LOG_WARNING,
+			LOG_INFO,
+			LOG_DEBUG,
+		};
+
+		typedef std::function<void(level, const std::string&)> sink;
+
+	public:
+		static void setLevel(const level& maxLevel);
+		static level getLevel();
+
+		static bool enabled(const level& messageLevel)
+		{
+			return (int(messageLevel) <= _level.load(std::memory_order_relaxed));
+		}
+
+		// An empty sink restores the default of std::cout.
+		static void setSink(const sink& output);
+
+		// This thread's stream, tagged with messageLevel.
+		static std::ostream& stream(const level& messageLevel);
+
+		// Hand a pending partial line to the sink.
+		static void flush();
+
+		// Lets SWG_LOG discard the stream expression.
+		struct voidify
+		{
+			void operator&(std::ostream&) {}
+		};
+
+	private:
+		static std::atomic<int> _level;
+	};
+}
+
+// Stream for one log statement. The operands of << are only evaluated
+// when the level is enabled:
+//   SWG_LOG(LOG_INFO) << "Found FORM: " << size << "\n";
+#define SWG_LOG(messageLevel) \
+	!ml::logger::enabled(ml::logger::messageLevel) ? (void)0 \
+	: ml::logger::voidify() & ml::logger::stream(ml::logger::messageLevel)
+
+#endif
@@ -23,6 +23,8 @@
  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
+#include <swgLib/iffReader.hpp>
+
 #include <istream>
 #include <vector>
 
@@ -38,7 +40,7 @@ namespace ml
 		mfrc();
 		~mfrc();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 		void setSeed(const uint32_t& seed);
 		const uint32_t& getSeed() const;
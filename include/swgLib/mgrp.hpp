@@ -47,7 +47,7 @@ namespace ml
 		mgrp();
 		~mgrp();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 		const std::vector<family>& getFamily() const;
 
@@ -92,10 +92,13 @@ namespace ml
 
 		// Read record containing Hardpoint records
 		unsigned int readHPTS(std::istream& file);
+		unsigned int readHPTS(iffReader& file);
 		unsigned int readFLOR(std::istream& file);
 		// Read one hardpoint record
 		unsigned int readHPNT(std::istream& file);
+		unsigned int readHPNT(iffReader& file);
 		unsigned int readDYN(std::istream& file);
+		unsigned int readDYN(iffReader& file);
 
 	private:
 	};
@@ -23,10 +23,13 @@
  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 #include <swgLib/appr.hpp>
+#include <swgLib/iffIndex.hpp>
 #include <swgLib/tgen.hpp>
 #include <swgLib/wsMap.hpp>
 
+#include <atomic>
 #include <istream>
+#include <mutex>
 #include <string>
 
 #ifndef PTAT_HPP
@@ -41,9 +44,34 @@ namespace ml
 		ptat();
 		~ptat();
 
+		// Copies take the decoded generator and maps under the source's
+		// locks.
+		ptat(const ptat& other);
+		ptat& operator=(const ptat& other);
+
 		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
+
+		// Index the terrain and decode only its DATA record. The terrain
+		// generator and water/slope maps are decoded on first access,
+		// under a lock, so the getters may be called from several threads.
+		bool open(std::istream& file);
+		bool open(const char* data, const std::size_t& size);
+
+		uint32_t getVersion() const;
+		const std::string& getName() const;
+		const float& getMapWidth() const;
+		const float& getChunkWidth() const;
+		const int32_t& getTilesPerChunk() const;
+
+		const tgen& getTerrainGenerator() const;
+		const wsMap& getWaterSlopeMap() const;
 
 	protected:
+		std::size_t readDATA(iffReader& file);
+		bool openIndex();
+
+
 		uint32_t _ptatVersion;
 
 		std::string _name;
@@ -82,9 +110,16 @@ namespace ml
 
 		bool _legacyMap;
 
-		tgen _tgen;
+		mutable tgen _tgen;
+
+		mutable wsMap _wsMap;
 
-		wsMap _wsMap;
+		iffIndex _index;
+		uint32_t _versionChunk;
+		mutable std::atomic<bool> _tgenLoaded;
+		mutable std::atomic<bool> _wsMapLoaded;
+		mutable std::mutex _tgenMutex;
+		mutable std::mutex _wsMapMutex;
 
 #if 0
 		std::size_t readTGEN(std::istream& file);
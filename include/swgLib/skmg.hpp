@@ -23,6 +23,7 @@
  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 #include <swgLib/model.hpp>
+#include <swgLib/iffIndex.hpp>
 
 #include <fstream>
 #include <string>
@@ -88,6 +89,15 @@ namespace ml
       return isOfType( file, "SKMG" );
     }
     unsigned int readSKMG( std::istream &file );
+    unsigned int readSKMG( iffReader &file );
+
+    // Index the mesh and decode only the INFO, SKTM and XFNM records
+    // (counts, skeleton and bone names). loadGeometry() decodes the rest
+    // from the indexed buffer when it is needed.
+    bool open( std::istream &file );
+    bool open( const char *data, const std::size_t &size );
+    bool loadGeometry();
+
     void print() const;
 
     const std::string &getShader() const
@@ -110,6 +120,21 @@ namespace ml
       return numBones;
     }
 
+    const std::vector<std::string> &getBoneNames() const
+    {
+      return boneNames;
+    }
+
+    uint32_t getNumPoints() const
+    {
+      return numPoints;
+    }
+
+    uint32_t getNumNormals() const
+    {
+      return numNorm;
+    }
+
     uint32_t getNumPsdt() const
     {
       return uint32_t(psdtList.size());
@@ -129,40 +154,44 @@ namespace ml
     const std::vector<float> &getNZVector() const { return nz; }
 
   protected:
-    unsigned int readINFO( std::istream &file );
-
-    unsigned int readSKTM( std::istream &file );
-    unsigned int readXFNM( std::istream &file );
-    unsigned int readPOSN( std::istream &file );
-    unsigned int readTWHD( std::istream &file );
-    unsigned int readTWDT( std::istream &file );
-    unsigned int readNORM( std::istream &file );
-    unsigned int readDOT3( std::istream &file );
-    unsigned int readPSDT( std::istream &file, psdt &newPsdt );
-    unsigned int readNAME( std::istream &file, psdt &newPsdt );
-    unsigned int readBLTS( std::istream &file );
-    unsigned int readBLT( std::istream &file, blt &newBlt );
-    unsigned int readBLTPOSN( std::istream &file, unsigned int num );
-    unsigned int readBLTNORM( std::istream &file, unsigned int num );
-    unsigned int readBLTHPTS( std::istream &file );
-    unsigned int readOZN( std::istream &file );
-    unsigned int readFOZC( std::istream &file );
-    unsigned int readOZC( std::istream &file );
-    unsigned int readZTO( std::istream &file );
-    unsigned int readTRTS( std::istream &file );
-    unsigned int readBLTINFO( std::istream &file, blt &newBlt );
-    unsigned int readDOT3Index( std::istream &file, psdt &newPsdt );
-
-    unsigned int readPIDX( std::istream &file, psdt &newPsdt );
-    unsigned int readNIDX( std::istream &file, psdt &newPsdt );
-    unsigned int readVDCL( std::istream &file, psdt &newPsdt );
-    unsigned int readTXCI( std::istream &file, psdt &newPsdt );
-    unsigned int readTCSF( std::istream &file, psdt &newPsdt );
-    unsigned int readTCSD( std::istream &file, psdt &newPsdt );
-    unsigned int readPRIM( std::istream &file, psdt &newPsdt );
-    unsigned int readPRIMINFO( std::istream &file, psdt &newPsdt );
-    unsigned int readITL( std::istream &file, psdt &newPsdt );
-    unsigned int readOITL( std::istream &file, psdt &newPsdt );
+    bool openIndex();
+
+    unsigned int readINFO( iffReader &file );
+    // Next child of the version form, dispatched on its tag.
+    unsigned int readSKMGChild( iffReader &file );
+
+    unsigned int readSKTM( iffReader &file );
+    unsigned int readXFNM( iffReader &file );
+    unsigned int readPOSN( iffReader &file );
+    unsigned int readTWHD( iffReader &file );
+    unsigned int readTWDT( iffReader &file );
+    unsigned int readNORM( iffReader &file );
+    unsigned int readDOT3( iffReader &file );
+    unsigned int readPSDT( iffReader &file, psdt &newPsdt );
+    unsigned int readNAME( iffReader &file, psdt &newPsdt );
+    unsigned int readBLTS( iffReader &file );
+    unsigned int readBLT( iffReader &file, blt &newBlt );
+    unsigned int readBLTPOSN( iffReader &file, unsigned int num );
+    unsigned int readBLTNORM( iffReader &file, unsigned int num );
+    unsigned int readBLTHPTS( iffReader &file );
+    unsigned int readOZN( iffReader &file );
+    unsigned int readFOZC( iffReader &file );
+    unsigned int readOZC( iffReader &file );
+    unsigned int readZTO( iffReader &file );
+    unsigned int readTRTS( iffReader &file );
+    unsigned int readBLTINFO( iffReader &file, blt &newBlt );
+    unsigned int readDOT3Index( iffReader &file, psdt &newPsdt );
+
+    unsigned int readPIDX( iffReader &file, psdt &newPsdt );
+    unsigned int readNIDX( iffReader &file, psdt &newPsdt );
+    unsigned int readVDCL( iffReader &file, psdt &newPsdt );
+    unsigned int readTXCI( iffReader &file, psdt &newPsdt );
+    unsigned int readTCSF( iffReader &file, psdt &newPsdt );
+    unsigned int readTCSD( iffReader &file, psdt &newPsdt );
+    unsigned int readPRIM( iffReader &file, psdt &newPsdt );
+    unsigned int readPRIMINFO( iffReader &file, psdt &newPsdt );
+    unsigned int readITL( iffReader &file, psdt &newPsdt );
+    unsigned int readOITL( iffReader &file, psdt &newPsdt );
 
   private:
     std::vector<std::string> skeletonFilenameList;
@@ -194,6 +223,8 @@ namespace ml
     std::vector<blt> bltList;
     std::vector<psdt> psdtList;
 
+    iffIndex index;
+
   };
 }
 #endif
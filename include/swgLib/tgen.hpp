@@ -23,7 +23,9 @@
  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
+#include <atomic>
 #include <istream>
+#include <mutex>
 #include <vector>
 
 #include <swgLib/sgrp.hpp>
@@ -33,6 +35,7 @@
 #include <swgLib/mgrp.hpp>
 
 #include <swgLib/tgenLayer.hpp>
+#include <swgLib/iffIndex.hpp>
 
 #ifndef TGEN_HPP
 #define TGEN_HPP 1
@@ -45,19 +48,56 @@ namespace ml
 		tgen();
 		~tgen();
 
-		std::size_t read(std::istream& file);
+		// Copies take the decoded groups under the source's lock.
+		tgen(const tgen& other);
+		tgen& operator=(const tgen& other);
+
+		std::size_t read(iffReader& file);
+
+		// Index a TGEN form of a parent index. Groups and layers are
+		// decoded on first access, under a lock, so the getters may be
+		// called from several threads.
+		bool open(const iffIndex& index, const uint32_t& chunk);
+
+		// Drop everything read or indexed.
+		void clear();
+
+		const sgrp& getShaderGroup() const;
+		const fgrp& getFloraGroup() const;
+		const rgrp& getRadialGroup() const;
+		const egrp& getEnvironmentGroup() const;
+		const mgrp& getFractalGroup() const;
+		const std::vector<tgenLayer>& getLayers() const;
 
 	protected:
+		enum {
+			LOADED_SHADER_GROUP = 0x01,
+			LOADED_FLORA_GROUP = 0x02,
+			LOADED_RADIAL_GROUP = 0x04,
+			LOADED_ENVIRONMENT_GROUP = 0x08,
+			LOADED_FRACTAL_GROUP = 0x10,
+			LOADED_LAYERS = 0x20,
+			LOADED_ALL = 0x3f
+		};
+
+		template<typename T>
+		void loadGroup(const uint32_t& flag, const char* type, T& group) const;
+
 		uint32_t _tgenVersion;
 
-		sgrp _shaderGroup;
-		fgrp _floraGroup;
-		rgrp _radialGroup;
-		egrp _environmentGroup;
-		mgrp _fractalGroup;
+		mutable sgrp _shaderGroup;
+		mutable fgrp _floraGroup;
+		mutable rgrp _radialGroup;
+		mutable egrp _environmentGroup;
+		mutable mgrp _fractalGroup;
 		//bgrp _bitmapGroup;
 
-		std::vector<tgenLayer> _layers;
+		mutable std::vector<tgenLayer> _layers;
+
+		iffIndex _index;
+		uint32_t _versionChunk;
+		mutable std::atomic<uint32_t> _loaded;
+		mutable std::mutex _loadMutex;
 	private:
 	};
 }
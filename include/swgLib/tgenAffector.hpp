@@ -48,10 +48,10 @@ namespace ml
 			float x, y, height;
 		};
 	public:
-		static bool peekAffector(std::istream& file);
-		virtual std::size_t read(std::istream& file);
+		static bool peekAffector(iffReader& file);
+		virtual std::size_t read(iffReader& file);
 
-		static std::size_t read(std::istream& file, tgenAffectorPtr& affectorPtr);
+		static std::size_t read(iffReader& file, tgenAffectorPtr& affectorPtr);
 
 	};
 
@@ -61,7 +61,7 @@ namespace ml
 		affectorEnvironment();
 		~affectorEnvironment();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
 		int32_t _familyId;
@@ -76,7 +76,7 @@ namespace ml
 		affectorHeightTerrace();
 		~affectorHeightTerrace();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
 		float _fraction;
@@ -91,7 +91,7 @@ namespace ml
 		affectorHeightConstant();
 		~affectorHeightConstant();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
 		int32_t _operation;
@@ -105,13 +105,13 @@ namespace ml
 		affectorHeightFractal();
 		~affectorHeightFractal();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
-		std::size_t readV0(std::istream& file);
-		std::size_t readV1(std::istream& file);
-		std::size_t readV2(std::istream& file);
-		std::size_t readV3(std::istream& file);
+		std::size_t readV0(iffReader& file);
+		std::size_t readV1(iffReader& file);
+		std::size_t readV2(iffReader& file);
+		std::size_t readV3(iffReader& file);
 	protected:
 		int32_t _familyId;
 		int32_t _operation;
@@ -127,7 +127,7 @@ namespace ml
 		affectorColorConstant();
 		~affectorColorConstant();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
 		int32_t _operation;
@@ -143,7 +143,7 @@ namespace ml
 		affectorColorRampHeight();
 		~affectorColorRampHeight();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
 		int32_t     _operation;
@@ -159,7 +159,7 @@ namespace ml
 		affectorColorFractal();
 		~affectorColorFractal();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
 		mfrc _multifractal;
@@ -175,7 +175,7 @@ namespace ml
 		affectorShaderConstant();
 		~affectorShaderConstant();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
 		int32_t _familyId;
@@ -190,7 +190,7 @@ namespace ml
 		affectorShaderReplace();
 		~affectorShaderReplace();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
 		int32_t _sourceFamilyId;
@@ -206,7 +206,7 @@ namespace ml
 		affectorFloraSCC();
 		~affectorFloraSCC();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
 		int32_t _familyId;
@@ -223,7 +223,7 @@ namespace ml
 		affectorFloraSNCC();
 		~affectorFloraSNCC();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
 		int32_t _familyId;
@@ -240,7 +240,7 @@ namespace ml
 		affectorFDNC();
 		~affectorFDNC();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
 		int32_t _familyId;
@@ -257,7 +257,7 @@ namespace ml
 		affectorFDFC();
 		~affectorFDFC();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
 		int32_t _familyId;
@@ -274,15 +274,15 @@ namespace ml
 		affectorRibbon();
 		~affectorRibbon();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
-		std::size_t readV0(std::istream& file);
-		std::size_t readV1(std::istream& file);
-		std::size_t readV2(std::istream& file);
-		std::size_t readV3(std::istream& file);
-		std::size_t readV4(std::istream& file);
-		std::size_t readV5(std::istream& file);
+		std::size_t readV0(iffReader& file);
+		std::size_t readV1(iffReader& file);
+		std::size_t readV2(iffReader& file);
+		std::size_t readV3(iffReader& file);
+		std::size_t readV4(iffReader& file);
+		std::size_t readV5(iffReader& file);
 
 	protected:
 		hdta _heightData;
@@ -304,7 +304,7 @@ namespace ml
 		affectorExclude();
 		~affectorExclude();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
 	};
@@ -316,7 +316,7 @@ namespace ml
 		affectorPassable();
 		~affectorPassable();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
 		bool _passable;
@@ -330,16 +330,16 @@ namespace ml
 		affectorRoad();
 		~affectorRoad();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
-		std::size_t readV0(std::istream& file);
-		std::size_t readV1(std::istream& file);
-		std::size_t readV2(std::istream& file);
-		std::size_t readV3(std::istream& file);
-		std::size_t readV4(std::istream& file);
-		std::size_t readV5(std::istream& file);
-		std::size_t readV6(std::istream& file);
+		std::size_t readV0(iffReader& file);
+		std::size_t readV1(iffReader& file);
+		std::size_t readV2(iffReader& file);
+		std::size_t readV3(iffReader& file);
+		std::size_t readV4(iffReader& file);
+		std::size_t readV5(iffReader& file);
+		std::size_t readV6(iffReader& file);
 
 	protected:
 		std::vector<point2D> _points;
@@ -362,16 +362,16 @@ namespace ml
 		affectorRiver();
 		~affectorRiver();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
-		std::size_t readV0(std::istream& file);
-		std::size_t readV1(std::istream& file);
-		std::size_t readV2(std::istream& file);
-		std::size_t readV3(std::istream& file);
-		std::size_t readV4(std::istream& file);
-		std::size_t readV5(std::istream& file);
-		std::size_t readV6(std::istream& file);
+		std::size_t readV0(iffReader& file);
+		std::size_t readV1(iffReader& file);
+		std::size_t readV2(iffReader& file);
+		std::size_t readV3(iffReader& file);
+		std::size_t readV4(iffReader& file);
+		std::size_t readV5(iffReader& file);
+		std::size_t readV6(iffReader& file);
 
 	protected:
 		hdta _heightData;
@@ -23,6 +23,8 @@
  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
+#include <swgLib/iffReader.hpp>
+
 #include <istream>
 #include <vector>
 
@@ -36,7 +38,7 @@ namespace ml
 		tgenBaseLayer();
 		virtual ~tgenBaseLayer();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 		const std::string& getTag() const;
 		bool isActive() const;
@@ -42,10 +42,10 @@ namespace ml
 		tgenBoundary();
 		virtual ~tgenBoundary();
 
-		static bool peekBoundary(std::istream& file);
-		virtual std::size_t read(std::istream& file);
+		static bool peekBoundary(iffReader& file);
+		virtual std::size_t read(iffReader& file);
 
-		static std::size_t read(std::istream& file, tgenBoundaryPtr& boundaryPtr);
+		static std::size_t read(iffReader& file, tgenBoundaryPtr& boundaryPtr);
 
 	protected:
 		int32_t _featherFunction;
@@ -57,7 +57,7 @@ namespace ml
 		boundaryCircle();
 		~boundaryCircle();
 
-		std::size_t read(std::istream& file) override;
+		std::size_t read(iffReader& file) override;
 
 		const float& getCenterNorth() const;
 		const float& getCenterEast() const;
@@ -77,7 +77,7 @@ namespace ml
 		boundaryRectangle();
 		~boundaryRectangle();
 
-		std::size_t read(std::istream& file) override;
+		std::size_t read(iffReader& file) override;
 
 		const float& getWest() const;
 		const float& getSouth() const;
@@ -113,7 +113,7 @@ namespace ml
 		boundaryPolygon();
 		~boundaryPolygon();
 
-		std::size_t read(std::istream& file) override;
+		std::size_t read(iffReader& file) override;
 
 		bool hasLocalWaterTable() const;
 		const float& getLocalWaterTableHeight() const;
@@ -141,7 +141,7 @@ namespace ml
 		boundaryPolyline();
 		~boundaryPolyline();
 
-		std::size_t read(std::istream& file) override;
+		std::size_t read(iffReader& file) override;
 
 		const float& getWidth() const;
 		const std::vector<std::pair<float, float>>& getPoints() const;
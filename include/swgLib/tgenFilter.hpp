@@ -42,10 +42,10 @@ namespace ml
 		tgenFilter();
 		~tgenFilter();
 
-		static bool peekFilter(std::istream& file);
-		virtual std::size_t read(std::istream& file);
+		static bool peekFilter(iffReader& file);
+		virtual std::size_t read(iffReader& file);
 
-		static std::size_t read(std::istream& file, tgenFilterPtr& filterPtr);
+		static std::size_t read(iffReader& file, tgenFilterPtr& filterPtr);
 
 	protected:
 		int32_t _featherFunction;
@@ -57,7 +57,7 @@ namespace ml
 		filterHeight();
 		~filterHeight();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
 		float _low;
@@ -70,14 +70,14 @@ namespace ml
 		filterFractal();
 		~filterFractal();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 	protected:
-		std::size_t readV0(std::istream& file);
-		std::size_t readV1(std::istream& file);
-		std::size_t readV2(std::istream& file);
-		std::size_t readV3(std::istream& file);
-		std::size_t readV4(std::istream& file);
-		std::size_t readV5(std::istream& file);
+		std::size_t readV0(iffReader& file);
+		std::size_t readV1(iffReader& file);
+		std::size_t readV2(iffReader& file);
+		std::size_t readV3(iffReader& file);
+		std::size_t readV4(iffReader& file);
+		std::size_t readV5(iffReader& file);
 
 	protected:
 		mfrc _multifractal;
@@ -93,7 +93,7 @@ namespace ml
 		filterSlope();
 		~filterSlope();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
 		float _minAngle;
@@ -106,7 +106,7 @@ namespace ml
 		filterDirection();
 		~filterDirection();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
 		float _minAngle;
@@ -119,7 +119,7 @@ namespace ml
 		filterShader();
 		~filterShader();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 
 	protected:
 		int32_t _familyId;
@@ -41,8 +41,8 @@ namespace ml
 		tgenLayer();
 		~tgenLayer();
 
-		std::size_t read(std::istream& file);
-		std::size_t readACTN(std::istream& file);
+		std::size_t read(iffReader& file);
+		std::size_t readACTN(iffReader& file);
 
 		uint32_t getNumBoundaries() const;
 		const std::vector<tgenBoundary>& getBoundaries() const;
@@ -57,15 +57,15 @@ namespace ml
 		const std::vector<tgenLayer>& getSublayers() const;
 
 	protected:
-		std::size_t readV0(std::istream& file);
-		std::size_t readV1(std::istream& file);
-		std::size_t readV2(std::istream& file);
-		std::size_t readV3(std::istream& file);
-		std::size_t readV4(std::istream& file);
-
-		std::size_t readACTNv0(std::istream& file);
-		std::size_t readACTNv1(std::istream& file);
-		std::size_t readACTNv2(std::istream& file);
+		std::size_t readV0(iffReader& file);
+		std::size_t readV1(iffReader& file);
+		std::size_t readV2(iffReader& file);
+		std::size_t readV3(iffReader& file);
+		std::size_t readV4(iffReader& file);
+
+		std::size_t readACTNv0(iffReader& file);
+		std::size_t readACTNv1(iffReader& file);
+		std::size_t readACTNv2(iffReader& file);
 
 	protected:
 		bool _invertBoundaries;
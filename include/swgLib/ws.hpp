@@ -45,7 +45,7 @@ namespace ml
 			node();
 			~node();
 
-			std::size_t read(std::istream& file);
+			std::size_t read(iffReader& file);
 			//std::size_t write(std::ofstream& file) const;
 			void print(std::ostream& os) const;
 
@@ -98,6 +98,7 @@ namespace ml
 		~ws();
 
 		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
 		//std::size_t create(std::ofstream& outfile);
 		//std::size_t readMetaFile(std::istream& infile);
 
@@ -111,8 +112,10 @@ namespace ml
 
 		const std::string& getName(const uint32_t& i) const;
 	protected:
-		std::size_t readNODS(std::istream& file);
-		std::size_t readOTNL(std::istream& file);
+		std::size_t readNODS(iffReader& file);
+		std::size_t readOTNL(iffReader& file);
+		// Resolve object names and dump the nodes once both lists are read.
+		void linkNodes();
 
 #if 0
 		std::size_t writeNODS(std::ofstream& outfile);
@@ -23,6 +23,8 @@
  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
+#include <swgLib/iffReader.hpp>
+
 #include <istream>
 #include <vector>
 
@@ -37,7 +39,14 @@ namespace ml
 		wsMap();
 		~wsMap();
 
-		std::size_t read(std::istream& file);
+		std::size_t read(iffReader& file);
+
+		const float& getMapWidth() const;
+		const float& getChunkWidth() const;
+		const int32_t& getWidth() const;
+		const int32_t& getHeight() const;
+		const std::vector<uint8_t>& getWaterMap() const;
+		const std::vector<uint8_t>& getSlopeMap() const;
 
 	protected:
 		uint32_t _version;
@@ -23,16 +23,31 @@
  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <functional>
 #include <sstream>
 #include <string>
 #include <list>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 #include <treLib/treClass.hpp>
+#include <treLib/treRecordCache.hpp>
 
 #ifndef TREARCHIVE_HPP
 #define TREARCHIVE_HPP 1
 
+/**
+   Ordered set of .tre files that behaves like one archive.  Lookups and
+   reads (fileExists, getFileStream, getFileView, ...) may be called from
+   several threads at once.  Changing the set of files (addFile,
+   removeFile, setMapped) must not overlap with any other call.
+*/
 class treArchive
 {
 public:
@@ -57,12 +72,253 @@ public:
 
 	void getArchiveContents( const std::string &substr, std::vector<std::string>& content ) const;
 
+	/**
+	   Directory queries over the effective view, answered from a sorted
+	   name index that is built on first use.  Results are appended to
+	   content in sorted order.
+	*/
+	/// Every name starting with prefix, e.g. "appearance/mesh/".
+	void listPrefix(const std::string& prefix,
+		std::vector<std::string>& content) const;
+
+	/**
+	   Every name matching pattern.  '?' matches one character and '*'
+	   any run of characters, neither crosses a '/'.  "**" matches
+	   across directories.
+	*/
+	void listGlob(const std::string& pattern,
+		std::vector<std::string>& content) const;
+
+	/**
+	   Files directly inside directory ("" is the root) and, if subdirs
+	   is not null, the names of its immediate subdirectories.
+	*/
+	void listDirectory(const std::string& directory,
+		std::vector<std::string>& files,
+		std::vector<std::string>* subdirs = nullptr) const;
+
+	static bool globMatch(const char* pattern, const char* name);
+
 	bool fileExists(const std::string& filename) const;
 
-	std::stringstream* getFileStream(const std::string& filename);
+	std::stringstream* getFileStream(const std::string& filename) const;
+
+	/// Read and uncompress a record into a caller owned data block.
+	bool getFileData(const std::string& filename,
+		treDataBlock& dataBlock) const;
+
+	/**
+	   Shared, read-only uncompressed record.  Served from the record
+	   cache when it is enabled; null if the file does not exist.
+	*/
+	std::shared_ptr<const treDataBlock>
+		getFileBlock(const std::string& filename) const;
+
+	/**
+	   Stream that inflates the record incrementally instead of
+	   holding all of it in memory.  Caller deletes; NULL if not found.
+	*/
+	treRecordStream* openFileStream(const std::string& filename) const;
+
+	/**
+	   Called by readFiles() once per requested name.  block is null if
+	   the name was not found or could not be read.
+	*/
+	typedef std::function<void(const std::string& filename,
+		const std::shared_ptr<const treDataBlock>& block)> readCallback;
+
+	/**
+	   Read many files at once.  Names are grouped by archive, sorted by
+	   offset, and records close together on disk are fetched with one
+	   read, or one at a time if that read fails.  callback is invoked
+	   as each record is uncompressed; with numThreads other than 1
+	   (0 = one per core) it is called from worker threads and must be
+	   thread-safe.
+	*/
+	void readFiles(const std::vector<std::string>& filenames,
+		const readCallback& callback,
+		const unsigned int& numThreads = 1) const;
+
+	/**
+	   Hint that a file will be read soon.  A background thread reads
+	   and uncompresses it into the record cache, so a later read does
+	   not wait on I/O or inflate.  A read of a record the thread is
+	   working on waits for it instead of doing it twice.  Without the
+	   cache only the stored data is read, to warm the OS file cache.
+	   Unknown names are ignored, hints past maxPrefetchQueue dropped.
+	*/
+	void prefetch(const std::string& filename) const;
+	void prefetch(const std::vector<std::string>& filenames) const;
+
+	/// Drop pending hints and wait for the one in progress.
+	void cancelPrefetch() const;
+
+	/// Number of hints the background thread has completed.
+	uint64_t getPrefetched() const { return prefetched; }
+
+	/**
+	   Usage statistics, off by default.  While enabled lookups and
+	   misses are counted here, and each archive counts the lookups it
+	   answered plus its treClass::readStats.
+	*/
+	void setCollectStats(const bool& s);
+	bool getCollectStats() const { return collectStats.load(std::memory_order_relaxed); }
+	uint64_t getLookups() const { return statLookups; }
+	uint64_t getLookupMisses() const { return statMisses; }
+	void resetStats();
+
+	/// Totals followed by one line per archive, newest first.
+	void printStats(std::ostream& os) const;
+
+	/**
+	   Access trace.  Every record read through this archive (including
+	   ones served from the cache) is written to os as one line,
+	   "<microseconds>\t<archive>\t<record name>\t<size>".  The stream
+	   must outlive the trace, pass null to stop tracing.
+	*/
+	void setTrace(std::ostream* os);
+
+	/// MD5 handling for record reads, see treClass::md5Modes.
+	void setMD5Mode(const treClass::md5Modes& m);
+	treClass::md5Modes getMD5Mode() const { return md5Mode; }
+
+	/**
+	   Check the stored MD5 of every record in every file, threads
+	   workers per file (0 = one per core).  Each mismatch is written to
+	   os as "<tre file>: <record name>".  Returns number of mismatches.
+	*/
+	uint32_t scrub(std::ostream& os, const unsigned int& threads = 0) const;
+
+	/// Byte budget for cached uncompressed records, 0 (default) disables.
+	void setCacheSize(const uint64_t& bytes) { cache.setMaxSize(bytes); }
+	const treRecordCache& getCache() const { return cache; }
+
+	/**
+	   Load archives added from now on through index sidecars, see
+	   treClass::setIndexSidecar().  An empty directory keeps sidecars
+	   beside the archives.
+	*/
+	void setIndexSidecar(const bool& s, const std::string& directory = "")
+	{
+		indexSidecar = s;
+		indexDirectory = directory;
+	}
+	bool getIndexSidecar() const { return indexSidecar; }
+
+	/**
+	   Memory map archives for their lifetime instead of reopening them.
+	   False if an archive already loaded could not be mapped; it is
+	   still read with positional reads.
+	*/
+	bool setMapped(const bool m);
+	bool isMapped() const { return mapped; }
+
+	/**
+	   Zero-copy view of an uncompressed (format 0) record.  Only
+	   available in mapped mode; the view is valid until the owning
+	   archive is removed.
+	*/
+	bool getFileView(const std::string& filename, treRecordView& view) const;
+
+	/// Records in every file, shadowed and zero sized ones included.
+	uint32_t getNumRecords() const;
+	/// Zero sized records in every file.
+	uint32_t getNumEmptyRecords() const;
+
+	/**
+	   Write the effective contents of the archive (shadowed records
+	   dropped) to new .tre files, grouped by directory.  Stored data is
+	   copied without recompressing.  With maxSize 0 everything goes to
+	   treName, otherwise a new file (treName with _00, _01, ... before
+	   the extension) is started when the next record would exceed
+	   maxSize bytes of data.  Written file names are added to outputFiles.
+	   Fails without writing over an input archive.  Zero sized records
+	   never match a lookup and are not copied, see getNumEmptyRecords().
+	*/
+	bool repack(const std::string& treName,
+		std::vector<std::string>& outputFiles,
+		const uint64_t& maxSize = 0,
+		const bool& deduplicate = false) const;
 
 protected:
+	/// Location of the record that currently wins for a name.
+	class indexEntry
+	{
+	public:
+		treClass* tre;
+		uint32_t index;
+	};
+
+	/// Find the effective record for an already slash-corrected name.
+	bool findFile(const std::string& filename,
+		treClass*& tre,
+		uint32_t& index) const;
+
+	/// findFile() for a record that is about to be read; counts and traces.
+	bool findRecord(const std::string& filename,
+		treClass*& tre,
+		uint32_t& index) const;
+
+	std::shared_ptr<const treDataBlock>
+		getRecordBlock(const treClass* tre, const uint32_t& index) const;
+
+	void queuePrefetch(const std::string& filename) const;
+	void prefetchWorker() const;
+	void waitForPrefetch(const treClass* tre, const uint32_t& index) const;
+
+	/// Most hints waiting for the prefetch thread.
+	static const size_t maxPrefetchQueue = 4096;
+
+	/// Records closer than this are read together by readFiles().
+	static const uint32_t maxReadGap = 64 * 1024;
+	/// Largest single coalesced read made by readFiles().
+	static const uint32_t maxReadSize = 8 * 1024 * 1024;
+
+	void addToIndex(treClass* tre);
+	void rebuildIndex();
+
+	/// fileIndex keys in sorted order, built on demand.
+	const std::vector<const treNameView*>& getSortedNames() const;
+	std::vector<const treNameView*>::const_iterator
+		lowerBound(const std::string& name) const;
+
 	std::list< treClass*> treList;
+	bool mapped;
+	treClass::md5Modes md5Mode;
+	bool indexSidecar;
+	std::string indexDirectory;
+
+	/**
+	   Name -> record lookup over every archive, newest archive wins.
+	   Keys point at the names held by the records, which stay put
+	   until the archive is removed.
+	*/
+	std::unordered_map<treNameView, indexEntry, treNameViewHash> fileIndex;
+
+	mutable std::vector<const treNameView*> sortedNames;
+	mutable bool sortedValid;
+	mutable std::mutex sortedMutex;
+
+	mutable treRecordCache cache;
+
+	std::atomic<bool> collectStats;
+	mutable std::atomic<uint64_t> statLookups;
+	mutable std::atomic<uint64_t> statMisses;
+
+	std::atomic<std::ostream*> traceStream;
+	std::chrono::steady_clock::time_point traceStart;
+	mutable std::mutex traceMutex;
+
+	// Prefetch thread, started by the first hint
+	mutable std::thread prefetchThread;
+	mutable std::mutex prefetchMutex;
+	mutable std::condition_variable prefetchReady;
+	mutable std::condition_variable prefetchDone;
+	mutable std::deque<indexEntry> prefetchQueue;
+	mutable indexEntry prefetchCurrent;
+	mutable bool prefetchStop;
+	mutable std::atomic<bool> prefetchStarted;
+	mutable std::atomic<uint64_t> prefetched;
 
 private:
 
@@ -23,13 +23,19 @@
  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
+#include <atomic>
 #include <istream>
+#include <memory>
 #include <ostream>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <treLib/treFileRecord.hpp>
 #include <treLib/treDataBlock.hpp>
+#include <treLib/treMappedFile.hpp>
+#include <treLib/treRecordView.hpp>
+#include <treLib/treRecordStream.hpp>
 
 #ifndef TRECLASS_HPP
 #define TRECLASS_HPP 1
@@ -37,19 +43,113 @@
 class treClass
 {
 public:
+	/// How record reads use the MD5 table stored in the archive.
+	enum md5Modes
+	{
+		MD5_OFF = 0, ///< Don't hash records (fast path)
+		MD5_VERIFY = 1 ///< Fail reads whose stored data doesn't match
+	};
+
 	treClass();
 	~treClass();
 
 	bool readFile(const std::string& treName);
 	bool readFile(std::ifstream& file);
 
+	/// Write every record in getFileRecordList(), names are input files.
 	bool writeFile(const std::string& treName);
 
+	/**
+	   Streaming writer.  Call beginWrite(), then addRecord() once per
+	   payload, then endWrite().  Each payload is compressed and written
+	   immediately and only the record metadata is kept, so memory use
+	   does not grow with the size of the archive.
+	*/
+	bool beginWrite(const std::string& treName);
+	bool addRecord(const std::string& name,
+		const char* data,
+		const uint32_t& size,
+		const uint32_t& format);
+
+	/// As above, the record takes over the block's uncompressed data.
+	bool addRecord(const std::string& name,
+		treDataBlock&& block,
+		const uint32_t& format);
+
+	/**
+	   Streaming writer: add data exactly as stored in another archive
+	   (compressed for format 2), without compressing it again.
+	*/
+	bool addStoredRecord(const std::string& name,
+		const char* storedData,
+		const uint32_t& storedSize,
+		const uint32_t& uncompressedSize,
+		const uint32_t& format);
+	bool endWrite();
+
+	/**
+	   Index sidecar.  When enabled, readFile() loads the records from
+	   "<archive>.idx" if it matches the archive's size and mtime, and
+	   otherwise reads the archive and (re)writes the sidecar.  With an
+	   index directory set, sidecars are kept there instead of beside
+	   the archive.
+	*/
+	void setIndexSidecar(const bool& s) { useIndexSidecar = s; }
+	bool getIndexSidecar() const { return useIndexSidecar; }
+	void setIndexDirectory(const std::string& d) { indexDirectory = d; }
+	const std::string& getIndexDirectory() const { return indexDirectory; }
+	std::string getIndexSidecarName() const;
+
+	/**
+	   Keep archive memory mapped until unmapFile() or destruction.
+	   If mapping fails the archive stays readable with positional reads.
+	*/
+	bool mapFile();
+	void unmapFile();
+	bool isMapped() const { return treMap.isMapped(); }
+
+	/// Zero-copy view of an uncompressed record, requires mapFile().
+	bool getRecordView(const uint32_t& recordNum,
+		treRecordView& view) const;
+
 	void setFileBlockCompression(const uint32_t& f);
 	void setNameBlockCompression(const uint32_t& f);
 	uint32_t getFileBlockCompression() { return fileCompression; }
 	uint32_t getNameBlockCompression() { return nameCompression; }
 
+	/// Threads used to read/compress records in writeFile(), 1 is serial.
+	void setNumThreads(const unsigned int& n) { numThreads = (n > 0) ? n : 1; }
+	unsigned int getNumThreads() const { return numThreads; }
+
+	/// zlib level (0-9) used by writeFile(), -1 is zlib's default.
+	void setCompressionLevel(const int& l) { compressionLevel = l; }
+	int getCompressionLevel() const { return compressionLevel; }
+
+	/**
+	   Store byte-identical payloads once when writing.  Later records
+	   with the same format, sizes and MD5 are compared byte for byte
+	   with the copy already written and point at it if they match.
+	*/
+	void setDeduplicate(const bool& d) { deduplicate = d; }
+	bool getDeduplicate() const { return deduplicate; }
+
+	/// Records and stored bytes saved by deduplication in the last write.
+	uint32_t getDeduplicatedRecords() const { return dedupRecords; }
+	uint64_t getDeduplicatedBytes() const { return dedupBytes; }
+
+	/**
+	   Incremental builds.  When a base archive is set, writeFile()
+	   copies the compressed bytes of any format 2 input whose content
+	   matches the base archive's record of the same name instead of
+	   compressing it again.  Only new or changed inputs go through zlib.
+	*/
+	bool setBaseArchive(const std::string& treName);
+	void clearBaseArchive();
+
+	/// Records and uncompressed bytes reused from the base archive.
+	uint32_t getReusedRecords() const { return reusedRecords; }
+	uint64_t getReusedBytes() const { return reusedBytes; }
+
 	const std::string& getVersion() const { return version; }
 	void setVersion(const std::string& v) { version = v; }
 
@@ -57,11 +157,85 @@ public:
 	void printFileBlock(std::ostream& os) const;
 	void printNameBlock(std::ostream& os, bool verbose=false) const;
 
-	bool saveRecordAsFile(const uint32_t& recordNum);
+	/**
+	   Read and uncompress one record.  Only positional reads or the
+	   mapping are used, so this (and the saveRecordAs* functions) may
+	   be called from several threads at once on the same treClass.
+	   If md5sum is not null the 16 byte MD5 of the stored data is
+	   written to it.  In MD5_VERIFY mode the read fails on a mismatch.
+	*/
+	bool readRecord(const uint32_t& recordNum,
+		treDataBlock& dataBlock,
+		unsigned char* md5sum = nullptr) const;
+
+	/**
+	   Positional read of a record's data as stored in the archive
+	   (compressed for format 2), starting offset bytes into the record.
+	*/
+	bool readStoredData(const uint32_t& recordNum,
+		const uint32_t& offset,
+		char* buffer,
+		const uint32_t& size) const;
+
+	/// Counters collected by readRecord() and friends, see setCollectStats().
+	class readStats
+	{
+	public:
+		uint64_t lookups; ///< Lookups answered by this archive
+		uint64_t records; ///< Records uncompressed
+		uint64_t bytesRead; ///< Stored bytes read from file or mapping
+		uint64_t bytesInflated; ///< Uncompressed bytes produced
+		uint64_t ioNanoseconds; ///< Time in positional reads
+		uint64_t inflateNanoseconds; ///< Time uncompressing (and MD5 checks)
+	};
+
+	/// Collect readStats, off by default.
+	void setCollectStats(const bool& s) { collectStats.store(s, std::memory_order_relaxed); }
+	bool getCollectStats() const { return collectStats.load(std::memory_order_relaxed); }
+	void getReadStats(readStats& stats) const;
+	void resetReadStats();
+	void countLookup() const { if (collectStats) { ++statLookups; } }
+
+	void setMD5Mode(const md5Modes& m) { md5Mode = m; }
+	md5Modes getMD5Mode() const { return md5Mode; }
+
+	/**
+	   Check every record that has a stored MD5 against its data using
+	   threads workers (0 = one per core).  Record numbers that don't
+	   match are added to mismatches.  Returns the number checked.
+	*/
+	uint32_t scrub(std::vector<uint32_t>& mismatches,
+		const unsigned int& threads = 0) const;
+
+	/// Size of a record's data as stored in the archive.
+	uint32_t getStoredSize(const uint32_t& recordNum) const;
+
+	/// Positional read of any byte range of the archive file.
+	bool readRange(const uint64_t& offset,
+		char* buffer,
+		const uint32_t& size) const;
+
+	/// Pointer into the mapping for a byte range, null if not mapped.
+	const char* getMappedRange(const uint64_t& offset,
+		const uint32_t& size) const;
+
+	/// Uncompress a record whose stored data the caller already read.
+	bool uncompressRecord(const uint32_t& recordNum,
+		const char* storedData,
+		treDataBlock& dataBlock) const;
+
+	/// Incrementally inflating stream over one record, caller deletes.
+	treRecordStream* openRecordStream(const uint32_t& recordNum) const;
+
+	bool saveRecordAsFile(const uint32_t& recordNum) const;
 	std::stringstream* saveRecordAsStream(const uint32_t& recordNum,
-		bool verbose = false);
+		bool verbose = false) const;
 
 	std::vector<treFileRecord>& getFileRecordList() { return fileRecordList; }
+	const std::vector<treFileRecord>& getFileRecordList() const
+	{
+		return fileRecordList;
+	}
 	bool getFileRecordIndex(const std::string& recordName,
 		uint32_t& index) const;
 	const std::string& getFilename() const
@@ -74,17 +248,49 @@ public:
 		return numRecords;
 	}
 
+	/**
+	   True if a record name stays inside the directory it is extracted
+	   to: not empty, not absolute and without ".." components.
+	*/
+	static bool isSafeRecordName(const std::string& name);
+
+	/// True if both names refer to the same file on disk.
+	static bool isSameFile(const std::string& a, const std::string& b);
+
 protected:
 	bool readHeader(std::istream& file);
 	bool readFileBlock(std::istream& file);
 	bool readNameBlock(std::istream& file);
 	bool readMD5sums(std::istream& file);
+	void parseFileBlock(const char* buffer);
+	bool parseNameBlock(const char* names, const uint32_t& size);
+
+	bool getArchiveKey(uint64_t& size, int64_t& mtime) const;
+	bool readIndexSidecar();
+	bool writeIndexSidecar() const;
+
+	/// Sidecar layout version and size of its fixed header.
+	static const uint32_t indexVersion = 1;
+	static const uint32_t indexHeaderSize = 60;
+
+	bool hasStoredMD5(const uint32_t& recordNum) const;
+	bool isStoredMD5Correct(const uint32_t& recordNum,
+		const char* storedData) const;
 
 	bool writeHeader(std::ostream& file);
 	bool writeFileBlock(std::ostream& file);
 
+	bool prepareRecord(treFileRecord& record) const;
+	bool reuseBaseRecord(treFileRecord& record) const;
+	bool appendRecord(treFileRecord& record);
+	static std::string getDedupKey(const treFileRecord& record);
+	bool isWrittenCopy(treFileRecord& record,
+		const uint32_t& offset,
+		const uint32_t& storedSize);
+	bool writeRecordsParallel(std::vector<treFileRecord>& inputList);
+
 	std::string filename;
-	std::ifstream treFile;
+	treMappedFile treMap;
 
 	std::string version;
 	uint32_t numRecords;
@@ -96,6 +302,38 @@ protected:
 	uint32_t nameSize;
 	uint32_t nameFinalSize;
 
+	md5Modes md5Mode;
+
+	std::atomic<bool> collectStats;
+	mutable std::atomic<uint64_t> statLookups;
+	mutable std::atomic<uint64_t> statRecords;
+	mutable std::atomic<uint64_t> statBytesRead;
+	mutable std::atomic<uint64_t> statBytesInflated;
+	mutable std::atomic<uint64_t> statIoNanoseconds;
+	mutable std::atomic<uint64_t> statInflateNanoseconds;
+
+	bool useIndexSidecar;
+	std::string indexDirectory;
+	treMappedFile indexMap;
+
+	unsigned int numThreads;
+	int compressionLevel;
+	bool deduplicate;
+
+	// Streaming writer state
+	std::ofstream outTreFile;
+	uint32_t nameBlockOffset;
+	std::unordered_map<std::string, uint32_t> dedupIndex;
+	std::ifstream dedupFile;
+	uint32_t dedupRecords;
+	uint64_t dedupBytes;
+
+	// Incremental build state
+	std::unique_ptr<treClass> baseArchive;
+	std::unordered_map<std::string, uint32_t> baseIndex;
+	mutable std::atomic<uint32_t> reusedRecords;
+	mutable std::atomic<uint64_t> reusedBytes;
+
 	std::vector<treFileRecord> fileRecordList;
 	treDataBlock fileBlock;
 	treDataBlock nameBlock;
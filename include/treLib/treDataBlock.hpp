@@ -38,6 +38,9 @@ public:
 	treDataBlock();
 	~treDataBlock();
 
+	treDataBlock(treDataBlock&&) = default;
+	treDataBlock& operator=(treDataBlock&&) = default;
+
 	bool readAndUncompress(
 		std::istream& file,
 		const int& format,
@@ -45,7 +48,29 @@ public:
 		const uint32_t& uncompSize
 	);
 
+	/// Same as readAndUncompress, but source is already in memory.
+	bool uncompressFromBuffer(
+		const char* buffer,
+		const int& format,
+		const uint32_t& compSize,
+		const uint32_t& uncompSize
+	);
+
+	/// level is a zlib level, -1 is zlib's default (same as compress())
 	bool compressAndWrite(
+		std::ostream& file,
+		const int& format,
+		const int& level = -1
+	);
+
+	/// Compress (if required) and calculate the MD5 of the stored data.
+	bool compressData(
+		const int& format,
+		const int& level = -1
+	);
+
+	/// Write data prepared by compressData().
+	bool writeData(
 		std::ostream& file,
 		const int& format
 	);
@@ -59,6 +84,8 @@ public:
 
 	char* getCompressedDataPtr();
 	char* getUncompressedDataPtr();
+	const char* getCompressedDataPtr() const { return compData.get(); }
+	const char* getUncompressedDataPtr() const { return data.get(); }
 
 	bool allocateUncompressedData(const uint32_t& size);
 
@@ -67,6 +94,12 @@ public:
 		const uint32_t& newDataSize
 	);
 
+	/// Use already compressed (format 2) data instead of compressData().
+	bool setCompressedData(
+		const char* newData,
+		const uint32_t& newDataSize
+	);
+
 	uint32_t getUncompressedSize() const
 	{
 		return uncompressedSize;
@@ -77,12 +110,18 @@ public:
 	}
 
 protected:
+	bool uncompressData(
+		const char* src,
+		const uint32_t& compSize,
+		const uint32_t& uncompSize
+	);
+
 	uint32_t checksum;
 	uint32_t uncompressedSize;
 	uint32_t compressedSize;
 	std::vector<unsigned char> md5sum;
-	std::unique_ptr<char> data;
-	std::unique_ptr<char> compData;
+	std::unique_ptr<char[]> data;
+	std::unique_ptr<char[]> compData;
 
 };
 
@@ -0,0 +1,90 @@
+/** -*-c++-*-
+ *  \class  treExtractor
+ *  \file   treExtractor.hpp
+ *  \author Ken Sewell
+
+ treLib is used for the creation and deconstruction of .TRE files.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of treLib.
+
+ treLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ treLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with treLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <treLib/treClass.hpp>
+
+#ifndef TREEXTRACTOR_HPP
+#define TREEXTRACTOR_HPP 1
+
+/**
+   Extracts records from a treClass to disk using a pool of worker
+   threads.  Records are handed out in on-disk offset order, every
+   directory is created once up front, and workers inflate and write
+   files independently of each other.
+*/
+class treExtractor
+{
+public:
+	treExtractor(const treClass& t);
+	~treExtractor();
+
+	/// 0 uses one thread per hardware core.
+	void setNumThreads(const unsigned int& n) { numThreads = n; }
+	unsigned int getNumThreads() const { return numThreads; }
+
+	/// Directory the record paths are created under, default is cwd.
+	void setOutputDir(const std::string& dir) { outputDir = dir; }
+	const std::string& getOutputDir() const { return outputDir; }
+
+	/// Extract every record.
+	bool extract();
+
+	/// Extract records first through last (inclusive).
+	bool extract(const uint32_t& first, const uint32_t& last);
+
+	uint32_t getNumExtracted() const { return numExtracted; }
+	uint32_t getNumFailed() const { return numFailed; }
+	uint64_t getBytesWritten() const { return bytesWritten; }
+
+protected:
+	bool makeDirectories(const std::vector<uint32_t>& records) const;
+	void worker();
+	bool extractRecord(const uint32_t& recordNum);
+
+	std::string getOutputPath(const std::string& name) const;
+
+	const treClass& tre;
+	unsigned int numThreads;
+	std::string outputDir;
+
+	std::vector<uint32_t> workList;
+	std::atomic<size_t> nextWork;
+
+	std::atomic<uint32_t> numExtracted;
+	std::atomic<uint32_t> numFailed;
+	std::atomic<uint64_t> bytesWritten;
+
+	std::mutex printMutex;
+
+private:
+	treExtractor(const treExtractor&);
+	treExtractor& operator=(const treExtractor&);
+};
+
+#endif
@@ -23,18 +23,28 @@
  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <array>
 #include <fstream>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <vector>
 #include <treLib/treDataBlock.hpp>
+#include <treLib/treNameView.hpp>
 
 #ifndef TREFILERECORD_HPP
 #define TREFILERECORD_HPP 1
 
+/**
+   One entry of a .tre file block.  Names read from an archive are views
+   into the name block kept by the owning treClass, so a copied record
+   is only valid while that treClass is.  Names set with setFileName()
+   are owned by the record.  The data block is created on first use.
+*/
 class treFileRecord
 {
 public:
+	typedef std::array<unsigned char, 16> md5Type;
 
 	enum Size
 	{
@@ -42,7 +52,9 @@ public:
 	};
 
 	treFileRecord();
+	/// Copies leave the data block behind, only the metadata is copied.
 	treFileRecord(const treFileRecord& rec);
+	treFileRecord(treFileRecord&& rec);
 	~treFileRecord() {};
 
 	bool read(std::istream& file);
@@ -52,6 +64,7 @@ public:
 	uint32_t writeToBuffer(char* buffer) const;
 
 	void operator=(const treFileRecord& src);
+	void operator=(treFileRecord&& src);
 	bool operator==(const treFileRecord& src) const;
 
 	void setChecksum(const uint32_t& x) { checksum = x; }
@@ -60,11 +73,11 @@ public:
 	void setFormat(const uint32_t& x) { format = x; }
 	void setSize(const uint32_t& x) { size = x; }
 	void setNameOffset(const uint32_t& x) { nameOffset = x; }
-	void setFileName(const std::string& fn) { fileName = fn; }
-	void setMD5sum(const std::vector<unsigned char>& newSum)
-	{
-		md5sum = newSum;
-	}
+	void setFileName(const std::string& fn);
+	/// Name owned elsewhere, n[s] must be null and outlive the record.
+	void setFileNameView(const char* n, const uint32_t& s);
+	void setMD5sum(const std::vector<unsigned char>& newSum);
+	void setMD5sum(const unsigned char* newSum);
 
 	uint32_t getChecksum() const { return checksum; }
 	uint32_t getUncompressedSize() const { return uncompressedSize; }
@@ -72,17 +85,16 @@ public:
 	uint32_t getFormat() const { return format; }
 	uint32_t getSize() const { return size; }
 	uint32_t getNameOffset() const { return nameOffset; }
-	const std::string& getFileName() const { return fileName; }
-	const std::vector<unsigned char>& getMD5sum() const
-	{
-		return md5sum;
-	}
+	treNameView getFileName() const { return treNameView(name, nameSize); }
+	const md5Type& getMD5sum() const { return md5sum; }
 
 	bool readMD5(std::istream& file);
 	bool writeMD5(std::ostream& file) const;
 	uint32_t generateChecksum() const;
 
-	treDataBlock& getDataBlock() { return dataBlock; }
+	treDataBlock& getDataBlock();
+	bool hasDataBlock() const { return (nullptr != dataBlock); }
+	void freeDataBlock() { dataBlock.reset(); }
 
 	static std::string getFormatStr(const uint32_t format);
 
@@ -93,9 +105,11 @@ protected:
 	uint32_t format;
 	uint32_t size;
 	uint32_t nameOffset;
-	std::vector<unsigned char> md5sum;
-	std::string fileName;
-	treDataBlock dataBlock;
+	uint32_t nameSize;
+	const char* name;
+	md5Type md5sum;
+	std::unique_ptr<char[]> ownedName;
+	std::unique_ptr<treDataBlock> dataBlock;
 };
 
 #endif
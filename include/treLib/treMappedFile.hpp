@@ -0,0 +1,73 @@
+/** -*-c++-*-
+ *  \class  treMappedFile
+ *  \file   treMappedFile.hpp
+ *  \author Ken Sewell
+
+ treLib is used for the creation and deconstruction of .TRE files.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of treLib.
+
+ treLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ treLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with treLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <cstdint>
+#include <string>
+
+#ifndef TREMAPPEDFILE_HPP
+#define TREMAPPEDFILE_HPP 1
+
+/**
+   Read-only handle to a whole file, optionally memory mapped.  The
+   file (and mapping) stays valid until close() is called or the object
+   is destroyed.  readAt() does not share a file position, so it can be
+   called from several threads at once.
+*/
+class treMappedFile
+{
+public:
+	treMappedFile();
+	~treMappedFile();
+
+	bool open(const std::string& filename, const bool map = true);
+	void close();
+
+	bool isOpen() const;
+	bool isMapped() const { return (nullptr != mapData); }
+
+	/// Positional read, safe to call concurrently.
+	bool readAt(const uint64_t& offset, char* buffer,
+		const uint32_t& size) const;
+
+	const char* getData() const { return mapData; }
+	uint64_t getSize() const { return mapSize; }
+
+protected:
+	const char* mapData;
+	uint64_t mapSize;
+
+#ifdef WIN32
+	void* fileHandle;
+	void* mapHandle;
+#else
+	int fd;
+#endif
+
+private:
+	treMappedFile(const treMappedFile&);
+	treMappedFile& operator=(const treMappedFile&);
+};
+
+#endif
@@ -0,0 +1,130 @@
+/** -*-c++-*-
+ *  \class  treNameView
+ *  \file   treNameView.hpp
+ *  \author Ken Sewell
+
+ treLib is used for the creation and deconstruction of .TRE files.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of treLib.
+
+ treLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ treLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with treLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+
+#ifndef TRENAMEVIEW_HPP
+#define TRENAMEVIEW_HPP 1
+
+/**
+   Read-only, null terminated record name owned by someone else,
+   usually the name block retained by treClass.  Converts to
+   std::string where a copy is needed.
+*/
+class treNameView
+{
+public:
+	treNameView() : name(""), length(0) {}
+	treNameView(const char* n, const uint32_t& s) : name(n), length(s) {}
+	/// View of s, valid while s is unchanged.
+	explicit treNameView(const std::string& s) :
+		name(s.c_str()), length(static_cast<uint32_t>(s.size())) {}
+
+	const char* data() const { return name; }
+	const char* c_str() const { return name; }
+	uint32_t size() const { return length; }
+	bool empty() const { return (0 == length); }
+
+	const char* begin() const { return name; }
+	const char* end() const { return name + length; }
+
+	std::string str() const { return std::string(name, length); }
+	operator std::string() const { return str(); }
+
+	size_t find(const std::string& s, const size_t& pos = 0) const
+	{
+		if (pos > length)
+		{
+			return std::string::npos;
+		}
+
+		const char* found = std::search(name + pos, end(), s.begin(), s.end());
+		return (end() == found && !s.empty()) ?
+			std::string::npos : size_t(found - name);
+	}
+
+	bool startsWith(const std::string& prefix) const
+	{
+		return (prefix.size() <= length) &&
+			(0 == memcmp(name, prefix.data(), prefix.size()));
+	}
+
+	bool operator==(const treNameView& v) const
+	{
+		return (length == v.length) && (0 == memcmp(name, v.name, length));
+	}
+	bool operator==(const std::string& s) const
+	{
+		return (length == s.size()) && (0 == memcmp(name, s.data(), length));
+	}
+	bool operator!=(const treNameView& v) const { return !(*this == v); }
+	bool operator!=(const std::string& s) const { return !(*this == s); }
+
+	bool operator<(const treNameView& v) const
+	{
+		const int c = memcmp(name, v.name, std::min(length, v.length));
+		return (0 != c) ? (c < 0) : (length < v.length);
+	}
+
+protected:
+	const char* name;
+	uint32_t length;
+};
+
+/// FNV-1a over the name, for unordered containers keyed on views.
+struct treNameViewHash
+{
+	size_t operator()(const treNameView& v) const
+	{
+		uint64_t hash = 14695981039346656037ULL;
+		for (const char c : v)
+		{
+			hash ^= static_cast<unsigned char>(c);
+			hash *= 1099511628211ULL;
+		}
+		return static_cast<size_t>(hash);
+	}
+};
+
+inline bool operator==(const std::string& s, const treNameView& v)
+{
+	return (v == s);
+}
+
+inline bool operator!=(const std::string& s, const treNameView& v)
+{
+	return (v != s);
+}
+
+inline std::ostream& operator<<(std::ostream& os, const treNameView& v)
+{
+	return os.write(v.data(), v.size());
+}
+
+#endif
@@ -0,0 +1,122 @@
+/** -*-c++-*-
+ *  \class  treRecordCache
+ *  \file   treRecordCache.hpp
+ *  \author Ken Sewell
+
+ treLib is used for the creation and deconstruction of .TRE files.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of treLib.
+
+ treLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ treLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with treLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <treLib/treDataBlock.hpp>
+
+#ifndef TRERECORDCACHE_HPP
+#define TRERECORDCACHE_HPP 1
+
+class treClass;
+
+/**
+   Least recently used cache of decompressed records, limited by the
+   total number of uncompressed bytes it holds.  Records are handed out
+   as shared, read-only data blocks so several users can share one
+   copy; an evicted block stays alive until its last user lets go.
+   All functions are thread-safe.
+*/
+class treRecordCache
+{
+public:
+	typedef std::shared_ptr<const treDataBlock> blockPtr;
+
+	treRecordCache();
+	~treRecordCache();
+
+	/// Byte budget, 0 disables the cache.
+	void setMaxSize(const uint64_t& bytes);
+	uint64_t getMaxSize() const { return maxSize.load(std::memory_order_relaxed); }
+	uint64_t getSize() const;
+
+	bool isEnabled() const { return (maxSize.load(std::memory_order_relaxed) > 0); }
+
+	/// Look up a record, counts as a hit or a miss.
+	blockPtr find(const treClass* tre, const uint32_t& index);
+
+	/// Check for a record without counting or touching the LRU order.
+	bool contains(const treClass* tre, const uint32_t& index) const;
+
+	/**
+	   Add a record and return the cached copy.  If another thread
+	   added the same record first its copy is returned instead.
+	*/
+	blockPtr insert(const treClass* tre, const uint32_t& index,
+		const blockPtr& block);
+
+	void clear();
+
+	uint64_t getHits() const { return hits; }
+	uint64_t getMisses() const { return misses; }
+	uint64_t getEvictions() const { return evictions; }
+	void resetCounters();
+
+protected:
+	class key
+	{
+	public:
+		const treClass* tre;
+		uint32_t index;
+
+		bool operator==(const key& k) const
+		{
+			return (tre == k.tre) && (index == k.index);
+		}
+	};
+
+	class keyHash
+	{
+	public:
+		size_t operator()(const key& k) const
+		{
+			return std::hash<const void*>()(k.tre) ^
+				(std::hash<uint32_t>()(k.index) * 0x9e3779b9u);
+		}
+	};
+
+	typedef std::list< std::pair<key, blockPtr> > lruList;
+
+	void evict();
+
+	/// Written under mutex, atomic so isEnabled() can skip the lock.
+	std::atomic<uint64_t> maxSize;
+	uint64_t size;
+
+	/// Front is most recently used.
+	lruList lru;
+	std::unordered_map<key, lruList::iterator, keyHash> entries;
+	mutable std::mutex mutex;
+
+	std::atomic<uint64_t> hits;
+	std::atomic<uint64_t> misses;
+	std::atomic<uint64_t> evictions;
+};
+
+#endif
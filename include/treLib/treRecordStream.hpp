@@ -0,0 +1,113 @@
+/** -*-c++-*-
+ *  \class  treRecordStream
+ *  \file   treRecordStream.hpp
+ *  \author Ken Sewell
+
+ treLib is used for the creation and deconstruction of .TRE files.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of treLib.
+
+ treLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ treLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with treLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <vector>
+
+#ifndef TRERECORDSTREAM_HPP
+#define TRERECORDSTREAM_HPP 1
+
+class treClass;
+
+/**
+   std::streambuf that reads one record straight from its archive and
+   inflates it in small pieces, so only a fixed window of the record is
+   ever in memory.  Seeking forward inflates and discards; seeking back
+   further than the retained window restarts from the beginning of the
+   record.  Uses treClass::readStoredData(), so several streams can be
+   open on the same archive from different threads.
+*/
+class treRecordStreambuf : public std::streambuf
+{
+public:
+	enum
+	{
+		WINDOW_SIZE = 64 * 1024,
+		PUTBACK_SIZE = 4 * 1024,
+		INPUT_SIZE = 16 * 1024
+	};
+
+	treRecordStreambuf(const treClass& t, const uint32_t& recordNum);
+	~treRecordStreambuf();
+
+	bool isOpen() const { return open; }
+	uint32_t getSize() const { return size; }
+
+protected:
+	int_type underflow();
+	std::streamsize showmanyc();
+	pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+		std::ios_base::openmode which = std::ios_base::in);
+	pos_type seekpos(pos_type pos,
+		std::ios_base::openmode which = std::ios_base::in);
+
+	bool restart();
+	bool fill();
+
+	/// Position in record of the first byte after the buffer.
+	uint64_t getBufferEnd() const { return produced; }
+
+	const treClass& tre;
+	uint32_t record;
+	uint32_t format;
+	uint32_t size;
+	uint32_t storedSize;
+
+	/// Bytes of stored (possibly compressed) data consumed so far.
+	uint32_t consumed;
+	/// Uncompressed bytes produced so far.
+	uint64_t produced;
+
+	bool open;
+
+	std::vector<char> window;
+	std::vector<char> input;
+
+	class inflater;
+	std::unique_ptr<inflater> zstream;
+
+private:
+	treRecordStreambuf(const treRecordStreambuf&);
+	treRecordStreambuf& operator=(const treRecordStreambuf&);
+};
+
+/// std::istream over a treRecordStreambuf.
+class treRecordStream : public std::istream
+{
+public:
+	treRecordStream(const treClass& t, const uint32_t& recordNum);
+	~treRecordStream();
+
+	bool isOpen() const { return buffer.isOpen(); }
+	uint32_t getSize() const { return buffer.getSize(); }
+
+protected:
+	treRecordStreambuf buffer;
+};
+
+#endif
@@ -0,0 +1,54 @@
+/** -*-c++-*-
+ *  \class  treRecordView
+ *  \file   treRecordView.hpp
+ *  \author Ken Sewell
+
+ treLib is used for the creation and deconstruction of .TRE files.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of treLib.
+
+ treLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ treLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with treLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <cstdint>
+
+#ifndef TRERECORDVIEW_HPP
+#define TRERECORDVIEW_HPP 1
+
+/**
+   Read-only view of record data that is owned by someone else,
+   usually the memory mapping of an archive.  No copy is made, so the
+   view is only valid while the owner is alive.
+*/
+class treRecordView
+{
+public:
+	treRecordView() : data(nullptr), size(0) {}
+	treRecordView(const char* d, const uint32_t& s) : data(d), size(s) {}
+
+	const char* getData() const { return data; }
+	uint32_t getSize() const { return size; }
+	bool empty() const { return (nullptr == data); }
+
+	const char* begin() const { return data; }
+	const char* end() const { return data + size; }
+
+protected:
+	const char* data;
+	uint32_t size;
+};
+
+#endif
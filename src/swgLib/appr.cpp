@@ -27,6 +27,8 @@
 #include <swgLib/exbx.hpp>
 #include <swgLib/base.hpp>
 #include <swgLib/collisionUtil.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -40,7 +42,7 @@ std::size_t appr::read(std::istream& file) {
 	std::size_t apprSize;
 	std::size_t total = base::readFormHeader(file, "APPR", apprSize);
 	apprSize += 8;
-	std::cout << "Found APPR form: " << apprSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found APPR form: " << apprSize << " bytes\n";
 
 	std::size_t size;
 	std::string type;
@@ -48,10 +50,11 @@ std::size_t appr::read(std::istream& file) {
 
 	_apprVersion = base::tagToVersion(type);
 	if ((_apprVersion < 1) || (3 < _apprVersion)) {
-		std::cout << "Expected type [0001..0003]: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0001..0003]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found form of type: " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found form of type: " << type << std::endl;
 
 	// Load extents (box/sphere/mesh)...
 	total += collisionUtil::read(file, _boundingPtr);
@@ -69,12 +72,13 @@ std::size_t appr::read(std::istream& file) {
 	}
 
 	if (apprSize == total) {
-		std::cout << "Finished reading APPR\n";
+		SWG_LOG(LOG_INFO) << "Finished reading APPR\n";
 	}
 	else {
-		std::cout << "Failed in reading APPR\n";
-		std::cout << "Read " << total << " out of " << apprSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading APPR: ";
+		msg << "Read " << total << " out of " << apprSize;
+		base::fail(file, "APPR", msg.str());
 	}
 
 	return total;
@@ -84,17 +88,17 @@ std::size_t appr::readHPTS(std::istream& file) {
 	std::size_t hptsSize;
 	std::size_t total = base::readFormHeader(file, "HPTS", hptsSize);
 	hptsSize += 8;
-	std::cout << "Found HPTS form: " << hptsSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found HPTS form: " << hptsSize << " bytes\n";
 
 	while (total < hptsSize) {
 		std::size_t hpntSize;
 		total += base::readRecordHeader(file, "HPNT", hpntSize);
-		std::cout << "Found HPNT form: " << hpntSize << " bytes\n";
+		SWG_LOG(LOG_DEBUG) << "Found HPNT form: " << hpntSize << " bytes\n";
 		std::string name;
 		matrix3x4 mat;
 		total += base::read(file, mat);
 		total += base::read(file, name);
-		std::cout << "Hardpoint " << _hardpointName.size() << ":\n"
+		SWG_LOG(LOG_DEBUG) << "Hardpoint " << _hardpointName.size() << ":\n"
 			<< "Name: " << name << "\n"
 			<< "Transform: \n" << mat << "\n";
 		_hardpointTransform.push_back(mat);
@@ -103,13 +107,14 @@ std::size_t appr::readHPTS(std::istream& file) {
 
 	if (hptsSize == total)
 	{
-		std::cout << "Finished reading HPTS\n";
+		SWG_LOG(LOG_INFO) << "Finished reading HPTS\n";
 	}
 	else
 	{
-		std::cout << "Failed in reading hpts\n"
-			<< "Read " << total << " out of " << hptsSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading hpts: "
+			<< "Read " << total << " out of " << hptsSize;
+		base::fail(file, "HPTS", msg.str());
 	}
 
 	return total;
@@ -119,28 +124,29 @@ std::size_t appr::readFLOR(std::istream& file) {
 	std::size_t florSize;
 	std::size_t total = base::readFormHeader(file, "FLOR", florSize);
 	florSize += 8;
-	std::cout << "Found FLOR form: " << florSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FLOR form: " << florSize << " bytes\n";
 
 	std::size_t dataSize;
 	total += base::readRecordHeader(file, "DATA", dataSize);
 
 	total += base::read(file, _hasFloor);
-	std::cout << "Has floor: " << std::boolalpha << _hasFloor << "\n";
+	SWG_LOG(LOG_INFO) << "Has floor: " << std::boolalpha << _hasFloor << "\n";
 
 	if (_hasFloor) {
 		total += base::read(file, _floorName);
-		std::cout << "Floor name: " << _floorName << "\n";
+		SWG_LOG(LOG_INFO) << "Floor name: " << _floorName << "\n";
 	}
 
 	if (florSize == total)
 	{
-		std::cout << "Finished reading FLOR\n";
+		SWG_LOG(LOG_INFO) << "Finished reading FLOR\n";
 	}
 	else
 	{
-		std::cout << "Failed in reading FLOR" << std::endl;
-		std::cout << "Read " << total << " out of " << florSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading FLOR: ";
+		msg << "Read " << total << " out of " << florSize;
+		base::fail(file, "FLOR", msg.str());
 	}
 
 	return total;
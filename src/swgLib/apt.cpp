@@ -25,9 +25,11 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/apt.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -44,7 +46,7 @@ std::size_t apt::readAPT(std::istream& file)
 	std::size_t aptSize;
 	std::size_t total = base::readFormHeader(file, "APT ", aptSize);
 	aptSize += 8;
-	std::cout << "Found form APT: " << aptSize << "\n";
+	SWG_LOG(LOG_INFO) << "Found form APT: " << aptSize << "\n";
 
 	std::size_t size;
 	total += base::readFormHeader(file, "0000", size);
@@ -52,15 +54,16 @@ std::size_t apt::readAPT(std::istream& file)
 	total += base::readRecordHeader(file, "NAME", size);
 
 	total += base::read(file, _filename);
-	std::cout << "Name: " << _filename << "\n";
+	SWG_LOG(LOG_INFO) << "Name: " << _filename << "\n";
 
 	if (aptSize == total) {
-		std::cout << "Finished reading APT\n";
+		SWG_LOG(LOG_INFO) << "Finished reading APT\n";
 	}
 	else {
-		std::cout << "FAILED in reading APT\n"
-			<< "Read " << total << " out of " << aptSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading APT: "
+			<< "Read " << total << " out of " << aptSize;
+		base::fail(file, "APT ", msg.str());
 	}
 
 	return total;
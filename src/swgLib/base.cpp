@@ -24,11 +24,13 @@
 */
 
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 #include <cstdlib>
 #include <iostream>
 #include <iomanip>
 #include <sstream>
 #include <string>
+#include <utility>
 
 using namespace ml;
 
@@ -38,6 +40,32 @@ using namespace ml;
 #endif
 #endif
 
+const std::size_t parseError::unknownOffset;
+
+static std::string formatParseError(const std::string& tag,
+	const std::size_t& offset,
+	const std::string& message)
+{
+	std::ostringstream text;
+	text << tag;
+	if (parseError::unknownOffset != offset)
+	{
+		text << " at offset " << offset;
+	}
+	text << ": " << message;
+	return text.str();
+}
+
+parseError::parseError(const std::string& tag,
+	const std::size_t& offset,
+	const std::string& message) :
+	std::runtime_error(formatParseError(tag, offset, message)),
+	_tag(tag),
+	_offset(offset),
+	_message(message)
+{
+}
+
 tag::tag() {
 }
 
@@ -72,6 +100,22 @@ std::size_t tag::read(std::istream& file) {
 	return 4;
 }
 
+std::size_t tag::read(iffReader& file) {
+	file.read(_raw);
+	_str.clear();
+
+	if (0 == _raw) {
+		return 4;
+	}
+
+	char* tagPtr = (char*)(&_raw);
+	for (auto i = 3; i >= 0; --i) {
+		_str += tagPtr[i];
+	}
+
+	return 4;
+}
+
 std::size_t tag::write(std::ostream& file) const {
 	// Write 4 char tag as uint32_t...
 	return base::write(file, _raw);
@@ -142,13 +186,12 @@ std::size_t base::readBigEndian(std::istream& file,
 	char* buffer
 )
 {
+	file.read(buffer, size);
 #ifdef PLATFORM_LITTLE_ENDIAN
-	for (unsigned int i = 0; i < size; ++i)
+	for (std::size_t i = 0; i < size / 2; ++i)
 	{
-		file.read(&(buffer[size - 1 - i]), 1);
+		std::swap(buffer[i], buffer[size - 1 - i]);
 	}
-#else
-	file.read(buffer, size);
 #endif
 
 	return size;
@@ -176,6 +219,30 @@ std::size_t base::skip(std::istream& file, const std::size_t& skipBytes) {
 	return skipBytes;
 }
 
+void base::fail(std::istream& file,
+	const std::string& tag,
+	const std::string& message)
+{
+	// tellg() is -1 once the stream has failed.
+	const std::streamoff offset = file.tellg();
+	throw parseError(tag,
+		((offset < 0) ? parseError::unknownOffset : std::size_t(offset)),
+		message);
+}
+
+void base::fail(const iffReader& file,
+	const std::string& tag,
+	const std::string& message)
+{
+	throw parseError(tag, file.tell(), message);
+}
+
+void base::fail(const std::string& tag,
+	const std::string& message)
+{
+	throw parseError(tag, parseError::unknownOffset, message);
+}
+
 void base::peekHeader(std::istream& file,
 	std::string& form,
 	std::size_t& size,
@@ -249,9 +316,7 @@ std::size_t base::readRecordHeader(std::istream& file,
 	file.read(tempType, 4);
 	tempType[4] = 0;
 	if (expectedType != tempType) {
-		std::cout << "Expected record type of " << expectedType
-			<< ", found type of '" << tempType << "'\n";
-		exit(0);
+		fail(file, tempType, "expected record type " + expectedType);
 	}
 	uint32_t tempSize = 0;
 	readBigEndian(file, sizeof(tempSize), (char*)&tempSize);
@@ -271,9 +336,8 @@ std::size_t base::readRecordHeader(std::istream& file,
 	size = tempSize;
 
 	if (expectedType != type) {
-		std::cout << "Expected record type of " << tagToStr(expectedType)
-			<< ", found type of '" << tagToStr(type) << "'\n";
-		exit(0);
+		fail(file, tagToStr(type),
+			"expected record type " + tagToStr(expectedType));
 	}
 
 	return 8;
@@ -286,9 +350,7 @@ std::size_t base::readRecordHeader(std::istream& file,
 	file.read(tempType, 4);
 	tempType[4] = 0;
 	if (expectedType != tempType) {
-		std::cout << "Expected record type of " << expectedType
-			<< ", found type of '" << tempType << "'\n";
-		exit(0);
+		fail(file, tempType, "expected record type " + expectedType);
 	}
 
 	// Skip over size field
@@ -305,9 +367,8 @@ std::size_t base::readRecordHeader(std::istream& file,
 	file.seekg(sizeof(uint32_t), std::ios_base::cur);
 
 	if (expectedType != type) {
-		std::cout << "Expected record type of " << tagToStr(expectedType)
-			<< ", found type of '" << tagToStr(type) << "'\n";
-		exit(0);
+		fail(file, tagToStr(type),
+			"expected record type " + tagToStr(expectedType));
 	}
 
 	return 8;
@@ -409,9 +470,7 @@ std::size_t base::readFormHeader(std::istream& file,
 	std::string type(tempType);
 	if (expectedType != type)
 	{
-		std::cout << "Expected FORM of type " << expectedType
-			<< ", found: " << type << "\n";
-		exit(0);
+		fail(file, type, "expected FORM of type " + expectedType);
 	}
 
 	return total;
@@ -428,9 +487,8 @@ std::size_t base::readFormHeader(std::istream& file,
 
 	if (expectedType != type)
 	{
-		std::cout << "Expected FORM of type " << expectedType
-			<< ", found: " << type << "\n";
-		exit(0);
+		fail(file, tagToStr(type),
+			"expected FORM of type " + tagToStr(expectedType));
 	}
 
 	return 12;
@@ -445,22 +503,21 @@ std::size_t base::readUnknown(std::istream& file,
 		unsigned char data;
 		file.read((char*)&data, 1);
 		if (file.eof()) {
-			std::cout << "\nUnexpected EOF\n";
-			exit(0);
+			fail(file, "", "unexpected end of file");
 		}
 		if (data >= ' ' && data <= '~')
 		{
-			std::cout << data;
+			SWG_LOG(LOG_DEBUG) << data;
 		}
 		else
 		{
-			std::cout << std::hex << "0x" << std::setw(2)
+			SWG_LOG(LOG_DEBUG) << std::hex << "0x" << std::setw(2)
 				<< std::setfill('0')
 				<< (unsigned int)data
 				<< " " << std::dec;
 		}
 	}
-	std::cout << std::endl;
+	SWG_LOG(LOG_DEBUG) << std::endl;
 	return size;
 }
 
@@ -665,6 +722,228 @@ std::size_t base::write(std::ostream& file, const tag& t) {
 	return t.write(file);
 }
 
+// ******************** Buffer based reads ********************
+
+// Matches the istream readers, which stop the tag string at the first null.
+static std::string bufferTagToStr(const uint32_t& t) {
+	const char tagC[5] = {
+		char(t >> 24), char(t >> 16), char(t >> 8), char(t), 0
+	};
+	return std::string(tagC);
+}
+
+std::size_t base::read(iffReader& file, vector3& vec) {
+	float v[3];
+	file.read((char*)v, sizeof(v));
+	vec.set(v);
+	return sizeof(v);
+}
+
+std::size_t base::read(iffReader& file, matrix3x3& mat) {
+	float v[9];
+	file.read((char*)v, sizeof(v));
+	mat.set(v);
+	return sizeof(v);
+}
+
+std::size_t base::read(iffReader& file, matrix3x4& mat) {
+	float v[12];
+	file.read((char*)v, sizeof(v));
+	mat.set(v);
+	return sizeof(v);
+}
+
+std::size_t base::read(iffReader& file, tag& t) {
+	return t.read(file);
+}
+
+std::size_t base::readUnknown(iffReader& file,
+	const std::size_t size)
+{
+	if (size > file.remaining())
+	{
+		fail(file, "", "unexpected end of file");
+	}
+
+	const unsigned char* data = (const unsigned char*)file.current();
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		if (data[i] >= ' ' && data[i] <= '~')
+		{
+			SWG_LOG(LOG_DEBUG) << data[i];
+		}
+		else
+		{
+			SWG_LOG(LOG_DEBUG) << std::hex << "0x" << std::setw(2)
+				<< std::setfill('0')
+				<< (unsigned int)data[i]
+				<< " " << std::dec;
+		}
+	}
+	SWG_LOG(LOG_DEBUG) << std::endl;
+	file.skip(size);
+	return size;
+}
+
+void base::peekHeader(iffReader& file,
+	std::string& form,
+	std::size_t& size,
+	std::string& type)
+{
+	uint32_t formTag, typeTag;
+	file.peekHeader(formTag, size, typeTag);
+	form = bufferTagToStr(formTag);
+	type = bufferTagToStr(typeTag);
+}
+
+void base::peekHeader(iffReader& file,
+	uint32_t& form,
+	std::size_t& size,
+	uint32_t& type)
+{
+	file.peekHeader(form, size, type);
+}
+
+std::size_t base::readRecordHeader(iffReader& file,
+	std::string& type,
+	std::size_t& size)
+{
+	uint32_t typeTag;
+	file.readRecordHeader(typeTag, size);
+	type = bufferTagToStr(typeTag);
+
+	return 8;
+}
+
+std::size_t base::readRecordHeader(iffReader& file,
+	std::string& type)
+{
+	std::size_t size;
+	return readRecordHeader(file, type, size);
+}
+
+std::size_t base::readRecordHeader(iffReader& file,
+	const std::string& expectedType,
+	std::size_t& size)
+{
+	std::string type;
+	readRecordHeader(file, type, size);
+	if (expectedType != type) {
+		fail(file, type, "expected record type " + expectedType);
+	}
+
+	return 8;
+}
+
+std::size_t base::readRecordHeader(iffReader& file,
+	const std::string& expectedType)
+{
+	std::size_t size;
+	return readRecordHeader(file, expectedType, size);
+}
+
+std::size_t base::readRecordHeader(iffReader& file,
+	uint32_t& type,
+	std::size_t& size)
+{
+	return file.readRecordHeader(type, size);
+}
+
+std::size_t base::readRecordHeader(iffReader& file,
+	const uint32_t& expectedType,
+	std::size_t& size)
+{
+	uint32_t type;
+	file.readRecordHeader(type, size);
+
+	if (expectedType != type) {
+		fail(file, tagToStr(type),
+			"expected record type " + tagToStr(expectedType));
+	}
+
+	return 8;
+}
+
+std::size_t base::readRecordHeader(iffReader& file,
+	const uint32_t& expectedType)
+{
+	std::size_t size;
+	return readRecordHeader(file, expectedType, size);
+}
+
+std::size_t base::readFormHeader(iffReader& file,
+	std::string& form,
+	std::size_t& size,
+	std::string& type)
+{
+	uint32_t formTag, typeTag;
+	file.readFormHeader(formTag, size, typeTag);
+	form = bufferTagToStr(formTag);
+	type = bufferTagToStr(typeTag);
+
+	return 12;
+}
+
+std::size_t base::readFormHeader(iffReader& file,
+	std::string& type,
+	std::size_t& size)
+{
+	uint32_t typeTag;
+	readRecordHeader(file, (uint32_t)tag::TAG_FORM, size);
+	file.readBigEndian(typeTag);
+	type = bufferTagToStr(typeTag);
+
+	return 12;
+}
+
+std::size_t base::readFormHeader(iffReader& file,
+	const std::string& expectedType,
+	std::size_t& size)
+{
+	std::string type;
+	readFormHeader(file, type, size);
+	if (expectedType != type)
+	{
+		fail(file, type, "expected FORM of type " + expectedType);
+	}
+
+	return 12;
+}
+
+std::size_t base::readFormHeader(iffReader& file,
+	uint32_t& form,
+	std::size_t& size,
+	uint32_t& type)
+{
+	return file.readFormHeader(form, size, type);
+}
+
+std::size_t base::readFormHeader(iffReader& file,
+	uint32_t& type,
+	std::size_t& size)
+{
+	readRecordHeader(file, (uint32_t)tag::TAG_FORM, size);
+	file.readBigEndian(type);
+
+	return 12;
+}
+
+std::size_t base::readFormHeader(iffReader& file,
+	const uint32_t& expectedType,
+	std::size_t& size)
+{
+	uint32_t type;
+	readFormHeader(file, type, size);
+
+	if (expectedType != type)
+	{
+		fail(file, tagToStr(type),
+			"expected FORM of type " + tagToStr(expectedType));
+	}
+
+	return 12;
+}
+
 // **************************************************
 
 bool base::fixSlash(std::string& filename)
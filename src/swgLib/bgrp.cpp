@@ -25,6 +25,8 @@
 
 #include <swgLib/bgrp.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -38,17 +40,18 @@ std::size_t bgrp::read(std::istream& file) {
 	std::size_t mgrpSize;
 	std::size_t total = base::readFormHeader(file, "MGRP", mgrpSize);
 	mgrpSize += 8;
-	std::cout << "Found MGRP form: " << mgrpSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found MGRP form: " << mgrpSize << " bytes\n";
 
 	std::size_t size;
 	std::string form, type;
 	total += base::readFormHeader(file, form, size, type);
 	_version = base::tagToVersion(type);
 	if (0 != _version) {
-		std::cout << "Expected type [0000]: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0000]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Bitmap Group version: " << _version << "\n";
+	SWG_LOG(LOG_INFO) << "Bitmap Group version: " << _version << "\n";
 
 	while (total < mgrpSize) {
 		total += base::readFormHeader(file, "MFAM", size);
@@ -61,17 +64,18 @@ std::size_t bgrp::read(std::istream& file) {
 		total += base::read(file, newFamily.familyId);
 		total += base::read(file, newFamily.name);
 		total += base::read(file, newFamily.bitmapName);
-		std::cout << "Name: " << newFamily.name << "\n"
+		SWG_LOG(LOG_DEBUG) << "Name: " << newFamily.name << "\n"
 		          << "Bitmap name: " << newFamily.bitmapName << "\n";
 	}
 
 	if (mgrpSize == total) {
-		std::cout << "Finished reading MGRP\n";
+		SWG_LOG(LOG_INFO) << "Finished reading MGRP\n";
 	}
 	else {
-		std::cout << "Failed in reading MGRP\n";
-		std::cout << "Read " << total << " out of " << mgrpSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading MGRP: ";
+		msg << "Read " << total << " out of " << mgrpSize;
+		base::fail(file, "MGRP", msg.str());
 	}
 
 	return total;
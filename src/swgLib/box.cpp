@@ -25,7 +25,9 @@
 
 #include <swgLib/box.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -38,10 +40,11 @@ std::size_t box::readBOX(std::istream& file)
 	size += 8; // Size of header
 	if (type != "BOX ")
 	{
-		std::cout << "Expected record of type BOX: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type BOX: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found BOX record" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found BOX record" << std::endl;
 
 	// Read center and radius of bounding sphere
 	total += base::read(file, x1);
@@ -51,18 +54,18 @@ std::size_t box::readBOX(std::istream& file)
 	total += base::read(file, y2);
 	total += base::read(file, z2);
 
-	std::cout << "Bounding box corners: " << std::endl;
-	std::cout << "   " << x1 << ", " << y1 << ", " << z1 << std::endl;
-	std::cout << "   " << x2 << ", " << y2 << ", " << z2 << std::endl;
+	SWG_LOG(LOG_INFO) << "Bounding box corners: " << std::endl;
+	SWG_LOG(LOG_INFO) << "   " << x1 << ", " << y1 << ", " << z1 << std::endl;
+	SWG_LOG(LOG_INFO) << "   " << x2 << ", " << y2 << ", " << z2 << std::endl;
 
 	if (total == size)
 	{
-		std::cout << "Finished reading BOX." << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading BOX." << std::endl;
 	}
 	else
 	{
-		std::cout << "Error reading BOX!" << std::endl;
-		std::cout << "Read " << total << " out of " << size
+		SWG_LOG(LOG_ERROR) << "Error reading BOX!" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << size
 			<< std::endl;
 	}
 
@@ -24,8 +24,10 @@
 */
 
 #include <swgLib/cach.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
+#include <sstream>
 #include <bitset>
 #include <cstdlib>
 
@@ -49,33 +51,34 @@ std::size_t cach::readCACH(std::istream& file, std::string path)
 
 	total += readFormHeader(file, "CACH", cachSize);
 	cachSize += 8;
-	std::cout << "Found CACH form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found CACH form" << std::endl;
 
 	std::size_t size;
 	total += readRecordHeader(file, type, size);
 	if (type != "0000")
 	{
-		std::cout << "Expected type " << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type 0000: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found type: " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found type: " << type << std::endl;
 
 	std::string name;
 	while (total < cachSize)
 	{
 		total += base::read(file, name);
 		cacheList.push_back(name);
-		std::cout << name << std::endl;
+		SWG_LOG(LOG_DEBUG) << name << std::endl;
 	}
 
 	if (cachSize == total)
 	{
-		std::cout << "Finished reading CACH" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading CACH" << std::endl;
 	}
 	else
 	{
-		std::cout << "Failed in reading CACH" << std::endl;
-		std::cout << "Read " << total << " out of " << cachSize
+		SWG_LOG(LOG_ERROR) << "Failed in reading CACH" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << cachSize
 			<< std::endl;
 	}
 
@@ -29,9 +29,11 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/cclt.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -54,10 +56,11 @@ std::size_t cclt::readCCLT(std::istream& file)
 	ccltSize += 8;
 	if (form != "FORM" || type != "CCLT")
 	{
-		std::cout << "Expected Form of type CCLT: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected Form of type CCLT: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found CCLT form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found CCLT form" << std::endl;
 
 	total += readDERV(file, ccltBaseObjectFilename);
 
@@ -66,10 +69,11 @@ std::size_t cclt::readCCLT(std::istream& file)
 	size0000 += 8;
 	if (form != "FORM" || type != "0000")
 	{
-		std::cout << "Expected Form of type 0000: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected Form of type 0000: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found 0000 form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found 0000 form" << std::endl;
 
 	int32_t numParameters;
 	total += readPCNT(file, numParameters);
@@ -83,14 +87,14 @@ std::size_t cclt::readCCLT(std::istream& file)
 
 	if (ccltSize == total)
 	{
-		std::cout << "Finished reading CCLT" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading CCLT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading CCLT" << std::endl;
-		std::cout << "Read " << total << " out of " << ccltSize
-			<< std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading CCLT: ";
+		msg << "Read " << total << " out of " << ccltSize;
+		base::fail(file, "CCLT", msg.str());
 	}
 
 	return total;
@@ -101,7 +105,6 @@ void cclt::print() const
 }
 
 std::size_t cclt::readCCLTParameter(std::istream& file) {
-	std::cout << "readCCLTParameter not implemented\n";
-	exit(0);
+	base::fail(file, "CCLT", "readCCLTParameter not implemented");
 	return 0;
 }
\ No newline at end of file
@@ -26,6 +26,8 @@
 #include <swgLib/cell.hpp>
 #include <swgLib/base.hpp>
 #include <swgLib/collisionUtil.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -39,44 +41,45 @@ std::size_t cell::read(std::istream& file) {
 	std::size_t cellSize;
 	std::size_t total = base::readFormHeader(file, "CELL", cellSize);
 	cellSize += 8;
-	std::cout << "Found FORM CELL: "
+	SWG_LOG(LOG_INFO) << "Found FORM CELL: "
 		<< cellSize - 12 << " bytes\n";
 
 	std::size_t size;
 	std::string type;
 	total += base::readFormHeader(file, type, size);
 	_version = base::tagToVersion(type);
-	std::cout << "CELL version: " << (int)_version << "\n";
+	SWG_LOG(LOG_INFO) << "CELL version: " << (int)_version << "\n";
 
 	if ((_version < 1) || (_version > 5))
 	{
-		std::cout << "Expected FORM of type 0001, 0002, 0003, 0004, or 0005. Found: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM of type 0001, 0002, 0003, 0004, or 0005. Found: " << type;
+		base::fail(file, type, msg.str());
 	}
 
 	total += base::readRecordHeader(file, "DATA", size);
 
 	total += base::read(file, _numPortals);
-	std::cout << "Num portals: " << _numPortals << "\n";
+	SWG_LOG(LOG_INFO) << "Num portals: " << _numPortals << "\n";
 
 	total += base::read(file, _canSeeParentCell);
-	std::cout << "Can see parent cell: " << std::boolalpha << _canSeeParentCell << "\n";
+	SWG_LOG(LOG_INFO) << "Can see parent cell: " << std::boolalpha << _canSeeParentCell << "\n";
 
 	if (3 < _version) {
 		total += base::read(file, _name);
-		std::cout << "Name: " << _name << "\n";
+		SWG_LOG(LOG_INFO) << "Name: " << _name << "\n";
 	}
 
 	total += base::read(file, _appearanceName);
-	std::cout << "Appearance name: " << _appearanceName << "\n";
+	SWG_LOG(LOG_INFO) << "Appearance name: " << _appearanceName << "\n";
 
 	// Only present in versions 2+
 	if (1 < _version) {
 		total += base::read(file, _hasFloor);
-		std::cout << "Has floor: " << std::boolalpha << _hasFloor << "\n";
+		SWG_LOG(LOG_INFO) << "Has floor: " << std::boolalpha << _hasFloor << "\n";
 
 		total += base::read(file, _floorName);
-		std::cout << "Floor name: " << _floorName << "\n";
+		SWG_LOG(LOG_INFO) << "Floor name: " << _floorName << "\n";
 	}
 
 	// Only present in versions 5+
@@ -94,10 +97,10 @@ std::size_t cell::read(std::istream& file) {
 	// Only present in versions 3+
 	if (2 < _version) {
 		total += base::readRecordHeader(file, "LGHT", size);
-		std::cout << "Found Record LGHT: " << size << " bytes\n";
+		SWG_LOG(LOG_INFO) << "Found Record LGHT: " << size << " bytes\n";
 
 		total += base::read(file, _numLights);
-		std::cout << "Num lights: " << _numLights << "\n";
+		SWG_LOG(LOG_INFO) << "Num lights: " << _numLights << "\n";
 		_lights.resize(_numLights);
 
 		// Read lights...
@@ -108,13 +111,14 @@ std::size_t cell::read(std::istream& file) {
 
 	if (cellSize == total)
 	{
-		std::cout << "Finished reading CELL\n";
+		SWG_LOG(LOG_INFO) << "Finished reading CELL\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading CELL\n";
-		std::cout << "Read " << total << " out of " << cellSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading CELL: ";
+		msg << "Read " << total << " out of " << cellSize;
+		base::fail(file, "CELL", msg.str());
 	}
 
 	return total;
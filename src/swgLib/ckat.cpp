@@ -23,10 +23,13 @@
  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 #include <swgLib/ckat.hpp>
+#include <swgLib/logger.hpp>
 
+#include <iomanip>
 #include <iostream>
 #include <cstdlib>
 #include <bitset>
+#include <sstream>
 
 using namespace ml;
 
@@ -45,7 +48,7 @@ unsigned int ckat::readCKAT(std::istream& file, std::string path,
 	std::size_t ckatSize;
 	std::size_t total = readFormHeader(file, "CKAT", ckatSize);
 	ckatSize += 8;
-	std::cout << std::string(depth, ' ')
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 		<< "Found CKAT form"
 		<< ": " << ckatSize - 12 << " bytes"
 		<< std::endl;
@@ -55,10 +58,11 @@ unsigned int ckat::readCKAT(std::istream& file, std::string path,
 	total += readFormHeader(file, form, size, type);
 	if (form != "FORM")
 	{
-		std::cout << "Expected FORM: " << form << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM: " << form;
+		base::fail(file, form, msg.str());
 	}
-	std::cout << "Found " << form << " " << type
+	SWG_LOG(LOG_INFO) << "Found " << form << " " << type
 		<< ": " << size - 4 << " bytes"
 		<< std::endl;
 
@@ -83,13 +87,13 @@ unsigned int ckat::readCKAT(std::istream& file, std::string path,
 
 	if (ckatSize == total)
 	{
-		std::cout << std::string(depth, ' ')
+		SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 			<< "Finished reading CKAT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading CKAT" << std::endl;
-		std::cout << "Read " << total << " out of " << ckatSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading CKAT" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << ckatSize
 			<< std::endl;
 	}
 
@@ -104,10 +108,11 @@ unsigned int ckat::readINFO(std::istream& file, const unsigned short& depth)
 	infoSize += 8;
 	if (type != "INFO")
 	{
-		std::cout << "Expected record of type INFO: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type INFO: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << std::string(depth, ' ') << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ') << "Found " << type << std::endl;
 
 	float u1;
 	short u2;
@@ -119,7 +124,7 @@ unsigned int ckat::readINFO(std::istream& file, const unsigned short& depth)
 	total += base::read(file, numCHNL);
 	total += base::read(file, numSTRN);
 
-	std::cout << std::string(depth + 1, ' ')
+	SWG_LOG(LOG_INFO) << std::string(depth + 1, ' ')
 		<< "Frames per second?: " << std::fixed << u1 << "\n"
 		<< std::string(depth + 1, ' ')
 		<< "Max bone index: " << u2 << "\n"
@@ -132,13 +137,13 @@ unsigned int ckat::readINFO(std::istream& file, const unsigned short& depth)
 
 	if (infoSize == total)
 	{
-		std::cout << std::string(depth, ' ')
+		SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 			<< "Finished reading INFO" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading INFO" << std::endl;
-		std::cout << "Read " << total << " out of " << infoSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading INFO" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << infoSize
 			<< std::endl;
 	}
 
@@ -151,7 +156,7 @@ unsigned int ckat::readXFRM(std::istream& file, const unsigned short& depth)
 	std::size_t xfrmSize;
 	std::size_t total = readFormHeader(file, "XFRM", xfrmSize);
 	xfrmSize += 8;
-	std::cout << std::string(depth, ' ')
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 		<< "Found XFRM form"
 		<< ": " << xfrmSize - 12 << " bytes"
 		<< std::endl;
@@ -164,13 +169,13 @@ unsigned int ckat::readXFRM(std::istream& file, const unsigned short& depth)
 
 	if (xfrmSize == total)
 	{
-		std::cout << std::string(depth, ' ')
+		SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 			<< "Finished reading XFRM" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading XFRM" << std::endl;
-		std::cout << "Read " << total << " out of " << xfrmSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading XFRM" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << xfrmSize
 			<< std::endl;
 	}
 
@@ -183,7 +188,7 @@ unsigned int ckat::readAROT(std::istream& file, const unsigned short& depth)
 	std::size_t arotSize;
 	std::size_t total = readFormHeader(file, "AROT", arotSize);
 	arotSize += 8;
-	std::cout << std::string(depth, ' ')
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 		<< "Found AROT form"
 		<< ": " << arotSize - 12 << " bytes"
 		<< std::endl;
@@ -195,13 +200,13 @@ unsigned int ckat::readAROT(std::istream& file, const unsigned short& depth)
 
 	if (arotSize == total)
 	{
-		std::cout << std::string(depth, ' ')
+		SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 			<< "Finished reading AROT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading AROT" << std::endl;
-		std::cout << "Read " << total << " out of " << arotSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading AROT" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << arotSize
 			<< std::endl;
 	}
 
@@ -216,10 +221,11 @@ unsigned int ckat::readSROT(std::istream& file, const unsigned short& depth)
 	srotSize += 8;
 	if (type != "SROT")
 	{
-		std::cout << "Expected record of type SROT: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type SROT: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << std::string(depth, ' ')
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 		<< "Found " << type << ": " << srotSize - 8 << " bytes"
 		<< std::endl;
 
@@ -227,17 +233,17 @@ unsigned int ckat::readSROT(std::istream& file, const unsigned short& depth)
 	{
 		unsigned char u3;
 		total += base::read(file, u3);
-		std::cout << std::string(depth, ' ') << (u3 / 255.0) << " ";
+		SWG_LOG(LOG_DEBUG) << std::string(depth, ' ') << (u3 / 255.0) << " ";
 
 		total += base::read(file, u3);
-		std::cout << (u3 / 255.0) << " ";
+		SWG_LOG(LOG_DEBUG) << (u3 / 255.0) << " ";
 
 		total += base::read(file, u3);
-		std::cout << (u3 / 255.0) << " ";
+		SWG_LOG(LOG_DEBUG) << (u3 / 255.0) << " ";
 
 		float u1;
 		total += base::read(file, u1);
-		std::cout << u1 << std::endl;
+		SWG_LOG(LOG_DEBUG) << u1 << std::endl;
 
 	}
 
@@ -245,13 +251,13 @@ unsigned int ckat::readSROT(std::istream& file, const unsigned short& depth)
 
 	if (srotSize == total)
 	{
-		std::cout << std::string(depth, ' ')
+		SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 			<< "Finished reading SROT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading SROT" << std::endl;
-		std::cout << "Read " << total << " out of " << srotSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading SROT" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << srotSize
 			<< std::endl;
 	}
 
@@ -264,7 +270,7 @@ unsigned int ckat::readATRN(std::istream& file, const unsigned short& depth)
 	std::size_t atrnSize;
 	std::size_t total = readFormHeader(file, "ATRN", atrnSize);
 	atrnSize += 8;
-	std::cout << std::string(depth, ' ')
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 		<< "Found ATRN form"
 		<< ": " << atrnSize - 12 << " bytes"
 		<< std::endl;
@@ -277,13 +283,13 @@ unsigned int ckat::readATRN(std::istream& file, const unsigned short& depth)
 
 	if (atrnSize == total)
 	{
-		std::cout << std::string(depth, ' ')
+		SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 			<< "Finished reading ATRN" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading ATRN" << std::endl;
-		std::cout << "Read " << total << " out of " << atrnSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading ATRN" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << atrnSize
 			<< std::endl;
 	}
 
@@ -298,10 +304,11 @@ unsigned int ckat::readSTRN(std::istream& file, const unsigned short& depth)
 	strnSize += 8;
 	if (type != "STRN")
 	{
-		std::cout << "Expected record of type STRN: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type STRN: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << std::string(depth, ' ')
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 		<< "Found " << type << ": " << strnSize - 8 << " bytes"
 		<< std::endl;
 
@@ -309,20 +316,20 @@ unsigned int ckat::readSTRN(std::istream& file, const unsigned short& depth)
 	for (unsigned int i = 0; i < numSTRN; ++i)
 	{
 		total += base::read(file, u1);
-		std::cout << std::string(depth + 1, ' ') << u1 << std::endl;
+		SWG_LOG(LOG_DEBUG) << std::string(depth + 1, ' ') << u1 << std::endl;
 	}
 
 	total += readUnknown(file, strnSize - total);
 
 	if (strnSize == total)
 	{
-		std::cout << std::string(depth, ' ')
+		SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 			<< "Finished reading STRN" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading STRN" << std::endl;
-		std::cout << "Read " << total << " out of " << strnSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading STRN" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << strnSize
 			<< std::endl;
 	}
 
@@ -337,51 +344,52 @@ unsigned int ckat::readXFIN(std::istream& file, const unsigned short& depth)
 	xfinSize += 8;
 	if (type != "XFIN")
 	{
-		std::cout << "Expected record of type XFIN: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type XFIN: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << std::string(depth, ' ')
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 		<< "Found " << type << ": " << xfinSize - 8 << " bytes"
 		<< std::endl;
 
 	std::string name;
 	total += base::read(file, name);
-	std::cout << std::string(depth + 1, ' ') << "Name: " << name << std::endl;
+	SWG_LOG(LOG_INFO) << std::string(depth + 1, ' ') << "Name: " << name << std::endl;
 
 	char u2;
 	total += base::read(file, u2);
-	std::cout << std::string(depth + 1, ' ')
+	SWG_LOG(LOG_INFO) << std::string(depth + 1, ' ')
 		<< "Bone group?: " << (int)u2 << std::endl;
 
 	total += base::read(file, u2);
-	std::cout << std::string(depth + 1, ' ')
+	SWG_LOG(LOG_INFO) << std::string(depth + 1, ' ')
 		<< "Bone number: " << (int)u2 << std::endl;
 
 	total += base::read(file, u2);
-	std::cout << std::string(depth + 1, ' ') << (int)u2 << std::endl;
+	SWG_LOG(LOG_INFO) << std::string(depth + 1, ' ') << (int)u2 << std::endl;
 
 	total += base::read(file, u2);
-	std::cout << std::string(depth + 1, ' ') << (int)u2 << std::endl;
+	SWG_LOG(LOG_INFO) << std::string(depth + 1, ' ') << (int)u2 << std::endl;
 
 	short u1;
 	total += base::read(file, u1);
-	std::cout << std::string(depth + 1, ' ') << "STRN index: " << u1 << std::endl;
+	SWG_LOG(LOG_INFO) << std::string(depth + 1, ' ') << "STRN index: " << u1 << std::endl;
 
 	total += base::read(file, u1);
-	std::cout << std::string(depth + 1, ' ') << "STRN index: " << u1 << std::endl;
+	SWG_LOG(LOG_INFO) << std::string(depth + 1, ' ') << "STRN index: " << u1 << std::endl;
 
 	total += base::read(file, u1);
-	std::cout << std::string(depth + 1, ' ') << "STRN index: " << u1 << std::endl;
+	SWG_LOG(LOG_INFO) << std::string(depth + 1, ' ') << "STRN index: " << u1 << std::endl;
 
 	if (xfinSize == total)
 	{
-		std::cout << std::string(depth, ' ')
+		SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 			<< "Finished reading XFIN" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading XFIN" << std::endl;
-		std::cout << "Read " << total << " out of " << xfinSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading XFIN" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << xfinSize
 			<< std::endl;
 	}
 
@@ -396,31 +404,32 @@ unsigned int ckat::readQCHN(std::istream& file, const unsigned short& depth)
 	qchnSize += 8;
 	if (type != "QCHN")
 	{
-		std::cout << "Expected record of type QCHN: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type QCHN: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << std::string(depth, ' ')
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 		<< "Found " << type << ": " << qchnSize - 8 << " bytes"
 		<< std::endl;
 
 	unsigned short num;
 	total += base::read(file, num);
-	std::cout << std::string(depth + 1, ' ')
+	SWG_LOG(LOG_INFO) << std::string(depth + 1, ' ')
 		<< "Num bones: " << (int)num << std::endl;
 
 	unsigned char u1;
 	/*
 	total += base::read( file, u1 );
-	std::cout << std::string( depth+1, ' ' ) << (int)u1 << std::endl;
+	SWG_LOG(LOG_INFO) << std::string( depth+1, ' ' ) << (int)u1 << std::endl;
 	*/
 	total += base::read(file, u1);
-	std::cout << std::string(depth + 1, ' ') << std::bitset<8>(u1) << std::endl;
+	SWG_LOG(LOG_INFO) << std::string(depth + 1, ' ') << std::bitset<8>(u1) << std::endl;
 
 	total += base::read(file, u1);
-	std::cout << std::string(depth + 1, ' ') << std::bitset<8>(u1) << std::endl;
+	SWG_LOG(LOG_INFO) << std::string(depth + 1, ' ') << std::bitset<8>(u1) << std::endl;
 
 	total += base::read(file, u1);
-	std::cout << std::string(depth + 1, ' ') << std::bitset<8>(u1) << std::endl;
+	SWG_LOG(LOG_INFO) << std::string(depth + 1, ' ') << std::bitset<8>(u1) << std::endl;
 
 	keyframe newKey;
 
@@ -438,30 +447,30 @@ unsigned int ckat::readQCHN(std::istream& file, const unsigned short& depth)
 		quat newQuat(x / 255.0f, y / 255.0f, z / 255.0f, w / 255.0f);
 		newKey.quatMap[bone] = newQuat;
 #if 0
-		std::cout << std::string(depth + 1, ' ') << "Bone " << bone << ": ";
+		SWG_LOG(LOG_DEBUG) << std::string(depth + 1, ' ') << "Bone " << bone << ": ";
 #if 1
-		std::cout << (x / 255.0) << ", ";
-		std::cout << (y / 255.0) << ", ";
-		std::cout << (z / 255.0) << ", ";
-		std::cout << (w / 255.0) << std::endl;
+		SWG_LOG(LOG_DEBUG) << (x / 255.0) << ", ";
+		SWG_LOG(LOG_DEBUG) << (y / 255.0) << ", ";
+		SWG_LOG(LOG_DEBUG) << (z / 255.0) << ", ";
+		SWG_LOG(LOG_DEBUG) << (w / 255.0) << std::endl;
 #else
-		std::cout << (x / 128.0) << ", ";
-		std::cout << (y / 128.0) << ", ";
-		std::cout << (z / 128.0) << ", ";
-		std::cout << (w / 128.0) << std::endl;
+		SWG_LOG(LOG_DEBUG) << (x / 128.0) << ", ";
+		SWG_LOG(LOG_DEBUG) << (y / 128.0) << ", ";
+		SWG_LOG(LOG_DEBUG) << (z / 128.0) << ", ";
+		SWG_LOG(LOG_DEBUG) << (w / 128.0) << std::endl;
 #endif
 #else
-		std::cout << std::string(depth + 1, ' ') << "Bone ";
-		std::cout.width(2);
-		std::cout << bone << ": ";
-		std::cout.width(4);
-		std::cout << (int)x << ", ";
-		std::cout.width(4);
-		std::cout << (int)y << ", ";
-		std::cout.width(4);
-		std::cout << (int)z << ", ";
-		std::cout.width(4);
-		std::cout << (int)w << std::endl;
+		SWG_LOG(LOG_DEBUG) << std::string(depth + 1, ' ') << "Bone ";
+		SWG_LOG(LOG_DEBUG) << std::setw(2);
+		SWG_LOG(LOG_DEBUG) << bone << ": ";
+		SWG_LOG(LOG_DEBUG) << std::setw(4);
+		SWG_LOG(LOG_DEBUG) << (int)x << ", ";
+		SWG_LOG(LOG_DEBUG) << std::setw(4);
+		SWG_LOG(LOG_DEBUG) << (int)y << ", ";
+		SWG_LOG(LOG_DEBUG) << std::setw(4);
+		SWG_LOG(LOG_DEBUG) << (int)z << ", ";
+		SWG_LOG(LOG_DEBUG) << std::setw(4);
+		SWG_LOG(LOG_DEBUG) << (int)w << std::endl;
 #endif
 	}
 	keyframeList.push_back(newKey);
@@ -470,13 +479,13 @@ unsigned int ckat::readQCHN(std::istream& file, const unsigned short& depth)
 
 	if (qchnSize == total)
 	{
-		std::cout << std::string(depth, ' ')
+		SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 			<< "Finished reading QCHN" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading QCHN" << std::endl;
-		std::cout << "Read " << total << " out of " << qchnSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading QCHN" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << qchnSize
 			<< std::endl;
 	}
 
@@ -489,7 +498,7 @@ unsigned int ckat::readMSGS(std::istream& file, const unsigned short& depth)
 	std::size_t msgsSize;
 	std::size_t total = readFormHeader(file, "MSGS", msgsSize);
 	msgsSize += 8;
-	std::cout << std::string(depth, ' ')
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 		<< "Found MSGS form"
 		<< ": " << msgsSize - 12 << " bytes"
 		<< std::endl;
@@ -499,16 +508,17 @@ unsigned int ckat::readMSGS(std::istream& file, const unsigned short& depth)
 	infoSize += 8;
 	if (type != "INFO")
 	{
-		std::cout << "Expected record of type INFO: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type INFO: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << std::string(depth, ' ')
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 		<< "Found " << type << ": " << infoSize - 8 << " bytes"
 		<< std::endl;
 
 	unsigned short numMESG;
 	total += base::read(file, numMESG);
-	std::cout << std::string(depth, ' ')
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 		<< "Num MESG: " << numMESG << std::endl;
 
 	for (unsigned short i = 0; i < numMESG; ++i)
@@ -518,13 +528,13 @@ unsigned int ckat::readMSGS(std::istream& file, const unsigned short& depth)
 
 	if (msgsSize == total)
 	{
-		std::cout << std::string(depth, ' ')
+		SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 			<< "Finished reading MSGS" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading MSGS" << std::endl;
-		std::cout << "Read " << total << " out of " << msgsSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading MSGS" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << msgsSize
 			<< std::endl;
 	}
 
@@ -539,37 +549,38 @@ unsigned int ckat::readMESG(std::istream& file, const unsigned short& depth)
 	mesgSize += 8;
 	if (type != "MESG")
 	{
-		std::cout << "Expected record of type MESG: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type MESG: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << std::string(depth, ' ')
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 		<< "Found " << type << ": " << mesgSize - 8 << " bytes"
 		<< std::endl;
 
 	unsigned short num;
 	total += base::read(file, num);
-	std::cout << std::string(depth, ' ') << "Num: " << num << std::endl;
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ') << "Num: " << num << std::endl;
 
 	std::string name;
 	total += base::read(file, name);
-	std::cout << std::string(depth, ' ') << name << std::endl;
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ') << name << std::endl;
 
 	unsigned short u1;
 	for (unsigned i = 0; i < num; ++i)
 	{
 		total += base::read(file, u1);
-		std::cout << std::string(depth, ' ') << u1 << std::endl;
+		SWG_LOG(LOG_DEBUG) << std::string(depth, ' ') << u1 << std::endl;
 	}
 
 	if (mesgSize == total)
 	{
-		std::cout << std::string(depth, ' ')
+		SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 			<< "Finished reading MESG" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading MESG" << std::endl;
-		std::cout << "Read " << total << " out of " << mesgSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading MESG" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << mesgSize
 			<< std::endl;
 	}
 
@@ -584,25 +595,26 @@ unsigned int ckat::readLOCT(std::istream& file, const unsigned short& depth)
 	loctSize += 8;
 	if (type != "LOCT")
 	{
-		std::cout << "Expected record of type LOCT: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type LOCT: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << std::string(depth, ' ')
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 		<< "Found " << type << ": " << loctSize - 8 << " bytes"
 		<< std::endl;
 
 	unsigned char u1;
 	total += base::read(file, u1);
-	std::cout << std::string(depth, ' ') << (int)u1 << std::endl;
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ') << (int)u1 << std::endl;
 	total += base::read(file, u1);
-	std::cout << std::string(depth, ' ') << (int)u1 << std::endl;
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ') << (int)u1 << std::endl;
 	total += base::read(file, u1);
-	std::cout << std::string(depth, ' ') << (int)u1 << std::endl;
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ') << (int)u1 << std::endl;
 	total += base::read(file, u1);
-	std::cout << std::string(depth, ' ') << (int)u1 << std::endl;
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ') << (int)u1 << std::endl;
 	unsigned short num;
 	total += base::read(file, num);
-	std::cout << std::string(depth, ' ') << "Num: " << num << std::endl;
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ') << "Num: " << num << std::endl;
 	//total += base::read( file, u1 );
 	//std::cout << std::string( depth, ' ' ) << (int)u1 << std::endl;
 
@@ -613,22 +625,22 @@ unsigned int ckat::readLOCT(std::istream& file, const unsigned short& depth)
 	for (unsigned int i = 0; i < num; ++i)
 	{
 		total += base::read(file, u2);
-		std::cout << std::string(depth, ' ') << (int)u2 << " ";
+		SWG_LOG(LOG_DEBUG) << std::string(depth, ' ') << (int)u2 << " ";
 
 		total += base::read(file, u4);
-		std::cout << std::string(depth, ' ') << u4 << " ";
+		SWG_LOG(LOG_DEBUG) << std::string(depth, ' ') << u4 << " ";
 
 		total += base::read(file, u4);
-		std::cout << std::string(depth, ' ') << u4 << " ";
+		SWG_LOG(LOG_DEBUG) << std::string(depth, ' ') << u4 << " ";
 
 		total += base::read(file, u4);
-		std::cout << std::string(depth, ' ') << u4 << " ";
+		SWG_LOG(LOG_DEBUG) << std::string(depth, ' ') << u4 << " ";
 
 		total += base::read(file, u4);
-		std::cout << std::string(depth, ' ') << u4 << " ";
+		SWG_LOG(LOG_DEBUG) << std::string(depth, ' ') << u4 << " ";
 
 		total += base::read(file, u3);
-		std::cout << std::string(depth, ' ') << u3 << std::endl;
+		SWG_LOG(LOG_DEBUG) << std::string(depth, ' ') << u3 << std::endl;
 	}
 #else
 	total += readUnknown(file, loctSize - total);
@@ -636,13 +648,13 @@ unsigned int ckat::readLOCT(std::istream& file, const unsigned short& depth)
 
 	if (loctSize == total)
 	{
-		std::cout << std::string(depth, ' ')
+		SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 			<< "Finished reading LOCT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading LOCT" << std::endl;
-		std::cout << "Read " << total << " out of " << loctSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading LOCT" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << loctSize
 			<< std::endl;
 	}
 
@@ -657,49 +669,50 @@ unsigned int ckat::readCHNL(std::istream& file, const unsigned short& depth)
 	chnlSize += 8;
 	if (type != "CHNL")
 	{
-		std::cout << "Expected record of type CHNL: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type CHNL: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << std::string(depth, ' ')
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 		<< "Found " << type << ": " << chnlSize - 8 << " bytes"
 		<< std::endl;
 
 	unsigned short num;
 	total += base::read(file, num);
-	std::cout << std::string(depth, ' ') << "Num: " << num << std::endl;
+	SWG_LOG(LOG_INFO) << std::string(depth, ' ') << "Num: " << num << std::endl;
 	unsigned char u1;
 	short u2;
 	for (unsigned int i = 0; i < num; ++i)
 	{
 		total += base::read(file, u2);
-		std::cout << std::string(depth, ' ') << u2 << " ";
+		SWG_LOG(LOG_DEBUG) << std::string(depth, ' ') << u2 << " ";
 
 		total += base::read(file, u1);
-		std::cout << (u1 / 255.0) << " ";
+		SWG_LOG(LOG_DEBUG) << (u1 / 255.0) << " ";
 
 		total += base::read(file, u1);
-		std::cout << (u1 / 255.0) << " ";
+		SWG_LOG(LOG_DEBUG) << (u1 / 255.0) << " ";
 
 		total += base::read(file, u1);
-		std::cout << (u1 / 255.0) << " ";
+		SWG_LOG(LOG_DEBUG) << (u1 / 255.0) << " ";
 
 		total += base::read(file, u1);
-		std::cout << (u1 / 255.0) << " ";
+		SWG_LOG(LOG_DEBUG) << (u1 / 255.0) << " ";
 
-		std::cout << std::endl;
+		SWG_LOG(LOG_DEBUG) << std::endl;
 	}
 
 	//total += readUnknown( file, chnlSize - total );
 
 	if (chnlSize == total)
 	{
-		std::cout << std::string(depth, ' ')
+		SWG_LOG(LOG_INFO) << std::string(depth, ' ')
 			<< "Finished reading CHNL" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading CHNL" << std::endl;
-		std::cout << "Read " << total << " out of " << chnlSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading CHNL" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << chnlSize
 			<< std::endl;
 	}
 
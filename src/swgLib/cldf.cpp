@@ -25,9 +25,11 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/cldf.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -44,7 +46,7 @@ std::size_t cldf::read(std::istream& file)
 	std::size_t cldfSize;
 	std::size_t total = base::readFormHeader(file, "CLDF", cldfSize);
 	cldfSize += 8;
-	std::cout << "Found form CLDF: " << cldfSize << "\n";
+	SWG_LOG(LOG_INFO) << "Found form CLDF: " << cldfSize << "\n";
 
 	std::size_t size;
 	total += base::readFormHeader(file, "0000", size);
@@ -106,8 +108,9 @@ std::size_t cldf::read(std::istream& file)
 			}
 #endif
 			else {
-				std::cout << "Unhandled FORM type: " << type << "\n";
-				exit(0);
+				std::ostringstream msg;
+				msg << "Unhandled FORM type: " << type;
+				base::fail(file, type, msg.str());
 			}
 		}
 		else if ("ASND" == form) {
@@ -157,18 +160,20 @@ std::size_t cldf::read(std::istream& file)
 		}
 #endif
 		else {
-			std::cout << "Unhandled form: " << form << "\n";
-			exit(0);
+			std::ostringstream msg;
+			msg << "Unhandled form: " << form;
+			base::fail(file, form, msg.str());
 		}
 	}
 
 	if (cldfSize == total) {
-		std::cout << "Finished reading CLDF\n";
+		SWG_LOG(LOG_INFO) << "Finished reading CLDF\n";
 	}
 	else {
-		std::cout << "FAILED in reading CLDF\n"
-			<< "Read " << total << " out of " << cldfSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading CLDF: "
+			<< "Read " << total << " out of " << cldfSize;
+		base::fail(file, "CLDF", msg.str());
 	}
 
 	return total;
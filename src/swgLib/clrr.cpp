@@ -24,10 +24,12 @@
 */
 #include <swgLib/clrr.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <bitset>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -44,17 +46,18 @@ std::size_t clrr::read(std::istream& file)
 	std::size_t clrrSize;
 	std::size_t total = base::readFormHeader(file, "CLRR", clrrSize);
 	clrrSize += 8;
-	std::cout << "Found FORM CLRR: " << clrrSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM CLRR: " << clrrSize - 12 << " bytes\n";
 
 	std::string type;
 	std::size_t size;
 	total += base::readRecordHeader(file, type, size);
 	_version = base::tagToVersion(type);
 	if (_version > 1) {
-		std::cout << "Expected type [0000..0001]: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0000..0001]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Color Ramp Version: " << _version << "\n";
+	SWG_LOG(LOG_INFO) << "Color Ramp Version: " << _version << "\n";
 
 	total += base::read(file, _interpolationType);
 	if (_version > 0) {
@@ -71,13 +74,14 @@ std::size_t clrr::read(std::istream& file)
 	}
 
 	if (clrrSize == total) {
-		std::cout << "Finished reading CLRR\n";
+		SWG_LOG(LOG_INFO) << "Finished reading CLRR\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading CLRR\n"
-			<< "Read " << total << " out of " << clrrSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading CLRR: "
+			<< "Read " << total << " out of " << clrrSize;
+		base::fail(file, "CLRR", msg.str());
 	}
 
 	return total;
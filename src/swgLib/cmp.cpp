@@ -25,14 +25,20 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/cmp.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <bitset>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
-cmp::cmp() : appr::appr(), _hasRadar(false)
+cmp::cmp() : appr::appr(),
+	_cmpVersion(0),
+	_hasRadar(false),
+	_versionChunk(iffIndex::npos),
+	_partsLoaded(true)
 {
 }
 
@@ -40,32 +46,158 @@ cmp::~cmp()
 {
 }
 
-uint32_t cmp::getNumParts() const { return (uint32_t)_parts.size(); }
+cmp::cmp(const cmp& other) : cmp()
+{
+	*this = other;
+}
+
+cmp& cmp::operator=(const cmp& other)
+{
+	if (this == &other)
+	{
+		return *this;
+	}
+
+	// A decode in progress on other must not be copied half done
+	std::lock_guard<std::mutex> lock(other._partsMutex);
+
+	appr::operator=(other);
+	_cmpVersion = other._cmpVersion;
+	_parts = other._parts;
+	_hasRadar = other._hasRadar;
+	_radar = other._radar;
+	_index = other._index;
+	_versionChunk = other._versionChunk;
+	_partsLoaded.store(other._partsLoaded.load(std::memory_order_relaxed),
+		std::memory_order_relaxed);
+
+	return *this;
+}
+
+uint32_t cmp::getVersion() const { return _cmpVersion; }
+
+uint32_t cmp::getNumParts() const {
+	loadParts();
+	return (uint32_t)_parts.size();
+}
 
 const cmp::part& cmp::getPart(const uint32_t& index) const {
+	loadParts();
 	return _parts.at(index);
 }
 
 const std::vector<cmp::part>& cmp::getParts() const {
+	loadParts();
 	return _parts;
 }
 
+bool cmp::open(std::istream& file)
+{
+	if (!_index.load(file))
+	{
+		SWG_LOG(LOG_ERROR) << "Failed to index CMPA form\n";
+		return false;
+	}
+	return openIndex();
+}
+
+bool cmp::open(const char* data, const std::size_t& size)
+{
+	if (!_index.build(data, size))
+	{
+		SWG_LOG(LOG_ERROR) << "Failed to index CMPA form\n";
+		return false;
+	}
+	return openIndex();
+}
+
+bool cmp::openIndex()
+{
+	_parts.clear();
+	_partsLoaded = true;
+
+	if (_index.empty() || (iffIndex::tagFromStr("CMPA") != _index.at(0).type))
+	{
+		SWG_LOG(LOG_INFO) << "Expected CMPA form\n";
+		return false;
+	}
+
+	_versionChunk = _index.firstChild(0);
+	if (iffIndex::npos == _versionChunk)
+	{
+		return false;
+	}
+
+	_cmpVersion = base::tagToVersion(base::tagToStr(_index.at(_versionChunk).type));
+	if ((_cmpVersion < 1) || (_cmpVersion > 5))
+	{
+		SWG_LOG(LOG_WARNING) << "Unhandled CMPA version: " << (int)_cmpVersion << "\n";
+		return false;
+	}
+
+	_partsLoaded = false;
+	return true;
+}
+
+void cmp::loadParts() const
+{
+	if (_partsLoaded.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(_partsMutex);
+	if (_partsLoaded.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	// Start over if an earlier attempt threw part way through
+	_parts.clear();
+
+	const uint32_t partTag = iffIndex::tagFromStr("PART");
+	for (uint32_t i = _index.firstChild(_versionChunk); iffIndex::npos != i;
+		i = _index.nextSibling(i))
+	{
+		if (partTag != _index.at(i).tag)
+		{
+			continue;
+		}
+
+		iffReader reader = _index.reader(i);
+		if (1 == _cmpVersion)
+		{
+			readPARTv1(reader);
+		}
+		else
+		{
+			readPART(reader);
+		}
+	}
+
+	_partsLoaded.store(true, std::memory_order_release);
+}
+
 std::size_t cmp::read(std::istream& file)
 {
+	_parts.clear();
+	_partsLoaded = true;
+
 	std::size_t cmpSize;
 	std::size_t total = base::readFormHeader(file, "CMPA", cmpSize);
 	cmpSize += 8;
-	std::cout << "Found form CMPA: " << cmpSize << "\n";
+	SWG_LOG(LOG_INFO) << "Found form CMPA: " << cmpSize << "\n";
 
 	std::string form, type;
 	std::size_t size;
 	base::peekHeader(file, form, size, type);
 	_cmpVersion = base::tagToVersion(type);
 	if ((_cmpVersion < 1) || (_cmpVersion > 5)) {
-		std::cout << "Expected FORM of type 0001, 0002, 0003, 0004, or 0005. Found: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM of type 0001, 0002, 0003, 0004, or 0005. Found: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "CMPA version: " << (int)_cmpVersion << "\n";
+	SWG_LOG(LOG_INFO) << "CMPA version: " << (int)_cmpVersion << "\n";
 
 	switch (_cmpVersion) {
 	case 1: total += readCMPv1(file); break;
@@ -74,19 +206,22 @@ std::size_t cmp::read(std::istream& file)
 	case 4: total += readCMPv4(file); break;
 	case 5: total += readCMPv5(file); break;
 	default:
-		std::cout << "Unhandled CMPA version: " << (int)_cmpVersion << "\n";
-		exit(0);
+		{
+			std::ostringstream msg;
+			msg << "Unhandled CMPA version: " << (int)_cmpVersion;
+			base::fail(file, "CMPA", msg.str());
+		}
 	}
 
 	if (cmpSize == total) {
-		std::cout << "Finished reading CMPA\n";
+		SWG_LOG(LOG_INFO) << "Finished reading CMPA\n";
 	}
 	else
 	{
-		std::cout << "Failed in reading CMPA\n"
-			<< "Read " << total << " out of " << cmpSize
-			<< "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading CMPA: "
+			<< "Read " << total << " out of " << cmpSize;
+		base::fail(file, "CMPA", msg.str());
 	}
 
 	return total;
@@ -100,25 +235,16 @@ std::size_t cmp::readCMPv1(std::istream& file)
 
 	// Load all parts
 	while (total < size0001) {
-		std::size_t size;
-		total += base::readRecordHeader(file, "PART", size);
-		part newPart;
-		total += base::read(file, newPart.filename);
-		newPart.filename = std::string("appearance/") + newPart.filename;
-		std::cout << "Part: " << newPart.filename << std::endl;
-
-		newPart.validTransform = false;
-		total += base::read(file, newPart.position);
-		total += base::read(file, newPart.yawPitchRoll);
-		std::cout << "Position: " << newPart.position << "\n"
-			<< "Yaw, Pitch, Roll: " << newPart.yawPitchRoll << "\n";
+		iffReader reader;
+		reader.load(file);
+		total += readPARTv1(reader);
 	}
 
 	if (size0001 != total) {
-		std::cout << "Failed in reading 0001\n"
-			<< "Read " << total << " out of " << size0001
-			<< "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0001: "
+			<< "Read " << total << " out of " << size0001;
+		base::fail(file, "0001", msg.str());
 	}
 
 	return total;
@@ -136,10 +262,10 @@ std::size_t cmp::readCMPv2(std::istream& file)
 	}
 
 	if (size0002 != total) {
-		std::cout << "Failed in reading 0002\n"
-			<< "Read " << total << " out of " << size0002
-			<< "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0002: "
+			<< "Read " << total << " out of " << size0002;
+		base::fail(file, "0002", msg.str());
 	}
 
 	return total;
@@ -160,10 +286,10 @@ std::size_t cmp::readCMPv3(std::istream& file)
 	}
 
 	if (size0003 != total) {
-		std::cout << "Failed in reading 0003\n"
-			<< "Read " << total << " out of " << size0003
-			<< "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0003: "
+			<< "Read " << total << " out of " << size0003;
+		base::fail(file, "0003", msg.str());
 	}
 
 	return total;
@@ -186,10 +312,10 @@ std::size_t cmp::readCMPv4(std::istream& file)
 	// TODO: Create test shape?
 
 	if (size0004 != total) {
-		std::cout << "Failed in reading 0004\n"
-			<< "Read " << total << " out of " << size0004
-			<< "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0004: "
+			<< "Read " << total << " out of " << size0004;
+		base::fail(file, "0004", msg.str());
 	}
 
 	return total;
@@ -215,16 +341,23 @@ std::size_t cmp::readCMPv5(std::istream& file)
 	// TODO: Create test shape?
 
 	if (size0005 != total) {
-		std::cout << "Failed in reading 0005\n"
-			<< "Read " << total << " out of " << size0005
-			<< "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0005: "
+			<< "Read " << total << " out of " << size0005;
+		base::fail(file, "0005", msg.str());
 	}
 
 	return total;
 }
 
 std::size_t cmp::readPART(std::istream& file)
+{
+	iffReader reader;
+	reader.load(file);
+	return readPART(reader);
+}
+
+std::size_t cmp::readPART(iffReader& file) const
 {
 	std::size_t partSize;
 	std::size_t total = base::readRecordHeader(file, "PART", partSize);
@@ -234,19 +367,49 @@ std::size_t cmp::readPART(std::istream& file)
 
 	total += base::read(file, newPart.filename);
 	newPart.filename = std::string("appearance/") + newPart.filename;
-	std::cout << "Part: " << newPart.filename << "\n";
+	SWG_LOG(LOG_INFO) << "Part: " << newPart.filename << "\n";
 
 	// Read 3x4 transform matrix
 	newPart.validTransform = true;
-	total += newPart.transform.read(file);
-	std::cout << "Matrix: \n" << newPart.transform << "\n";
+	total += base::read(file, newPart.transform);
+	SWG_LOG(LOG_INFO) << "Matrix: \n" << newPart.transform << "\n";
+
+	_parts.push_back(newPart);
+
+	if (partSize != total) {
+		std::ostringstream msg;
+		msg << "FAILED in reading PART: "
+			<< "Read " << total << " out of " << partSize;
+		base::fail(file, "PART", msg.str());
+	}
+
+	return total;
+}
+
+std::size_t cmp::readPARTv1(iffReader& file) const
+{
+	std::size_t partSize;
+	std::size_t total = base::readRecordHeader(file, "PART", partSize);
+	partSize += 8;
+
+	part newPart;
+	total += base::read(file, newPart.filename);
+	newPart.filename = std::string("appearance/") + newPart.filename;
+	SWG_LOG(LOG_INFO) << "Part: " << newPart.filename << std::endl;
+
+	newPart.validTransform = false;
+	total += base::read(file, newPart.position);
+	total += base::read(file, newPart.yawPitchRoll);
+	SWG_LOG(LOG_INFO) << "Position: " << newPart.position << "\n"
+		<< "Yaw, Pitch, Roll: " << newPart.yawPitchRoll << "\n";
 
 	_parts.push_back(newPart);
 
 	if (partSize != total) {
-		std::cout << "FAILED in reading PART\n"
-			<< "Read " << total << " out of " << partSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading PART: "
+			<< "Read " << total << " out of " << partSize;
+		base::fail(file, "PART", msg.str());
 	}
 
 	return total;
@@ -264,19 +427,20 @@ std::size_t cmp::readRADR(std::istream& file)
 	uint32_t hasRadar;
 	total += base::read(file, hasRadar);
 	_hasRadar = (hasRadar > 0);
-	std::cout << "Has Radar: " << std::boolalpha << _hasRadar << "\n";
+	SWG_LOG(LOG_INFO) << "Has Radar: " << std::boolalpha << _hasRadar << "\n";
 
 	if (_hasRadar) {
 		total += _radar.read(file);
 	}
 
 	if (radrSize == total) {
-		std::cout << "Finished reading RADR\n";
+		SWG_LOG(LOG_INFO) << "Finished reading RADR\n";
 	}
 	else {
-		std::cout << "Failed in reading RADR\n"
-			<< "Read " << total << " out of " << radrSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading RADR: "
+			<< "Read " << total << " out of " << radrSize;
+		base::fail(file, "RADR", msg.str());
 	}
 
 	return total;
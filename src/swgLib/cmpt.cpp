@@ -25,6 +25,8 @@
 
 #include <swgLib/cmpt.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -38,23 +40,24 @@ std::size_t cmpt::read(std::istream& file) {
 	std::size_t cmptSize;
 	std::size_t total = base::readFormHeader(file, "CMPT", cmptSize);
 	cmptSize += 8;
-	std::cout << "Found FORM CMPT: " << cmptSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM CMPT: " << cmptSize - 12 << " bytes\n";
 
 	std::size_t size;
 	total += base::readFormHeader(file, "0000", size);
-	std::cout << "Found FORM 0000: " << size - 4 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM 0000: " << size - 4 << " bytes\n";
 
 	total += cpst::read(file);
 
 	if (cmptSize == total)
 	{
-		std::cout << "Finished reading CMPT\n";
+		SWG_LOG(LOG_INFO) << "Finished reading CMPT\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading CMPT\n"
-			<< "Read " << total << " out of " << cmptSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading CMPT: "
+			<< "Read " << total << " out of " << cmptSize;
+		base::fail(file, "CMPT", msg.str());
 	}
 
 	return total;
@@ -25,6 +25,7 @@
 
 #include <swgLib/cmsh.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 
 using namespace ml;
 
@@ -38,25 +39,25 @@ std::size_t cmsh::read(std::istream& file) {
 	std::size_t cmshSize;
 	std::size_t total = base::readFormHeader(file, "CMSH", cmshSize);
 	cmshSize += 8;
-	std::cout << "Found FORM CMSH: "
+	SWG_LOG(LOG_INFO) << "Found FORM CMSH: "
 		<< cmshSize - 12 << " bytes\n";
 
 	std::size_t size;
 	std::string form, type;
 	total += base::readFormHeader(file, "0000", size );
 
-	std::cout << "Found FORM 0000: " << size - 4 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM 0000: " << size - 4 << " bytes\n";
 
 	total += _idtl.read(file);
 
 	if (cmshSize == total)
 	{
-		std::cout << "Finished reading CMSH" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading CMSH" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading CMSH" << std::endl;
-		std::cout << "Read " << total << " out of " << cmshSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading CMSH" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << cmshSize
 			<< std::endl;
 	}
 
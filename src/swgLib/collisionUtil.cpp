@@ -34,6 +34,7 @@
 #include <swgLib/cmsh.hpp>
 #include <swgLib/xcyl.hpp>
 #include <swgLib/xocl.hpp>
+#include <swgLib/logger.hpp>
 
 using namespace ml;
 
@@ -81,7 +82,7 @@ std::size_t collisionUtil::read(std::istream& file, baseCollisionPtr& collisionP
 			return base::readFormHeader(file, form, size, type);
 		}
 		else {
-			std::cout << "Unknown collision primitive: " << type << "\n";
+			SWG_LOG(LOG_WARNING) << "Unknown collision primitive: " << type << "\n";
 			return 0;
 		}
 
@@ -90,7 +91,7 @@ std::size_t collisionUtil::read(std::istream& file, baseCollisionPtr& collisionP
 		}
 	}
 	else {
-		std::cout << "Expected FORM instead of record: " << type << "\n";
+		SWG_LOG(LOG_INFO) << "Expected FORM instead of record: " << type << "\n";
 		return 0;
 	}
 
@@ -26,6 +26,8 @@
 #include <swgLib/cpst.hpp>
 #include <swgLib/base.hpp>
 #include <swgLib/collisionUtil.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -40,11 +42,11 @@ std::size_t cpst::read(std::istream& file) {
 	std::size_t cpstSize;
 	std::size_t total = base::readFormHeader(file, "CPST", cpstSize);
 	cpstSize += 8;
-	std::cout << "Found FORM CPST: " << cpstSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM CPST: " << cpstSize - 12 << " bytes\n";
 
 	std::size_t size;
 	total += base::readFormHeader(file, "0000", size);
-	std::cout << "Found FORM 0000: " << size - 4 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM 0000: " << size - 4 << " bytes\n";
 
 	// Read all collision shapes and append to list...
 	while (total < cpstSize) {
@@ -57,13 +59,14 @@ std::size_t cpst::read(std::istream& file) {
 
 	if (cpstSize == total)
 	{
-		std::cout << "Finished reading CPST\n";
+		SWG_LOG(LOG_INFO) << "Finished reading CPST\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading CPST\n"
-			<< "Read " << total << " out of " << cpstSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading CPST: "
+			<< "Read " << total << " out of " << cpstSize;
+		base::fail(file, "CPST", msg.str());
 	}
 
 	return total;
@@ -24,9 +24,11 @@
 */
 #include <swgLib/base.hpp>
 #include <swgLib/cshd.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -43,17 +45,18 @@ std::size_t cshd::readCSHD(std::istream& file)
 	std::size_t cshdSize;
 	std::size_t total = base::readFormHeader(file, "CSHD", cshdSize);
 	cshdSize += 8;
-	std::cout << "Found CSHD form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found CSHD form" << std::endl;
 
 	std::size_t size;
 	std::string form, type;
 	total += base::readFormHeader(file, form, size, type);
 	if (form != "FORM")
 	{
-		std::cout << "Expected FORM: " << form << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM: " << form;
+		base::fail(file, form, msg.str());
 	}
-	std::cout << "Found " << form << " " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << form << " " << type << std::endl;
 
 	while (total < cshdSize)
 	{
@@ -76,25 +79,27 @@ std::size_t cshd::readCSHD(std::istream& file)
 			}
 			else
 			{
-				std::cout << "Unexpected form: " << type << std::endl;
-				exit(0);
+				std::ostringstream msg;
+				msg << "Unexpected form: " << type;
+				base::fail(file, type, msg.str());
 			}
 		}
 		else
 		{
-			std::cout << "Unexpected record: " << form << std::endl;
-			exit(0);
+			std::ostringstream msg;
+			msg << "Unexpected record: " << form;
+			base::fail(file, form, msg.str());
 		}
 	}
 
 	if (cshdSize == total)
 	{
-		std::cout << "Finished reading CSHD" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading CSHD" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading CSHD" << std::endl;
-		std::cout << "Read " << total << " out of " << cshdSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading CSHD" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << cshdSize
 			<< std::endl;
 	}
 
@@ -106,7 +111,7 @@ std::size_t cshd::readTFAC(std::istream& file)
 	std::size_t tfacSize;
 	std::size_t total = base::readFormHeader(file, "TFAC", tfacSize);
 	tfacSize += 8; // Add size of FORM and size fields.
-	std::cout << "Found FORM TFAC" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found FORM TFAC" << std::endl;
 
 	while (total < tfacSize)
 	{
@@ -115,12 +120,12 @@ std::size_t cshd::readTFAC(std::istream& file)
 
 	if (tfacSize == total)
 	{
-		std::cout << "Finished reading TFAC" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading TFAC" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading TFAC" << std::endl;
-		std::cout << "Read " << total << " out of " << tfacSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading TFAC" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << tfacSize
 			<< std::endl;
 	}
 
@@ -134,21 +139,22 @@ std::size_t cshd::readPAL(std::istream& file)
 	std::size_t total = base::readRecordHeader(file, type, palSize);
 	if (type != "PAL ")
 	{
-		std::cout << "Expected record of type PAL: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type PAL: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	total += base::readUnknown(file, palSize);
 
 	if (palSize == (total - 8))
 	{
-		std::cout << "Finished reading PAL" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading PAL" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading PAL" << std::endl;
-		std::cout << "Read " << total << " out of " << palSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading PAL" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << palSize
 			<< std::endl;
 	}
 
@@ -160,7 +166,7 @@ std::size_t cshd::readTXTR(std::istream& file)
 	std::size_t txtrSize;
 	std::size_t total = base::readFormHeader(file, "TXTR", txtrSize);
 	txtrSize += 8;
-	std::cout << "Found FORM TXTR: " << txtrSize - 12 << " bytes"
+	SWG_LOG(LOG_INFO) << "Found FORM TXTR: " << txtrSize - 12 << " bytes"
 		<< std::endl;
 
 	std::size_t size;
@@ -168,10 +174,11 @@ std::size_t cshd::readTXTR(std::istream& file)
 	total += base::readRecordHeader(file, type, size);
 	if (type != "DATA")
 	{
-		std::cout << "Expected record of type DATA: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type DATA: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found record " << type
+	SWG_LOG(LOG_INFO) << "Found record " << type
 		<< ": " << size << " bytes"
 		<< std::endl;
 
@@ -182,19 +189,19 @@ std::size_t cshd::readTXTR(std::istream& file)
 	{
 		std::string texName;
 		total += base::read(file, texName);
-		std::cout << "Texture name: " << texName << std::endl;
+		SWG_LOG(LOG_DEBUG) << "Texture name: " << texName << std::endl;
 	}
 
 	total += readCUST(file);
 
 	if (txtrSize == total)
 	{
-		std::cout << "Finished reading TXTR" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading TXTR" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading TXTR" << std::endl;
-		std::cout << "Read " << total << " out of " << txtrSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading TXTR" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << txtrSize
 			<< std::endl;
 	}
 
@@ -206,7 +213,7 @@ std::size_t cshd::readCUST(std::istream& file)
 	std::size_t custSize;
 	std::size_t total = base::readFormHeader(file, "CUST", custSize);
 	custSize += 8;
-	std::cout << "Found FORM CUST: " << custSize - 12 << " bytes"
+	SWG_LOG(LOG_INFO) << "Found FORM CUST: " << custSize - 12 << " bytes"
 		<< std::endl;
 
 	while (total < custSize)
@@ -216,12 +223,12 @@ std::size_t cshd::readCUST(std::istream& file)
 
 	if (custSize == total)
 	{
-		std::cout << "Finished reading CUST" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading CUST" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading CUST" << std::endl;
-		std::cout << "Read " << total << " out of " << custSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading CUST" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << custSize
 			<< std::endl;
 	}
 
@@ -236,21 +243,22 @@ std::size_t cshd::readTX1D(std::istream& file)
 	std::size_t total = base::readRecordHeader(file, type, tx1dSize);
 	if (type != "TX1D")
 	{
-		std::cout << "Expected record of type TX1D: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type TX1D: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	total += base::readUnknown(file, tx1dSize);
 
 	if (tx1dSize == (total - 8))
 	{
-		std::cout << "Finished reading TX1D" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading TX1D" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading TX1D" << std::endl;
-		std::cout << "Read " << total << " out of " << tx1dSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading TX1D" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << tx1dSize
 			<< std::endl;
 	}
 
@@ -24,8 +24,10 @@
 */
 
 #include <swgLib/cstb.hpp>
+#include <swgLib/logger.hpp>
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 #define MAX_SWG_STRING 2048
 
@@ -44,7 +46,7 @@ unsigned int cstb::readCSTB(std::istream& file)
 	std::size_t cstbSize;
 	std::size_t total = readFormHeader(file, "CSTB", cstbSize);
 	cstbSize += 8;
-	std::cout << "Found CSTB form"
+	SWG_LOG(LOG_INFO) << "Found CSTB form"
 		<< ": " << cstbSize - 12 << " bytes"
 		<< std::endl;
 
@@ -53,10 +55,11 @@ unsigned int cstb::readCSTB(std::istream& file)
 	total += readFormHeader(file, form, size, type);
 	if (form != "FORM")
 	{
-		std::cout << "Expected FORM: " << form << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM: " << form;
+		base::fail(file, form, msg.str());
 	}
-	std::cout << "Found " << form << " " << type
+	SWG_LOG(LOG_INFO) << "Found " << form << " " << type
 		<< ": " << size - 4 << " bytes"
 		<< std::endl;
 
@@ -67,13 +70,13 @@ unsigned int cstb::readCSTB(std::istream& file)
 
 	if (cstbSize == total)
 	{
-		std::cout << "Finished reading CSTB" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading CSTB" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading CSTB" << std::endl;
-		std::cout << "Possibly a corrupt or non-finished file" << std::endl;
-		std::cout << "Read " << total << " out of " << cstbSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading CSTB" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Possibly a corrupt or non-finished file" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << cstbSize
 			<< std::endl;
 	}
 
@@ -90,10 +93,11 @@ unsigned int cstb::readDATA(std::istream& file)
 	size += 8;
 	if (type != "DATA")
 	{
-		std::cout << "Expected record of type DATA: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type DATA: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found DATA Record"
+	SWG_LOG(LOG_INFO) << "Found DATA Record"
 		<< ": " << size - 8 << " bytes"
 		<< std::endl;
 
@@ -101,12 +105,12 @@ unsigned int cstb::readDATA(std::istream& file)
 
 	if (size == total)
 	{
-		std::cout << "Finished reading DATA" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading DATA" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading DATA" << std::endl;
-		std::cout << "Read " << total << " out of " << size
+		SWG_LOG(LOG_ERROR) << "FAILED in reading DATA" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << size
 			<< std::endl;
 	}
 
@@ -121,10 +125,11 @@ unsigned int cstb::readCRCT(std::istream& file)
 	size += 8;
 	if (type != "CRCT")
 	{
-		std::cout << "Expected record of type CRCT: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type CRCT: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found CRCT record"
+	SWG_LOG(LOG_INFO) << "Found CRCT record"
 		<< ": " << size - 8 << " bytes"
 		<< std::endl;
 
@@ -137,12 +142,12 @@ unsigned int cstb::readCRCT(std::istream& file)
 
 	if (size == total)
 	{
-		std::cout << "Finished reading CRCT" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading CRCT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading CRCT" << std::endl;
-		std::cout << "Read " << total << " out of " << size
+		SWG_LOG(LOG_ERROR) << "FAILED in reading CRCT" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << size
 			<< std::endl;
 	}
 
@@ -157,10 +162,11 @@ unsigned int cstb::readSTRT(std::istream& file)
 	size += 8;
 	if (type != "STRT")
 	{
-		std::cout << "Expected record of type STRT: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type STRT: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found STRT record"
+	SWG_LOG(LOG_INFO) << "Found STRT record"
 		<< ": " << size - 8 << " bytes"
 		<< std::endl;
 
@@ -173,12 +179,12 @@ unsigned int cstb::readSTRT(std::istream& file)
 
 	if (size == total)
 	{
-		std::cout << "Finished reading STRT" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading STRT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading STRT" << std::endl;
-		std::cout << "Read " << total << " out of " << size
+		SWG_LOG(LOG_ERROR) << "FAILED in reading STRT" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << size
 			<< std::endl;
 	}
 
@@ -194,10 +200,11 @@ unsigned int cstb::readSTNG(std::istream& file)
 	size += 8;
 	if (type != "STNG")
 	{
-		std::cout << "Expected record of type STNG: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type STNG: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found STNG record"
+	SWG_LOG(LOG_INFO) << "Found STNG record"
 		<< ": " << size - 8 << " bytes"
 		<< std::endl;
 
@@ -213,12 +220,12 @@ unsigned int cstb::readSTNG(std::istream& file)
 
 	if (size == total)
 	{
-		std::cout << "Finished reading STNG" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading STNG" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading STNG" << std::endl;
-		std::cout << "Read " << total << " out of " << size
+		SWG_LOG(LOG_ERROR) << "FAILED in reading STNG" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << size
 			<< std::endl;
 	}
 
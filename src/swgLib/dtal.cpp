@@ -25,6 +25,8 @@
 
 #include <swgLib/dtal.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -38,7 +40,7 @@ std::size_t dtal::read(std::istream& file) {
 	std::size_t dtalSize;
 	std::size_t total = base::readFormHeader(file, "DTAL", dtalSize);
 	dtalSize += 8;
-	std::cout << "Found DTAL form: " << dtalSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found DTAL form: " << dtalSize - 12 << " bytes\n";
 
 	std::size_t size;
 	total += base::readFormHeader(file, "0000", size);
@@ -47,13 +49,14 @@ std::size_t dtal::read(std::istream& file) {
 
 	if (total == dtalSize)
 	{
-		std::cout << "Finished reading DTAL.\n";
+		SWG_LOG(LOG_INFO) << "Finished reading DTAL.\n";
 	}
 	else
 	{
-		std::cout << "Error reading DTAL!\n"
-			<< "Read " << total << " out of " << dtalSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Error reading DTAL!: "
+			<< "Read " << total << " out of " << dtalSize;
+		base::fail(file, "DTAL", msg.str());
 	}
 
 	return total;
@@ -24,8 +24,10 @@
 */
 
 #include <swgLib/dtii.hpp>
+#include <swgLib/logger.hpp>
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 #define MAX_SWG_STRING 2048
 
@@ -46,7 +48,7 @@ unsigned int dtii::readDTII(std::istream& file)
 	std::size_t dtiiSize;
 	std::size_t total = readFormHeader(file, "DTII", dtiiSize);
 	dtiiSize += 8;
-	std::cout << "Found DTII form"
+	SWG_LOG(LOG_INFO) << "Found DTII form"
 		<< ": " << dtiiSize - 12 << " bytes"
 		<< std::endl;
 
@@ -55,10 +57,11 @@ unsigned int dtii::readDTII(std::istream& file)
 	total += readFormHeader(file, form, size, type);
 	if (form != "FORM")
 	{
-		std::cout << "Expected FORM: " << form << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM: " << form;
+		base::fail(file, form, msg.str());
 	}
-	std::cout << "Found " << form << " " << type
+	SWG_LOG(LOG_INFO) << "Found " << form << " " << type
 		<< ": " << size - 4 << " bytes"
 		<< std::endl;
 
@@ -70,13 +73,13 @@ unsigned int dtii::readDTII(std::istream& file)
 
 	if (dtiiSize == total)
 	{
-		std::cout << "Finished reading DTII" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading DTII" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading DTII" << std::endl;
-		std::cout << "Possibly a corrupt or non-finished file" << std::endl;
-		std::cout << "Read " << total << " out of " << dtiiSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading DTII" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Possibly a corrupt or non-finished file" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << dtiiSize
 			<< std::endl;
 	}
 
@@ -92,10 +95,11 @@ unsigned int dtii::readCOLS(std::istream& file)
 	colsSize += 8;
 	if (type != "COLS")
 	{
-		std::cout << "Expected record of type COLS: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type COLS: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found COLS record"
+	SWG_LOG(LOG_INFO) << "Found COLS record"
 		<< ": " << colsSize - 8 << " bytes"
 		<< std::endl;
 
@@ -107,18 +111,18 @@ unsigned int dtii::readCOLS(std::istream& file)
 		std::string name;
 		total += base::read(file, name);
 		columnName.push_back(name);
-		std::cout << i << ": " << name << std::endl;
+		SWG_LOG(LOG_DEBUG) << i << ": " << name << std::endl;
 	}
-	std::cout << std::endl;
+	SWG_LOG(LOG_INFO) << std::endl;
 
 	if (colsSize == total)
 	{
-		std::cout << "Finished reading COLS" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading COLS" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading COLS" << std::endl;
-		std::cout << "Read " << total << " out of " << colsSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading COLS" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << colsSize
 			<< std::endl;
 	}
 
@@ -133,10 +137,11 @@ unsigned int dtii::readTYPE(std::istream& file)
 	typeSize += 8;
 	if (type != "TYPE")
 	{
-		std::cout << "Expected record of type TYPE: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type TYPE: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found TYPE record"
+	SWG_LOG(LOG_INFO) << "Found TYPE record"
 		<< ": " << typeSize - 8 << " bytes"
 		<< std::endl;
 
@@ -146,18 +151,18 @@ unsigned int dtii::readTYPE(std::istream& file)
 		std::string name;
 		total += base::read(file, name);
 		columnType.push_back(name);
-		std::cout << i << ": " << name << std::endl;
+		SWG_LOG(LOG_DEBUG) << i << ": " << name << std::endl;
 	}
-	std::cout << std::endl;
+	SWG_LOG(LOG_INFO) << std::endl;
 
 	if (typeSize == total)
 	{
-		std::cout << "Finished reading TYPE" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading TYPE" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading TYPE" << std::endl;
-		std::cout << "Read " << total << " out of " << typeSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading TYPE" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << typeSize
 			<< std::endl;
 	}
 
@@ -172,79 +177,80 @@ unsigned int dtii::readROWS(std::istream& file)
 	rowsSize += 8;
 	if (type != "ROWS")
 	{
-		std::cout << "Expected record of type ROWS: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type ROWS: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found ROWS record"
+	SWG_LOG(LOG_INFO) << "Found ROWS record"
 		<< ": " << rowsSize - 8 << " bytes"
 		<< std::endl;
 
 	total += base::read(file, numRows);
-	std::cout << "Number of rows: " << numRows << std::endl;
+	SWG_LOG(LOG_INFO) << "Number of rows: " << numRows << std::endl;
 
 	for (unsigned int row = 0; row < numRows; ++row)
 	{
-		std::cout << "Row " << row << ": " << std::endl;
+		SWG_LOG(LOG_DEBUG) << "Row " << row << ": " << std::endl;
 		for (unsigned int i = 0; i < numColumns; ++i)
 		{
-			std::cout << columnName[i] << ": ";
+			SWG_LOG(LOG_DEBUG) << columnName[i] << ": ";
 
 			if ('i' == (columnType[i])[0])
 			{
 				int x;
 				total += base::read(file, x);
-				std::cout << x << std::endl;
+				SWG_LOG(LOG_DEBUG) << x << std::endl;
 			}
 			else if ('I' == (columnType[i])[0])
 			{
 				int x;
 				total += base::read(file, x);
-				std::cout << x << std::endl;
+				SWG_LOG(LOG_DEBUG) << x << std::endl;
 			}
 			else if ('f' == (columnType[i])[0])
 			{
 				float x;
 				total += base::read(file, x);
-				std::cout << x << std::endl;
+				SWG_LOG(LOG_DEBUG) << x << std::endl;
 			}
 			else if ('z' == (columnType[i])[0])
 			{
 				int x;
 				total += base::read(file, x);
-				std::cout << x << std::endl;
+				SWG_LOG(LOG_DEBUG) << x << std::endl;
 			}
 			else if ('e' == (columnType[i])[0])
 			{
 				int x;
 				total += base::read(file, x);
-				std::cout << x << std::endl;
+				SWG_LOG(LOG_DEBUG) << x << std::endl;
 			}
 			else if ('s' == (columnType[i])[0])
 			{
 				std::string name;
 				total += base::read(file, name);
-				std::cout << name << std::endl;
+				SWG_LOG(LOG_DEBUG) << name << std::endl;
 			}
 			else if ('b' == (columnType[i])[0])
 			{
 				unsigned int x;
 				total += base::read(file, x);
-				std::cout << x << std::endl;
+				SWG_LOG(LOG_DEBUG) << x << std::endl;
 			}
 			else if ('h' == (columnType[i])[0])
 			{
 				unsigned int x;
 				total += base::read(file, x);
-				std::cout << std::hex << "0x" << x << std::dec << std::endl;
+				SWG_LOG(LOG_DEBUG) << std::hex << "0x" << x << std::dec << std::endl;
 			}
 			else
 			{
-				std::cout << "Error: Unknown type: " << columnType[i]
-					<< std::endl;
-				exit(0);
+				std::ostringstream msg;
+				msg << "Error: Unknown type: " << columnType[i];
+				base::fail(file, "ROWS", msg.str());
 			}
 		}
-		std::cout << std::endl;
+		SWG_LOG(LOG_DEBUG) << std::endl;
 	}
 
 	return total;
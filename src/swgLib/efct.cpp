@@ -23,10 +23,12 @@
  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 #include <swgLib/efct.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <bitset>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -43,28 +45,29 @@ std::size_t efct::readEFCT(std::istream& file)
 	std::size_t efctSize;
 	std::size_t total = base::readFormHeader(file, "EFCT", efctSize);
 	efctSize += 8;
-	std::cout << "Found EFCT form: " << efctSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found EFCT form: " << efctSize - 12 << " bytes\n";
 
 	std::size_t size;
 	std::string type;
 	total += base::readFormHeader(file, type, size);
 	_version = base::tagToVersion(type);
 	if ((0 != _version) && (1 != _version)) {
-		std::cout << "Expected 0000 or 0001. Found: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected 0000 or 0001. Found: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found form " << type << ": " << size - 4 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found form " << type << ": " << size - 4 << " bytes\n";
 
 	// Read DATA record
 	total += base::readRecordHeader(file, "DATA", size);
-	std::cout << "Found record DATA: " << size << "\n";
+	SWG_LOG(LOG_INFO) << "Found record DATA: " << size << "\n";
 
 	total += base::read(file, _numImplementations);
-	std::cout << "Number of implementations: " << (int)_numImplementations << "\n";
+	SWG_LOG(LOG_INFO) << "Number of implementations: " << (int)_numImplementations << "\n";
 
 	if (1 == _version) {
 		total += base::read(file, _precalcVertexLighting);
-		std::cout << "Precalculated vertex Lighting: " << std::boolalpha << _precalcVertexLighting << "\n";
+		SWG_LOG(LOG_INFO) << "Precalculated vertex Lighting: " << std::boolalpha << _precalcVertexLighting << "\n";
 	}
 
 	// Read all implementations...
@@ -74,12 +77,13 @@ std::size_t efct::readEFCT(std::istream& file)
 	}
 
 	if (efctSize == total) {
-		std::cout << "Finished reading EFCT\n";
+		SWG_LOG(LOG_INFO) << "Finished reading EFCT\n";
 	}
 	else {
-		std::cout << "FAILED in reading EFCT\n";
-		std::cout << "Read " << total << " out of " << efctSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading EFCT: ";
+		msg << "Read " << total << " out of " << efctSize;
+		base::fail(file, "EFCT", msg.str());
 	}
 
 	return total;
@@ -25,6 +25,8 @@
 
 #include <swgLib/egrp.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -34,44 +36,49 @@ egrp::egrp() {
 egrp::~egrp() {
 }
 
-std::size_t egrp::read(std::istream& file) {
+std::size_t egrp::read(iffReader& file) {
 	std::size_t egrpSize;
 	std::size_t total = base::readFormHeader(file, "EGRP", egrpSize);
 	egrpSize += 8;
-	std::cout << "Found EGRP form: " << egrpSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found EGRP form: " << egrpSize << " bytes\n";
 
 	std::size_t size;
 	std::string form, type;
 	base::peekHeader(file, form, size, type);
 	_version = base::tagToVersion(type);
 	if (2 < _version) {
-		std::cout << "Expected type [0000...0002]: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0000...0002]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Environment Group version: " << _version << "\n";
+	SWG_LOG(LOG_INFO) << "Environment Group version: " << _version << "\n";
 
 	switch (_version) {
 	case 0: total += readV0(file); break;
 	case 1: total += readV1(file); break;
 	case 2: total += readV2(file); break;
 	default:
-		std::cout << "Unexpected version: " << _version << "\n";
-		exit(0);
+		{
+			std::ostringstream msg;
+			msg << "Unexpected version: " << _version;
+			base::fail(file, "EGRP", msg.str());
+		}
 	}
 
 	if (egrpSize == total) {
-		std::cout << "Finished reading EGRP\n";
+		SWG_LOG(LOG_INFO) << "Finished reading EGRP\n";
 	}
 	else {
-		std::cout << "Failed in reading EGRP\n";
-		std::cout << "Read " << total << " out of " << egrpSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading EGRP: ";
+		msg << "Read " << total << " out of " << egrpSize;
+		base::fail(file, "EGRP", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t egrp::readV0(std::istream& file) {
+std::size_t egrp::readV0(iffReader& file) {
 	std::size_t size0000;
 	std::size_t total = base::readFormHeader(file, "0000", size0000);
 	size0000 += 8;
@@ -93,18 +100,19 @@ std::size_t egrp::readV0(std::istream& file) {
 	}
 
 	if (size0000 == total) {
-		std::cout << "Finished reading 0000\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0000\n";
 	}
 	else {
-		std::cout << "Failed in reading 0000\n";
-		std::cout << "Read " << total << " out of " << size0000 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0000: ";
+		msg << "Read " << total << " out of " << size0000;
+		base::fail(file, "0000", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t egrp::readV1(std::istream& file) {
+std::size_t egrp::readV1(iffReader& file) {
 	std::size_t size0001;
 	std::size_t total = base::readFormHeader(file, "0001", size0001);
 	size0001 += 8;
@@ -126,18 +134,19 @@ std::size_t egrp::readV1(std::istream& file) {
 	}
 
 	if (size0001 == total) {
-		std::cout << "Finished reading 0001\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0001\n";
 	}
 	else {
-		std::cout << "Failed in reading 0001\n";
-		std::cout << "Read " << total << " out of " << size0001 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0001: ";
+		msg << "Read " << total << " out of " << size0001;
+		base::fail(file, "0001", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t egrp::readV2(std::istream& file) {
+std::size_t egrp::readV2(iffReader& file) {
 	std::size_t size0002;
 	std::size_t total = base::readFormHeader(file, "0002", size0002);
 	size0002 += 8;
@@ -156,17 +165,18 @@ std::size_t egrp::readV2(std::istream& file) {
 		total += base::read(file, newFamily.blue);
 		total += base::read(file, newFamily.featherClamp);
 
-		std::cout << "Family name: " << newFamily.name << "\n";
+		SWG_LOG(LOG_DEBUG) << "Family name: " << newFamily.name << "\n";
 		_family.push_back(newFamily);
 	}
 
 	if (size0002 == total) {
-		std::cout << "Finished reading 0002\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0002\n";
 	}
 	else {
-		std::cout << "Failed in reading 0002\n";
-		std::cout << "Read " << total << " out of " << size0002 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0002: ";
+		msg << "Read " << total << " out of " << size0002;
+		base::fail(file, "0002", msg.str());
 	}
 
 	return total;
@@ -24,10 +24,12 @@
 */
 #include <swgLib/emgp.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <bitset>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -44,17 +46,18 @@ std::size_t emgp::read(std::istream& file)
 	std::size_t emgpSize;
 	std::size_t total = base::readFormHeader(file, "EMGP", emgpSize);
 	emgpSize += 8;
-	std::cout << "Found FORM EMGP: " << emgpSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM EMGP: " << emgpSize - 12 << " bytes\n";
 
 	std::string type;
 	std::size_t size;
 	total += base::readFormHeader(file, type, size);
 	_version = base::tagToVersion(type);
 	if (_version > 1) {
-		std::cout << "Expected type [0000..0001]: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0000..0001]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Emitter Group Version: " << _version << "\n";
+	SWG_LOG(LOG_INFO) << "Emitter Group Version: " << _version << "\n";
 
 	if (1 == _version) {
 		total += _timing.read(file);
@@ -62,7 +65,7 @@ std::size_t emgp::read(std::istream& file)
 
 	total += base::readRecordHeader(file, "0000", size);
 	total += base::read(file, _numEmitterDescriptions);
-	std::cout << "Emitter Group: Num Descriptions: " << _numEmitterDescriptions << "\n";
+	SWG_LOG(LOG_INFO) << "Emitter Group: Num Descriptions: " << _numEmitterDescriptions << "\n";
 
 	_emitterDescriptions.resize(_numEmitterDescriptions);
 	for (auto& ed : _emitterDescriptions) {
@@ -71,13 +74,14 @@ std::size_t emgp::read(std::istream& file)
 
 	if (emgpSize == total)
 	{
-		std::cout << "Finished reading EMGP" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading EMGP" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading EMGP\n"
-			<< "Read " << total << " out of " << emgpSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading EMGP: "
+			<< "Read " << total << " out of " << emgpSize;
+		base::fail(file, "EMGP", msg.str());
 	}
 
 	return total;
@@ -24,10 +24,12 @@
 */
 #include <swgLib/emtr.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <bitset>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -44,18 +46,19 @@ std::size_t emtr::read(std::istream& file)
 	std::size_t emtrSize;
 	std::size_t total = base::readFormHeader(file, "EMTR", emtrSize);
 	emtrSize += 8;
-	std::cout << "Found EMTR: " << emtrSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found EMTR: " << emtrSize - 12 << " bytes\n";
 
 	std::string form, type;
 	std::size_t size;
 	base::peekHeader(file, form, size, type);
-	std::cout << form << ":" << type << ":" << size << "\n";
+	SWG_LOG(LOG_INFO) << form << ":" << type << ":" << size << "\n";
 	_version = base::tagToVersion(type);
 	if (_version > 14) {
-		std::cout << "Expected type [0000..0014]: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0000..0014]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Emitter Description Version: " << _version << "\n";
+	SWG_LOG(LOG_INFO) << "Emitter Description Version: " << _version << "\n";
 
 	switch (_version) {
 	case 0: total += readV0(file); break;
@@ -74,17 +77,21 @@ std::size_t emtr::read(std::istream& file)
 	case 13: total += readV13(file); break;
 	case 14: total += readV14(file); break;
 	default:
-		std::cout << "Unhandled Emitter Description version: " << _version << "\n";
-		exit(0);
+		{
+			std::ostringstream msg;
+			msg << "Unhandled Emitter Description version: " << _version;
+			base::fail(file, "EMTR", msg.str());
+		}
 	}
 
 	if (emtrSize == total) {
-		std::cout << "Finished reading EMTR\n";
+		SWG_LOG(LOG_INFO) << "Finished reading EMTR\n";
 	}
 	else {
-		std::cout << "FAILED in reading EMTR\n"
-			<< "Read " << total << " out of " << emtrSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading EMTR: "
+			<< "Read " << total << " out of " << emtrSize;
+		base::fail(file, "EMTR", msg.str());
 	}
 
 	return total;
@@ -122,30 +129,30 @@ std::size_t emtr::readV0(std::istream& file)
 	total += base::readRecordHeader(file, "0000", size);
 
 	total += base::read(file, _emitterEmitDirection);
-	std::cout << "Emit direction: " << _emitterEmitDirection << "\n";
+	SWG_LOG(LOG_INFO) << "Emit direction: " << _emitterEmitDirection << "\n";
 
 	total += base::read(file, _emitterShape);
-	std::cout << "Emitter shape: " << _emitterShape << "\n";
+	SWG_LOG(LOG_INFO) << "Emitter shape: " << _emitterShape << "\n";
 
 	total += base::read(file, _emitterLoopImmediately);
-	std::cout << "Loop immediately: " << std::boolalpha << _emitterLoopImmediately << "\n";
+	SWG_LOG(LOG_INFO) << "Loop immediately: " << std::boolalpha << _emitterLoopImmediately << "\n";
 
 	total += base::read(file, _emitterLifetimeMin);
 	_emitterLifetimeMax = _emitterLifetimeMin;
-	std::cout << "Lifetime min/max: [" << _emitterLifetimeMin << ".." << _emitterLifetimeMax << "]\n";
+	SWG_LOG(LOG_INFO) << "Lifetime min/max: [" << _emitterLifetimeMin << ".." << _emitterLifetimeMax << "]\n";
 
 	total += base::read(file, _emitterMaxParticles);
-	std::cout << "Max particles: " << _emitterMaxParticles << "\n";
+	SWG_LOG(LOG_INFO) << "Max particles: " << _emitterMaxParticles << "\n";
 
 	total += base::read(file, _emitterOneShot);
-	std::cout << "One shot: " << std::boolalpha << _emitterOneShot << "\n";
+	SWG_LOG(LOG_INFO) << "One shot: " << std::boolalpha << _emitterOneShot << "\n";
 
 	_emitterOneShotMin = int32_t(_emitterMaxParticles) - 1;
 	_emitterOneShotMax = int32_t(_emitterMaxParticles) - 1;
-	std::cout << "One shot min/max: [" << _emitterOneShotMin << ".." << _emitterOneShotMax << "]\n";
+	SWG_LOG(LOG_INFO) << "One shot min/max: [" << _emitterOneShotMin << ".." << _emitterOneShotMax << "]\n";
 
 	total += base::read(file, _particleRandomInitialRotation);
-	std::cout << "Random initial rotation: " << std::boolalpha << _particleRandomInitialRotation << "\n";
+	SWG_LOG(LOG_INFO) << "Random initial rotation: " << std::boolalpha << _particleRandomInitialRotation << "\n";
 
 	bool particleOrientWithVelocity;
 	total += base::read(file, particleOrientWithVelocity);
@@ -157,11 +164,11 @@ std::size_t emtr::readV0(std::istream& file)
 		_particleOrientation = 0;
 	}
 
-	std::cout << "Particle orientation: " << _particleOrientation << "\n";
+	SWG_LOG(LOG_INFO) << "Particle orientation: " << _particleOrientation << "\n";
 
 	bool junk; total += base::read(file, junk);
 	total += base::read(file, _particleVisible);
-	std::cout << "Particle visible: " << std::boolalpha << _particleVisible << "\n";
+	SWG_LOG(LOG_INFO) << "Particle visible: " << std::boolalpha << _particleVisible << "\n";
 	uint32_t junk2;	total += base::read(file, junk2);
 
 	//particle description quad
@@ -169,9 +176,10 @@ std::size_t emtr::readV0(std::istream& file)
 	total += _ptcl->read(file);
 
 	if (size0000 != total) {
-		std::cout << "FAILED in reading 0000\n"
-			<< "Read " << total << " out of " << size0000 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading 0000: "
+			<< "Read " << total << " out of " << size0000;
+		base::fail(file, "0000", msg.str());
 	}
 
 	return total;
@@ -228,9 +236,10 @@ std::size_t emtr::readV1(std::istream& file)
 	total += _ptcl->read(file);
 
 	if (size0001 != total) {
-		std::cout << "FAILED in reading 0001\n"
-			<< "Read " << total << " out of " << size0001 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading 0001: "
+			<< "Read " << total << " out of " << size0001;
+		base::fail(file, "0001", msg.str());
 	}
 
 	return total;
@@ -290,9 +299,10 @@ std::size_t emtr::readV2(std::istream& file)
 	total += _ptcl->read(file);
 
 	if (size0002 != total) {
-		std::cout << "FAILED in reading 0002\n"
-			<< "Read " << total << " out of " << size0002 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading 0002: "
+			<< "Read " << total << " out of " << size0002;
+		base::fail(file, "0002", msg.str());
 	}
 
 	return total;
@@ -351,9 +361,10 @@ std::size_t emtr::readV3(std::istream& file)
 	total += _ptcl->read(file);
 
 	if (size0003 != total) {
-		std::cout << "FAILED in reading 0003\n"
-			<< "Read " << total << " out of " << size0003 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading 0003: "
+			<< "Read " << total << " out of " << size0003;
+		base::fail(file, "0003", msg.str());
 	}
 
 	return total;
@@ -417,15 +428,17 @@ std::size_t emtr::readV4(std::istream& file)
 		_ptcl = ptmhPtr(new ptmh());
 	}
 	else {
-		std::cout << "Unhandled particle type: " << _particleType << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unhandled particle type: " << _particleType;
+		base::fail(file, "EMTR", msg.str());
 	}
 	total += _ptcl->read(file);
 
 	if (size0004 != total) {
-		std::cout << "FAILED in reading 0004\n"
-			<< "Read " << total << " out of " << size0004 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading 0004: "
+			<< "Read " << total << " out of " << size0004;
+		base::fail(file, "0004", msg.str());
 	}
 
 	return total;
@@ -490,15 +503,17 @@ std::size_t emtr::readV5(std::istream& file)
 		_ptcl = ptmhPtr(new ptmh());
 	}
 	else {
-		std::cout << "Unhandled particle type: " << _particleType << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unhandled particle type: " << _particleType;
+		base::fail(file, "EMTR", msg.str());
 	}
 	total += _ptcl->read(file);
 
 	if (size0005 != total) {
-		std::cout << "FAILED in reading 0005\n"
-			<< "Read " << total << " out of " << size0005 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading 0005: "
+			<< "Read " << total << " out of " << size0005;
+		base::fail(file, "0005", msg.str());
 	}
 
 	return total;
@@ -564,15 +579,17 @@ std::size_t emtr::readV6(std::istream& file)
 		_ptcl = ptmhPtr(new ptmh());
 	}
 	else {
-		std::cout << "Unhandled particle type: " << _particleType << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unhandled particle type: " << _particleType;
+		base::fail(file, "EMTR", msg.str());
 	}
 	total += _ptcl->read(file);
 
 	if (size0006 != total) {
-		std::cout << "FAILED in reading 0006\n"
-			<< "Read " << total << " out of " << size0006 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading 0006: "
+			<< "Read " << total << " out of " << size0006;
+		base::fail(file, "0006", msg.str());
 	}
 
 	return total;
@@ -648,15 +665,17 @@ std::size_t emtr::readV7(std::istream& file)
 		_ptcl = ptmhPtr(new ptmh());
 	}
 	else {
-		std::cout << "Unhandled particle type: " << _particleType << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unhandled particle type: " << _particleType;
+		base::fail(file, "EMTR", msg.str());
 	}
 	total += _ptcl->read(file);
 
 	if (size0007 != total) {
-		std::cout << "FAILED in reading 0007\n"
-			<< "Read " << total << " out of " << size0007 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading 0007: "
+			<< "Read " << total << " out of " << size0007;
+		base::fail(file, "0007", msg.str());
 	}
 
 	return total;
@@ -733,15 +752,17 @@ std::size_t emtr::readV8(std::istream& file)
 		_ptcl = ptmhPtr(new ptmh());
 	}
 	else {
-		std::cout << "Unhandled particle type: " << _particleType << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unhandled particle type: " << _particleType;
+		base::fail(file, "EMTR", msg.str());
 	}
 	total += _ptcl->read(file);
 
 	if (size0008 != total) {
-		std::cout << "FAILED in reading 0008\n"
-			<< "Read " << total << " out of " << size0008 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading 0008: "
+			<< "Read " << total << " out of " << size0008;
+		base::fail(file, "0008", msg.str());
 	}
 
 	return total;
@@ -818,15 +839,17 @@ std::size_t emtr::readV9(std::istream& file)
 		_ptcl = ptmhPtr(new ptmh());
 	}
 	else {
-		std::cout << "Unhandled particle type: " << _particleType << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unhandled particle type: " << _particleType;
+		base::fail(file, "EMTR", msg.str());
 	}
 	total += _ptcl->read(file);
 
 	if (size0009 != total) {
-		std::cout << "FAILED in reading 0009\n"
-			<< "Read " << total << " out of " << size0009 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading 0009: "
+			<< "Read " << total << " out of " << size0009;
+		base::fail(file, "0009", msg.str());
 	}
 
 	return total;
@@ -916,15 +939,17 @@ std::size_t emtr::readV10(std::istream& file)
 		_ptcl = ptmhPtr(new ptmh());
 	}
 	else {
-		std::cout << "Unhandled particle type: " << _particleType << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unhandled particle type: " << _particleType;
+		base::fail(file, "V10 ", msg.str());
 	}
 	total += _ptcl->read(file);
 
 	if (size0010 != total) {
-		std::cout << "FAILED in reading 0010\n"
-			<< "Read " << total << " out of " << size0010 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading 0010: "
+			<< "Read " << total << " out of " << size0010;
+		base::fail(file, "0010", msg.str());
 	}
 
 	return total;
@@ -1015,15 +1040,17 @@ std::size_t emtr::readV11(std::istream& file)
 		_ptcl = ptmhPtr(new ptmh());
 	}
 	else {
-		std::cout << "Unhandled particle type: " << _particleType << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unhandled particle type: " << _particleType;
+		base::fail(file, "V11 ", msg.str());
 	}
 	total += _ptcl->read(file);
 
 	if (size0011 != total) {
-		std::cout << "FAILED in reading 0011\n"
-			<< "Read " << total << " out of " << size0011 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading 0011: "
+			<< "Read " << total << " out of " << size0011;
+		base::fail(file, "0011", msg.str());
 	}
 
 	return total;
@@ -1116,15 +1143,17 @@ std::size_t emtr::readV12(std::istream& file)
 		_ptcl = ptmhPtr(new ptmh());
 	}
 	else {
-		std::cout << "Unhandled particle type: " << _particleType << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unhandled particle type: " << _particleType;
+		base::fail(file, "V12 ", msg.str());
 	}
 	total += _ptcl->read(file);
 
 	if (size0012 != total) {
-		std::cout << "FAILED in reading 0012\n"
-			<< "Read " << total << " out of " << size0012 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading 0012: "
+			<< "Read " << total << " out of " << size0012;
+		base::fail(file, "0012", msg.str());
 	}
 
 	return total;
@@ -1218,15 +1247,17 @@ std::size_t emtr::readV13(std::istream& file)
 		_ptcl = ptmhPtr(new ptmh());
 	}
 	else {
-		std::cout << "Unhandled particle type: " << _particleType << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unhandled particle type: " << _particleType;
+		base::fail(file, "V13 ", msg.str());
 	}
 	total += _ptcl->read(file);
 
 	if (size0013 != total) {
-		std::cout << "FAILED in reading 0013\n"
-			<< "Read " << total << " out of " << size0013 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading 0013: "
+			<< "Read " << total << " out of " << size0013;
+		base::fail(file, "0013", msg.str());
 	}
 
 	return total;
@@ -1321,15 +1352,17 @@ std::size_t emtr::readV14(std::istream& file)
 		_ptcl = ptmhPtr(new ptmh());
 	}
 	else {
-		std::cout << "Unhandled particle type: " << _particleType << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unhandled particle type: " << _particleType;
+		base::fail(file, "V14 ", msg.str());
 	}
 	total += _ptcl->read(file);
 
 	if (size0014 != total) {
-		std::cout << "FAILED in reading 0014\n"
-			<< "Read " << total << " out of " << size0014 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading 0014: "
+			<< "Read " << total << " out of " << size0014;
+		base::fail(file, "0014", msg.str());
 	}
 
 	return total;
@@ -25,6 +25,8 @@
 
 #include <swgLib/exbx.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -38,7 +40,7 @@ std::size_t exbx::read(std::istream& file) {
 	std::size_t exbxSize;
 	std::size_t total = base::readFormHeader(file, "EXBX", exbxSize);
 	exbxSize += 8;
-	std::cout << "Found EXBX form: " << exbxSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found EXBX form: " << exbxSize - 12 << " bytes\n";
 
 	std::string form, type;
 	std::size_t size;
@@ -61,7 +63,7 @@ std::size_t exbx::read(std::istream& file) {
 		total += base::read(file, _exbxMin);
 	}
 
-	std::cout
+	SWG_LOG(LOG_INFO)
 		<< "EXSP sphere center: " << _exspCenter << "\n"
 		<< "EXSP sphere radius: " << _exspRadius << "\n"
 		<< "EXBX Box Max: " << _exbxMax << "\n"
@@ -69,13 +71,14 @@ std::size_t exbx::read(std::istream& file) {
 
 	if (total == exbxSize)
 	{
-		std::cout << "Finished reading EXBX.\n";
+		SWG_LOG(LOG_INFO) << "Finished reading EXBX.\n";
 	}
 	else
 	{
-		std::cout << "Error reading EXBX!\n"
-			<< "Read " << total << " out of " << exbxSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Error reading EXBX!: "
+			<< "Read " << total << " out of " << exbxSize;
+		base::fail(file, "EXBX", msg.str());
 	}
 
 	return total;
@@ -94,7 +97,7 @@ std::size_t exbx::read(std::istream& file,
 	std::size_t exbxSize;
 	std::size_t total = base::readFormHeader(file, "EXBX", exbxSize);
 	exbxSize += 8;
-	std::cout << "Found EXBX form: " << exbxSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found EXBX form: " << exbxSize - 12 << " bytes\n";
 
 	std::string form, type;
 	std::size_t size;
@@ -103,27 +106,29 @@ std::size_t exbx::read(std::istream& file,
 	uint8_t version = base::tagToVersion(type);
 
 	if (version > 1) {
-		std::cout << "Expected form [0000..0001] not " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected form [0000..0001] not " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found form " << type << "\n";
+	SWG_LOG(LOG_INFO) << "Found form " << type << "\n";
 
 	if (1 == version) {
 		// Load EXSP
 		std::size_t exspSize;
 		total += base::readFormHeader(file, "EXSP", exspSize);
 		exspSize += 8;
-		std::cout << "Found EXSP form: " << exspSize - 12 << " bytes\n";
+		SWG_LOG(LOG_INFO) << "Found EXSP form: " << exspSize - 12 << " bytes\n";
 
 		std::string exspType;
 		total += base::readFormHeader(file, form, size, exspType);
 
 		uint8_t exspVersion = base::tagToVersion(exspType);
 		if (exspVersion > 1) {
-			std::cout << "Expected form [0000..0001] not " << exspType << "\n";
-			exit(0);
+			std::ostringstream msg;
+			msg << "Expected form [0000..0001] not " << exspType;
+			base::fail(file, "EXBX", msg.str());
 		}
-		std::cout << "Found form " << exspType << "\n";
+		SWG_LOG(LOG_INFO) << "Found form " << exspType << "\n";
 
 		if (0 == exspVersion) {
 			total += base::readRecordHeader(file, "CNTR", size);
@@ -150,7 +155,7 @@ std::size_t exbx::read(std::istream& file,
 		total += base::read(file, exspRadius);
 	}
 
-	std::cout
+	SWG_LOG(LOG_INFO)
 		<< "EXSP sphere center: " << exspCenter << "\n"
 		<< "EXSP sphere radius: " << exspRadius << "\n"
 		<< "EXBX corner 1: " << boxCorner1 << "\n"
@@ -158,13 +163,14 @@ std::size_t exbx::read(std::istream& file,
 
 	if (total == exbxSize)
 	{
-		std::cout << "Finished reading EXBX." << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading EXBX." << std::endl;
 	}
 	else
 	{
-		std::cout << "Error reading EXBX!" << std::endl;
-		std::cout << "Read " << total << " out of " << exbxSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Error reading EXBX!: ";
+		msg << "Read " << total << " out of " << exbxSize;
+		base::fail(file, "EXBX", msg.str());
 	}
 
 	return total;
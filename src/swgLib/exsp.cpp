@@ -25,6 +25,8 @@
 
 #include <swgLib/exsp.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -48,7 +50,7 @@ std::size_t exsp::read(std::istream& file) {
 	std::size_t exspSize;
 	std::size_t total = base::readFormHeader(file, "EXSP", exspSize);
 	exspSize += 8;
-	std::cout << "Found EXSP form: " << exspSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found EXSP form: " << exspSize - 12 << " bytes\n";
 
 	std::string form, type;
 	std::size_t size;
@@ -56,10 +58,11 @@ std::size_t exsp::read(std::istream& file) {
 	_exspVersion = base::tagToVersion(type);
 
 	if (_exspVersion > 1) {
-		std::cout << "Expected form [0000..0001] not " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected form [0000..0001] not " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found form " << type << "\n";
+	SWG_LOG(LOG_INFO) << "Found form " << type << "\n";
 
 	if (0 == _exspVersion) {
 		total += readOld(file);
@@ -70,19 +73,20 @@ std::size_t exsp::read(std::istream& file) {
 		total += base::read(file, _exspRadius);
 	}
 
-	std::cout
+	SWG_LOG(LOG_INFO)
 		<< "EXSP sphere center: " << _exspCenter << "\n"
 		<< "EXSP sphere radius: " << _exspRadius << "\n";
 
 	if (total == exspSize)
 	{
-		std::cout << "Finished reading EXSP.\n";
+		SWG_LOG(LOG_INFO) << "Finished reading EXSP.\n";
 	}
 	else
 	{
-		std::cout << "Error reading EXSP!\n"
-			<< "Read " << total << " out of " << exspSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Error reading EXSP!: "
+			<< "Read " << total << " out of " << exspSize;
+		base::fail(file, "EXSP", msg.str());
 	}
 
 	return total;
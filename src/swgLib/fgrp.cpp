@@ -25,6 +25,8 @@
 
 #include <swgLib/fgrp.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -34,21 +36,22 @@ fgrp::fgrp() {
 fgrp::~fgrp() {
 }
 
-std::size_t fgrp::read(std::istream& file) {
+std::size_t fgrp::read(iffReader& file) {
 	std::size_t fgrpSize;
 	std::size_t total = base::readFormHeader(file, "FGRP", fgrpSize);
 	fgrpSize += 8;
-	std::cout << "Found FGRP form: " << fgrpSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FGRP form: " << fgrpSize << " bytes\n";
 
 	std::size_t size;
 	std::string form, type;
 	base::peekHeader(file, form, size, type);
 	_version = base::tagToVersion(type);
 	if ((1 > _version) || (_version > 8)) {
-		std::cout << "Expected type [0001...0008]: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0001...0008]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Flora Group version: " << _version << "\n";
+	SWG_LOG(LOG_INFO) << "Flora Group version: " << _version << "\n";
 
 	switch (_version) {
 	case 1: total += readV1(file); break;
@@ -60,17 +63,21 @@ std::size_t fgrp::read(std::istream& file) {
 	case 7: total += readV7(file); break;
 	case 8: total += readV8(file); break;
 	default:
-		std::cout << "Unexpected version: " << _version << "\n";
-		exit(0);
+		{
+			std::ostringstream msg;
+			msg << "Unexpected version: " << _version;
+			base::fail(file, "FGRP", msg.str());
+		}
 	}
 
 	if (fgrpSize == total) {
-		std::cout << "Finished reading FGRP\n";
+		SWG_LOG(LOG_INFO) << "Finished reading FGRP\n";
 	}
 	else {
-		std::cout << "Failed in reading FGRP\n";
-		std::cout << "Read " << total << " out of " << fgrpSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading FGRP: ";
+		msg << "Read " << total << " out of " << fgrpSize;
+		base::fail(file, "FGRP", msg.str());
 	}
 
 	return total;
@@ -80,7 +87,7 @@ const std::vector<fgrp::family>& fgrp::getFamily() const {
 	return _family;
 }
 
-std::size_t fgrp::readV1(std::istream& file) {
+std::size_t fgrp::readV1(iffReader& file) {
 	std::size_t size0001;
 	std::size_t total = base::readFormHeader(file, "0001", size0001);
 	size0001 += 8;
@@ -110,18 +117,19 @@ std::size_t fgrp::readV1(std::istream& file) {
 	}
 
 	if (size0001 == total) {
-		std::cout << "Finished reading 0001\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0001\n";
 	}
 	else {
-		std::cout << "Failed in reading 0001\n";
-		std::cout << "Read " << total << " out of " << size0001 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0001: ";
+		msg << "Read " << total << " out of " << size0001;
+		base::fail(file, "0001", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t fgrp::readV2(std::istream& file) {
+std::size_t fgrp::readV2(iffReader& file) {
 	std::size_t size0002;
 	std::size_t total = base::readFormHeader(file, "0002", size0002);
 	size0002 += 8;
@@ -153,18 +161,19 @@ std::size_t fgrp::readV2(std::istream& file) {
 	}
 
 	if (size0002 == total) {
-		std::cout << "Finished reading 0002\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0002\n";
 	}
 	else {
-		std::cout << "Failed in reading 0002\n";
-		std::cout << "Read " << total << " out of " << size0002 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0002: ";
+		msg << "Read " << total << " out of " << size0002;
+		base::fail(file, "0002", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t fgrp::readV3(std::istream& file) {
+std::size_t fgrp::readV3(iffReader& file) {
 	std::size_t size0003;
 	std::size_t total = base::readFormHeader(file, "0003", size0003);
 	size0003 += 8;
@@ -195,18 +204,19 @@ std::size_t fgrp::readV3(std::istream& file) {
 	}
 
 	if (size0003 == total) {
-		std::cout << "Finished reading 0003\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0003\n";
 	}
 	else {
-		std::cout << "Failed in reading 0003\n";
-		std::cout << "Read " << total << " out of " << size0003 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0003: ";
+		msg << "Read " << total << " out of " << size0003;
+		base::fail(file, "0003", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t fgrp::readV4(std::istream& file) {
+std::size_t fgrp::readV4(iffReader& file) {
 	std::size_t size0004;
 	std::size_t total = base::readFormHeader(file, "0004", size0004);
 	size0004 += 8;
@@ -235,18 +245,19 @@ std::size_t fgrp::readV4(std::istream& file) {
 	}
 
 	if (size0004 == total) {
-		std::cout << "Finished reading 0004\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0004\n";
 	}
 	else {
-		std::cout << "Failed in reading 0004\n";
-		std::cout << "Read " << total << " out of " << size0004 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0004: ";
+		msg << "Read " << total << " out of " << size0004;
+		base::fail(file, "0004", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t fgrp::readV5(std::istream& file) {
+std::size_t fgrp::readV5(iffReader& file) {
 	std::size_t size0005;
 	std::size_t total = base::readFormHeader(file, "0005", size0005);
 	size0005 += 8;
@@ -279,18 +290,19 @@ std::size_t fgrp::readV5(std::istream& file) {
 	}
 
 	if (size0005 == total) {
-		std::cout << "Finished reading 0005\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0005\n";
 	}
 	else {
-		std::cout << "Failed in reading 0005\n";
-		std::cout << "Read " << total << " out of " << size0005 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0005: ";
+		msg << "Read " << total << " out of " << size0005;
+		base::fail(file, "0005", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t fgrp::readV6(std::istream& file) {
+std::size_t fgrp::readV6(iffReader& file) {
 	std::size_t size0006;
 	std::size_t total = base::readFormHeader(file, "0006", size0006);
 	size0006 += 8;
@@ -325,18 +337,19 @@ std::size_t fgrp::readV6(std::istream& file) {
 	}
 
 	if (size0006 == total) {
-		std::cout << "Finished reading 0006\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0006\n";
 	}
 	else {
-		std::cout << "Failed in reading 0006\n";
-		std::cout << "Read " << total << " out of " << size0006 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0006: ";
+		msg << "Read " << total << " out of " << size0006;
+		base::fail(file, "0006", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t fgrp::readV7(std::istream& file) {
+std::size_t fgrp::readV7(iffReader& file) {
 	std::size_t size0007;
 	std::size_t total = base::readFormHeader(file, "0007", size0007);
 	size0007 += 8;
@@ -372,18 +385,19 @@ std::size_t fgrp::readV7(std::istream& file) {
 	}
 
 	if (size0007 == total) {
-		std::cout << "Finished reading 0007\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0007\n";
 	}
 	else {
-		std::cout << "Failed in reading 0007\n";
-		std::cout << "Read " << total << " out of " << size0007 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0007: ";
+		msg << "Read " << total << " out of " << size0007;
+		base::fail(file, "0007", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t fgrp::readV8(std::istream& file) {
+std::size_t fgrp::readV8(iffReader& file) {
 	std::size_t size0008;
 	std::size_t total = base::readFormHeader(file, "0008", size0008);
 	size0008 += 8;
@@ -404,7 +418,7 @@ std::size_t fgrp::readV8(std::istream& file) {
 		newFamily.floats = (0 != floatsInt);
 		total += base::read(file, newFamily.numChildren);
 
-		std::cout
+		SWG_LOG(LOG_DEBUG)
 			<< "Family name: " << newFamily.name << "\n"
 			<< "Density: " << newFamily.density << "\n"
 			<< "Floats: " << std::boolalpha << newFamily.floats << "\n"
@@ -423,7 +437,7 @@ std::size_t fgrp::readV8(std::istream& file) {
 			total += base::read(file, temp); child.shouldScale = (0 != temp);
 			total += base::read(file, child.minimumScale);
 			total += base::read(file, child.maximumScale);
-			std::cout << "Child appearance: " << child.appearanceName << "\n"
+			SWG_LOG(LOG_DEBUG) << "Child appearance: " << child.appearanceName << "\n"
 				<< "Child weight: " << child.weight << "\n"
 				<< "Child should sway: " << std::boolalpha << child.shouldSway << "\n"
 				<< "Child displacement: " << child.displacement << "\n"
@@ -437,12 +451,13 @@ std::size_t fgrp::readV8(std::istream& file) {
 	}
 
 	if (size0008 == total) {
-		std::cout << "Finished reading 0008\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0008\n";
 	}
 	else {
-		std::cout << "Failed in reading 0008\n";
-		std::cout << "Read " << total << " out of " << size0008 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0008: ";
+		msg << "Read " << total << " out of " << size0008;
+		base::fail(file, "0008", msg.str());
 	}
 
 	return total;
@@ -29,9 +29,11 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/flor.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -50,12 +52,12 @@ std::size_t flor::readFLOR(std::istream& file)
 
 	std::size_t total = base::readFormHeader(file, "FLOR", florSize);
 	florSize += 8;
-	std::cout << "Found FLOR form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found FLOR form" << std::endl;
 
 	std::size_t size;
 	total += base::readFormHeader(file, "0006", size);
 	size += 8;
-	std::cout << "Found 0006 form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found 0006 form" << std::endl;
 
 	total += readVERT(file);
 	total += readTRIS(file);
@@ -65,12 +67,12 @@ std::size_t flor::readFLOR(std::istream& file)
 
 	if (total == florSize)
 	{
-		std::cout << "Finished reading FLOR." << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading FLOR." << std::endl;
 	}
 	else
 	{
-		std::cout << "Error reading FLOR!" << std::endl;
-		std::cout << "Read " << total << " out of " << florSize
+		SWG_LOG(LOG_ERROR) << "Error reading FLOR!" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << florSize
 			<< std::endl;
 	}
 
@@ -86,36 +88,37 @@ std::size_t flor::readVERT(std::istream& file)
 	vertSize += 8;
 	if (type != "VERT")
 	{
-		std::cout << "Expected record of type VERT: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type VERT: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found VERT record" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found VERT record" << std::endl;
 
 	unsigned int numVerts;
 	total += base::read(file, numVerts);
-	std::cout << "Number of vertices: " << numVerts << std::endl;
+	SWG_LOG(LOG_INFO) << "Number of vertices: " << numVerts << std::endl;
 
 	vertex.resize(numVerts * 3);
 	unsigned int numBytes = numVerts * 3 * sizeof(float);
 	file.read((char*)&(vertex[0]), numBytes);
 	total += numBytes;
 
-	std::cout << std::fixed;
+	SWG_LOG(LOG_INFO) << std::fixed;
 	for (unsigned int i = 0; i < numVerts; ++i)
 	{
-		std::cout << vertex[(i * 3)] << ", "
+		SWG_LOG(LOG_DEBUG) << vertex[(i * 3)] << ", "
 			<< vertex[(i * 3) + 1] << ", "
 			<< vertex[(i * 3) + 2] << std::endl;
 	}
 
 	if (vertSize == total)
 	{
-		std::cout << "Finished reading VERT" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading VERT" << std::endl;
 	}
 	else
 	{
-		std::cout << "Failed in reading VERT" << std::endl;
-		std::cout << "Read " << total << " out of " << vertSize
+		SWG_LOG(LOG_ERROR) << "Failed in reading VERT" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << vertSize
 			<< std::endl;
 	}
 
@@ -131,76 +134,77 @@ std::size_t flor::readTRIS(std::istream& file)
 	trisSize += 8;
 	if (type != "TRIS")
 	{
-		std::cout << "Expected record of type TRIS: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type TRIS: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found TRIS record" << std::endl;
-	std::cout << "Size: " << trisSize << std::endl;
+	SWG_LOG(LOG_INFO) << "Found TRIS record" << std::endl;
+	SWG_LOG(LOG_INFO) << "Size: " << trisSize << std::endl;
 
 	unsigned int numTris;
 	total += base::read(file, numTris);
-	std::cout << "Number of triangles: " << numTris << std::endl;
+	SWG_LOG(LOG_INFO) << "Number of triangles: " << numTris << std::endl;
 
 	for (unsigned int i = 0; i < numTris; ++i)
 	{
 		int u1;
 		total += base::read(file, u1);
-		std::cout << u1 << std::endl;
+		SWG_LOG(LOG_DEBUG) << u1 << std::endl;
 
 		total += base::read(file, u1);
-		std::cout << u1 << std::endl;
+		SWG_LOG(LOG_DEBUG) << u1 << std::endl;
 
 		total += base::read(file, u1);
-		std::cout << u1 << std::endl;
+		SWG_LOG(LOG_DEBUG) << u1 << std::endl;
 
 		total += base::read(file, u1);
-		std::cout << u1 << std::endl;
+		SWG_LOG(LOG_DEBUG) << u1 << std::endl;
 
 		total += base::read(file, u1);
-		std::cout << u1 << std::endl;
+		SWG_LOG(LOG_DEBUG) << u1 << std::endl;
 
 		total += base::read(file, u1);
-		std::cout << u1 << std::endl;
+		SWG_LOG(LOG_DEBUG) << u1 << std::endl;
 
 		total += base::read(file, u1);
-		std::cout << u1 << std::endl;
+		SWG_LOG(LOG_DEBUG) << u1 << std::endl;
 
 		float u2;
 		total += base::read(file, u2);
-		std::cout << u2 << std::endl;
+		SWG_LOG(LOG_DEBUG) << u2 << std::endl;
 
 		total += base::read(file, u2);
-		std::cout << u2 << std::endl;
+		SWG_LOG(LOG_DEBUG) << u2 << std::endl;
 
 		total += base::read(file, u2);
-		std::cout << u2 << std::endl;
+		SWG_LOG(LOG_DEBUG) << u2 << std::endl;
 
 		total += base::read(file, u2);
-		std::cout << u2 << std::endl;
+		SWG_LOG(LOG_DEBUG) << u2 << std::endl;
 
 		total += base::read(file, u1);
-		std::cout << u1 << std::endl;
+		SWG_LOG(LOG_DEBUG) << u1 << std::endl;
 
 		total += base::read(file, u1);
-		std::cout << u1 << std::endl;
+		SWG_LOG(LOG_DEBUG) << u1 << std::endl;
 
 		total += base::read(file, u1);
-		std::cout << u1 << std::endl;
+		SWG_LOG(LOG_DEBUG) << u1 << std::endl;
 
 		total += base::read(file, u1);
-		std::cout << u1 << std::endl;
+		SWG_LOG(LOG_DEBUG) << u1 << std::endl;
 
-		std::cout << std::endl;
+		SWG_LOG(LOG_DEBUG) << std::endl;
 	}
 
 	if (trisSize == total)
 	{
-		std::cout << "Finished reading TRIS" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading TRIS" << std::endl;
 	}
 	else
 	{
-		std::cout << "Failed in reading TRIS" << std::endl;
-		std::cout << "Read " << total << " out of " << trisSize
+		SWG_LOG(LOG_ERROR) << "Failed in reading TRIS" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << trisSize
 			<< std::endl;
 	}
 
@@ -29,9 +29,11 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/foot.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -48,29 +50,28 @@ unsigned int foot::readFOOT(std::istream& file)
 	std::size_t footSize;
 	std::size_t total = readFormHeader(file, "FOOT", footSize);
 	footSize += 8;
-	std::cout << "Found FOOT form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found FOOT form" << std::endl;
 
 	std::size_t size;
 	std::string form, type;
 	total += readFormHeader(file, form, size, type);
 	if (form != "FORM")
 	{
-		std::cout << "Expected Form" << std::endl;
-		exit(0);
+		base::fail(file, form, "Expected Form");
 	}
-	std::cout << "Found form of type: " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found form of type: " << type << std::endl;
 
 	total += readINFO(file);
 	total += readPRNT(file);
 
 	if (footSize == total)
 	{
-		std::cout << "Finished reading FOOT" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading FOOT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading FOOT" << std::endl;
-		std::cout << "Read " << total << " out of " << footSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading FOOT" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << footSize
 			<< std::endl;
 	}
 
@@ -86,38 +87,39 @@ unsigned int foot::readINFO(std::istream& file)
 	infoSize += 8;
 	if (type != "INFO")
 	{
-		std::cout << "Expected record of type INFO: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type INFO: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	unsigned int x;
 	total += base::read(file, numColumns);
-	std::cout << "Number columns: " << numColumns << std::endl;
+	SWG_LOG(LOG_INFO) << "Number columns: " << numColumns << std::endl;
 
 	total += base::read(file, numRows);
-	std::cout << "Num rows: " << numRows << std::endl;
+	SWG_LOG(LOG_INFO) << "Num rows: " << numRows << std::endl;
 
 	total += base::read(file, x);
-	std::cout << "???: " << x << std::endl;
+	SWG_LOG(LOG_INFO) << "???: " << x << std::endl;
 
 	total += base::read(file, x);
-	std::cout << "???: " << x << std::endl;
+	SWG_LOG(LOG_INFO) << "???: " << x << std::endl;
 
 	total += base::read(file, blockWidth);
-	std::cout << std::fixed << blockWidth << std::endl;
+	SWG_LOG(LOG_INFO) << std::fixed << blockWidth << std::endl;
 
 	total += base::read(file, blockHeight);
-	std::cout << std::fixed << blockHeight << std::endl;
+	SWG_LOG(LOG_INFO) << std::fixed << blockHeight << std::endl;
 
 	if (infoSize == total)
 	{
-		std::cout << "Finished reading INFO" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading INFO" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading INFO" << std::endl;
-		std::cout << "Read " << total << " out of " << infoSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading INFO" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << infoSize
 			<< std::endl;
 	}
 
@@ -132,26 +134,27 @@ unsigned int foot::readPRNT(std::istream& file)
 	prntSize += 8;
 	if (type != "PRNT")
 	{
-		std::cout << "Expected record of type PRNT: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type PRNT: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	for (unsigned int i = 0; i < numRows; ++i)
 	{
 		std::string prntString;
 		total += base::read(file, prntString);
-		std::cout << prntString << std::endl;
+		SWG_LOG(LOG_DEBUG) << prntString << std::endl;
 	}
 
 	if (prntSize == total)
 	{
-		std::cout << "Finished reading PRNT" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading PRNT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading PRNT" << std::endl;
-		std::cout << "Read " << total << " out of " << prntSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading PRNT" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << prntSize
 			<< std::endl;
 	}
 
@@ -25,6 +25,8 @@
 
 #include <swgLib/hdta.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -34,16 +36,16 @@ hdta::hdta() {
 hdta::~hdta() {
 }
 
-std::size_t hdta::read(std::istream& file) {
+std::size_t hdta::read(iffReader& file) {
 	std::string hdtaForm;
 	std::size_t hdtaSize;
 	std::size_t total = base::readFormHeader(file, hdtaForm, hdtaSize);
 	hdtaSize += 8;
 	if (("HDTA" != hdtaForm) && ("ROAD" != hdtaForm)) {
-		std::cout << "Expected HDTA/ROAD. Found form: " << hdtaForm << "\n";
+		SWG_LOG(LOG_INFO) << "Expected HDTA/ROAD. Found form: " << hdtaForm << "\n";
 		return 0;
 	}
-	std::cout << "Found HDTA/ROAD form: " << hdtaSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found HDTA/ROAD form: " << hdtaSize << " bytes\n";
 
 	std::size_t size;
 	std::string type;
@@ -51,10 +53,11 @@ std::size_t hdta::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 1) {
-		std::cout << "Expected type [0000..0001]: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0000..0001]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "HDTA/ROAD version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "HDTA/ROAD version: " << version << "\n";
 
 	if (0 == version) {
 		while (total < hdtaSize) {
@@ -70,25 +73,26 @@ std::size_t hdta::read(std::istream& file) {
 	}
 
 	if (hdtaSize == total) {
-		std::cout << "Finished reading HDTA/ROAD\n";
+		SWG_LOG(LOG_INFO) << "Finished reading HDTA/ROAD\n";
 	}
 	else {
-		std::cout << "Failed in reading HDTA/ROAD\n";
-		std::cout << "Read " << total << " out of " << hdtaSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading HDTA/ROAD: ";
+		msg << "Read " << total << " out of " << hdtaSize;
+		base::fail(file, "HDTA", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t hdta::read(std::istream& file, point& newPoint) {
+std::size_t hdta::read(iffReader& file, point& newPoint) {
 	std::size_t total = base::read(file, newPoint.x);
 	total += base::read(file, newPoint.y);
 	total += base::read(file, newPoint.z);
 	return total;
 }
 
-std::size_t hdta::read(std::istream& file, segment& newSegment) {
+std::size_t hdta::read(iffReader& file, segment& newSegment) {
 	std::size_t sgmtSize;
 	std::size_t total = base::readRecordHeader(file, "SGMT", sgmtSize);
 	sgmtSize += 8;
@@ -99,9 +103,10 @@ std::size_t hdta::read(std::istream& file, segment& newSegment) {
 	}
 
 	if (total != sgmtSize) {
-		std::cout << "Failed in reading SGMT\n";
-		std::cout << "Read " << total << " out of " << sgmtSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading SGMT: ";
+		msg << "Read " << total << " out of " << sgmtSize;
+		base::fail(file, "SGMT", msg.str());
 	}
 	return total;
 }
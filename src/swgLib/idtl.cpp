@@ -25,6 +25,7 @@
 
 #include <swgLib/idtl.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 
 using namespace ml;
 
@@ -38,25 +39,25 @@ std::size_t idtl::read(std::istream& file) {
 	std::size_t idtlSize;
 	std::size_t total = base::readFormHeader(file, "IDTL", idtlSize);
 	idtlSize += 8;
-	std::cout << "Found IDTL FORM: " << idtlSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found IDTL FORM: " << idtlSize - 12 << " bytes\n";
 
 	std::size_t size;
 	std::string form, type;
 	total += base::readFormHeader(file, "0000", size);
 	size += 8;
-	std::cout << "Found 0000 FORM: " << size - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found 0000 FORM: " << size - 12 << " bytes\n";
 
 	total += readVERT(file, _vertex);
 	total += readINDX(file, _index);
 
 	if (idtlSize == total)
 	{
-		std::cout << "Finished reading IDTL" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading IDTL" << std::endl;
 	}
 	else
 	{
-		std::cout << "Failed in reading IDTL" << std::endl;
-		std::cout << "Read " << total << " out of " << idtlSize
+		SWG_LOG(LOG_ERROR) << "Failed in reading IDTL" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << idtlSize
 			<< std::endl;
 	}
 
@@ -68,27 +69,27 @@ std::size_t idtl::readVERT(std::istream& file, std::vector<vector3>& vec)
 	std::size_t vertSize;
 	std::size_t total = base::readRecordHeader(file, "VERT", vertSize);
 	vertSize += 8;
-	std::cout << "Found VERT record" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found VERT record" << std::endl;
 
 	unsigned int numVerts = (vertSize - 8) / (sizeof(float) * 3);
-	std::cout << "Number of vertices: " << numVerts << std::endl;
+	SWG_LOG(LOG_INFO) << "Number of vertices: " << numVerts << std::endl;
 	vec.resize(numVerts);
 
 	for (auto& v : vec) {
 		total += v.read(file);
 
-		std::cout << "Vertex: " << v << "\n";
+		SWG_LOG(LOG_DEBUG) << "Vertex: " << v << "\n";
 
 	}
 
 	if (vertSize == total)
 	{
-		std::cout << "Finished reading VERT" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading VERT" << std::endl;
 	}
 	else
 	{
-		std::cout << "Failed in reading VERT" << std::endl;
-		std::cout << "Read " << total << " out of " << vertSize
+		SWG_LOG(LOG_ERROR) << "Failed in reading VERT" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << vertSize
 			<< std::endl;
 	}
 
@@ -100,7 +101,7 @@ std::size_t idtl::readINDX(std::istream& file, std::vector<int32_t>& index)
 	std::size_t indxSize;
 	std::size_t total = base::readRecordHeader(file, "INDX", indxSize);
 	indxSize += 8;
-	std::cout << "Found INDX record" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found INDX record" << std::endl;
 
 	int32_t numIndex = (indxSize - 8) / sizeof(int32_t);
 	index.resize(numIndex);
@@ -108,13 +109,13 @@ std::size_t idtl::readINDX(std::istream& file, std::vector<int32_t>& index)
 	for (auto& i : index) {
 		total += base::read(file, i);
 		if (0 == count) {
-			std::cout << "Triangle: ";
+			SWG_LOG(LOG_DEBUG) << "Triangle: ";
 		}
 
-		std::cout << i << ", ";
+		SWG_LOG(LOG_DEBUG) << i << ", ";
 
 		if (2 == count) {
-			std::cout << "\n";
+			SWG_LOG(LOG_DEBUG) << "\n";
 			count = 0;
 		}
 		else { ++count; }
@@ -122,12 +123,12 @@ std::size_t idtl::readINDX(std::istream& file, std::vector<int32_t>& index)
 
 	if (indxSize == total)
 	{
-		std::cout << "Finished reading INDX" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading INDX" << std::endl;
 	}
 	else
 	{
-		std::cout << "Failed in reading INDX" << std::endl;
-		std::cout << "Read " << total << " out of " << indxSize
+		SWG_LOG(LOG_ERROR) << "Failed in reading INDX" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << indxSize
 			<< std::endl;
 	}
 
@@ -0,0 +1,317 @@
+/** -*-c++-*-
+ *  \class  iffIndex
+ *  \file   iffIndex.cpp
+ *  \author Ken Sewell
+
+ swgLib is used for the parsing and exporting SWG models.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of swgLib.
+
+ swgLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ swgLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with swgLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <swgLib/iffIndex.hpp>
+
+#include <cstring>
+
+using namespace ml;
+
+const uint32_t iffIndex::npos;
+
+// Path element matching any name; not a valid four character tag.
+static const uint32_t wildcard = 0;
+
+static uint32_t loadBigEndian(const char* ptr)
+{
+	const unsigned char* p = reinterpret_cast<const unsigned char*>(ptr);
+	return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16)
+		| (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+}
+
+iffIndex::iffIndex() :
+	_data(nullptr),
+	_size(0),
+	_good(false)
+{
+}
+
+iffIndex::~iffIndex()
+{
+}
+
+bool iffIndex::load(std::istream& file)
+{
+	clear();
+
+	std::shared_ptr<std::vector<char>> buffer =
+		std::make_shared<std::vector<char>>();
+	if (!iffReader::readChunk(file, *buffer) && buffer->empty())
+	{
+		return false;
+	}
+
+	_buffer = buffer;
+	_data = _buffer->data();
+	_size = _buffer->size();
+	walk();
+
+	return _good;
+}
+
+bool iffIndex::build(const char* data, const std::size_t& size)
+{
+	clear();
+	_data = data;
+	_size = size;
+	walk();
+
+	return _good;
+}
+
+bool iffIndex::build(const iffIndex& parent, const uint32_t& index)
+{
+	if (index >= parent.size())
+	{
+		clear();
+		return false;
+	}
+
+	// Take the parent's buffer before clear() in case parent is *this.
+	std::shared_ptr<std::vector<char>> buffer = parent._buffer;
+	const chunk& c = parent._chunks[index];
+	const char* data = parent._data + c.offset;
+	const std::size_t size = c.totalSize();
+
+	clear();
+	_buffer = buffer;
+	_data = data;
+	_size = size;
+	walk();
+
+	return _good;
+}
+
+void iffIndex::clear()
+{
+	_buffer.reset();
+	_data = nullptr;
+	_size = 0;
+	_chunks.clear();
+	_good = false;
+}
+
+void iffIndex::walk()
+{
+	_chunks.clear();
+	_good = true;
+
+	struct level
+	{
+		uint32_t form;
+		std::size_t end;
+		uint32_t last;
+	};
+
+	std::vector<level> stack;
+	stack.push_back({ npos, _size, npos });
+
+	std::size_t position = 0;
+	while (!stack.empty())
+	{
+		level& current = stack.back();
+		if (position >= current.end)
+		{
+			position = current.end;
+			stack.pop_back();
+			continue;
+		}
+
+		if (current.end - position < 8)
+		{
+			_good = false;
+			position = current.end;
+			continue;
+		}
+
+		chunk c;
+		c.tag = loadBigEndian(_data + position);
+		c.size = loadBigEndian(_data + position + 4);
+		c.type = 0;
+		c.offset = position;
+		c.parent = current.form;
+		c.next = npos;
+		c.depth = uint32_t(stack.size() - 1);
+
+		if (c.size > current.end - position - 8)
+		{
+			// Truncated or corrupt: clamp to what is there so the
+			// readable part is still indexed.
+			_good = false;
+			c.size = current.end - position - 8;
+		}
+
+		const uint32_t index = uint32_t(_chunks.size());
+		if (npos != current.last)
+		{
+			_chunks[current.last].next = index;
+		}
+		current.last = index;
+
+		if (c.isForm() && c.size >= 4)
+		{
+			c.type = loadBigEndian(_data + position + 8);
+			_chunks.push_back(c);
+
+			const std::size_t end = position + c.totalSize();
+			position += 12;
+			stack.push_back({ index, end, npos });
+		}
+		else
+		{
+			_chunks.push_back(c);
+			position += c.totalSize();
+		}
+	}
+}
+
+uint32_t iffIndex::firstChild(const uint32_t& parent) const
+{
+	if (npos == parent)
+	{
+		return (_chunks.empty() ? npos : 0);
+	}
+
+	// Children directly follow their FORM in walk order.
+	const uint32_t child = parent + 1;
+	if ((child < _chunks.size()) && (_chunks[child].parent == parent))
+	{
+		return child;
+	}
+	return npos;
+}
+
+uint32_t iffIndex::nextSibling(const uint32_t& index) const
+{
+	return ((index < _chunks.size()) ? _chunks[index].next : npos);
+}
+
+uint32_t iffIndex::findChild(const uint32_t& parent, const uint32_t& name) const
+{
+	for (uint32_t i = firstChild(parent); npos != i; i = _chunks[i].next)
+	{
+		if (_chunks[i].name() == name)
+		{
+			return i;
+		}
+	}
+	return npos;
+}
+
+uint32_t iffIndex::findChild(const uint32_t& parent, const std::string& name) const
+{
+	return findChild(parent, tagFromStr(name));
+}
+
+uint32_t iffIndex::countChildren(const uint32_t& parent, const uint32_t& name) const
+{
+	uint32_t count = 0;
+	for (uint32_t i = firstChild(parent); npos != i; i = _chunks[i].next)
+	{
+		if (_chunks[i].name() == name)
+		{
+			++count;
+		}
+	}
+	return count;
+}
+
+uint32_t iffIndex::find(const std::string& path) const
+{
+	std::vector<uint32_t> names;
+	std::size_t start = 0;
+	while (start <= path.size())
+	{
+		std::size_t end = path.find('/', start);
+		if (std::string::npos == end)
+		{
+			end = path.size();
+		}
+
+		const std::string name(path.substr(start, end - start));
+		names.push_back(("*" == name) ? wildcard : tagFromStr(name));
+		start = end + 1;
+	}
+
+	return findPath(npos, names, 0);
+}
+
+uint32_t iffIndex::findPath(const uint32_t& parent,
+	const std::vector<uint32_t>& names,
+	const std::size_t& level) const
+{
+	for (uint32_t i = firstChild(parent); npos != i; i = _chunks[i].next)
+	{
+		if ((wildcard != names[level]) && (_chunks[i].name() != names[level]))
+		{
+			continue;
+		}
+
+		if (level + 1 == names.size())
+		{
+			return i;
+		}
+
+		const uint32_t found = findPath(i, names, level + 1);
+		if (npos != found)
+		{
+			return found;
+		}
+	}
+	return npos;
+}
+
+uint32_t iffIndex::findAny(const uint32_t& name) const
+{
+	for (uint32_t i = 0; i < _chunks.size(); ++i)
+	{
+		if (_chunks[i].name() == name)
+		{
+			return i;
+		}
+	}
+	return npos;
+}
+
+iffReader iffIndex::reader(const uint32_t& index) const
+{
+	if (index >= _chunks.size())
+	{
+		return iffReader();
+	}
+	const chunk& c = _chunks[index];
+	return iffReader(_data + c.offset, c.totalSize());
+}
+
+uint32_t iffIndex::tagFromStr(const std::string& tag)
+{
+	// Short tags are space padded, as in "DYN ".
+	char t[4] = { ' ', ' ', ' ', ' ' };
+	for (std::size_t i = 0; (i < 4) && (i < tag.size()); ++i)
+	{
+		t[i] = tag[i];
+	}
+	return loadBigEndian(t);
+}
@@ -0,0 +1,293 @@
+/** -*-c++-*-
+ *  \class  iffReader
+ *  \file   iffReader.cpp
+ *  \author Ken Sewell
+
+ swgLib is used for the parsing and exporting SWG models.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of swgLib.
+
+ swgLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ swgLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with swgLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <swgLib/iffReader.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+using namespace ml;
+
+iffReader::iffReader() :
+	_data(nullptr),
+	_size(0),
+	_position(0),
+	_fail(false)
+{
+}
+
+iffReader::iffReader(const char* data, const std::size_t& size) :
+	_data(data),
+	_size(size),
+	_position(0),
+	_fail(false)
+{
+}
+
+// Moving the vector keeps its storage, so _data stays valid.
+iffReader::iffReader(iffReader&& reader) :
+	_buffer(std::move(reader._buffer)),
+	_data(reader._data),
+	_size(reader._size),
+	_position(reader._position),
+	_fail(reader._fail)
+{
+	reader._data = nullptr;
+	reader._size = 0;
+	reader._position = 0;
+}
+
+iffReader& iffReader::operator=(iffReader&& reader)
+{
+	if (this != &reader)
+	{
+		_buffer = std::move(reader._buffer);
+		_data = reader._data;
+		_size = reader._size;
+		_position = reader._position;
+		_fail = reader._fail;
+
+		reader._data = nullptr;
+		reader._size = 0;
+		reader._position = 0;
+	}
+	return *this;
+}
+
+iffReader::~iffReader()
+{
+}
+
+bool iffReader::load(std::istream& file)
+{
+	_fail = !readChunk(file, _buffer);
+	_data = (_buffer.empty() ? nullptr : _buffer.data());
+	_size = _buffer.size();
+	_position = 0;
+
+	return !_fail;
+}
+
+bool iffReader::readChunk(std::istream& file, std::vector<char>& buffer)
+{
+	char header[8];
+	buffer.clear();
+	file.read(header, sizeof(header));
+	if (file.gcount() != sizeof(header))
+	{
+		return false;
+	}
+
+	const unsigned char* p = reinterpret_cast<const unsigned char*>(header + 4);
+	const std::size_t chunkSize = (std::size_t(p[0]) << 24)
+		| (std::size_t(p[1]) << 16) | (std::size_t(p[2]) << 8) | p[3];
+
+	// Clamp to what a seekable stream has left. Otherwise grow the buffer
+	// as data arrives rather than trusting the header up front.
+	std::size_t left = chunkSize;
+	std::size_t step = std::size_t(1) << 20;
+	const std::streampos start = file.tellg();
+	if (std::streampos(-1) != start)
+	{
+		file.seekg(0, std::ios_base::end);
+		const std::streampos end = file.tellg();
+		file.seekg(start);
+		if ((std::streampos(-1) != end) && (end >= start))
+		{
+			left = std::min(left, std::size_t(end - start));
+			step = left;
+		}
+	}
+
+	buffer.reserve(sizeof(header) + std::min(left, step));
+	buffer.assign(header, header + sizeof(header));
+	while (left > 0)
+	{
+		const std::size_t offset = buffer.size();
+		const std::size_t wanted = std::min(left, step);
+		buffer.resize(offset + wanted);
+		file.read(buffer.data() + offset, wanted);
+		const std::size_t got = std::size_t(file.gcount());
+		buffer.resize(offset + got);
+		if (got != wanted)
+		{
+			break;
+		}
+		left -= got;
+	}
+
+	return (sizeof(header) + chunkSize == buffer.size());
+}
+
+bool iffReader::loadAll(std::istream& file)
+{
+	_buffer.assign(std::istreambuf_iterator<char>(file),
+		std::istreambuf_iterator<char>());
+	_data = _buffer.data();
+	_size = _buffer.size();
+	_position = 0;
+	_fail = false;
+
+	return true;
+}
+
+void iffReader::assign(const char* data, const std::size_t& size)
+{
+	_buffer.clear();
+	_data = data;
+	_size = size;
+	_position = 0;
+	_fail = false;
+}
+
+iffReader iffReader::chunk(const std::size_t& size)
+{
+	if (size > remaining())
+	{
+		setFail();
+		iffReader empty;
+		empty._fail = true;
+		return empty;
+	}
+
+	iffReader child(_data + _position, size);
+	_position += size;
+	return child;
+}
+
+bool iffReader::seek(const std::size_t& position)
+{
+	if (position > _size)
+	{
+		setFail();
+		return false;
+	}
+	_position = position;
+	return true;
+}
+
+std::size_t iffReader::skip(const std::size_t& bytes)
+{
+	if (bytes > remaining())
+	{
+		setFail();
+	}
+	else
+	{
+		_position += bytes;
+	}
+	return bytes;
+}
+
+std::size_t iffReader::read(std::string& data)
+{
+	if (eof())
+	{
+		data.clear();
+		setFail();
+		return 1;
+	}
+
+	const char* start = _data + _position;
+	const char* end = static_cast<const char*>(
+		std::memchr(start, 0, remaining())
+		);
+	if (nullptr == end)
+	{
+		// Unterminated: keep what is there, but flag it.
+		data.assign(start, remaining());
+		const std::size_t total = data.size() + 1;
+		setFail();
+		return total;
+	}
+
+	data.assign(start, end);
+	_position += data.size() + 1;
+	return data.size() + 1;
+}
+
+std::size_t iffReader::read(std::string& data, const std::size_t& length)
+{
+	// Same semantics as base::read(file, data, length): embedded nulls
+	// become spaces and the final byte is dropped.
+	data.resize(length);
+	if (0 == length)
+	{
+		return 0;
+	}
+	read(&data[0], length);
+	for (auto& c : data)
+	{
+		if (0 == c) { c = ' '; }
+	}
+	data.resize(length - 1);
+	return length;
+}
+
+bool iffReader::peekHeader(uint32_t& form, std::size_t& size, uint32_t& type) const
+{
+	form = 0;
+	size = 0;
+	type = 0;
+	if (remaining() < 8)
+	{
+		return false;
+	}
+
+	const unsigned char* p =
+		reinterpret_cast<const unsigned char*>(_data + _position);
+	form = (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16)
+		| (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+	size = (std::size_t(p[4]) << 24) | (std::size_t(p[5]) << 16)
+		| (std::size_t(p[6]) << 8) | std::size_t(p[7]);
+
+	// A record at the very end may have no room for a form type.
+	if (remaining() >= 12)
+	{
+		type = (uint32_t(p[8]) << 24) | (uint32_t(p[9]) << 16)
+			| (uint32_t(p[10]) << 8) | uint32_t(p[11]);
+	}
+
+	return true;
+}
+
+std::size_t iffReader::readRecordHeader(uint32_t& type, std::size_t& size)
+{
+	uint32_t tempSize;
+	readBigEndian(type);
+	readBigEndian(tempSize);
+	size = tempSize;
+
+	return 8;
+}
+
+std::size_t iffReader::readFormHeader(uint32_t& form, std::size_t& size, uint32_t& type)
+{
+	readRecordHeader(form, size);
+	readBigEndian(type);
+
+	return 12;
+}
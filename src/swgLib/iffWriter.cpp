@@ -0,0 +1,278 @@
+/** -*-c++-*-
+ *  \class  iffWriter
+ *  \file   iffWriter.cpp
+ *  \author Ken Sewell
+
+ swgLib is used for the parsing and exporting SWG models.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of swgLib.
+
+ swgLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ swgLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with swgLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <swgLib/base.hpp>
+#include <swgLib/iffWriter.hpp>
+#include <treLib/treClass.hpp>
+
+#include <utility>
+
+using namespace ml;
+
+static void storeBigEndian(char* ptr, const uint32_t& data)
+{
+	ptr[0] = char(data >> 24);
+	ptr[1] = char(data >> 16);
+	ptr[2] = char(data >> 8);
+	ptr[3] = char(data);
+}
+
+iffWriter::iffWriter() :
+	_size(0),
+	_fail(false)
+{
+}
+
+iffWriter::iffWriter(const std::size_t& reserve) :
+	_size(0),
+	_fail(false)
+{
+	_buffer.reserve(reserve);
+}
+
+iffWriter::~iffWriter()
+{
+}
+
+void iffWriter::clear()
+{
+	_buffer.clear();
+	_segments.clear();
+	_scopes.clear();
+	_size = 0;
+	_fail = false;
+}
+
+bool iffWriter::beginForm(const std::string& type)
+{
+	return beginForm(iffIndex::tagFromStr(type));
+}
+
+bool iffWriter::beginForm(const uint32_t& type)
+{
+	return beginChunk(tag::TAG_FORM, type, true);
+}
+
+bool iffWriter::endForm()
+{
+	return endChunk(true);
+}
+
+bool iffWriter::beginRecord(const std::string& type)
+{
+	return beginRecord(iffIndex::tagFromStr(type));
+}
+
+bool iffWriter::beginRecord(const uint32_t& type)
+{
+	return beginChunk(type, 0, false);
+}
+
+bool iffWriter::endRecord()
+{
+	return endChunk(false);
+}
+
+bool iffWriter::record(const std::string& type,
+	const char* data,
+	const std::size_t& size)
+{
+	if (!beginRecord(type))
+	{
+		return false;
+	}
+	append(data, size);
+	return endRecord();
+}
+
+std::size_t iffWriter::write(const char* data, const std::size_t& size)
+{
+	if (0 == size)
+	{
+		return 0;
+	}
+
+	const std::size_t offset = _buffer.size();
+	_buffer.insert(_buffer.end(), data, data + size);
+
+	// Extend the last owned run rather than adding a segment per scalar.
+	if (!_segments.empty()
+		&& (nullptr == _segments.back().external)
+		&& (_segments.back().offset + _segments.back().size == offset))
+	{
+		_segments.back().size += size;
+	}
+	else
+	{
+		_segments.push_back({ nullptr, offset, size });
+	}
+
+	_size += size;
+	return size;
+}
+
+std::size_t iffWriter::writeBigEndian(const uint32_t& data)
+{
+	char temp[4];
+	storeBigEndian(temp, data);
+	return write(temp, sizeof(temp));
+}
+
+std::size_t iffWriter::write(const std::string& data)
+{
+	return write(data.c_str(), data.size() + 1);
+}
+
+std::size_t iffWriter::append(const char* data, const std::size_t& size)
+{
+	if (0 == size)
+	{
+		return 0;
+	}
+	_segments.push_back({ data, 0, size });
+	_size += size;
+	return size;
+}
+
+std::size_t iffWriter::append(const iffIndex& index, const uint32_t& chunk)
+{
+	if (chunk >= index.size())
+	{
+		setFail();
+		return 0;
+	}
+
+	const iffIndex::chunk& c = index.at(chunk);
+	if (!_scopes.empty() && !_scopes.back().isForm)
+	{
+		// A chunk can only be nested in a FORM.
+		setFail();
+		return 0;
+	}
+	return append(index.data() + c.offset, c.totalSize());
+}
+
+bool iffWriter::beginChunk(const uint32_t& tag, const uint32_t& type, const bool& isForm)
+{
+	if (!_scopes.empty() && !_scopes.back().isForm)
+	{
+		setFail();
+		return false;
+	}
+
+	writeBigEndian(tag);
+	const std::size_t header = _buffer.size();
+	writeBigEndian(0);
+	_scopes.push_back({ header, _size, isForm });
+
+	if (isForm)
+	{
+		writeBigEndian(type);
+	}
+	return true;
+}
+
+bool iffWriter::endChunk(const bool& isForm)
+{
+	if (_scopes.empty() || (isForm != _scopes.back().isForm))
+	{
+		setFail();
+		return false;
+	}
+
+	const scope s = _scopes.back();
+	_scopes.pop_back();
+
+	const std::size_t chunkSize = _size - s.start;
+	if (chunkSize > 0xffffffff)
+	{
+		setFail();
+		return false;
+	}
+
+	storeBigEndian(&_buffer[s.header], uint32_t(chunkSize));
+	return true;
+}
+
+bool iffWriter::finished() const
+{
+	return (!_fail && _scopes.empty());
+}
+
+bool iffWriter::write(std::ostream& file) const
+{
+	if (!finished())
+	{
+		return false;
+	}
+
+	for (const auto& s : _segments)
+	{
+		const char* data = (s.external ? s.external : _buffer.data() + s.offset);
+		file.write(data, s.size);
+	}
+	return file.good();
+}
+
+bool iffWriter::copyTo(std::vector<char>& data) const
+{
+	if (!finished())
+	{
+		return false;
+	}
+
+	data.resize(_size);
+	gather(data.data());
+	return true;
+}
+
+bool iffWriter::addTo(treClass& tre,
+	const std::string& name,
+	const uint32_t& format) const
+{
+	if (!finished() || (_size > 0xffffffff))
+	{
+		return false;
+	}
+
+	// Gather straight into the record's buffer, which treClass keeps.
+	treDataBlock block;
+	if (!block.allocateUncompressedData(uint32_t(_size)))
+	{
+		return false;
+	}
+	gather(block.getUncompressedDataPtr());
+	return tre.addRecord(name, std::move(block), format);
+}
+
+void iffWriter::gather(char* out) const
+{
+	for (const auto& s : _segments)
+	{
+		const char* in = (s.external ? s.external : _buffer.data() + s.offset);
+		std::memcpy(out, in, s.size);
+		out += s.size;
+	}
+}
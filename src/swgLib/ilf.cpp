@@ -25,8 +25,11 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/ilf.hpp>
+#include <swgLib/logger.hpp>
+#include <iomanip>
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -66,30 +69,28 @@ std::size_t ilf::createILF(std::istream& infile, std::ofstream& outfile)
 		if (infile.eof()) { break; };
 		std::string objectFilename;
 		infile >> objectFilename;
-		std::cout << objectFilename << std::endl;
+		SWG_LOG(LOG_DEBUG) << objectFilename << std::endl;
 		nodeSize += static_cast<unsigned int>(objectFilename.size() + 1);
 
 		infile.getline(temp, 512, ':');
 		std::string objectZone;
 		infile >> objectZone;
-		std::cout << objectZone << std::endl;
+		SWG_LOG(LOG_DEBUG) << objectZone << std::endl;
 		nodeSize += static_cast<unsigned int>(objectZone.size() + 1);
 
 		// 'Transform matrix:' line
 		infile.getline(temp, 512, ':');
 
-		std::cout.flags(std::ios_base::showpoint);
-		std::cout << std::dec;
-		std::cout.flags(std::ios_base::fixed);
+		SWG_LOG(LOG_DEBUG) << std::fixed << std::dec;
 		float x[12];
 		for (unsigned int i = 0; i < 12; ++i)
 		{
-			std::cout.width(10);
+			SWG_LOG(LOG_DEBUG) << std::setw(10);
 			infile >> x[i];
 			nodeSize += sizeof(float);
-			std::cout << x[i] << " ";
+			SWG_LOG(LOG_DEBUG) << x[i] << " ";
 		}
-		std::cout << std::endl;
+		SWG_LOG(LOG_DEBUG) << std::endl;
 
 		// Blank line
 		infile.getline(temp, 512);
@@ -121,7 +122,7 @@ std::size_t ilf::readILF(std::istream& file)
 	std::size_t ilfSize;
 	std::size_t total = base::readFormHeader(file, "INLY", ilfSize);
 	ilfSize += 8;
-	std::cout << "Found INLY form: " << ilfSize << "\n";
+	SWG_LOG(LOG_INFO) << "Found INLY form: " << ilfSize << "\n";
 
 	std::size_t size;
 	total += base::readFormHeader(file, "0000", size);
@@ -133,13 +134,14 @@ std::size_t ilf::readILF(std::istream& file)
 
 	if (ilfSize == total)
 	{
-		std::cout << "Finished reading ILF\n";
+		SWG_LOG(LOG_INFO) << "Finished reading ILF\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading ILF\n"
-			<< "Read " << total << " out of " << ilfSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading ILF: "
+			<< "Read " << total << " out of " << ilfSize;
+		base::fail(file, "ILF ", msg.str());
 	}
 
 	return total;
@@ -153,18 +155,22 @@ std::size_t ilf::readNODE(std::istream& file)
 
 	node newNode;
 	total += newNode.read(file);
-	newNode.print(std::cout);
+	if (logger::enabled(logger::LOG_DEBUG))
+	{
+		newNode.print(logger::stream(logger::LOG_DEBUG));
+	}
 	_nodes.push_back(newNode);
 
 	if (nodeSize == total)
 	{
-		std::cout << "Finished reading NODE\n";
+		SWG_LOG(LOG_INFO) << "Finished reading NODE\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading NODE\n"
-			<< "Read " << total << " out of " << nodeSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading NODE: "
+			<< "Read " << total << " out of " << nodeSize;
+		base::fail(file, "NODE", msg.str());
 	}
 
 	return total;
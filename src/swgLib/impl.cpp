@@ -25,6 +25,8 @@
 
 #include <swgLib/impl.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -38,7 +40,7 @@ std::size_t impl::read(std::istream& file) {
 	std::size_t implSize;
 	std::size_t total = base::readFormHeader(file, "IMPL", implSize);
 	implSize += 8;
-	std::cout << "Found FORM IMPL: " << implSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM IMPL: " << implSize - 12 << " bytes\n";
 
 	std::size_t size;
 	std::string type;
@@ -47,22 +49,23 @@ std::size_t impl::read(std::istream& file) {
 
 	if (_version > 9)
 	{
-		std::cout << "Expected FORM of type [0000..0009]. Found: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM of type [0000..0009]. Found: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found FORM " << type << ": " << size << " bytes\n";
-	std::cout << "Implementation version: " << (int)_version << "\n";
+	SWG_LOG(LOG_INFO) << "Found FORM " << type << ": " << size << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Implementation version: " << (int)_version << "\n";
 
 	if (_version > 3) {
 		// Read SCAP record
 		total += base::readRecordHeader(file, "SCAP", size);
-		std::cout << "Found record SCAP: " << size << "\n";
+		SWG_LOG(LOG_INFO) << "Found record SCAP: " << size << "\n";
 
 		uint32_t numCapabilities = uint32_t(size / 4);
 		_shaderCapability.resize(numCapabilities);
 		for (auto& sc : _shaderCapability) {
 			total += base::read(file, sc);
-			std::cout << "Shader capability: " << sc << "\n";
+			SWG_LOG(LOG_DEBUG) << "Shader capability: " << sc << "\n";
 		}
 
 		// Peek for optional OPTN record...
@@ -71,22 +74,22 @@ std::size_t impl::read(std::istream& file) {
 		if ("OPTN" == form) {
 			// Read OPTN record
 			total += base::readRecordHeader(file, "OPTN", size);
-			std::cout << "Found record OPTN: " << size << "\n";
+			SWG_LOG(LOG_INFO) << "Found record OPTN: " << size << "\n";
 			uint32_t numOptions = uint32_t(size / 4);
 			_optionTag.resize(numOptions);
 			for (auto& o : _optionTag) {
 				total += base::read(file, o);
-				std::cout << "Option tag: " << o << "\n";
+				SWG_LOG(LOG_DEBUG) << "Option tag: " << o << "\n";
 			}
 		}
 	}
 
 	// Read DATA record
 	total += base::readRecordHeader(file, "DATA", size);
-	std::cout << "Found record DATA: " << size << "\n";
+	SWG_LOG(LOG_INFO) << "Found record DATA: " << size << "\n";
 
 	total += base::read(file, _numPasses);
-	std::cout << "Number of passes: " << (int)_numPasses << "\n";
+	SWG_LOG(LOG_INFO) << "Number of passes: " << (int)_numPasses << "\n";
 
 	// Version 1...
 	if (1 == _version) {
@@ -98,15 +101,15 @@ std::size_t impl::read(std::istream& file) {
 	if (_version > 1)
 	{
 		total += base::read(file, _phase);
-		std::cout << "Implementation phase: " << _phase << "\n";
+		SWG_LOG(LOG_INFO) << "Implementation phase: " << _phase << "\n";
 	}
 
 	// Versions 5+
 	if (_version > 4) {
 		total += base::read(file, _castsShadow);
 		total += base::read(file, _isCollidable);
-		std::cout << "  Cast shadow: " << std::boolalpha << _castsShadow << "\n";
-		std::cout << "Is collidable: " << std::boolalpha << _isCollidable << "\n";
+		SWG_LOG(LOG_INFO) << "  Cast shadow: " << std::boolalpha << _castsShadow << "\n";
+		SWG_LOG(LOG_INFO) << "Is collidable: " << std::boolalpha << _isCollidable << "\n";
 	}
 
 	if (8 == _version) {
@@ -121,13 +124,14 @@ std::size_t impl::read(std::istream& file) {
 
 	if (implSize == total)
 	{
-		std::cout << "Finished reading IMPL\n";
+		SWG_LOG(LOG_INFO) << "Finished reading IMPL\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading IMPL\n";
-		std::cout << "Read " << total << " out of " << implSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading IMPL: ";
+		msg << "Read " << total << " out of " << implSize;
+		base::fail(file, "IMPL", msg.str());
 	}
 
 	return total;
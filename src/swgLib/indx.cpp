@@ -25,6 +25,7 @@
 
 #include <swgLib/indx.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 
 using namespace ml;
 
@@ -36,7 +37,7 @@ indx::~indx() {
 
 std::size_t indx::readRaw(std::istream& file, const uint32_t& numIndices, bool index16) {
 	_numIndices = numIndices;
-	std::cout << "Number of indices: " << _numIndices << "\n";
+	SWG_LOG(LOG_INFO) << "Number of indices: " << _numIndices << "\n";
 
 	std::size_t total = 0;
 	if (index16) {
@@ -25,6 +25,7 @@
 
 #include <swgLib/lght.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 
@@ -40,34 +41,34 @@ std::size_t lght::read(std::istream& file) {
 	// Light type
 	std::size_t total = base::read(file, _type);
 	switch (_type) {
-	case Ambient:  std::cout << "Light type: Ambient\n"; break;
-	case Parallel: std::cout << "Light type: Parallel\n"; break;
-	case Point:    std::cout << "Light type: Point\n"; break;
+	case Ambient:  SWG_LOG(LOG_INFO) << "Light type: Ambient\n"; break;
+	case Parallel: SWG_LOG(LOG_INFO) << "Light type: Parallel\n"; break;
+	case Point:    SWG_LOG(LOG_INFO) << "Light type: Point\n"; break;
 	};
 
 	// Diffuse color (argb)
 	total += _diffuseColor.read32(file);
-	std::cout << "Diffuse color (argb): " << _diffuseColor << "\n";
+	SWG_LOG(LOG_INFO) << "Diffuse color (argb): " << _diffuseColor << "\n";
 
 	// Specular color (argb)
 	total += _specularColor.read32(file);
-	std::cout << "Specular color (argb): " << _specularColor << "\n";
+	SWG_LOG(LOG_INFO) << "Specular color (argb): " << _specularColor << "\n";
 
 	// Transform
 	total += _transform.read(file);
-	std::cout << "Matrix:\n" << _transform << "\n";
+	SWG_LOG(LOG_INFO) << "Matrix:\n" << _transform << "\n";
 
 	// Constant attenuation
 	total += base::read(file, _constantAttenuation);
-	std::cout << "Constant Attenuation: " << _constantAttenuation << "\n";
+	SWG_LOG(LOG_INFO) << "Constant Attenuation: " << _constantAttenuation << "\n";
 
 	// Linear attenuation
 	total += base::read(file, _linearAttenuation);
-	std::cout << "Linear Attenuation: " << _linearAttenuation << "\n";
+	SWG_LOG(LOG_INFO) << "Linear Attenuation: " << _linearAttenuation << "\n";
 
 	// Quadratic attenuation
 	total += base::read(file, _quadraticAttenuation);
-	std::cout << "Quadratic Attenuation: " << _quadraticAttenuation << "\n";
+	SWG_LOG(LOG_INFO) << "Quadratic Attenuation: " << _quadraticAttenuation << "\n";
 
 	return total;
 }
@@ -26,10 +26,12 @@
 #include <swgLib/lod.hpp>
 
 #include <swgLib/model.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <bitset>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -70,7 +72,7 @@ std::size_t lod::readLOD(std::istream& file)
 	std::size_t dtlaSize;
 	std::size_t total = base::readFormHeader(file, "DTLA", dtlaSize);
 	dtlaSize += 12;
-	std::cout << "Found DTLA form: " << dtlaSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found DTLA form: " << dtlaSize << " bytes\n";
 
 	std::size_t size;
 	std::string type;
@@ -78,10 +80,11 @@ std::size_t lod::readLOD(std::istream& file)
 
 	_dtlaVersion = base::tagToVersion(type);
 	if ((_dtlaVersion < 1) || (_dtlaVersion > 8)) {
-		std::cout << "Expected type [0001..0008]: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0001..0008]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "DTLA version: " << (int)_dtlaVersion << "\n";
+	SWG_LOG(LOG_INFO) << "DTLA version: " << (int)_dtlaVersion << "\n";
 
 	// Versions 4+...
 	if (_dtlaVersion >= 4) {
@@ -93,14 +96,14 @@ std::size_t lod::readLOD(std::istream& file)
 	if (_dtlaVersion >= 6) {
 		// Read PIVT...
 		total += base::readRecordHeader(file, "PIVT", size);
-		std::cout << "Found record PIVT: " << size << "\n";
+		SWG_LOG(LOG_INFO) << "Found record PIVT: " << size << "\n";
 		total += base::read(file, _lodFlags);
-		std::cout << "LOD Flags: 0x" << std::hex << (int)_lodFlags << std::dec << "\n";
+		SWG_LOG(LOG_INFO) << "LOD Flags: 0x" << std::hex << (int)_lodFlags << std::dec << "\n";
 		_usePivotPoint = (_lodFlags & 0x01) > 0;
-		std::cout << "Use pivot point: " << std::boolalpha << _usePivotPoint << "\n";
+		SWG_LOG(LOG_INFO) << "Use pivot point: " << std::boolalpha << _usePivotPoint << "\n";
 		if (_dtlaVersion >= 8) {
 			_disableLODCrossFade = (_lodFlags & 0x02) > 0;
-			std::cout << "Disable LOD cross fade: " << std::boolalpha << _disableLODCrossFade << "\n";
+			SWG_LOG(LOG_INFO) << "Disable LOD cross fade: " << std::boolalpha << _disableLODCrossFade << "\n";
 		}
 	}
 
@@ -110,9 +113,9 @@ std::size_t lod::readLOD(std::istream& file)
 		{
 			std::size_t infoSize;
 			total += base::readRecordHeader(file, "INFO", infoSize);
-			std::cout << "Found record INFO: " << infoSize << "\n";
+			SWG_LOG(LOG_INFO) << "Found record INFO: " << infoSize << "\n";
 			uint32_t numEntries = uint32_t(infoSize / 12);
-			std::cout << "Number of entries: " << numEntries << "\n";
+			SWG_LOG(LOG_INFO) << "Number of entries: " << numEntries << "\n";
 			_child.resize(numEntries);
 			for (auto& c : _child) {
 				total += base::read(file, c.id);
@@ -125,11 +128,11 @@ std::size_t lod::readLOD(std::istream& file)
 		{
 			std::size_t dataSize;
 			total += base::readFormHeader(file, "DATA", dataSize);
-			std::cout << "Found form DATA: " << dataSize << "\n";
+			SWG_LOG(LOG_INFO) << "Found form DATA: " << dataSize << "\n";
 			std::size_t dataRead = 4; // Count 4 bytes from the form header...
 			while (dataRead < dataSize) {
 				dataRead += base::readRecordHeader(file, "CHLD", size);
-				std::cout << "Found record CHLD: " << size << "\n";
+				SWG_LOG(LOG_DEBUG) << "Found record CHLD: " << size << "\n";
 				int32_t id;
 				dataRead += base::read(file, id);
 				std::string name;
@@ -153,7 +156,7 @@ std::size_t lod::readLOD(std::istream& file)
 		}
 
 		for (auto c : _child) {
-			std::cout
+			SWG_LOG(LOG_DEBUG)
 				<< "Child " << c.id << ":\n"
 				<< "  Near distance: " << c.near << "\n"
 				<< "   Far distance: " << c.far << "\n"
@@ -166,21 +169,21 @@ std::size_t lod::readLOD(std::istream& file)
 		// Load Radar...
 		std::size_t radrSize;
 		total += base::readFormHeader(file, "RADR", radrSize);
-		std::cout << "Found form RADR: " << radrSize << "\n";
+		SWG_LOG(LOG_INFO) << "Found form RADR: " << radrSize << "\n";
 
 		total += base::readRecordHeader(file, "INFO", size);
-		std::cout << "Found record INFO: " << size << "\n";
+		SWG_LOG(LOG_INFO) << "Found record INFO: " << size << "\n";
 
 		int32_t hasRadar = 0;
 		total += base::read(file, hasRadar);
 
 		if (hasRadar > 0) {
 			_hasRadar = true;
-			std::cout << "Has radar:  true\n";
+			SWG_LOG(LOG_INFO) << "Has radar:  true\n";
 			total += _radarShape.read(file);
 		}
 		else {
-			std::cout << "Has radar:  false\n";
+			SWG_LOG(LOG_INFO) << "Has radar:  false\n";
 		}
 	}
 
@@ -189,41 +192,41 @@ std::size_t lod::readLOD(std::istream& file)
 		// Load test shape...
 		std::size_t testSize;
 		total += base::readFormHeader(file, "TEST", testSize);
-		std::cout << "Found form TEST: " << testSize << "\n";
+		SWG_LOG(LOG_INFO) << "Found form TEST: " << testSize << "\n";
 
 		total += base::readRecordHeader(file, "INFO", size);
-		std::cout << "Found record INFO: " << size << "\n";
+		SWG_LOG(LOG_INFO) << "Found record INFO: " << size << "\n";
 
 		int32_t hasTest = 0;
 		total += base::read(file, hasTest);
 
 		if (hasTest > 0) {
 			_hasTest = true;
-			std::cout << "Has test:  true\n";
+			SWG_LOG(LOG_INFO) << "Has test:  true\n";
 			total += _testShape.read(file);
 		}
 		else {
-			std::cout << "Has test:  false\n";
+			SWG_LOG(LOG_INFO) << "Has test:  false\n";
 		}
 
 		// Load write shape...
 		std::size_t writSize;
 		total += base::readFormHeader(file, "WRIT", writSize);
-		std::cout << "Found form WRIT: " << writSize << "\n";
+		SWG_LOG(LOG_INFO) << "Found form WRIT: " << writSize << "\n";
 
 		total += base::readRecordHeader(file, "INFO", size);
-		std::cout << "Found record INFO: " << size << "\n";
+		SWG_LOG(LOG_INFO) << "Found record INFO: " << size << "\n";
 
 		int32_t hasWrite = 0;
 		total += base::read(file, hasWrite);
 
 		if (hasWrite > 0) {
 			_hasWrite = true;
-			std::cout << "Has write:  true\n";
+			SWG_LOG(LOG_INFO) << "Has write:  true\n";
 			total += _writeShape.read(file);
 		}
 		else {
-			std::cout << "Has write:  false\n";
+			SWG_LOG(LOG_INFO) << "Has write:  false\n";
 		}
 
 	}
@@ -231,19 +234,19 @@ std::size_t lod::readLOD(std::istream& file)
 	// Versions 3 or 4
 	if ((3 == _dtlaVersion) || (5 == _dtlaVersion)) {
 		// Load floors...
-		std::cout << "Needs handled...\n";
-		exit(0);
+		base::fail(file, "LOD ", "Needs handled...");
 	}
 
 	if (dtlaSize == total)
 	{
-		std::cout << "Finished reading DTLA\n";
+		SWG_LOG(LOG_INFO) << "Finished reading DTLA\n";
 	}
 	else
 	{
-		std::cout << "Failed in reading DTLA\n";
-		std::cout << "Read " << total << " out of " << dtlaSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading DTLA: ";
+		msg << "Read " << total << " out of " << dtlaSize;
+		base::fail(file, "DTLA", msg.str());
 	}
 
 	return total;
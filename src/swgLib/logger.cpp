@@ -0,0 +1,162 @@
+/** -*-c++-*-
+ *  \class  logger
+ *  \file   logger.cpp
+ *  \author Ken Sewell
+
+ swgLib is used for the parsing and exporting SWG models.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of swgLib.
+
+ swgLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ swgLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with swgLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <swgLib/logger.hpp>
+
+#include <iostream>
+#include <mutex>
+#include <streambuf>
+
+using namespace ml;
+
+std::atomic<int> logger::_level(logger::LOG_NONE);
+
+namespace
+{
+	std::mutex sinkMutex;
+	logger::sink userSink;
+
+	void deliver(const logger::level& messageLevel, const std::string& text)
+	{
+		std::lock_guard<std::mutex> lock(sinkMutex);
+		if (userSink)
+		{
+			userSink(messageLevel, text);
+		}
+		else
+		{
+			std::cout << text;
+		}
+	}
+
+	// Collects a thread's output and passes it on a line at a time.
+	class lineBuffer : public std::streambuf
+	{
+	public:
+		lineBuffer() : _level(logger::LOG_INFO) {}
+		~lineBuffer() { send(); }
+
+		void setLevel(const logger::level& messageLevel)
+		{
+			if (messageLevel != _level)
+			{
+				send();
+				_level = messageLevel;
+			}
+		}
+
+		void send()
+		{
+			if (!_line.empty())
+			{
+				deliver(_level, _line);
+				_line.clear();
+			}
+		}
+
+	protected:
+		int_type overflow(int_type c) override
+		{
+			if (traits_type::eq_int_type(c, traits_type::eof()))
+			{
+				return traits_type::not_eof(c);
+			}
+			_line += traits_type::to_char_type(c);
+			if ('\n' == c)
+			{
+				send();
+			}
+			return c;
+		}
+
+		std::streamsize xsputn(const char* s, std::streamsize n) override
+		{
+			_line.append(s, std::size_t(n));
+			const std::size_t end = _line.rfind('\n');
+			if (std::string::npos != end)
+			{
+				// Keep any text after the last newline for the next write.
+				const std::string rest(_line, end + 1);
+				_line.resize(end + 1);
+				send();
+				_line = rest;
+			}
+			return n;
+		}
+
+		int sync() override
+		{
+			send();
+			return 0;
+		}
+
+	private:
+		logger::level _level;
+		std::string _line;
+	};
+
+	struct threadStream
+	{
+		threadStream() : stream(&buffer) {}
+
+		lineBuffer buffer;
+		std::ostream stream;
+	};
+
+	threadStream& currentStream()
+	{
+		static thread_local threadStream current;
+		return current;
+	}
+}
+
+void logger::setLevel(const level& maxLevel)
+{
+	_level.store(int(maxLevel), std::memory_order_relaxed);
+}
+
+logger::level logger::getLevel()
+{
+	return level(_level.load(std::memory_order_relaxed));
+}
+
+void logger::setSink(const sink& output)
+{
+	flush();
+	std::lock_guard<std::mutex> lock(sinkMutex);
+	userSink = output;
+}
+
+std::ostream& logger::stream(const level& messageLevel)
+{
+	threadStream& current = currentStream();
+	current.buffer.setLevel(messageLevel);
+	return current.stream;
+}
+
+void logger::flush()
+{
+	currentStream().buffer.send();
+}
@@ -25,6 +25,8 @@
 
 #include <swgLib/matl.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -39,11 +41,12 @@ std::size_t matl::read(std::istream& file) {
 	std::size_t matlSize;
 	std::size_t total = base::readRecordHeader(file, "MATL", matlSize);
 	matlSize += 8; // Include Tag/Size from header...
-	std::cout << "Found record MATL: " << matlSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found record MATL: " << matlSize << " bytes\n";
 
 	if (76 != matlSize)	{
-		std::cout << "Expected MATL size 68. Found: " << matlSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected MATL size 68. Found: " << matlSize;
+		base::fail(file, "MATL", msg.str());
 	}
 
 	total += _ambient.read32(file); // ARGB ordering
@@ -52,7 +55,7 @@ std::size_t matl::read(std::istream& file) {
 	total += _specular.read32(file); // ARGB ordering
 	total += base::read(file, _power); // ARGB ordering
 
-	std::cout
+	SWG_LOG(LOG_INFO)
 		<< " Ambient: " << _ambient << "\n"
 		<< " Diffuse: " << _diffuse << "\n"
 		<< "Emissive: " << _emissive << "\n"
@@ -61,13 +64,14 @@ std::size_t matl::read(std::istream& file) {
 
 	if (matlSize == total)
 	{
-		std::cout << "Finished reading MATL\n";
+		SWG_LOG(LOG_INFO) << "Finished reading MATL\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading MATL\n";
-		std::cout << "Read " << total << " out of " << matlSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading MATL: ";
+		msg << "Read " << total << " out of " << matlSize;
+		base::fail(file, "MATL", msg.str());
 	}
 
 	return total;
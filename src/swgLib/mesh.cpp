@@ -27,10 +27,12 @@
 #include <swgLib/cshd.hpp>
 #include <swgLib/sht.hpp>
 #include <swgLib/collisionUtil.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <bitset>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -49,17 +51,18 @@ std::size_t mesh::readMESH(std::istream& file, bool skipSIDX)
 	std::size_t meshSize;
 	std::size_t total = base::readFormHeader(file, "MESH", meshSize);
 	meshSize += 8;
-	std::cout << "Found form MESH: " << meshSize << "\n";
+	SWG_LOG(LOG_INFO) << "Found form MESH: " << meshSize << "\n";
 
 	std::string type;
 	std::size_t size;
 	total += base::readFormHeader(file, type, size);
-	std::cout << "Found FORM " << type << ": " << size << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM " << type << ": " << size << " bytes\n";
 
 	_version = base::tagToVersion(type);
 	if ((_version < 2) || (_version > 5)) {
-		std::cout << "Expected FORM of type 0002, 0003, 0004, or 0005. Found: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM of type 0002, 0003, 0004, or 0005. Found: " << type;
+		base::fail(file, type, msg.str());
 	}
 
 	if (_version < 4) {
@@ -85,13 +88,14 @@ std::size_t mesh::readMESH(std::istream& file, bool skipSIDX)
 
 	if (total == meshSize)
 	{
-		std::cout << "Finished reading MESH.\n";
+		SWG_LOG(LOG_INFO) << "Finished reading MESH.\n";
 	}
 	else
 	{
-		std::cout << "Error reading MESH!\n"
-			<< "Read " << total << " out of " << meshSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Error reading MESH!: "
+			<< "Read " << total << " out of " << meshSize;
+		base::fail(file, "MESH", msg.str());
 	}
 
 	return total;
@@ -25,6 +25,8 @@
 
 #include <swgLib/mfrc.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -34,28 +36,29 @@ mfrc::mfrc() {
 mfrc::~mfrc() {
 }
 
-std::size_t mfrc::read(std::istream& file) {
+std::size_t mfrc::read(iffReader& file) {
 	{
 		std::string form, type;
 		std::size_t size;
 		base::peekHeader(file, form, size, type);
-		std::cout << "mfrc::read::peek: " << form << ":" << type << "\n";
+		SWG_LOG(LOG_INFO) << "mfrc::read::peek: " << form << ":" << type << "\n";
 	}
 
 	std::size_t mfrcSize;
 	std::size_t total = base::readFormHeader(file, "MFRC", mfrcSize);
 	mfrcSize += 8;
-	std::cout << "Found MFRC form: " << mfrcSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found MFRC form: " << mfrcSize << " bytes\n";
 
 	std::size_t size;
 	std::string form, type;
 	total += base::readFormHeader(file, form, size, type);
 	_version = base::tagToVersion(type);
 	if (_version > 1) {
-		std::cout << "Expected type [0000...0001]: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0000...0001]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "MultiFractal version: " << _version << "\n";
+	SWG_LOG(LOG_INFO) << "MultiFractal version: " << _version << "\n";
 
 	total += base::readRecordHeader(file, "DATA", size);
 
@@ -83,12 +86,13 @@ std::size_t mfrc::read(std::istream& file) {
 	total += base::read(file, _combinationRule);
 
 	if (mfrcSize == total) {
-		std::cout << "Finished reading MFRC\n";
+		SWG_LOG(LOG_INFO) << "Finished reading MFRC\n";
 	}
 	else {
-		std::cout << "Failed in reading MFRC\n";
-		std::cout << "Read " << total << " out of " << mfrcSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading MFRC: ";
+		msg << "Read " << total << " out of " << mfrcSize;
+		base::fail(file, "MFRC", msg.str());
 	}
 
 	return total;
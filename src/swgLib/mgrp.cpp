@@ -25,6 +25,8 @@
 
 #include <swgLib/mgrp.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -34,21 +36,22 @@ mgrp::mgrp() {
 mgrp::~mgrp() {
 }
 
-std::size_t mgrp::read(std::istream& file) {
+std::size_t mgrp::read(iffReader& file) {
 	std::size_t mgrpSize;
 	std::size_t total = base::readFormHeader(file, "MGRP", mgrpSize);
 	mgrpSize += 8;
-	std::cout << "Found MGRP form: " << mgrpSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found MGRP form: " << mgrpSize << " bytes\n";
 
 	std::size_t size;
 	std::string form, type;
 	total += base::readFormHeader(file, form, size, type);
 	uint32_t version = base::tagToVersion(type);
 	if (0 != version) {
-		std::cout << "Expected type [0000]: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0000]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "MultiFractal Group version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "MultiFractal Group version: " << version << "\n";
 
 	while (total < mgrpSize) {
 		std::size_t mfamSize;
@@ -60,19 +63,20 @@ std::size_t mgrp::read(std::istream& file) {
 		family newFamily;
 		total += base::read(file, newFamily.familyId);
 		total += base::read(file, newFamily.name);
-		std::cout << "Name: " << newFamily.name << "\n";
+		SWG_LOG(LOG_DEBUG) << "Name: " << newFamily.name << "\n";
 		total += newFamily.multifractal.read(file);
 
 		_family.push_back(newFamily);
 	}
 
 	if (mgrpSize == total) {
-		std::cout << "Finished reading MGRP\n";
+		SWG_LOG(LOG_INFO) << "Finished reading MGRP\n";
 	}
 	else {
-		std::cout << "Failed in reading MGRP\n";
-		std::cout << "Read " << total << " out of " << mgrpSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading MGRP: ";
+		msg << "Read " << total << " out of " << mgrpSize;
+		base::fail(file, "MGRP", msg.str());
 	}
 
 	return total;
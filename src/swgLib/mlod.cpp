@@ -24,10 +24,12 @@
 */
 
 #include <swgLib/mlod.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <bitset>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -45,34 +47,34 @@ std::size_t mlod::readMLOD(std::istream& file, const std::string& path)
 	std::size_t mlodSize;
 	std::size_t total = readFormHeader(file, "MLOD", mlodSize);
 	mlodSize += 8;
-	std::cout << "Found MLOD form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found MLOD form" << std::endl;
 
 	std::size_t size;
 	total += readFormHeader(file, "0000", size);
 
-	std::cout << "Found FORM 0000" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found FORM 0000" << std::endl;
 
 	unsigned short numNames;
 	total += readINFO(file, numNames);
 
-	std::cout << "Num names: " << numNames << std::endl;
+	SWG_LOG(LOG_INFO) << "Num names: " << numNames << std::endl;
 
 	for (unsigned int i = 0; i < numNames; ++i)
 	{
 		std::string name;
 		total += readNAME(file, name);
 		meshFilename.push_back(name);
-		std::cout << "Name: " << name << std::endl;
+		SWG_LOG(LOG_DEBUG) << "Name: " << name << std::endl;
 	}
 
 	if (mlodSize == total)
 	{
-		std::cout << "Finished reading MLOD" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading MLOD" << std::endl;
 	}
 	else
 	{
-		std::cout << "Failed in reading MLOD" << std::endl;
-		std::cout << "Read " << total << " out of " << mlodSize
+		SWG_LOG(LOG_ERROR) << "Failed in reading MLOD" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << mlodSize
 			<< std::endl;
 	}
 
@@ -91,10 +93,11 @@ std::size_t mlod::readINFO(std::istream& file, unsigned short& num)
 	std::size_t total = readRecordHeader(file, type, size);
 	if (type != "INFO")
 	{
-		std::cout << "Expected record of type INFO: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type INFO: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found INFO record" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found INFO record" << std::endl;
 
 	total += base::read(file, num);
 
@@ -108,10 +111,11 @@ std::size_t mlod::readNAME(std::istream& file, std::string& name)
 	std::size_t total = readRecordHeader(file, type, size);
 	if (type != "NAME")
 	{
-		std::cout << "Expected record of type NAME: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type NAME: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found NAME record" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found NAME record" << std::endl;
 
 	total += base::read(file, name);
 
@@ -25,8 +25,10 @@
 
 #include <swgLib/model.hpp>
 #include <swgLib/box.hpp>
+#include <swgLib/logger.hpp>
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -43,10 +45,11 @@ unsigned int model::readSPHR(std::istream& file,
 	size += 8; // Size of header
 	if (type != "SPHR")
 	{
-		std::cout << "Expected record of type SPHR: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type SPHR: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found SPHR record" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found SPHR record" << std::endl;
 
 	// Read center and radius of bounding sphere
 	total += base::read(file, cx);
@@ -54,18 +57,18 @@ unsigned int model::readSPHR(std::istream& file,
 	total += base::read(file, cz);
 	total += base::read(file, radius);
 
-	std::cout << "Bounding sphere center and radius: " << std::endl;
-	std::cout << "  ( " << cx << ", " << cy << ", " << cz
+	SWG_LOG(LOG_INFO) << "Bounding sphere center and radius: " << std::endl;
+	SWG_LOG(LOG_INFO) << "  ( " << cx << ", " << cy << ", " << cz
 		<< " ) ( " << radius << " ) " << std::endl;
 
 	if (total == size)
 	{
-		std::cout << "Finished reading SPHR." << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading SPHR." << std::endl;
 	}
 	else
 	{
-		std::cout << "Error reading SPHR!" << std::endl;
-		std::cout << "Read " << total << " out of " << size
+		SWG_LOG(LOG_ERROR) << "Error reading SPHR!" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << size
 			<< std::endl;
 	}
 
@@ -85,10 +88,11 @@ unsigned int model::readCYLN(std::istream& file,
 	size += 8; // Size of header
 	if (type != "CYLN")
 	{
-		std::cout << "Expected record of type CYLN: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type CYLN: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found CYLN record" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found CYLN record" << std::endl;
 
 	// Read 
 	total += read(file, u1);
@@ -96,7 +100,7 @@ unsigned int model::readCYLN(std::istream& file,
 	total += read(file, u3);
 	total += read(file, u4);
 	total += read(file, u5);
-	std::cout << u1 << " "
+	SWG_LOG(LOG_INFO) << u1 << " "
 		<< u2 << " "
 		<< u3 << " "
 		<< u4 << " "
@@ -104,12 +108,12 @@ unsigned int model::readCYLN(std::istream& file,
 
 	if (total == size)
 	{
-		std::cout << "Finished reading CYLN." << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading CYLN." << std::endl;
 	}
 	else
 	{
-		std::cout << "Error reading CYLN!" << std::endl;
-		std::cout << "Read " << total << " out of " << size
+		SWG_LOG(LOG_ERROR) << "Error reading CYLN!" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << size
 			<< std::endl;
 	}
 
@@ -127,22 +131,22 @@ unsigned int model::readEXSP(std::istream& file,
 
 	std::size_t total = readFormHeader(file, "EXSP", exspSize);
 	exspSize += 8;
-	std::cout << "Found EXSP form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found EXSP form" << std::endl;
 
 	std::size_t size;
 	total += readFormHeader(file, "0001", size);
-	std::cout << "Found 0001 form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found 0001 form" << std::endl;
 
 	total += model::readSPHR(file, cx, cy, cz, radius);
 
 	if (total == exspSize)
 	{
-		std::cout << "Finished reading EXSP." << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading EXSP." << std::endl;
 	}
 	else
 	{
-		std::cout << "Error reading EXSP!" << std::endl;
-		std::cout << "Read " << total << " out of " << exspSize
+		SWG_LOG(LOG_ERROR) << "Error reading EXSP!" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << exspSize
 			<< std::endl;
 	}
 
@@ -161,23 +165,23 @@ unsigned int model::readEXBX(std::istream& file,
 
 	std::size_t total = readFormHeader(file, "EXBX", exbxSize);
 	exbxSize += 8;
-	std::cout << "Found EXBX form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found EXBX form" << std::endl;
 
 	std::size_t size;
 	total += readFormHeader(file, "0001", size);
-	std::cout << "Found 0001 form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found 0001 form" << std::endl;
 
 	total += model::readEXSP(file, cx, cy, cz, radius);
 	total += box1.readBOX(file);
 
 	if (total == exbxSize)
 	{
-		std::cout << "Finished reading EXBX." << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading EXBX." << std::endl;
 	}
 	else
 	{
-		std::cout << "Error reading EXBX!" << std::endl;
-		std::cout << "Read " << total << " out of " << exbxSize
+		SWG_LOG(LOG_ERROR) << "Error reading EXBX!" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << exbxSize
 			<< std::endl;
 	}
 
@@ -195,22 +199,22 @@ unsigned int model::readXCYL(std::istream& file,
 
 	std::size_t total = readFormHeader(file, "XCYL", xcylSize);
 	xcylSize += 8;
-	std::cout << "Found XCYL form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found XCYL form" << std::endl;
 
 	std::size_t size;
 	total += readFormHeader(file, "0000", size);
-	std::cout << "Found 0000 form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found 0000 form" << std::endl;
 
 	total += model::readCYLN(file, u1, u2, u3, u4, u5);
 
 	if (total == xcylSize)
 	{
-		std::cout << "Finished reading XCYL." << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading XCYL." << std::endl;
 	}
 	else
 	{
-		std::cout << "Error reading XCYL!" << std::endl;
-		std::cout << "Read " << total << " out of " << xcylSize
+		SWG_LOG(LOG_ERROR) << "Error reading XCYL!" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << xcylSize
 			<< std::endl;
 	}
 
@@ -229,24 +233,24 @@ unsigned int model::readIDTL(std::istream& file,
 	std::size_t idtlSize;
 	std::size_t total = readFormHeader(file, "IDTL", idtlSize);
 	idtlSize += 8;
-	std::cout << "Found IDTL FORM\n";
+	SWG_LOG(LOG_INFO) << "Found IDTL FORM\n";
 
 	std::size_t size;
 	std::string form, type;
 	total += readFormHeader(file, "0000", size);
-	std::cout << "Found 0000 FORM\n";
+	SWG_LOG(LOG_INFO) << "Found 0000 FORM\n";
 
 	total += readVERT(file, vec);
 	total += readINDX(file, index);
 
 	if (idtlSize == total)
 	{
-		std::cout << "Finished reading IDTL" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading IDTL" << std::endl;
 	}
 	else
 	{
-		std::cout << "Failed in reading IDTL" << std::endl;
-		std::cout << "Read " << total << " out of " << idtlSize
+		SWG_LOG(LOG_ERROR) << "Failed in reading IDTL" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << idtlSize
 			<< std::endl;
 	}
 
@@ -262,18 +266,18 @@ unsigned int model::readVERT(std::istream& file,
 
 	std::size_t total = readRecordHeader(file, "VERT", vertSize);
 	vertSize += 8;
-	std::cout << "Found VERT record" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found VERT record" << std::endl;
 
 	float x, y, z;
 	unsigned int numVerts = (vertSize - 8) / (sizeof(float) * 3);
-	std::cout << "Number of vertices: " << numVerts << std::endl;
+	SWG_LOG(LOG_INFO) << "Number of vertices: " << numVerts << std::endl;
 	for (unsigned int i = 0; i < numVerts; ++i)
 	{
 		total += read(file, x);
 		total += read(file, y);
 		total += read(file, z);
 #if 1
-		std::cout << "Vert: " << std::fixed
+		SWG_LOG(LOG_DEBUG) << "Vert: " << std::fixed
 			<< x << ", "
 			<< y << ", "
 			<< z << std::endl;
@@ -283,12 +287,12 @@ unsigned int model::readVERT(std::istream& file,
 
 	if (vertSize == total)
 	{
-		std::cout << "Finished reading VERT" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading VERT" << std::endl;
 	}
 	else
 	{
-		std::cout << "Failed in reading VERT" << std::endl;
-		std::cout << "Read " << total << " out of " << vertSize
+		SWG_LOG(LOG_ERROR) << "Failed in reading VERT" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << vertSize
 			<< std::endl;
 	}
 
@@ -303,25 +307,25 @@ unsigned int model::readINDX(std::istream& file,
 
 	std::size_t total = readRecordHeader(file, "INDX", indxSize);
 	indxSize += 8;
-	std::cout << "Found INDX record" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found INDX record" << std::endl;
 
 	int32_t x;
 	unsigned int numIndex = (indxSize - 8) / sizeof(x);
 	for (unsigned int i = 0; i < numIndex; ++i)
 	{
 		total += read(file, x);
-		std::cout << "Index: " << x << std::endl;
+		SWG_LOG(LOG_DEBUG) << "Index: " << x << std::endl;
 		index.push_back(x);
 	}
 
 	if (indxSize == total)
 	{
-		std::cout << "Finished reading INDX" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading INDX" << std::endl;
 	}
 	else
 	{
-		std::cout << "Failed in reading INDX" << std::endl;
-		std::cout << "Read " << total << " out of " << indxSize
+		SWG_LOG(LOG_ERROR) << "Failed in reading INDX" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << indxSize
 			<< std::endl;
 	}
 
@@ -335,11 +339,11 @@ unsigned int model::readAPPR(std::istream& file)
 
 	std::size_t total = readFormHeader(file, "APPR", apprSize);
 	apprSize += 8;
-	std::cout << "Found APPR form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found APPR form" << std::endl;
 
 	std::size_t size;
 	total += readFormHeader(file, "0003", size);
-	std::cout << "Found 0003 form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found 0003 form" << std::endl;
 
 	std::string form;
 	while (total < apprSize)
@@ -398,148 +402,203 @@ unsigned int model::readAPPR(std::istream& file)
 			}
 			else
 			{
-				std::cout << "Expected form of type NULL, EXBX, EXSP, XCYL, CMPT, CMSH, DTAL, HPTS, FLOR or INFO: "
-					<< type
-					<< std::endl;
-				exit(0);
+				std::ostringstream msg;
+				msg << "Expected form of type NULL, EXBX, EXSP, XCYL, CMPT, CMSH, DTAL, HPTS, FLOR or INFO: "
+					<< type;
+				base::fail(file, type, msg.str());
 			}
 		}
 		else
 		{
-			std::cout << "Expected FORM: " << form
-				<< std::endl;
-			exit(0);
+			std::ostringstream msg;
+			msg << "Expected FORM: " << form;
+			base::fail(file, form, msg.str());
 		}
 	}
 
 	if (total == apprSize)
 	{
-		std::cout << "Finished reading APPR." << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading APPR." << std::endl;
 	}
 	else
 	{
-		std::cout << "Error reading APPR!" << std::endl;
-		std::cout << "Read " << total << " out of " << apprSize
+		SWG_LOG(LOG_ERROR) << "Error reading APPR!" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << apprSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int model::readHPNT(std::istream& file)
+// Hardpoint readers are shared by the istream and iffReader parsers.
+template<typename S>
+static unsigned int readHPNTImpl(S& file)
 {
 	std::size_t size;
 	std::string type;
 
-	std::size_t total = readRecordHeader(file, type, size);
+	std::size_t total = base::readRecordHeader(file, type, size);
 	size += 8; // Size of header
 	if (type != "HPNT")
 	{
-		std::cout << "Expected record of type HPNT: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type HPNT: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found HPNT record" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found HPNT record" << std::endl;
 
 	float u1, u2, u3, u4, u5, u6, u7, u8, u9, u10, u11, u12;
-	total += read(file, u1);
-	total += read(file, u2);
-	total += read(file, u3);
-	total += read(file, u4);
-	total += read(file, u5);
-	total += read(file, u6);
-	total += read(file, u7);
-	total += read(file, u8);
-	total += read(file, u9);
-	total += read(file, u10);
-	total += read(file, u11);
-	total += read(file, u12);
+	total += base::read(file, u1);
+	total += base::read(file, u2);
+	total += base::read(file, u3);
+	total += base::read(file, u4);
+	total += base::read(file, u5);
+	total += base::read(file, u6);
+	total += base::read(file, u7);
+	total += base::read(file, u8);
+	total += base::read(file, u9);
+	total += base::read(file, u10);
+	total += base::read(file, u11);
+	total += base::read(file, u12);
 
 	std::string name;
-	total += read(file, name);
+	total += base::read(file, name);
 
-	std::cout << u1 << " " << u2 << " " << u3 << " " << u4 << std::endl;
-	std::cout << u5 << " " << u6 << " " << u7 << " " << u8 << std::endl;
-	std::cout << u9 << " " << u10 << " " << u11 << " " << u12 << std::endl;
-	std::cout << name << std::endl;
+	SWG_LOG(LOG_INFO) << u1 << " " << u2 << " " << u3 << " " << u4 << std::endl;
+	SWG_LOG(LOG_INFO) << u5 << " " << u6 << " " << u7 << " " << u8 << std::endl;
+	SWG_LOG(LOG_INFO) << u9 << " " << u10 << " " << u11 << " " << u12 << std::endl;
+	SWG_LOG(LOG_INFO) << name << std::endl;
 
 	if (total == size)
 	{
-		std::cout << "Finished reading HPNT." << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading HPNT." << std::endl;
 	}
 	else
 	{
-		std::cout << "Error reading HPNT!" << std::endl;
-		std::cout << "Read " << total << " out of " << size
+		SWG_LOG(LOG_ERROR) << "Error reading HPNT!" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << size
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int model::readNULL(std::istream& file)
+template<typename S>
+static unsigned int readDYNImpl(S& file)
 {
-	std::size_t nullSize;
+	std::size_t size;
 	std::string type;
+	std::size_t total = base::readRecordHeader(file, type, size);
+	size += 8; // Size of header
+	if (type != "DYN ")
+	{
+		std::ostringstream msg;
+		msg << "Expected record of type DYN : " << type;
+		base::fail(file, type, msg.str());
+	}
+	SWG_LOG(LOG_INFO) << "Found DYN  record" << std::endl;
 
-	std::size_t total = readFormHeader(file, "NULL", nullSize);
-	nullSize += 8;
-	std::cout << "Found NULL form" << std::endl;
-
-	total += readUnknown(file, nullSize - total);
+	total += base::readUnknown(file, size - total);
 
-	if (total == nullSize)
+	if (total == size)
 	{
-		std::cout << "Finished reading NULL." << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading DYN ." << std::endl;
 	}
 	else
 	{
-		std::cout << "Error reading NULL!" << std::endl;
-		std::cout << "Read " << total << " out of " << nullSize
+		SWG_LOG(LOG_ERROR) << "Error reading DYN !" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << size
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int model::readHPTS(std::istream& file)
+template<typename S>
+static unsigned int readHPTSImpl(S& file)
 {
 	std::size_t hptsSize;
 	std::string type;
 
-	std::size_t total = readFormHeader(file, "HPTS", hptsSize);
+	std::size_t total = base::readFormHeader(file, "HPTS", hptsSize);
 	hptsSize += 8;
-	std::cout << "Found HPTS form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found HPTS form" << std::endl;
 
 	std::string form;
 	std::size_t size;
 	while (total < hptsSize)
 	{
-		peekHeader(file, form, size, type);
+		base::peekHeader(file, form, size, type);
 
 		if ("HPNT" == form)
 		{
-			total += readHPNT(file);
+			total += readHPNTImpl(file);
 		}
 		else if ("DYN " == form)
 		{
-			total += readDYN(file);
+			total += readDYNImpl(file);
 		}
 	}
 
 	if (total == hptsSize)
 	{
-		std::cout << "Finished reading HPTS." << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading HPTS." << std::endl;
+	}
+	else
+	{
+		SWG_LOG(LOG_ERROR) << "Error reading HPTS!" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << hptsSize
+			<< std::endl;
+	}
+
+	return total;
+}
+
+unsigned int model::readHPNT(std::istream& file)
+{
+	return readHPNTImpl(file);
+}
+
+unsigned int model::readHPNT(iffReader& file)
+{
+	return readHPNTImpl(file);
+}
+
+unsigned int model::readNULL(std::istream& file)
+{
+	std::size_t nullSize;
+	std::string type;
+
+	std::size_t total = readFormHeader(file, "NULL", nullSize);
+	nullSize += 8;
+	SWG_LOG(LOG_INFO) << "Found NULL form" << std::endl;
+
+	total += readUnknown(file, nullSize - total);
+
+	if (total == nullSize)
+	{
+		SWG_LOG(LOG_INFO) << "Finished reading NULL." << std::endl;
 	}
 	else
 	{
-		std::cout << "Error reading HPTS!" << std::endl;
-		std::cout << "Read " << total << " out of " << hptsSize
+		SWG_LOG(LOG_ERROR) << "Error reading NULL!" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << nullSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
+unsigned int model::readHPTS(std::istream& file)
+{
+	return readHPTSImpl(file);
+}
+
+unsigned int model::readHPTS(iffReader& file)
+{
+	return readHPTSImpl(file);
+}
+
 unsigned int model::readFLOR(std::istream& file)
 {
 	std::size_t florSize;
@@ -547,17 +606,18 @@ unsigned int model::readFLOR(std::istream& file)
 
 	std::size_t total = readFormHeader(file, "FLOR", florSize);
 	florSize += 8;
-	std::cout << "Found FLOR form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found FLOR form" << std::endl;
 
 	// Read DATA record
 	std::size_t size;
 	total += readRecordHeader(file, type, size);
 	if (type != "DATA")
 	{
-		std::cout << "Expected record of type DATA: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type DATA: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Size: " << size << std::endl;
+	SWG_LOG(LOG_INFO) << "Size: " << size << std::endl;
 
 	unsigned char numFloor = 0;
 	total += read(file, numFloor);
@@ -566,17 +626,17 @@ unsigned int model::readFLOR(std::istream& file)
 	{
 		std::string name;
 		total += read(file, name);
-		std::cout << name << std::endl;
+		SWG_LOG(LOG_DEBUG) << name << std::endl;
 	}
 
 	if (total == florSize)
 	{
-		std::cout << "Finished reading FLOR." << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading FLOR." << std::endl;
 	}
 	else
 	{
-		std::cout << "Error reading FLOR!" << std::endl;
-		std::cout << "Read " << total << " out of " << florSize
+		SWG_LOG(LOG_ERROR) << "Error reading FLOR!" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << florSize
 			<< std::endl;
 	}
 
@@ -590,11 +650,11 @@ unsigned int model::readCMPT(std::istream& file)
 
 	std::size_t total = readFormHeader(file, "CMPT", cmptSize);
 	cmptSize += 8;
-	std::cout << "Found CMPT form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found CMPT form" << std::endl;
 
 	std::size_t size;
 	total += readFormHeader(file, "0000", size);
-	std::cout << "Found FORM " << type
+	SWG_LOG(LOG_INFO) << "Found FORM " << type
 		<< ": " << size - 4 << " bytes"
 		<< std::endl;
 
@@ -602,12 +662,12 @@ unsigned int model::readCMPT(std::istream& file)
 
 	if (cmptSize == total)
 	{
-		std::cout << "Finished reading CMPT" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading CMPT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading CMPT" << std::endl;
-		std::cout << "Read " << total << " out of " << cmptSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading CMPT" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << cmptSize
 			<< std::endl;
 	}
 
@@ -620,7 +680,7 @@ unsigned int model::readCPST(std::istream& file)
 
 	std::size_t total = readFormHeader(file, "CPST", cpstSize);
 	cpstSize += 8;
-	std::cout << "Found CPST form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found CPST form" << std::endl;
 
 	std::size_t size;
 	std::string form;
@@ -629,10 +689,11 @@ unsigned int model::readCPST(std::istream& file)
 	total += readFormHeader(file, form, size, type);
 	if (form != "FORM")
 	{
-		std::cout << "Expected FORM not: " << form << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM not: " << form;
+		base::fail(file, form, msg.str());
 	}
-	std::cout << "Found " << form << " " << type
+	SWG_LOG(LOG_INFO) << "Found " << form << " " << type
 		<< ": " << size - 4 << " bytes"
 		<< std::endl;
 #else
@@ -669,19 +730,20 @@ unsigned int model::readCPST(std::istream& file)
 		}
 		else
 		{
-			std::cout << "Unexpected type: " << type << std::endl;
-			exit(0);
+			std::ostringstream msg;
+			msg << "Unexpected type: " << type;
+			base::fail(file, type, msg.str());
 		}
 	}
 
 	if (cpstSize == total)
 	{
-		std::cout << "Finished reading CPST" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading CPST" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading CPST" << std::endl;
-		std::cout << "Read " << total << " out of " << cpstSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading CPST" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << cpstSize
 			<< std::endl;
 	}
 
@@ -694,7 +756,7 @@ unsigned int model::readCMSH(std::istream& file)
 
 	std::size_t total = readFormHeader(file, "CMSH", cmshSize);
 	cmshSize += 8;
-	std::cout << "Found FORM CMSH: "
+	SWG_LOG(LOG_INFO) << "Found FORM CMSH: "
 		<< cmshSize - 12 << " bytes"
 		<< std::endl;
 
@@ -704,10 +766,11 @@ unsigned int model::readCMSH(std::istream& file)
 	total += readFormHeader(file, form, size, type);
 	if (form != "FORM")
 	{
-		std::cout << "Expected FORM not: " << form << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM not: " << form;
+		base::fail(file, form, msg.str());
 	}
-	std::cout << "Found " << form << " " << type
+	SWG_LOG(LOG_INFO) << "Found " << form << " " << type
 		<< ": " << size - 4 << " bytes"
 		<< std::endl;
 
@@ -718,12 +781,12 @@ unsigned int model::readCMSH(std::istream& file)
 
 	if (cmshSize == total)
 	{
-		std::cout << "Finished reading CMSH" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading CMSH" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading CMSH" << std::endl;
-		std::cout << "Read " << total << " out of " << cmshSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading CMSH" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << cmshSize
 			<< std::endl;
 	}
 
@@ -738,7 +801,7 @@ unsigned int model::readDTAL(std::istream& file)
 
 	std::size_t total = readFormHeader(file, "DTAL", dtalSize);
 	dtalSize += 8;
-	std::cout << "Found " << form << " " << type
+	SWG_LOG(LOG_INFO) << "Found " << form << " " << type
 		<< ": " << dtalSize - 12 << " bytes"
 		<< std::endl;
 
@@ -746,10 +809,11 @@ unsigned int model::readDTAL(std::istream& file)
 	total += readFormHeader(file, form, size, type);
 	if (form != "FORM")
 	{
-		std::cout << "Expected FORM not: " << form << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM not: " << form;
+		base::fail(file, form, msg.str());
 	}
-	std::cout << "Found " << form << " " << type
+	SWG_LOG(LOG_INFO) << "Found " << form << " " << type
 		<< ": " << size - 4 << " bytes"
 		<< std::endl;
 
@@ -757,12 +821,12 @@ unsigned int model::readDTAL(std::istream& file)
 
 	if (dtalSize == total)
 	{
-		std::cout << "Finished reading DTAL" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading DTAL" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading DTAL" << std::endl;
-		std::cout << "Read " << total << " out of " << dtalSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading DTAL" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << dtalSize
 			<< std::endl;
 	}
 
@@ -771,29 +835,10 @@ unsigned int model::readDTAL(std::istream& file)
 
 unsigned int model::readDYN(std::istream& file)
 {
-	std::size_t size;
-	std::string type;
-	std::size_t total = readRecordHeader(file, type, size);
-	size += 8; // Size of header
-	if (type != "DYN ")
-	{
-		std::cout << "Expected record of type DYN : " << type << std::endl;
-		exit(0);
-	}
-	std::cout << "Found DYN  record" << std::endl;
-
-	total += readUnknown(file, size - total);
-
-	if (total == size)
-	{
-		std::cout << "Finished reading DYN ." << std::endl;
-	}
-	else
-	{
-		std::cout << "Error reading DYN !" << std::endl;
-		std::cout << "Read " << total << " out of " << size
-			<< std::endl;
-	}
+	return readDYNImpl(file);
+}
 
-	return total;
+unsigned int model::readDYN(iffReader& file)
+{
+	return readDYNImpl(file);
 }
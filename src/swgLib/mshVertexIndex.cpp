@@ -23,6 +23,7 @@
 */
 
 #include <swgLib/mshVertexIndex.hpp>
+#include <swgLib/logger.hpp>
 #include <iostream>
 
 using namespace ml;
@@ -103,7 +104,7 @@ bool mshVertexIndex::read( std::istream &file, unsigned int numIndices )
 
   this->clear();
 
-  std::cout << "Reading " << bytesPerIndex*numIndices << " indices" 
+  SWG_LOG(LOG_INFO) << "Reading " << bytesPerIndex*numIndices << " indices" 
 	    << std::endl;
   if( 2 == bytesPerIndex ) 
     {
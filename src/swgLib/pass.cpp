@@ -25,6 +25,8 @@
 
 #include <swgLib/pass.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -38,7 +40,7 @@ std::size_t pass::read(std::istream& file) {
 	std::size_t passSize;
 	std::size_t total = base::readFormHeader(file, "PASS", passSize);
 	passSize += 8;
-	std::cout << "Found FORM PASS: " << passSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM PASS: " << passSize - 12 << " bytes\n";
 
 	std::size_t size;
 	std::string type;
@@ -47,106 +49,110 @@ std::size_t pass::read(std::istream& file) {
 
 	if (_version > 10)
 	{
-		std::cout << "Expected FORM of type [0000..0010]. Found: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM of type [0000..0010]. Found: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found FORM " << type << ": " << size << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM " << type << ": " << size << " bytes\n";
 
-	std::cout << "Shader pass version: " << (int)_version << "\n";
+	SWG_LOG(LOG_INFO) << "Shader pass version: " << (int)_version << "\n";
 
 	// Versions 1+...
 	if (_version > 0) {
 		// Read DATA record
 		total += base::readRecordHeader(file, "DATA", size);
-		std::cout << "Found record DATA: " << size << "\n";
+		SWG_LOG(LOG_INFO) << "Found record DATA: " << size << "\n";
 	}
 
 	// Versions 2, 3, and 4...
 	if ((1 < _version) && (_version < 4)) {
 		total += base::read(file, _hasPixelShader);
-		std::cout << "Has pixel shader: " << std::boolalpha << _hasPixelShader << "\n";
+		SWG_LOG(LOG_INFO) << "Has pixel shader: " << std::boolalpha << _hasPixelShader << "\n";
 	}
 
 	total += base::read(file, _numStages);
-	std::cout << "Number of stages: " << (int)_numStages << "\n";
+	SWG_LOG(LOG_INFO) << "Number of stages: " << (int)_numStages << "\n";
 
 	if (1 == _version) {
 		total += base::read(file, _pixelShaderTag);
-		std::cout << "Pixel shader tag: " << _pixelShaderTag << "\n";
+		SWG_LOG(LOG_INFO) << "Pixel shader tag: " << _pixelShaderTag << "\n";
 	}
 
 	total += base::read(file, _shadeMode);
-	std::cout << "Shade mode: " << (int)_shadeMode << "\n";
+	SWG_LOG(LOG_INFO) << "Shade mode: " << (int)_shadeMode << "\n";
 
 	// Versions 2+...
 	if (_version > 1) {
 		total += base::read(file, _fogMode);
-		std::cout << "Fog mode: " << (int)_fogMode << "\n";
+		SWG_LOG(LOG_INFO) << "Fog mode: " << (int)_fogMode << "\n";
 	}
 
 	total += base::read(file, _ditherEnable);
-	std::cout << "Dither enable: " << std::boolalpha << _ditherEnable << "\n";
+	SWG_LOG(LOG_INFO) << "Dither enable: " << std::boolalpha << _ditherEnable << "\n";
 
 	if (10 == _version) {
 		total += base::read(file, _heat);
-		std::cout << "Heat: " << std::boolalpha << _heat << "\n";
+		SWG_LOG(LOG_INFO) << "Heat: " << std::boolalpha << _heat << "\n";
 	}
 
 	total += base::read(file, _zEnable);
 	total += base::read(file, _zWrite);
 	total += base::read(file, _zCompare);
 
-	std::cout << "Z Enable: " << std::boolalpha << _zEnable << "\n";
-	std::cout << "Z Write: " << std::boolalpha << _zWrite << "\n";
-	std::cout << "Z Compare: " << std::boolalpha << (int)_zCompare << "\n";
+	SWG_LOG(LOG_INFO) << "Z Enable: " << std::boolalpha << _zEnable << "\n";
+	SWG_LOG(LOG_INFO) << "Z Write: " << std::boolalpha << _zWrite << "\n";
+	SWG_LOG(LOG_INFO) << "Z Compare: " << std::boolalpha << (int)_zCompare << "\n";
 
 	total += base::read(file, _alphaBlendEnable);
 	total += base::read(file, _alphaBlendOperation);
 	total += base::read(file, _alphaBlendSource);
 	total += base::read(file, _alphaBlendDestination);
 
-	std::cout << "Alpha blend enable: " << std::boolalpha << _alphaBlendEnable << "\n";
-	std::cout << "Alpha blend operation: " << (int)_alphaBlendOperation << "\n";
-	std::cout << "Alpha blend source: " << (int)_alphaBlendSource << "\n";
-	std::cout << "Alpha blend destination: " << (int)_alphaBlendDestination << "\n";
+	SWG_LOG(LOG_INFO) << "Alpha blend enable: " << std::boolalpha << _alphaBlendEnable << "\n";
+	SWG_LOG(LOG_INFO) << "Alpha blend operation: " << (int)_alphaBlendOperation << "\n";
+	SWG_LOG(LOG_INFO) << "Alpha blend source: " << (int)_alphaBlendSource << "\n";
+	SWG_LOG(LOG_INFO) << "Alpha blend destination: " << (int)_alphaBlendDestination << "\n";
 
 	total += base::read(file, _alphaTestEnable);
 	total += base::read(file, _alphaReferenceValueTag);
 	total += base::read(file, _alphaTestFunction);
 
-	std::cout << "Alpha test enable: " << std::boolalpha << _alphaTestEnable << "\n";
-	std::cout << "Alpha reference value tag: " << _alphaReferenceValueTag << "\n";
-	std::cout << "Alpha test function: " << (int)_alphaTestFunction << "\n";
+	SWG_LOG(LOG_INFO) << "Alpha test enable: " << std::boolalpha << _alphaTestEnable << "\n";
+	SWG_LOG(LOG_INFO) << "Alpha reference value tag: " << _alphaReferenceValueTag << "\n";
+	SWG_LOG(LOG_INFO) << "Alpha test function: " << (int)_alphaTestFunction << "\n";
 
 	total += base::read(file, _writeEnable);
-	std::cout << "Write enable: " << (int)_writeEnable << "\n";
+	SWG_LOG(LOG_INFO) << "Write enable: " << (int)_writeEnable << "\n";
 
 	total += base::read(file, _textureFactorTag);
-	std::cout << "Texture factor tag: " << _textureFactorTag << "\n";
+	SWG_LOG(LOG_INFO) << "Texture factor tag: " << _textureFactorTag << "\n";
 
 	if (_version > 6) {
 		total += base::read(file, _textureFactorTag2);
-		std::cout << "Texture factor tag 2: " << _textureFactorTag2 << "\n";
+		SWG_LOG(LOG_INFO) << "Texture factor tag 2: " << _textureFactorTag2 << "\n";
 	}
 	if (_version > 7) {
 		total += base::read(file, _textureScrollTag);
-		std::cout << "Texture scroll tag: " << _textureScrollTag << "\n";
+		SWG_LOG(LOG_INFO) << "Texture scroll tag: " << _textureScrollTag << "\n";
 	}
 
 	if (_version < 4) {
 		// fixed function pipeline ?
 		// material tag
-		std::cout << "Not handled yet: " << __FILE__ << ": " << __LINE__ << "\n";
-		exit(0);
+		{
+			std::ostringstream msg;
+			msg << "Not handled yet: " << __FILE__ << ": " << __LINE__;
+			base::fail(file, "PASS", msg.str());
+		}
 	}
 
 	// stencil enable (bool)
 	total += base::read(file, _stencilEnable);
-	std::cout << "Stencil enable: " << std::boolalpha << _stencilEnable << "\n";
+	SWG_LOG(LOG_INFO) << "Stencil enable: " << std::boolalpha << _stencilEnable << "\n";
 
 	if (_version > 8) {
 		total += base::read(file, _stencilTwoSidedMode);
-		std::cout << "Stencil two sided mode: " << std::boolalpha << _stencilTwoSidedMode << "\n";
+		SWG_LOG(LOG_INFO) << "Stencil two sided mode: " << std::boolalpha << _stencilTwoSidedMode << "\n";
 	}
 	total += base::read(file, _stencilReferenceValueTag);
 	total += base::read(file, _stencilCompareFunction);
@@ -154,11 +160,11 @@ std::size_t pass::read(std::istream& file) {
 	total += base::read(file, _stencilZFailOperation);
 	total += base::read(file, _stencilFailOperation);
 
-	std::cout << "Stencil reference value tag: " << _stencilReferenceValueTag << "\n";
-	std::cout << "Stencil compare function: " << (int)_stencilCompareFunction << "\n";
-	std::cout << "Stencil pass operation: " << (int)_stencilPassOperation << "\n";
-	std::cout << "Stencil z fail operation: " << (int)_stencilZFailOperation << "\n";
-	std::cout << "Stencil fail operation: " << (int)_stencilFailOperation << "\n";
+	SWG_LOG(LOG_INFO) << "Stencil reference value tag: " << _stencilReferenceValueTag << "\n";
+	SWG_LOG(LOG_INFO) << "Stencil compare function: " << (int)_stencilCompareFunction << "\n";
+	SWG_LOG(LOG_INFO) << "Stencil pass operation: " << (int)_stencilPassOperation << "\n";
+	SWG_LOG(LOG_ERROR) << "Stencil z fail operation: " << (int)_stencilZFailOperation << "\n";
+	SWG_LOG(LOG_ERROR) << "Stencil fail operation: " << (int)_stencilFailOperation << "\n";
 
 	if (_version > 8) {
 		total += base::read(file, _stencilCCWCompareFunction);
@@ -166,17 +172,17 @@ std::size_t pass::read(std::istream& file) {
 		total += base::read(file, _stencilCCWZFailOperation);
 		total += base::read(file, _stencilCCWFailOperation);
 
-		std::cout << "Stencil CCW compare function: " << (int)_stencilCompareFunction << "\n";
-		std::cout << "Stencil CCW pass operation: " << (int)_stencilPassOperation << "\n";
-		std::cout << "Stencil CCW z fail operation: " << (int)_stencilZFailOperation << "\n";
-		std::cout << "Stencil CCW fail operation: " << (int)_stencilFailOperation << "\n";
+		SWG_LOG(LOG_INFO) << "Stencil CCW compare function: " << (int)_stencilCompareFunction << "\n";
+		SWG_LOG(LOG_INFO) << "Stencil CCW pass operation: " << (int)_stencilPassOperation << "\n";
+		SWG_LOG(LOG_ERROR) << "Stencil CCW z fail operation: " << (int)_stencilZFailOperation << "\n";
+		SWG_LOG(LOG_ERROR) << "Stencil CCW fail operation: " << (int)_stencilFailOperation << "\n";
 	}
 	// stencil write mask (uint32)
 	total += base::read(file, _stencilWriteMask);
-	std::cout << "Stencil write mask: " << _stencilWriteMask << "\n";
+	SWG_LOG(LOG_INFO) << "Stencil write mask: " << _stencilWriteMask << "\n";
 	// stencil stencil mask (uint32)
 	total += base::read(file, _stencilMask);
-	std::cout << "Stencil mask: " << _stencilMask << "\n";
+	SWG_LOG(LOG_INFO) << "Stencil mask: " << _stencilMask << "\n";
 
 	if (3 == _version) {
 		uint32_t unused;
@@ -185,14 +191,14 @@ std::size_t pass::read(std::istream& file) {
 
 	if (_version > 5) {
 		total += base::read(file, _materialTag);
-		std::cout << "Material tag: " << _materialTag << "\n";
+		SWG_LOG(LOG_INFO) << "Material tag: " << _materialTag << "\n";
 	}
 
 	if (_version > 3) {
 		// PFFP or PVSH record...
 		std::string form;
 		base::peekHeader(file, form, size, type);
-		std::cout << "Peek: " << form << " " << type << "\n";
+		SWG_LOG(LOG_INFO) << "Peek: " << form << " " << type << "\n";
 
 		if ("PFFP" == type) {
 			total += _fixedFunctionPipeline.read(file);
@@ -203,28 +209,28 @@ std::size_t pass::read(std::istream& file) {
 			total += base::readRecordHeader(file, "0000", size);
 			total += base::read(file, _vertexShader);
 			base::fixSlash(_vertexShader);
-			std::cout << "Vertex shader: " << _vertexShader << "\n";
+			SWG_LOG(LOG_INFO) << "Vertex shader: " << _vertexShader << "\n";
 		}
 	}
 
 	if ((_version > 4) && (0 == _numStages)) {
 		std::string form;
 		base::peekHeader(file, form, size, type);
-		std::cout << "Peek: " << form << " " << type << "\n";
+		SWG_LOG(LOG_INFO) << "Peek: " << form << " " << type << "\n";
 		if ("PPSH" == type) {
 			total += base::readFormHeader(file, "PPSH", size);
-			std::cout << "Found form PPSH\n";
+			SWG_LOG(LOG_INFO) << "Found form PPSH\n";
 			total += base::readFormHeader(file, "0001", size);
-			std::cout << "Found form 0001\n";
+			SWG_LOG(LOG_INFO) << "Found form 0001\n";
 			total += base::readRecordHeader(file, "DATA", size);
-			std::cout << "Found record DATA\n";
+			SWG_LOG(LOG_INFO) << "Found record DATA\n";
 
 			total += base::read(file, _numTextureSamplers);
-			std::cout << "Number of texture samplers: " << (int)_numTextureSamplers << "\n";
+			SWG_LOG(LOG_INFO) << "Number of texture samplers: " << (int)_numTextureSamplers << "\n";
 
 			total += base::read(file, _pixelShader);
 			base::fixSlash(_pixelShader);
-			std::cout << "Pixel shader: " << _pixelShader << "\n";
+			SWG_LOG(LOG_INFO) << "Pixel shader: " << _pixelShader << "\n";
 
 			// Read all the texture samplers...
 			_textureSampler.resize(_numTextureSamplers);
@@ -245,13 +251,14 @@ std::size_t pass::read(std::istream& file) {
 
 	if (passSize == total)
 	{
-		std::cout << "Finished reading PASS\n";
+		SWG_LOG(LOG_INFO) << "Finished reading PASS\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading PASS\n";
-		std::cout << "Read " << total << " out of " << passSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading PASS: ";
+		msg << "Read " << total << " out of " << passSize;
+		base::fail(file, "PASS", msg.str());
 	}
 
 	return total;
@@ -24,10 +24,12 @@
 */
 #include <swgLib/patt.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <bitset>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -44,17 +46,18 @@ std::size_t patt::read(std::istream& file)
 	std::size_t pattSize;
 	std::size_t total = base::readFormHeader(file, "PATT", pattSize);
 	pattSize += 8;
-	std::cout << "Found PATT: " << pattSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found PATT: " << pattSize - 12 << " bytes\n";
 
 	std::string type;
 	std::size_t size;
 	total += base::readFormHeader(file, type, size);
 	_version = base::tagToVersion(type);
 	if (_version > 1) {
-		std::cout << "Expected type [0000..0001]: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0000..0001]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Particle Attachment Version: " << _version << "\n";
+	SWG_LOG(LOG_INFO) << "Particle Attachment Version: " << _version << "\n";
 
 	total += base::readRecordHeader(file, "0000", size);
 	total += base::read(file, _attachmentPath);
@@ -77,12 +80,13 @@ std::size_t patt::read(std::istream& file)
 	}
 
 	if (pattSize == total) {
-		std::cout << "Finished reading PATT\n";
+		SWG_LOG(LOG_INFO) << "Finished reading PATT\n";
 	}
 	else {
-		std::cout << "FAILED in reading PATT\n"
-			<< "Read " << total << " out of " << pattSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading PATT: "
+			<< "Read " << total << " out of " << pattSize;
+		base::fail(file, "PATT", msg.str());
 	}
 
 	return total;
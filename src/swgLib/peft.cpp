@@ -24,10 +24,12 @@
 */
 #include <swgLib/peft.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <bitset>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -44,17 +46,18 @@ std::size_t peft::readPEFT(std::istream& file)
 	std::size_t peftSize;
 	std::size_t total = base::readFormHeader(file, "PEFT", peftSize);
 	peftSize += 8;
-	std::cout << "Found PEFT form: " << peftSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found PEFT form: " << peftSize - 12 << " bytes\n";
 
 	std::size_t size;
 	std::string form, type;
 	total += base::readFormHeader(file, form, size, type);
 	_version = base::tagToVersion(type);
 	if (_version > 2) {
-		std::cout << "Expected type [0000..0002]: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0000..0002]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Particle Effect Version: " << (int)_version << "\n";
+	SWG_LOG(LOG_INFO) << "Particle Effect Version: " << (int)_version << "\n";
 
 	if (_version > 0) {
 		total += _timing.read(file);
@@ -70,7 +73,7 @@ std::size_t peft::readPEFT(std::istream& file)
 		total += base::read(file, _scale);
 	}
 
-	std::cout << "Num Emitter Groups: " << _numEmitterGroups << "\n";
+	SWG_LOG(LOG_INFO) << "Num Emitter Groups: " << _numEmitterGroups << "\n";
 
 
 
@@ -80,12 +83,13 @@ std::size_t peft::readPEFT(std::istream& file)
 	}
 
 	if (peftSize == total) {
-		std::cout << "Finished reading PEFT\n";
+		SWG_LOG(LOG_INFO) << "Finished reading PEFT\n";
 	}
 	else {
-		std::cout << "FAILED in reading PEFT\n"
-			<< "Read " << total << " out of " << peftSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading PEFT: "
+			<< "Read " << total << " out of " << peftSize;
+		base::fail(file, "PEFT", msg.str());
 	}
 
 	return total;
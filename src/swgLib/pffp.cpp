@@ -25,6 +25,8 @@
 
 #include <swgLib/pffp.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -38,7 +40,7 @@ std::size_t pffp::read(std::istream& file) {
 	std::size_t pffpSize;
 	std::size_t total = base::readFormHeader(file, "PFFP", pffpSize);
 	pffpSize += 8;
-	std::cout << "Found FORM PFFP: " << pffpSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM PFFP: " << pffpSize - 12 << " bytes\n";
 
 	std::size_t size;
 	std::string type;
@@ -47,22 +49,23 @@ std::size_t pffp::read(std::istream& file) {
 	_version = base::tagToVersion(type);
 	if (_version > 2)
 	{
-		std::cout << "Expected FORM of type 0000 or 0001. Found: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM of type 0000 or 0001. Found: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found FORM " << type << ": " << size - 4 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM " << type << ": " << size - 4 << " bytes\n";
 
 	total += base::read(file, _lighting);
 	total += base::read(file, _lightingSpecularEnable);
 	total += base::read(file, _lightingColorVertex);
 
-	std::cout << "Lighting: " << std::boolalpha << _lighting << "\n";
-	std::cout << "Lighting specular enable: " << std::boolalpha << _lightingSpecularEnable << "\n";
-	std::cout << "Lighting color vertex: " << std::boolalpha << _lightingColorVertex << "\n";
+	SWG_LOG(LOG_INFO) << "Lighting: " << std::boolalpha << _lighting << "\n";
+	SWG_LOG(LOG_INFO) << "Lighting specular enable: " << std::boolalpha << _lightingSpecularEnable << "\n";
+	SWG_LOG(LOG_INFO) << "Lighting color vertex: " << std::boolalpha << _lightingColorVertex << "\n";
 
 	if (0 == _version) {
 		total += base::read(file, _lightingMaterialTag);
-		std::cout << "Lighting material tag: " << _lightingMaterialTag << "\n";
+		SWG_LOG(LOG_INFO) << "Lighting material tag: " << _lightingMaterialTag << "\n";
 	}
 
 	total += base::read(file, _lightingAmbientColorSource);
@@ -70,20 +73,21 @@ std::size_t pffp::read(std::istream& file) {
 	total += base::read(file, _lightingSpecularColorSource);
 	total += base::read(file, _lightingEmissiveColorSource);
 
-	std::cout << "Lighting ambient color source: " << (int)_lightingAmbientColorSource << "\n";
-	std::cout << "Lighting diffuse color source: " << (int)_lightingDiffuseColorSource << "\n";
-	std::cout << "Lighting specular color source: " << (int)_lightingSpecularColorSource << "\n";
-	std::cout << "Lighting emissive color source: " << (int)_lightingEmissiveColorSource << "\n";
+	SWG_LOG(LOG_INFO) << "Lighting ambient color source: " << (int)_lightingAmbientColorSource << "\n";
+	SWG_LOG(LOG_INFO) << "Lighting diffuse color source: " << (int)_lightingDiffuseColorSource << "\n";
+	SWG_LOG(LOG_INFO) << "Lighting specular color source: " << (int)_lightingSpecularColorSource << "\n";
+	SWG_LOG(LOG_INFO) << "Lighting emissive color source: " << (int)_lightingEmissiveColorSource << "\n";
 
 	if (pffpSize == total)
 	{
-		std::cout << "Finished reading PFFP\n";
+		SWG_LOG(LOG_INFO) << "Finished reading PFFP\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading PFFP\n";
-		std::cout << "Read " << total << " out of " << pffpSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading PFFP: ";
+		msg << "Read " << total << " out of " << pffpSize;
+		base::fail(file, "PFFP", msg.str());
 	}
 
 	return total;
@@ -25,6 +25,8 @@
 
 #include <swgLib/pgrf.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -38,15 +40,16 @@ std::size_t pgrf::read(std::istream& file) {
 	std::size_t pgrfSize;
 	std::size_t total = base::readFormHeader(file, "PGRF", pgrfSize);
 	pgrfSize += 8;
-	std::cout << "Found FORM PGRF: " << ": " << pgrfSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM PGRF: " << ": " << pgrfSize - 12 << " bytes\n";
 
 	std::size_t size;
 	std::string form, type;
 	total += base::readFormHeader(file, form, size, type);
 	if (form != "FORM")
 	{
-		std::cout << "Expected FORM not: " << form << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM not: " << form;
+		base::fail(file, form, msg.str());
 	}
 
 	_version = 0;
@@ -57,29 +60,30 @@ std::size_t pgrf::read(std::istream& file) {
 		_version = 2;
 	}
 	else {
-		std::cout << "Expected FORM of type 0000 or 0001: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM of type 0000 or 0001: " << type;
+		base::fail(file, type, msg.str());
 	}
 
-	std::cout << "Found FORM " << type
+	SWG_LOG(LOG_INFO) << "Found FORM " << type
 		<< ": " << size - 4 << " bytes\n";
 
 	// Only in versions 1+
 	if (0 < _version) {
 		// Read META...
 		total += base::readRecordHeader(file, "META", size);
-		std::cout << "Found record META: " << size << " bytes\n";
+		SWG_LOG(LOG_INFO) << "Found record META: " << size << " bytes\n";
 		int32_t x;
 		total += base::read(file, x);
 	}
 
 	// Read Path Node (PNOD)...
 	total += base::readRecordHeader(file, "PNOD", size);
-	std::cout << "Found record PNOD: " << size << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found record PNOD: " << size << " bytes\n";
 
 	int32_t numNodes = 0;
 	total += base::read(file, numNodes);
-	std::cout << "Number of path nodes: " << numNodes << "\n";
+	SWG_LOG(LOG_INFO) << "Number of path nodes: " << numNodes << "\n";
 
 	_index.resize(numNodes);
 	_id.resize(numNodes);
@@ -94,7 +98,7 @@ std::size_t pgrf::read(std::istream& file) {
 		total += base::read(file, _type[i]);
 		total += base::read(file, _position[i]);
 		total += base::read(file, _radius[i]);
-		std::cout
+		SWG_LOG(LOG_DEBUG)
 			<< "Node " << i << ":\n"
 			<< "   Index: " << _index[i] << "\n"
 			<< "      ID: " << _id[i] << "\n"
@@ -106,11 +110,11 @@ std::size_t pgrf::read(std::istream& file) {
 
 	// Read Path Edge (PEDG)...
 	total += base::readRecordHeader(file, "PEDG", size);
-	std::cout << "Found record PEDG: " << size << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found record PEDG: " << size << " bytes\n";
 
 	int32_t numEdges = 0;
 	total += base::read(file, numEdges);
-	std::cout << "Number of path edges: " << numEdges << "\n";
+	SWG_LOG(LOG_INFO) << "Number of path edges: " << numEdges << "\n";
 	_aIndex.resize(numEdges);
 	_bIndex.resize(numEdges);
 	_laneWidthRight.resize(numEdges);
@@ -120,7 +124,7 @@ std::size_t pgrf::read(std::istream& file) {
 		total += base::read(file, _bIndex[i]);
 		total += base::read(file, _laneWidthRight[i]);
 		total += base::read(file, _laneWidthLeft[i]);
-		std::cout
+		SWG_LOG(LOG_DEBUG)
 			<< "Edge " << i << ":\n"
 			<< "Index A: " << _aIndex[i] << "\n"
 			<< "Index B: " << _bIndex[i] << "\n"
@@ -130,30 +134,30 @@ std::size_t pgrf::read(std::istream& file) {
 
 	// Read Edge Count (ECNT)...
 	total += base::readRecordHeader(file, "ECNT", size);
-	std::cout << "Found record ECNT: " << size << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found record ECNT: " << size << " bytes\n";
 
 	int32_t numEdgeCount = 0;
 	total += base::read(file, numEdgeCount);
-	std::cout << "Edge count: " << numEdgeCount << "\n";
+	SWG_LOG(LOG_INFO) << "Edge count: " << numEdgeCount << "\n";
 	
 	_edgeCount.resize(numEdgeCount);
 	for (auto i = 0; i < numEdgeCount; ++i) {
 		total += base::read(file, _edgeCount[i]);
-		std::cout << "Edge count " << i << ": " << _edgeCount[i] << "\n";
+		SWG_LOG(LOG_DEBUG) << "Edge count " << i << ": " << _edgeCount[i] << "\n";
 	}
 
 	// Read Edge Starts (ESTR)...
 	total += base::readRecordHeader(file, "ESTR", size);
-	std::cout << "Found record ESTR: " << size << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found record ESTR: " << size << " bytes\n";
 
 	int32_t numEdgeStarts = 0;
 	total += base::read(file, numEdgeStarts);
-	std::cout << "Number of edge starts: " << numEdgeStarts << "\n";
+	SWG_LOG(LOG_INFO) << "Number of edge starts: " << numEdgeStarts << "\n";
 
 	_edgeStart.resize(numEdgeStarts);
 	for (auto i = 0; i < numEdgeStarts; ++i) {
 		total += base::read(file, _edgeStart[i]);
-		std::cout << "Edge start " << i << ": " << _edgeStart[i] << "\n";
+		SWG_LOG(LOG_DEBUG) << "Edge start " << i << ": " << _edgeStart[i] << "\n";
 	}
 
 	return total;
@@ -25,8 +25,10 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/portal.hpp>
+#include <swgLib/logger.hpp>
 
 #include <ios>
+#include <sstream>
 
 using namespace ml;
 
@@ -40,7 +42,7 @@ std::size_t portal::read(std::istream& file) {
 	std::size_t prtlSize;
 	std::size_t total = base::readFormHeader(file, "PRTL", prtlSize);
 	prtlSize += 8;
-	std::cout << "Found FORM PRTL: " << prtlSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM PRTL: " << prtlSize - 12 << " bytes\n";
 
 	std::size_t size;
 	std::string type;
@@ -48,54 +50,55 @@ std::size_t portal::read(std::istream& file) {
 	_version = base::tagToVersion(type);
 
 	if ((_version < 1) || (_version > 5)) {
-		std::cout << "Expected record of type 0001, 0002, 0003, 0004, or 0005: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type 0001, 0002, 0003, 0004, or 0005: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found record " << type << ": " << size << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found record " << type << ": " << size << " bytes\n";
 
-	std::cout << "Portal version: " << (int)_version << "\n";
+	SWG_LOG(LOG_INFO) << "Portal version: " << (int)_version << "\n";
 
 	if (5 == _version) {
 		total += base::read(file, _disabled);
-		std::cout << "Disabled: " << std::boolalpha << _disabled << "\n";
+		SWG_LOG(LOG_INFO) << "Disabled: " << std::boolalpha << _disabled << "\n";
 	}
 
 	if (1 < _version) {
 		total += base::read(file, _passable);
-		std::cout << "Passable: " << std::boolalpha << _passable << "\n";
+		SWG_LOG(LOG_INFO) << "Passable: " << std::boolalpha << _passable << "\n";
 	}
 
 	total += base::read(file, _geometryIndex);
-	std::cout << "Geometry index: " << _geometryIndex << "\n";
+	SWG_LOG(LOG_INFO) << "Geometry index: " << _geometryIndex << "\n";
 
 	total += base::read(file, _geometryWindClockwise);
-	std::cout << "Geometry wind clockwise: " << std::boolalpha << _geometryWindClockwise << "\n";
+	SWG_LOG(LOG_INFO) << "Geometry wind clockwise: " << std::boolalpha << _geometryWindClockwise << "\n";
 
 	// Portal Geometry...
 	//... getPortalGeometry(int portalIndex, int cell, int cellPortalIndex, bool clockwise) 
 
 	total += base::read(file, _targetCellIndex);
-	std::cout << "Target cell index: " << _targetCellIndex << "\n";
+	SWG_LOG(LOG_INFO) << "Target cell index: " << _targetCellIndex << "\n";
 
 	if (2 < _version) {
 		total += base::read(file, _doorStyle);
-		std::cout << "Door style: " << _doorStyle << "\n";
+		SWG_LOG(LOG_INFO) << "Door style: " << _doorStyle << "\n";
 	}
 
 	if (3 < _version) {
 		total += base::read(file, _hasDoorHardpoint);
-		std::cout << "Has door hardpoint: " << std::boolalpha << _hasDoorHardpoint << "\n";
+		SWG_LOG(LOG_INFO) << "Has door hardpoint: " << std::boolalpha << _hasDoorHardpoint << "\n";
 		total += base::read(file, _doorHardpointTransform);
-		std::cout << "Door hardpoint transform:\n" << _doorHardpointTransform << "\n";
+		SWG_LOG(LOG_INFO) << "Door hardpoint transform:\n" << _doorHardpointTransform << "\n";
 	}
 
 	if (prtlSize == total)
 	{
-		std::cout << "Finished reading PRTL\n";
+		SWG_LOG(LOG_INFO) << "Finished reading PRTL\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading PRTL\n"
+		SWG_LOG(LOG_ERROR) << "FAILED in reading PRTL\n"
 			<< "Read " << total << " out of " << prtlSize << "\n";
 	}
 	return total;
@@ -25,6 +25,7 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/portalGeometry.hpp>
+#include <swgLib/logger.hpp>
 
 #include <ios>
 
@@ -41,17 +42,17 @@ std::size_t portalGeometry::read(std::istream& file) {
 	std::size_t prtlSize;
 	std::size_t total = base::readRecordHeader(file, "PRTL", prtlSize);
 	prtlSize += 8;
-	std::cout << "Found Record PRTL: " << prtlSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found Record PRTL: " << prtlSize - 12 << " bytes\n";
 
 	total += base::read(file, _numVertex);
-	std::cout << "Num vertices: " << _numVertex << "\n";
+	SWG_LOG(LOG_INFO) << "Num vertices: " << _numVertex << "\n";
 	_vertex.resize(_numVertex);
 
 	// TODO: Create idtl and with Triangle fan centered at vertex[0]...
 
 	for (auto &v : _vertex) {
 		total += base::read(file, v);
-		std::cout << "Vertex: " << v << "\n";
+		SWG_LOG(LOG_DEBUG) << "Vertex: " << v << "\n";
 	}
 
 	return total;
@@ -25,6 +25,8 @@
 
 #include <swgLib/primitive.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -42,32 +44,33 @@ std::size_t primitive::readOld(std::istream& file, bool skipSIDX) {
 	std::size_t primitiveSize;
 	std::size_t total = base::readFormHeader(file, form, primitiveSize, type);
 	primitiveSize += 8;
-	std::cout << form << ":" << type << "\n";
+	SWG_LOG(LOG_INFO) << form << ":" << type << "\n";
 
 	std::size_t size;
 	total += base::readRecordHeader(file, "INFO", size);
 
 	total += base::read(file, _primitiveType);
-	std::cout << "    Primitive type: " << shaderPrimitiveTypeToString(_primitiveType) << "\n";
+	SWG_LOG(LOG_INFO) << "    Primitive type: " << shaderPrimitiveTypeToString(_primitiveType) << "\n";
 
 	// Load vertices
 	total += _vertex.read(file);
 
 	// These primitive types need index array...
 	if ((_primitiveType >= IndexedPointList) && (_primitiveType <= IndexedTriangleFan)) {
-		std::cout << "       Has indices: true\n";
+		SWG_LOG(LOG_INFO) << "       Has indices: true\n";
 		_hasIndices = true;
 
 		std::size_t indxSize, indxRead;
 		base::readRecordHeader(file, "INDX", indxSize);
-		std::cout << "Found record INDX: " << indxSize << "\n";
+		SWG_LOG(LOG_INFO) << "Found record INDX: " << indxSize << "\n";
 
 		// Indices are 32-bit
 		indxRead = _index.readRaw(file, uint32_t(indxSize/4), false);
 
 		if (indxSize != indxRead) {
-			std::cout << "INDX data mismatch. Expected: " << indxSize << ", found: " << indxRead << "\n";
-			exit(0);
+			std::ostringstream msg;
+			msg << "INDX data mismatch. Expected: " << indxSize << ", found: " << indxRead;
+			base::fail(file, "INDX", msg.str());
 		}
 
 		total += indxRead + 8;
@@ -78,20 +81,21 @@ std::size_t primitive::readOld(std::istream& file, bool skipSIDX) {
 		}
 	}
 	else {
-		std::cout << "       Has indices: false\n";
+		SWG_LOG(LOG_INFO) << "       Has indices: false\n";
 		_hasIndices = false;
 	}
 	_hasSortedIndices = false;
 
 	if (primitiveSize == total)
 	{
-		std::cout << "Finished reading primitive\n";
+		SWG_LOG(LOG_INFO) << "Finished reading primitive\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading primitive\n";
-		std::cout << "Read " << total << " out of " << primitiveSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading primitive: ";
+		msg << "Read " << total << " out of " << primitiveSize;
+		base::fail(file, type, msg.str());
 	}
 
 	return total;
@@ -104,10 +108,10 @@ std::size_t primitive::read(std::istream& file, bool skipSIDX) {
 	primitiveSize += 8;
 	uint8_t version = base::tagToVersion(type);
 	if (0 == version) {
-		std::cout << "Primitive version: 0 (Indices are 32-bit)\n";
+		SWG_LOG(LOG_INFO) << "Primitive version: 0 (Indices are 32-bit)\n";
 	}
 	else if (1 == version) {
-		std::cout << "Primitive version: 1 (Indices are 16-bit)\n";
+		SWG_LOG(LOG_INFO) << "Primitive version: 1 (Indices are 16-bit)\n";
 	}
 
 	std::size_t size;
@@ -117,7 +121,7 @@ std::size_t primitive::read(std::istream& file, bool skipSIDX) {
 	total += base::read(file, _hasIndices);
 	total += base::read(file, _hasSortedIndices);
 
-	std::cout
+	SWG_LOG(LOG_INFO)
 		<< "    Primitive type: " << shaderPrimitiveTypeToString(_primitiveType) << "\n"
 		<< "       Has indices: " << std::boolalpha << _hasIndices << "\n"
 		<< "Has sorted indices: " << std::boolalpha << _hasSortedIndices << "\n";
@@ -128,7 +132,7 @@ std::size_t primitive::read(std::istream& file, bool skipSIDX) {
 	if (_hasIndices) {
 		std::size_t indxSize, indxRead;
 		base::readRecordHeader(file, "INDX", indxSize);
-		std::cout << "Found record INDX: " << indxSize << "\n";
+		SWG_LOG(LOG_INFO) << "Found record INDX: " << indxSize << "\n";
 
 		// Load indices
 		if (0 == version) {
@@ -141,8 +145,9 @@ std::size_t primitive::read(std::istream& file, bool skipSIDX) {
 		}
 
 		if (indxSize != indxRead) {
-			std::cout << "INDX data mismatch. Expected: " << indxSize << ", found: " << indxRead << "\n";
-			exit(0);
+			std::ostringstream msg;
+			msg << "INDX data mismatch. Expected: " << indxSize << ", found: " << indxRead;
+			base::fail(file, "INDX", msg.str());
 		}
 
 		total += indxRead + 8;
@@ -161,7 +166,7 @@ std::size_t primitive::read(std::istream& file, bool skipSIDX) {
 			file.seekg(sidxSize, std::ios_base::cur);
 		}
 		else {
-			std::cout << "Found record SIDX: " << size << "\n";
+			SWG_LOG(LOG_INFO) << "Found record SIDX: " << size << "\n";
 
 			std::size_t sidxRead = 0;
 			// Load sorted indices
@@ -175,8 +180,9 @@ std::size_t primitive::read(std::istream& file, bool skipSIDX) {
 			}
 
 			if (sidxSize != sidxRead) {
-				std::cout << "SIDX data mismatch. Expected: " << sidxSize << ", found: " << sidxRead << "\n";
-				exit(0);
+				std::ostringstream msg;
+				msg << "SIDX data mismatch. Expected: " << sidxSize << ", found: " << sidxRead;
+				base::fail(file, "SIDX", msg.str());
 			}
 
 			total += sidxRead + 8;
@@ -185,13 +191,14 @@ std::size_t primitive::read(std::istream& file, bool skipSIDX) {
 
 	if (primitiveSize == total)
 	{
-		std::cout << "Finished reading primitive\n";
+		SWG_LOG(LOG_INFO) << "Finished reading primitive\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading primitive\n";
-		std::cout << "Read " << total << " out of " << primitiveSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading primitive: ";
+		msg << "Read " << total << " out of " << primitiveSize;
+		base::fail(file, type, msg.str());
 	}
 
 	return total;
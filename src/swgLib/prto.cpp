@@ -27,10 +27,12 @@
 #include <swgLib/prto.hpp>
 #include <swgLib/portal.hpp>
 #include <swgLib/lght.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <bitset>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -64,32 +66,33 @@ std::size_t prto::readPRTO(std::istream& file)
 {
 	std::size_t prtoSize;
 	std::size_t total = base::readFormHeader(file, "PRTO", prtoSize);
-	std::cout << "Found PRTO form" << ": " << prtoSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found PRTO form" << ": " << prtoSize << " bytes\n";
 
 	std::string type;
 	std::size_t size;
 	total += base::readFormHeader(file, type, size);
 	_version = base::tagToVersion(type);
-	std::cout << "Version: " << (int)_version << "\n";
+	SWG_LOG(LOG_INFO) << "Version: " << (int)_version << "\n";
 
 	if (_version > 5) {
-		std::cout << "Expected FORM of type 0000, 0001, 0002, 0003, or 0004: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM of type 0000, 0001, 0002, 0003, or 0004: " << type;
+		base::fail(file, type, msg.str());
 	}
 
 	// ********** Read data record **********
 	std::size_t dataSize;
 	total += base::readRecordHeader(file, "DATA", dataSize);
-	std::cout << "Found record DATA: " << dataSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found record DATA: " << dataSize << " bytes\n";
 	total += base::read(file, _numPortals);
 	total += base::read(file, _numCells);
-	std::cout << "Num portals: " << _numPortals << "\n"
+	SWG_LOG(LOG_INFO) << "Num portals: " << _numPortals << "\n"
 		<< "Num cells: " << _numCells << "\n";
 
 	// ********** Read portal list **********
 	std::size_t prtsSize;
 	total += base::readFormHeader(file, "PRTS", prtsSize);
-	std::cout << "Found form PRTS: " << prtsSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found form PRTS: " << prtsSize << " bytes\n";
 	_portalGeometry.resize(_numPortals);
 	for (auto& pg : _portalGeometry) {
 		total += pg.read(file);
@@ -98,7 +101,7 @@ std::size_t prto::readPRTO(std::istream& file)
 	// ********** Read Cell list **********
 	std::size_t celsSize;
 	total += base::readFormHeader(file, "CELS", celsSize);
-	std::cout << "Found record CELS: " << celsSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found record CELS: " << celsSize << " bytes\n";
 	_cells.resize(_numCells);
 	for (auto& c : _cells) {
 		total += c.read(file);
@@ -108,7 +111,7 @@ std::size_t prto::readPRTO(std::istream& file)
 	if (1 < _version) {
 		std::string form;
 		base::peekHeader(file, form, size, type);
-		std::cout << "Peek: " << form << "\n";
+		SWG_LOG(LOG_INFO) << "Peek: " << form << "\n";
 		if (("FORM" == form) && ("PGRF" == type)) {
 			// Read Path Graph Factory record
 			total += _pgrf.read(file);
@@ -118,17 +121,18 @@ std::size_t prto::readPRTO(std::istream& file)
 	// Only for versions 1+
 	if (0 < _version) {
 		total += base::read(file, _crc);
-		std::cout << "CRC: 0x" << std::hex << _crc << std::dec << "\n";
+		SWG_LOG(LOG_INFO) << "CRC: 0x" << std::hex << _crc << std::dec << "\n";
 	}
 
 	if (prtoSize == total) {
-		std::cout << "Finished reading PRTO\n";
+		SWG_LOG(LOG_INFO) << "Finished reading PRTO\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading PRTO\n"
-			<< "Read " << total << " out of " << prtoSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading PRTO: "
+			<< "Read " << total << " out of " << prtoSize;
+		base::fail(file, "PRTO", msg.str());
 	}
 
 	return total;
@@ -25,16 +25,22 @@
 
 #include <swgLib/ptat.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <bitset>
 #include <cstdlib>
 #include <memory>
+#include <sstream>
 
 using namespace ml;
 
 // Procedural Terrain Appearance
-ptat::ptat()
+ptat::ptat() :
+	_ptatVersion(0),
+	_versionChunk(iffIndex::npos),
+	_tgenLoaded(false),
+	_wsMapLoaded(false)
 {
 }
 
@@ -42,30 +48,189 @@ ptat::~ptat()
 {
 }
 
-std::size_t ptat::read(std::istream& file)
+ptat::ptat(const ptat& other) : ptat()
+{
+	*this = other;
+}
+
+ptat& ptat::operator=(const ptat& other)
+{
+	if (this == &other)
+	{
+		return *this;
+	}
+
+	// A decode in progress on other must not be copied half done
+	std::lock(other._tgenMutex, other._wsMapMutex);
+	std::lock_guard<std::mutex> tgenLock(other._tgenMutex, std::adopt_lock);
+	std::lock_guard<std::mutex> wsMapLock(other._wsMapMutex, std::adopt_lock);
+
+	appr::operator=(other);
+	_ptatVersion = other._ptatVersion;
+	_name = other._name;
+	_mapWidth = other._mapWidth;
+	_chunkWidth = other._chunkWidth;
+	_tilesPerChunk = other._tilesPerChunk;
+	_useGlobalWaterTable = other._useGlobalWaterTable;
+	_globalWaterTableHeight = other._globalWaterTableHeight;
+	_globalWaterTableShaderSize = other._globalWaterTableShaderSize;
+	_globalWaterTableShader = other._globalWaterTableShader;
+	_environmentCycleTime = other._environmentCycleTime;
+	_collidableMinDist = other._collidableMinDist;
+	_collidableMaxDist = other._collidableMaxDist;
+	_collidableTileSize = other._collidableTileSize;
+	_collidableTileBorder = other._collidableTileBorder;
+	_collidableSeed = other._collidableSeed;
+	_nonCollidableMinDist = other._nonCollidableMinDist;
+	_nonCollidableMaxDist = other._nonCollidableMaxDist;
+	_nonCollidableTileSize = other._nonCollidableTileSize;
+	_nonCollidableTileBorder = other._nonCollidableTileBorder;
+	_nonCollidableSeed = other._nonCollidableSeed;
+	_radialMinDist = other._radialMinDist;
+	_radialMaxDist = other._radialMaxDist;
+	_radialTileSize = other._radialTileSize;
+	_radialTileBorder = other._radialTileBorder;
+	_radialSeed = other._radialSeed;
+	_farRadialMinDist = other._farRadialMinDist;
+	_farRadialMaxDist = other._farRadialMaxDist;
+	_farRadialTileSize = other._farRadialTileSize;
+	_farRadialTileBorder = other._farRadialTileBorder;
+	_farRadialSeed = other._farRadialSeed;
+	_legacyMap = other._legacyMap;
+	_tgen = other._tgen;
+	_wsMap = other._wsMap;
+	_index = other._index;
+	_versionChunk = other._versionChunk;
+	_tgenLoaded.store(other._tgenLoaded.load(std::memory_order_relaxed),
+		std::memory_order_relaxed);
+	_wsMapLoaded.store(other._wsMapLoaded.load(std::memory_order_relaxed),
+		std::memory_order_relaxed);
+
+	return *this;
+}
+
+// Outer PTAT/MPTA form and version form. Shared by the stream reader,
+// which takes headers straight from the file, and the in-memory one.
+template<typename S>
+static std::size_t readPTATHeader(S& file,
+	std::size_t& ptatSize,
+	uint32_t& version)
 {
 	// PTAT or MPTA Form ( Level 0 )
 	std::string type;
-	std::size_t ptatSize;
 	std::size_t total = base::readFormHeader(file, type, ptatSize);
 	ptatSize += 8;
 
 	if (("MPTA" != type) && ("PTAT" != type)) {
-		std::cout << "Found form: " << type << ": expected type MPTA or PTAT\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Found form: " << type << ": expected type MPTA or PTAT";
+		base::fail(file, "MPTA", msg.str());
 	}
-	std::cout << "Found " << type << " form\n";
+	SWG_LOG(LOG_INFO) << "Found " << type << " form\n";
 
 	std::size_t size;
 	total += base::readFormHeader(file, type, size);
-	_ptatVersion = base::tagToVersion(type);
-	if ((_ptatVersion < 13) || (15 < _ptatVersion)) {
-		std::cout << "Expected type [0013..0015]: " << type << std::endl;
-		exit(0);
+	version = base::tagToVersion(type);
+	if ((version < 13) || (15 < version)) {
+		std::ostringstream msg;
+		msg << "Expected type [0013..0015]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found form of type: " << type << std::endl;
-	std::cout << "PTAT version: " << _ptatVersion << "\n";
-	total += base::readRecordHeader(file, "DATA", size);
+	SWG_LOG(LOG_INFO) << "Found form of type: " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "PTAT version: " << version << "\n";
+
+	return total;
+}
+
+template<typename S>
+static void readPTATTail(S& file,
+	const uint32_t& version,
+	const std::size_t& total,
+	const std::size_t& ptatSize)
+{
+	if (version >= 15) {
+		std::string form;
+		std::string type;
+		std::size_t size;
+		base::peekHeader(file, form, size, type);
+		SWG_LOG(LOG_INFO) << "Peek: " << form << ":" << type << "\n";
+		//	total += base::skip(file, size + 8);
+				//total += base::read static collidable flora
+		//total += base::read static collidable flora height
+	}
+
+	if (ptatSize == total)
+	{
+		SWG_LOG(LOG_INFO) << "Finished reading PTAT\n";
+	}
+	else
+	{
+		std::ostringstream msg;
+		msg << "Failed in reading PTAT: "
+			<< "Read " << total << " out of " << ptatSize;
+		base::fail(file, "PTAT", msg.str());
+	}
+}
+
+// Next sub-form of the stream, loaded on its own.
+static void loadSubForm(std::istream& file, iffReader& reader, const std::string& tag)
+{
+	if (!reader.load(file))
+	{
+		base::fail(file, tag, "Truncated form");
+	}
+}
+
+std::size_t ptat::read(std::istream& file)
+{
+	// Only one sub-form is held in memory at a time.
+	std::size_t ptatSize;
+	std::size_t total = readPTATHeader(file, ptatSize, _ptatVersion);
+
+	iffReader reader;
+	loadSubForm(file, reader, "DATA");
+	total += readDATA(reader);
+
+	// Read terrain generation parameters...
+	loadSubForm(file, reader, "TGEN");
+	total += _tgen.read(reader);
+	_tgenLoaded = true;
+
+	// Read water and slope maps...
+	loadSubForm(file, reader, "WMAP");
+	total += _wsMap.read(reader);
+	_wsMapLoaded = true;
+
+	readPTATTail(file, _ptatVersion, total, ptatSize);
+
+	return total;
+}
+
+std::size_t ptat::read(iffReader& file)
+{
+	std::size_t ptatSize;
+	std::size_t total = readPTATHeader(file, ptatSize, _ptatVersion);
+	total += readDATA(file);
+
+	// Read terrain generation parameters...
+	total += _tgen.read(file);
+	_tgenLoaded = true;
+
+	// Read water and slope maps...
+	total += _wsMap.read(file);
+	_wsMapLoaded = true;
+
+	readPTATTail(file, _ptatVersion, total, ptatSize);
+
+	return total;
+}
+
+std::size_t ptat::readDATA(iffReader& file)
+{
+	std::size_t dataSize;
+	std::size_t total = base::readRecordHeader(file, "DATA", dataSize);
+	dataSize += 8;
+
 
 	total += base::read(file, _name);
 	total += base::read(file, _mapWidth);
@@ -78,7 +243,7 @@ std::size_t ptat::read(std::istream& file)
 	total += base::read(file, _globalWaterTableShader);
 	total += base::read(file, _environmentCycleTime);
 
-	std::cout
+	SWG_LOG(LOG_INFO)
 		<< "Terrain name: " << _name << "\n"
 		<< "Terrain Width: " << _mapWidth << "(m)\n"
 		<< "Chunk width: " << _chunkWidth << "(m)\n"
@@ -112,7 +277,7 @@ std::size_t ptat::read(std::istream& file)
 	total += base::read(file, _collidableTileBorder);
 	total += base::read(file, _collidableSeed);
 
-	std::cout << "Collidable:\n"
+	SWG_LOG(LOG_INFO) << "Collidable:\n"
 		<< "\t Min distance: " << _collidableMinDist << "\n"
 		<< "\t Max distance: " << _collidableMaxDist << "\n"
 		<< "\t    Tile size: " << _collidableTileSize << "\n"
@@ -125,7 +290,7 @@ std::size_t ptat::read(std::istream& file)
 	total += base::read(file, _nonCollidableTileBorder);
 	total += base::read(file, _nonCollidableSeed);
 
-	std::cout << "Non-collidable:\n"
+	SWG_LOG(LOG_INFO) << "Non-collidable:\n"
 		<< "\t Min distance: " << _nonCollidableMinDist << "\n"
 		<< "\t Max distance: " << _nonCollidableMaxDist << "\n"
 		<< "\t    Tile size: " << _nonCollidableTileSize << "\n"
@@ -138,7 +303,7 @@ std::size_t ptat::read(std::istream& file)
 	total += base::read(file, _radialTileBorder);
 	total += base::read(file, _radialSeed);
 
-	std::cout << "Radial:\n"
+	SWG_LOG(LOG_INFO) << "Radial:\n"
 		<< "\t Min distance: " << _radialMinDist << "\n"
 		<< "\t Max distance: " << _radialMaxDist << "\n"
 		<< "\t    Tile size: " << _radialTileSize << "\n"
@@ -151,7 +316,7 @@ std::size_t ptat::read(std::istream& file)
 	total += base::read(file, _farRadialTileBorder);
 	total += base::read(file, _farRadialSeed);
 
-	std::cout << "Far Radial:\n"
+	SWG_LOG(LOG_INFO) << "Far Radial:\n"
 		<< "\t Min distance: " << _farRadialMinDist << "\n"
 		<< "\t Max distance: " << _farRadialMaxDist << "\n"
 		<< "\t    Tile size: " << _farRadialTileSize << "\n"
@@ -160,35 +325,119 @@ std::size_t ptat::read(std::istream& file)
 
 	if (_ptatVersion >= 15) {
 		total += base::read(file, _legacyMap);
-		std::cout << "Legacy map: " << std::boolalpha << _legacyMap << "\n";
+		SWG_LOG(LOG_INFO) << "Legacy map: " << std::boolalpha << _legacyMap << "\n";
 	}
 
-	// Read terrain generation parameters...
-	total += _tgen.read(file);
+	if (dataSize != total)
+	{
+		std::ostringstream msg;
+		msg << "Failed in reading PTAT DATA: "
+			<< "Read " << total << " out of " << dataSize;
+		base::fail(file, "PTAT", msg.str());
+	}
 
-	// Read water and slope maps...
-	total += _wsMap.read(file);
+	return total;
+}
 
-	if (_ptatVersion >= 15) {
-		std::string form;
-		base::peekHeader(file, form, size, type);
-		std::cout << "Peek: " << form << ":" << type << "\n";
-		//	total += base::skip(file, size + 8);
-				//total += base::read static collidable flora
-		//total += base::read static collidable flora height
+bool ptat::open(std::istream& file)
+{
+	if (!_index.load(file))
+	{
+		SWG_LOG(LOG_ERROR) << "Failed to index terrain form\n";
+		return false;
 	}
+	return openIndex();
+}
 
-	if (ptatSize == total)
+bool ptat::open(const char* data, const std::size_t& size)
+{
+	if (!_index.build(data, size))
 	{
-		std::cout << "Finished reading PTAT\n";
+		SWG_LOG(LOG_ERROR) << "Failed to index terrain form\n";
+		return false;
 	}
-	else
-	{
-		std::cout << "Failed in reading PTAT\n"
-			<< "Read " << total << " out of " << ptatSize << "\n";
-		exit(0);
+	return openIndex();
+}
+
+bool ptat::openIndex()
+{
+	_tgenLoaded = false;
+	_wsMapLoaded = false;
+	_tgen.clear();
+	_wsMap = wsMap();
+
+	if (_index.empty()) {
+		return false;
 	}
 
-	return total;
+	const iffIndex::chunk& root = _index.at(0);
+	if (!root.isForm() ||
+		((iffIndex::tagFromStr("PTAT") != root.type) &&
+		(iffIndex::tagFromStr("MPTA") != root.type))) {
+		SWG_LOG(LOG_INFO) << "Expected form of type MPTA or PTAT\n";
+		return false;
+	}
+
+	_versionChunk = _index.firstChild(0);
+	if (iffIndex::npos == _versionChunk) {
+		return false;
+	}
+	_ptatVersion = base::tagToVersion(base::tagToStr(_index.at(_versionChunk).type));
+	if ((_ptatVersion < 13) || (15 < _ptatVersion)) {
+		SWG_LOG(LOG_INFO) << "Expected type [0013..0015]: " << _ptatVersion << std::endl;
+		return false;
+	}
+
+	const uint32_t data = _index.findChild(_versionChunk, tag::TAG_DATA);
+	if (iffIndex::npos == data) {
+		SWG_LOG(LOG_INFO) << "PTAT DATA record not found\n";
+		return false;
+	}
+
+	iffReader reader = _index.reader(data);
+	readDATA(reader);
+
+	return !reader.fail();
 }
 
+uint32_t ptat::getVersion() const { return _ptatVersion; }
+const std::string& ptat::getName() const { return _name; }
+const float& ptat::getMapWidth() const { return _mapWidth; }
+const float& ptat::getChunkWidth() const { return _chunkWidth; }
+const int32_t& ptat::getTilesPerChunk() const { return _tilesPerChunk; }
+
+const tgen& ptat::getTerrainGenerator() const
+{
+	if (!_tgenLoaded.load(std::memory_order_acquire)) {
+		std::lock_guard<std::mutex> lock(_tgenMutex);
+		if (!_tgenLoaded.load(std::memory_order_relaxed)) {
+			const uint32_t i = _index.findChild(_versionChunk,
+				iffIndex::tagFromStr("TGEN"));
+			if (iffIndex::npos != i) {
+				_tgen.open(_index, i);
+			}
+			_tgenLoaded.store(true, std::memory_order_release);
+		}
+	}
+	return _tgen;
+}
+
+const wsMap& ptat::getWaterSlopeMap() const
+{
+	if (!_wsMapLoaded.load(std::memory_order_acquire)) {
+		std::lock_guard<std::mutex> lock(_wsMapMutex);
+		if (!_wsMapLoaded.load(std::memory_order_relaxed)) {
+			// The water/slope map is the form following TGEN.
+			uint32_t i = _index.findChild(_versionChunk,
+				iffIndex::tagFromStr("TGEN"));
+			i = _index.nextSibling(i);
+			if ((iffIndex::npos != i) && _index.at(i).isForm()) {
+				_wsMap = wsMap();
+				iffReader reader = _index.reader(i);
+				_wsMap.read(reader);
+			}
+			_wsMapLoaded.store(true, std::memory_order_release);
+		}
+	}
+	return _wsMap;
+}
@@ -24,10 +24,12 @@
 */
 #include <swgLib/ptcl.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <bitset>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -48,17 +50,18 @@ std::size_t ptcl::read(std::istream& file)
 	std::size_t ptclSize;
 	std::size_t total = base::readFormHeader(file, "PTCL", ptclSize);
 	ptclSize += 8;
-	std::cout << "Found PTCL: " << ptclSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found PTCL: " << ptclSize - 12 << " bytes\n";
 
 	std::string type;
 	std::size_t size;
 	total += base::readFormHeader(file, type, size);
 	_version = base::tagToVersion(type);
 	if (_version > 3) {
-		std::cout << "Expected type [0000..0003]: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0000..0003]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Particle Description Version: " << _version << "\n";
+	SWG_LOG(LOG_INFO) << "Particle Description Version: " << _version << "\n";
 
 	total += base::readRecordHeader(file, "0000", size);
 	total += base::read(file, _name);
@@ -96,12 +99,13 @@ std::size_t ptcl::read(std::istream& file)
 
 
 	if (ptclSize == total) {
-		std::cout << "Finished reading PTCL\n";
+		SWG_LOG(LOG_INFO) << "Finished reading PTCL\n";
 	}
 	else {
-		std::cout << "FAILED in reading PTCL\n"
-			<< "Read " << total << " out of " << ptclSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading PTCL: "
+			<< "Read " << total << " out of " << ptclSize;
+		base::fail(file, "PTCL", msg.str());
 	}
 
 	return total;
@@ -24,8 +24,10 @@
 */
 #include <swgLib/ptex.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
+#include <sstream>
 
 using namespace ml;
 
@@ -42,17 +44,18 @@ std::size_t ptex::read(std::istream& file)
 	std::size_t ptexSize;
 	std::size_t total = base::readFormHeader(file, "PTEX", ptexSize);
 	ptexSize += 8;
-	std::cout << "Found PTEX: " << ptexSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found PTEX: " << ptexSize - 12 << " bytes\n";
 
 	std::string type;
 	std::size_t size;
 	total += base::readRecordHeader(file, type, size);
 	_version = base::tagToVersion(type);
 	if (_version > 0) {
-		std::cout << "Expected type [0000]: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0000]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Particle Texture Version: " << _version << "\n";
+	SWG_LOG(LOG_INFO) << "Particle Texture Version: " << _version << "\n";
 
 	total += base::read(file, _shaderPath);
 	total += base::read(file, _frameCount);
@@ -64,12 +67,13 @@ std::size_t ptex::read(std::istream& file)
 	total += base::read(file, _textureVisible);
 
 	if (ptexSize == total) {
-		std::cout << "Finished reading PTEX\n";
+		SWG_LOG(LOG_INFO) << "Finished reading PTEX\n";
 	}
 	else {
-		std::cout << "FAILED in reading PTEX\n"
-			<< "Read " << total << " out of " << ptexSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading PTEX: "
+			<< "Read " << total << " out of " << ptexSize;
+		base::fail(file, "PTEX", msg.str());
 	}
 
 	return total;
@@ -24,10 +24,12 @@
 */
 #include <swgLib/ptim.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <bitset>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -45,7 +47,7 @@ std::size_t ptim::read(std::istream& file)
 	std::size_t ptimSize;
 	std::size_t total = base::readFormHeader(file, "PTIM", ptimSize);
 	ptimSize += 8;
-	std::cout << "Found FORM PTIM: " << ptimSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM PTIM: " << ptimSize - 12 << " bytes\n";
 
 	std::size_t size;
 	std::string type;
@@ -53,10 +55,11 @@ std::size_t ptim::read(std::istream& file)
 
 	_version = base::tagToVersion(type);
 	if (_version > 1) {
-		std::cout << "Expected type [0000..0001]: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0000..0001]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "PTIM version: " << (int)_version << "\n";
+	SWG_LOG(LOG_INFO) << "PTIM version: " << (int)_version << "\n";
 
 	total += base::read(file, _startDelayMin);
 	total += base::read(file, _startDelayMax);
@@ -71,7 +74,7 @@ std::size_t ptim::read(std::istream& file)
 		}
 	}
 
-	std::cout
+	SWG_LOG(LOG_INFO)
 		<< "Start delay min: " << _startDelayMin << "\n"
 		<< "Start delay max: " << _startDelayMax << "\n"
 		<< "Loop delay min: " << _loopDelayMin << "\n"
@@ -81,13 +84,14 @@ std::size_t ptim::read(std::istream& file)
 
 	if (ptimSize == total)
 	{
-		std::cout << "Finished reading PTIM\n";
+		SWG_LOG(LOG_INFO) << "Finished reading PTIM\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading PTIM\n"
-			<< "Read " << total << " out of " << ptimSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading PTIM: "
+			<< "Read " << total << " out of " << ptimSize;
+		base::fail(file, "PTIM", msg.str());
 	}
 
 	return total;
@@ -24,8 +24,10 @@
 */
 #include <swgLib/ptmh.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
+#include <sstream>
 
 using namespace ml;
 
@@ -42,7 +44,7 @@ std::size_t ptmh::read(std::istream& file)
 	std::size_t ptmhSize;
 	std::size_t total = base::readFormHeader(file, "PTMH", ptmhSize);
 	ptmhSize += 8;
-	std::cout << "Found PTMH: " << ptmhSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found PTMH: " << ptmhSize - 12 << " bytes\n";
 
 	total += ptcl::read(file);
 
@@ -51,10 +53,11 @@ std::size_t ptmh::read(std::istream& file)
 	total += base::readFormHeader(file, type, size);
 	_version = base::tagToVersion(type);
 	if (_version > 0) {
-		std::cout << "Expected type [0000]: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0000]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Particle Description Mesh Version: " << _version << "\n";
+	SWG_LOG(LOG_INFO) << "Particle Description Mesh Version: " << _version << "\n";
 
 	if (_version > 0) {
 		total += base::readRecordHeader(file, "0000", size);
@@ -67,12 +70,13 @@ std::size_t ptmh::read(std::istream& file)
 	total += _rotationZ.read(file);
 
 	if (ptmhSize == total) {
-		std::cout << "Finished reading PTMH\n";
+		SWG_LOG(LOG_INFO) << "Finished reading PTMH\n";
 	}
 	else {
-		std::cout << "FAILED in reading PTMH\n"
-			<< "Read " << total << " out of " << ptmhSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading PTMH: "
+			<< "Read " << total << " out of " << ptmhSize;
+		base::fail(file, "PTMH", msg.str());
 	}
 
 	return total;
@@ -24,8 +24,10 @@
 */
 #include <swgLib/ptqd.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
+#include <sstream>
 
 using namespace ml;
 
@@ -47,17 +49,18 @@ std::size_t ptqd::read(std::istream& file)
 		std::size_t ptqdSize;
 		std::size_t total = base::readFormHeader(file, "PTQD", ptqdSize);
 		ptqdSize += 8;
-		std::cout << "Found PTQD: " << ptqdSize - 12 << " bytes\n";
+		SWG_LOG(LOG_INFO) << "Found PTQD: " << ptqdSize - 12 << " bytes\n";
 
 		total += ptcl::read(file);
 
 		total += base::readFormHeader(file, type, size);
 		_version = base::tagToVersion(type);
 		if (_version > 3) {
-			std::cout << "Expected type [0000..0003]: " << type << "\n";
-			exit(0);
+			std::ostringstream msg;
+			msg << "Expected type [0000..0003]: " << type;
+			base::fail(file, type, msg.str());
 		}
-		std::cout << "Particle Description Quad Version: " << _version << "\n";
+		SWG_LOG(LOG_INFO) << "Particle Description Quad Version: " << _version << "\n";
 
 		total += _rotation.read(file);
 		total += _length.read(file);
@@ -73,12 +76,13 @@ std::size_t ptqd::read(std::istream& file)
 		}
 
 		if (ptqdSize == total) {
-			std::cout << "Finished reading PTQD\n";
+			SWG_LOG(LOG_INFO) << "Finished reading PTQD\n";
 		}
 		else {
-			std::cout << "FAILED in reading PTQD\n"
-				<< "Read " << total << " out of " << ptqdSize << "\n";
-			exit(0);
+			std::ostringstream msg;
+			msg << "FAILED in reading PTQD: "
+				<< "Read " << total << " out of " << ptqdSize;
+			base::fail(file, "PTQD", msg.str());
 		}
 
 		return total;
@@ -87,15 +91,16 @@ std::size_t ptqd::read(std::istream& file)
 		std::size_t ptqdSize;
 		std::size_t total = base::readFormHeader(file, "PTCL", ptqdSize);
 		ptqdSize += 8;
-		std::cout << "Found PTCL Quad: " << ptqdSize - 12 << " bytes\n";
+		SWG_LOG(LOG_INFO) << "Found PTCL Quad: " << ptqdSize - 12 << " bytes\n";
 
 		total += base::readFormHeader(file, type, size);
 		_version = base::tagToVersion(type);
 		if (_version > 1) {
-			std::cout << "Expected type [0000..0001]: " << type << "\n";
-			exit(0);
+			std::ostringstream msg;
+			msg << "Expected type [0000..0001]: " << type;
+			base::fail(file, type, msg.str());
 		}
-		std::cout << "Particle Description Quad(old) Version: " << _version << "\n";
+		SWG_LOG(LOG_INFO) << "Particle Description Quad(old) Version: " << _version << "\n";
 
 		total += base::readRecordHeader(file, "0000", size);
 
@@ -105,8 +110,8 @@ std::size_t ptqd::read(std::istream& file)
 		}
 		total += base::read(file, _randomRotationDirection);
 
-		std::cout << "Name: " << _name << "\n";
-		std::cout << "Random rotation direction: " << _randomRotationDirection << "\n";
+		SWG_LOG(LOG_INFO) << "Name: " << _name << "\n";
+		SWG_LOG(LOG_INFO) << "Random rotation direction: " << _randomRotationDirection << "\n";
 
 		total += _rotation.read(file);
 		total += _length.read(file);
@@ -125,19 +130,21 @@ std::size_t ptqd::read(std::istream& file)
 		}
 
 		if (ptqdSize == total) {
-			std::cout << "Finished reading PTCL Quad\n";
+			SWG_LOG(LOG_INFO) << "Finished reading PTCL Quad\n";
 		}
 		else {
-			std::cout << "FAILED in reading PTCL Quad\n"
-				<< "Read " << total << " out of " << ptqdSize << "\n";
-			exit(0);
+			std::ostringstream msg;
+			msg << "FAILED in reading PTCL Quad: "
+				<< "Read " << total << " out of " << ptqdSize;
+			base::fail(file, "PTCL", msg.str());
 		}
 
 		return total;
 	}
 	else {
-		std::cout << "Unhandled PTQD type: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unhandled PTQD type: " << type;
+		base::fail(file, type, msg.str());
 	}
 	return 0;
 }
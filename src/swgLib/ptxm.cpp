@@ -25,6 +25,8 @@
 
 #include <swgLib/ptxm.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -38,7 +40,7 @@ std::size_t ptxm::read(std::istream& file) {
 	std::size_t ptxmSize;
 	std::size_t total = base::readFormHeader(file, "PTXM", ptxmSize);
 	ptxmSize += 8;
-	std::cout << "Found FORM PTXM: " << ptxmSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM PTXM: " << ptxmSize - 12 << " bytes\n";
 
 	std::size_t size;
 	std::string type;
@@ -47,16 +49,17 @@ std::size_t ptxm::read(std::istream& file) {
 	_version = base::tagToVersion(type);
 	if (_version > 2)
 	{
-		std::cout << "Expected FORM of type 0000, 0001, or 0002. Found: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM of type 0000, 0001, or 0002. Found: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found FORM " << type << ": " << size - 4 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM " << type << ": " << size - 4 << " bytes\n";
 
 	total += base::read(file, _textureIndex);
-	std::cout << "Texture index: " << (int)_textureIndex << "\n";
+	SWG_LOG(LOG_INFO) << "Texture index: " << (int)_textureIndex << "\n";
 
 	total += base::read(file, _textureTag);
-	std::cout << "Texture tag: " << _textureTag << "\n";
+	SWG_LOG(LOG_INFO) << "Texture tag: " << _textureTag << "\n";
 
 	if (0 == _version)
 	{
@@ -64,18 +67,18 @@ std::size_t ptxm::read(std::istream& file) {
 		total += base::read(file, ignored);
 
 		total += base::read(file, _textureAddressU);
-		std::cout << "Texture address U: " << (int)_textureAddressU << "\n";
+		SWG_LOG(LOG_INFO) << "Texture address U: " << (int)_textureAddressU << "\n";
 		total += base::read(file, _textureAddressV);
-		std::cout << "Texture address V: " << (int)_textureAddressV << "\n";
+		SWG_LOG(LOG_INFO) << "Texture address V: " << (int)_textureAddressV << "\n";
 		total += base::read(file, _textureAddressW);
-		std::cout << "Texture address W: " << (int)_textureAddressW << "\n";
+		SWG_LOG(LOG_INFO) << "Texture address W: " << (int)_textureAddressW << "\n";
 
 		total += base::read(file, _textureMipFilter);
-		std::cout << "Texture mip filter: " << (int)_textureMipFilter << "\n";
+		SWG_LOG(LOG_INFO) << "Texture mip filter: " << (int)_textureMipFilter << "\n";
 		total += base::read(file, _textureMinFilter);
-		std::cout << "Texture min filter: " << (int)_textureMinFilter << "\n";
+		SWG_LOG(LOG_INFO) << "Texture min filter: " << (int)_textureMinFilter << "\n";
 		total += base::read(file, _textureMagFilter);
-		std::cout << "Texture mag filter: " << (int)_textureMagFilter << "\n";
+		SWG_LOG(LOG_INFO) << "Texture mag filter: " << (int)_textureMagFilter << "\n";
 
 		uint8_t ignored2;
 		total += base::read(file, ignored2);
@@ -91,13 +94,14 @@ std::size_t ptxm::read(std::istream& file) {
 
 	if (ptxmSize == total)
 	{
-		std::cout << "Finished reading PTXM\n";
+		SWG_LOG(LOG_INFO) << "Finished reading PTXM\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading PTXM\n";
-		std::cout << "Read " << total << " out of " << ptxmSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading PTXM: ";
+		msg << "Read " << total << " out of " << ptxmSize;
+		base::fail(file, "PTXM", msg.str());
 	}
 
 	return total;
@@ -25,6 +25,8 @@
 
 #include <swgLib/rgrp.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -34,21 +36,22 @@ rgrp::rgrp() {
 rgrp::~rgrp() {
 }
 
-std::size_t rgrp::read(std::istream& file) {
+std::size_t rgrp::read(iffReader& file) {
 	std::size_t rgrpSize;
 	std::size_t total = base::readFormHeader(file, "RGRP", rgrpSize);
 	rgrpSize += 8;
-	std::cout << "Found RGRP form: " << rgrpSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found RGRP form: " << rgrpSize << " bytes\n";
 
 	std::size_t size;
 	std::string form, type;
 	base::peekHeader(file, form, size, type);
 	_version = base::tagToVersion(type);
 	if (_version > 4) {
-		std::cout << "Expected type [0000...0004]: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0000...0004]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Radial Group version: " << _version << "\n";
+	SWG_LOG(LOG_INFO) << "Radial Group version: " << _version << "\n";
 
 	switch (_version) {
 	case 0: total += readV0(file); break;
@@ -57,17 +60,21 @@ std::size_t rgrp::read(std::istream& file) {
 	case 3: total += readV3(file); break;
 	case 4: total += readV4(file); break;
 	default:
-		std::cout << "Unexpected version: " << _version << "\n";
-		exit(0);
+		{
+			std::ostringstream msg;
+			msg << "Unexpected version: " << _version;
+			base::fail(file, "RGRP", msg.str());
+		}
 	}
 
 	if (rgrpSize == total) {
-		std::cout << "Finished reading RGRP\n";
+		SWG_LOG(LOG_INFO) << "Finished reading RGRP\n";
 	}
 	else {
-		std::cout << "Failed in reading RGRP\n";
-		std::cout << "Read " << total << " out of " << rgrpSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading RGRP: ";
+		msg << "Read " << total << " out of " << rgrpSize;
+		base::fail(file, "RGRP", msg.str());
 	}
 
 	return total;
@@ -77,7 +84,7 @@ const std::vector<rgrp::family>& rgrp::getFamily() const {
 	return _family;
 }
 
-std::size_t rgrp::readV0(std::istream& file) {
+std::size_t rgrp::readV0(iffReader& file) {
 	std::size_t size0000;
 	std::size_t total = base::readFormHeader(file, "0000", size0000);
 	size0000 += 8;
@@ -107,18 +114,19 @@ std::size_t rgrp::readV0(std::istream& file) {
 	}
 
 	if (size0000 == total) {
-		std::cout << "Finished reading 0000\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0000\n";
 	}
 	else {
-		std::cout << "Failed in reading 0000\n";
-		std::cout << "Read " << total << " out of " << size0000 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0000: ";
+		msg << "Read " << total << " out of " << size0000;
+		base::fail(file, "0000", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t rgrp::readV1(std::istream& file) {
+std::size_t rgrp::readV1(iffReader& file) {
 	std::size_t size0001;
 	std::size_t total = base::readFormHeader(file, "0001", size0001);
 	size0001 += 8;
@@ -150,18 +158,19 @@ std::size_t rgrp::readV1(std::istream& file) {
 	}
 
 	if (size0001 == total) {
-		std::cout << "Finished reading 0001\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0001\n";
 	}
 	else {
-		std::cout << "Failed in reading 0001\n";
-		std::cout << "Read " << total << " out of " << size0001 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0001: ";
+		msg << "Read " << total << " out of " << size0001;
+		base::fail(file, "0001", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t rgrp::readV2(std::istream& file) {
+std::size_t rgrp::readV2(iffReader& file) {
 	std::size_t size0002;
 	std::size_t total = base::readFormHeader(file, "0002", size0002);
 	size0002 += 8;
@@ -197,18 +206,19 @@ std::size_t rgrp::readV2(std::istream& file) {
 	}
 
 	if (size0002 == total) {
-		std::cout << "Finished reading 0002\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0002\n";
 	}
 	else {
-		std::cout << "Failed in reading 0002\n";
-		std::cout << "Read " << total << " out of " << size0002 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0002: ";
+		msg << "Read " << total << " out of " << size0002;
+		base::fail(file, "0002", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t rgrp::readV3(std::istream& file) {
+std::size_t rgrp::readV3(iffReader& file) {
 	std::size_t size0003;
 	std::size_t total = base::readFormHeader(file, "0003", size0003);
 	size0003 += 8;
@@ -246,18 +256,19 @@ std::size_t rgrp::readV3(std::istream& file) {
 	}
 
 	if (size0003 == total) {
-		std::cout << "Finished reading 0003\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0003\n";
 	}
 	else {
-		std::cout << "Failed in reading 0003\n";
-		std::cout << "Read " << total << " out of " << size0003 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0003: ";
+		msg << "Read " << total << " out of " << size0003;
+		base::fail(file, "0003", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t rgrp::readV4(std::istream& file) {
+std::size_t rgrp::readV4(iffReader& file) {
 	std::size_t size0004;
 	std::size_t total = base::readFormHeader(file, "0004", size0004);
 	size0004 += 8;
@@ -298,12 +309,13 @@ std::size_t rgrp::readV4(std::istream& file) {
 	}
 
 	if (size0004 == total) {
-		std::cout << "Finished reading 0004\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0004\n";
 	}
 	else {
-		std::cout << "Failed in reading 0004\n";
-		std::cout << "Read " << total << " out of " << size0004 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0004: ";
+		msg << "Read " << total << " out of " << size0004;
+		base::fail(file, "0004", msg.str());
 	}
 
 	return total;
@@ -25,9 +25,11 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/sbot.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -45,16 +47,16 @@ std::size_t sbot::readSBOT(std::istream& file) {
 	std::size_t sbotSize;
 	std::size_t total = base::readFormHeader(file, "SBOT", sbotSize);
 	sbotSize += 8;
-	std::cout << "Found SBOT form: " << sbotSize << "\n";
+	SWG_LOG(LOG_INFO) << "Found SBOT form: " << sbotSize << "\n";
 
 	total += readDERV(file, _sbotBaseObjectFilename);
-	std::cout << "SBOT Base object filename: " << _sbotBaseObjectFilename << "\n";
+	SWG_LOG(LOG_INFO) << "SBOT Base object filename: " << _sbotBaseObjectFilename << "\n";
 
 	std::string type;
 	std::size_t size;
 	total += base::readFormHeader(file, type, size);
 	_sbotVersion = base::tagToVersion(type);
-	std::cout << "SBOT version: " << (int)_sbotVersion << "\n";
+	SWG_LOG(LOG_INFO) << "SBOT version: " << (int)_sbotVersion << "\n";
 
 	int32_t numParameters;
 	total += readPCNT(file, numParameters);
@@ -67,14 +69,14 @@ std::size_t sbot::readSBOT(std::istream& file) {
 
 	if (sbotSize == total)
 	{
-		std::cout << "Finished reading SBOT" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading SBOT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading SBOT" << std::endl;
-		std::cout << "Read " << total << " out of " << sbotSize
-			<< std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading SBOT: ";
+		msg << "Read " << total << " out of " << sbotSize;
+		base::fail(file, "SBOT", msg.str());
 	}
 
 	return total;
@@ -117,47 +119,48 @@ std::size_t sbot::readSBOTParameter(std::istream& file) {
 	total += base::read(file, dataType);
 
 #if 0
-	std::cout << "Parameter data type: ";
+	SWG_LOG(LOG_INFO) << "Parameter data type: ";
 	switch (dataType) {
-	case 1: std::cout << "Single"; break;
-	case 2: std::cout << "Weighted list"; break;
-	case 3: std::cout << "Range"; break;
-	case 4: std::cout << "Die Roll"; break;
-	default: std::cout << "None:" << (int)dataType;
+	case 1: SWG_LOG(LOG_INFO) << "Single"; break;
+	case 2: SWG_LOG(LOG_INFO) << "Weighted list"; break;
+	case 3: SWG_LOG(LOG_INFO) << "Range"; break;
+	case 4: SWG_LOG(LOG_INFO) << "Die Roll"; break;
+	default: SWG_LOG(LOG_INFO) << "None:" << (int)dataType;
 	}
 	//std::cout << " not handled\n";
-	std::cout << "\n";
+	SWG_LOG(LOG_INFO) << "\n";
 #endif
 
 #if 0
 	const std::size_t valueSize(xxxxSize - total);
-	std::cout << "Value size: " << valueSize << "\n";
+	SWG_LOG(LOG_INFO) << "Value size: " << valueSize << "\n";
 #endif
 	if (parameter == "terrainModificationFileName")
 	{
 		if (1 == dataType) {
 			total += base::read(file, _terrainModificationFileName);
-			std::cout << "Terrain modification filename: " << _terrainModificationFileName << "\n";
+			SWG_LOG(LOG_INFO) << "Terrain modification filename: " << _terrainModificationFileName << "\n";
 		}
 	}
 	else if (parameter == "interiorLayoutFileName")
 	{
 		if (1 == dataType) {
 			total += base::read(file, _interiorLayoutFileName);
-			std::cout << "Interior layout filename: " << _interiorLayoutFileName << "\n";
+			SWG_LOG(LOG_INFO) << "Interior layout filename: " << _interiorLayoutFileName << "\n";
 		}
 	}
 	else
 	{
-		std::cout << "Unknown: " << parameter << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unknown: " << parameter;
+		base::fail(file, "SBOT", msg.str());
 	}
 
 	if (xxxxSize != total) {
-		std::cout << "FAILED in reading XXXX" << std::endl;
-		std::cout << "Read " << total << " out of " << xxxxSize
-			<< std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading XXXX: ";
+		msg << "Read " << total << " out of " << xxxxSize;
+		base::fail(file, "XXXX", msg.str());
 	}
 
 	return total;
@@ -167,14 +170,15 @@ std::size_t sbot::readSBOTParameter(std::istream& file) {
 	std::size_t total = base::readRecordHeader(file, type, xxxxSize);
 	if (type != "XXXX")
 	{
-		std::cout << "Expected record of type XXXX: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type XXXX: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	std::string property;
 	total += base::read(file, property);
-	std::cout << "Property: " << property << std::endl;
+	SWG_LOG(LOG_INFO) << "Property: " << property << std::endl;
 
 	unsigned char enabled;
 	if (property == "terrainModificationFileName")
@@ -184,7 +188,7 @@ std::size_t sbot::readSBOTParameter(std::istream& file) {
 		{
 			total += base::read(file, terrainModificationFilename);
 
-			std::cout << property << ": "
+			SWG_LOG(LOG_INFO) << property << ": "
 				<< terrainModificationFilename
 				<< std::endl;
 		}
@@ -196,7 +200,7 @@ std::size_t sbot::readSBOTParameter(std::istream& file) {
 		{
 			total += base::read(file, interiorLayoutFilename);
 
-			std::cout << property << ": "
+			SWG_LOG(LOG_INFO) << property << ": "
 				<< interiorLayoutFilename
 				<< std::endl;
 		}
@@ -208,27 +212,28 @@ std::size_t sbot::readSBOTParameter(std::istream& file) {
 		{
 			total += base::read(file, _portalLayoutFilename);
 
-			std::cout << property << ": "
+			SWG_LOG(LOG_INFO) << property << ": "
 				<< _portalLayoutFilename
 				<< std::endl;
 		}
 	}
 	else
 	{
-		std::cout << "Unknown: " << property << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unknown: " << property;
+		base::fail(file, "SBOT", msg.str());
 	}
 
 	if (xxxxSize == (total - 8))
 	{
-		std::cout << "Finished reading XXXX" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading XXXX" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading XXXX" << std::endl;
-		std::cout << "Read " << total << " out of " << xxxxSize
-			<< std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading XXXX: ";
+		msg << "Read " << total << " out of " << xxxxSize;
+		base::fail(file, "XXXX", msg.str());
 	}
 
 	return total;
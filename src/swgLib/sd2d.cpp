@@ -29,9 +29,11 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/sd2d.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -48,18 +50,18 @@ unsigned int sd2d::readSD2D(std::istream& file)
 	std::size_t sd2dSize;
 	std::size_t total = readFormHeader(file, "SD2D", sd2dSize);
 	sd2dSize += 8;
-	std::cout << "Found SD2D form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found SD2D form" << std::endl;
 
 	total += read0003(file);
 
 	if (sd2dSize == total)
 	{
-		std::cout << "Finished reading SD2D" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading SD2D" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading SD2D" << std::endl;
-		std::cout << "Read " << total << " out of " << sd2dSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading SD2D" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << sd2dSize
 			<< std::endl;
 	}
 
@@ -74,20 +76,21 @@ unsigned int sd2d::read0003(std::istream& file)
 	size += 8;
 	if (type != "0003")
 	{
-		std::cout << "Expected record of type 0003: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type 0003: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	total += base::read(file, numSamples);
-	std::cout << "Num samples: " << numSamples << std::endl;
+	SWG_LOG(LOG_INFO) << "Num samples: " << numSamples << std::endl;
 
 	std::string sampleName;
 	for (unsigned int i = 0; i < numSamples; ++i)
 	{
 		total += base::read(file, sampleName);
 		base::fixSlash(sampleName);
-		std::cout << "Sample: " << sampleName << std::endl;
+		SWG_LOG(LOG_DEBUG) << "Sample: " << sampleName << std::endl;
 		samples.push_back(sampleName);
 	}
 
@@ -95,26 +98,26 @@ unsigned int sd2d::read0003(std::istream& file)
 	for (unsigned int i = 0; i < 28; ++i)
 	{
 		total += base::read(file, x);
-		std::cout << (unsigned int)x << " ";
+		SWG_LOG(LOG_DEBUG) << (unsigned int)x << " ";
 
 		total += base::read(file, x);
-		std::cout << (unsigned int)x << " ";
+		SWG_LOG(LOG_DEBUG) << (unsigned int)x << " ";
 
 		total += base::read(file, x);
-		std::cout << (unsigned int)x << " ";
+		SWG_LOG(LOG_DEBUG) << (unsigned int)x << " ";
 
 		total += base::read(file, x);
-		std::cout << (unsigned int)x << std::endl;
+		SWG_LOG(LOG_DEBUG) << (unsigned int)x << std::endl;
 	}
 
 	if (size == total)
 	{
-		std::cout << "Finished reading 0003" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading 0003" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading 0003" << std::endl;
-		std::cout << "Read " << total << " out of " << size
+		SWG_LOG(LOG_ERROR) << "FAILED in reading 0003" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << size
 			<< std::endl;
 	}
 
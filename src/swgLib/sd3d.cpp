@@ -29,9 +29,11 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/sd3d.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -48,19 +50,19 @@ unsigned int sd3d::readSD3D(std::istream& file)
 	std::size_t sd3dSize;
 	std::size_t total = readFormHeader(file, "SD3D", sd3dSize);
 	sd3dSize += 8;
-	std::cout << "Found SD3D form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found SD3D form" << std::endl;
 
 	total += readSD2D(file);
 	total += read0001(file);
 
 	if (sd3dSize == total)
 	{
-		std::cout << "Finished reading SD3D" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading SD3D" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading SD3D" << std::endl;
-		std::cout << "Read " << total << " out of " << sd3dSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading SD3D" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << sd3dSize
 			<< std::endl;
 	}
 
@@ -75,19 +77,20 @@ unsigned int sd3d::read0001(std::istream& file)
 	size += 8;
 	if (type != "0001")
 	{
-		std::cout << "Expected record of type 0001: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type 0001: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	if (size == total)
 	{
-		std::cout << "Finished reading 0001" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading 0001" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading 0001" << std::endl;
-		std::cout << "Read " << total << " out of " << size
+		SWG_LOG(LOG_ERROR) << "FAILED in reading 0001" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << size
 			<< std::endl;
 	}
 
@@ -25,6 +25,8 @@
 
 #include <swgLib/sgrp.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -34,21 +36,22 @@ sgrp::sgrp() {
 sgrp::~sgrp() {
 }
 
-std::size_t sgrp::read(std::istream& file) {
+std::size_t sgrp::read(iffReader& file) {
 	std::size_t sgrpSize;
 	std::size_t total = base::readFormHeader(file, "SGRP", sgrpSize);
 	sgrpSize += 8;
-	std::cout << "Found SGRP form: " << sgrpSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found SGRP form: " << sgrpSize << " bytes\n";
 
 	std::size_t size;
 	std::string form, type;
 	base::peekHeader(file, form, size, type);
 	_version = base::tagToVersion(type);
 	if (_version > 6) {
-		std::cout << "Expected type [0000..0006]: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0000..0006]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Shader Group version: " << _version << "\n";
+	SWG_LOG(LOG_INFO) << "Shader Group version: " << _version << "\n";
 
 	switch (_version) {
 	case 0: total += readV0(file); break;
@@ -60,17 +63,21 @@ std::size_t sgrp::read(std::istream& file) {
 	case 6: total += readV6(file); break;
 
 	default:
-		std::cout << "Unexpected shader group version: " << _version << "\n";
-		exit(0);
+		{
+			std::ostringstream msg;
+			msg << "Unexpected shader group version: " << _version;
+			base::fail(file, "SGRP", msg.str());
+		}
 	}
 
 	if (sgrpSize == total) {
-		std::cout << "Finished reading SGRP\n";
+		SWG_LOG(LOG_INFO) << "Finished reading SGRP\n";
 	}
 	else {
-		std::cout << "Failed in reading SGRP\n";
-		std::cout << "Read " << total << " out of " << sgrpSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading SGRP: ";
+		msg << "Read " << total << " out of " << sgrpSize;
+		base::fail(file, "SGRP", msg.str());
 	}
 
 	return total;
@@ -80,7 +87,7 @@ const std::vector<sgrp::family>& sgrp::getFamily() const {
 	return _family;
 }
 
-std::size_t sgrp::readV0(std::istream& file) {
+std::size_t sgrp::readV0(iffReader& file) {
 	std::size_t size0000;
 	std::size_t total = base::readFormHeader(file, "0000", size0000);
 	size0000 += 8;
@@ -100,29 +107,30 @@ std::size_t sgrp::readV0(std::istream& file) {
 		total += base::read(file, newFamily.numChildren);
 
 		newFamily.children.resize(newFamily.numChildren);
-		std::cout << "Num children: " << newFamily.numChildren << "\n";
+		SWG_LOG(LOG_DEBUG) << "Num children: " << newFamily.numChildren << "\n";
 		for (auto& child : newFamily.children) {
 			child.familyId = newFamily.familyId;
 			total += base::read(file, child.shaderName);
-			std::cout << "Child name: " << child.shaderName << "\n";
+			SWG_LOG(LOG_DEBUG) << "Child name: " << child.shaderName << "\n";
 			child.weight = 1.0f / float(newFamily.numChildren);
 		}
 		_family.push_back(newFamily);
 	}
 
 	if (size0000 == total) {
-		std::cout << "Finished reading 0000\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0000\n";
 	}
 	else {
-		std::cout << "Failed in reading 0000\n";
-		std::cout << "Read " << total << " out of " << size0000 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0000: ";
+		msg << "Read " << total << " out of " << size0000;
+		base::fail(file, "0000", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t sgrp::readV1(std::istream& file) {
+std::size_t sgrp::readV1(iffReader& file) {
 	std::size_t size0001;
 	std::size_t total = base::readFormHeader(file, "0001", size0001);
 	size0001 += 8;
@@ -142,13 +150,13 @@ std::size_t sgrp::readV1(std::istream& file) {
 		total += base::read(file, newFamily.numChildren);
 
 		newFamily.children.resize(newFamily.numChildren);
-		std::cout << "Num children: " << newFamily.numChildren << "\n";
+		SWG_LOG(LOG_DEBUG) << "Num children: " << newFamily.numChildren << "\n";
 		for (auto& child : newFamily.children) {
 			child.familyId = newFamily.familyId;
 			total += base::read(file, child.shaderName);
 			total += base::read(file, child.weight);
-			std::cout << "Child name: " << child.shaderName << "\n";
-			std::cout << "Child weight: " << child.weight << "\n";
+			SWG_LOG(LOG_DEBUG) << "Child name: " << child.shaderName << "\n";
+			SWG_LOG(LOG_DEBUG) << "Child weight: " << child.weight << "\n";
 
 			child.weight = 1.0f / float(newFamily.numChildren);
 		}
@@ -156,18 +164,19 @@ std::size_t sgrp::readV1(std::istream& file) {
 	}
 
 	if (size0001 == total) {
-		std::cout << "Finished reading 0001\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0001\n";
 	}
 	else {
-		std::cout << "Failed in reading 0001\n";
-		std::cout << "Read " << total << " out of " << size0001 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0001: ";
+		msg << "Read " << total << " out of " << size0001;
+		base::fail(file, "0001", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t sgrp::readV2(std::istream& file) {
+std::size_t sgrp::readV2(iffReader& file) {
 	std::size_t size0002;
 	std::size_t total = base::readFormHeader(file, "0002", size0002);
 	size0002 += 8;
@@ -187,13 +196,13 @@ std::size_t sgrp::readV2(std::istream& file) {
 		total += base::read(file, newFamily.numChildren);
 
 		newFamily.children.resize(newFamily.numChildren);
-		std::cout << "Num children: " << newFamily.numChildren << "\n";
+		SWG_LOG(LOG_DEBUG) << "Num children: " << newFamily.numChildren << "\n";
 		for (auto& child : newFamily.children) {
 			child.familyId = newFamily.familyId;
 			total += base::read(file, child.shaderName);
 			total += base::read(file, child.weight);
-			std::cout << "Child name: " << child.shaderName << "\n";
-			std::cout << "Child weight: " << child.weight << "\n";
+			SWG_LOG(LOG_DEBUG) << "Child name: " << child.shaderName << "\n";
+			SWG_LOG(LOG_DEBUG) << "Child weight: " << child.weight << "\n";
 
 			child.weight = 1.0f / float(newFamily.numChildren);
 		}
@@ -201,18 +210,19 @@ std::size_t sgrp::readV2(std::istream& file) {
 	}
 
 	if (size0002 == total) {
-		std::cout << "Finished reading 0002\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0002\n";
 	}
 	else {
-		std::cout << "Failed in reading 0002\n";
-		std::cout << "Read " << total << " out of " << size0002 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0002: ";
+		msg << "Read " << total << " out of " << size0002;
+		base::fail(file, "0002", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t sgrp::readV3(std::istream& file) {
+std::size_t sgrp::readV3(iffReader& file) {
 	std::size_t size0003;
 	std::size_t total = base::readFormHeader(file, "0003", size0003);
 	size0003 += 8;
@@ -233,13 +243,13 @@ std::size_t sgrp::readV3(std::istream& file) {
 		total += base::read(file, newFamily.numChildren);
 
 		newFamily.children.resize(newFamily.numChildren);
-		std::cout << "Num children: " << newFamily.numChildren << "\n";
+		SWG_LOG(LOG_DEBUG) << "Num children: " << newFamily.numChildren << "\n";
 		for (auto& child : newFamily.children) {
 			child.familyId = newFamily.familyId;
 			total += base::read(file, child.shaderName);
 			total += base::read(file, child.weight);
-			std::cout << "Child name: " << child.shaderName << "\n";
-			std::cout << "Child weight: " << child.weight << "\n";
+			SWG_LOG(LOG_DEBUG) << "Child name: " << child.shaderName << "\n";
+			SWG_LOG(LOG_DEBUG) << "Child weight: " << child.weight << "\n";
 
 			child.weight = 1.0f / float(newFamily.numChildren);
 		}
@@ -247,18 +257,19 @@ std::size_t sgrp::readV3(std::istream& file) {
 	}
 
 	if (size0003 == total) {
-		std::cout << "Finished reading 0003\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0003\n";
 	}
 	else {
-		std::cout << "Failed in reading 0003\n";
-		std::cout << "Read " << total << " out of " << size0003 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0003: ";
+		msg << "Read " << total << " out of " << size0003;
+		base::fail(file, "0003", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t sgrp::readV4(std::istream& file) {
+std::size_t sgrp::readV4(iffReader& file) {
 	std::size_t size0004;
 	std::size_t total = base::readFormHeader(file, "0004", size0004);
 	size0004 += 8;
@@ -279,13 +290,13 @@ std::size_t sgrp::readV4(std::istream& file) {
 		total += base::read(file, newFamily.numChildren);
 
 		newFamily.children.resize(newFamily.numChildren);
-		std::cout << "Num children: " << newFamily.numChildren << "\n";
+		SWG_LOG(LOG_DEBUG) << "Num children: " << newFamily.numChildren << "\n";
 		for (auto& child : newFamily.children) {
 			child.familyId = newFamily.familyId;
 			total += base::read(file, child.shaderName);
 			total += base::read(file, child.weight);
-			std::cout << "Child name: " << child.shaderName << "\n";
-			std::cout << "Child weight: " << child.weight << "\n";
+			SWG_LOG(LOG_DEBUG) << "Child name: " << child.shaderName << "\n";
+			SWG_LOG(LOG_DEBUG) << "Child weight: " << child.weight << "\n";
 
 			child.weight = 1.0f / float(newFamily.numChildren);
 		}
@@ -293,18 +304,19 @@ std::size_t sgrp::readV4(std::istream& file) {
 	}
 
 	if (size0004 == total) {
-		std::cout << "Finished reading 0004\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0004\n";
 	}
 	else {
-		std::cout << "Failed in reading 0004\n";
-		std::cout << "Read " << total << " out of " << size0004 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0004: ";
+		msg << "Read " << total << " out of " << size0004;
+		base::fail(file, "0004", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t sgrp::readV5(std::istream& file) {
+std::size_t sgrp::readV5(iffReader& file) {
 	std::size_t size0005;
 	std::size_t total = base::readFormHeader(file, "0005", size0005);
 	size0005 += 8;
@@ -326,13 +338,13 @@ std::size_t sgrp::readV5(std::istream& file) {
 		total += base::read(file, newFamily.numChildren);
 
 		newFamily.children.resize(newFamily.numChildren);
-		std::cout << "Num children: " << newFamily.numChildren << "\n";
+		SWG_LOG(LOG_DEBUG) << "Num children: " << newFamily.numChildren << "\n";
 		for (auto& child : newFamily.children) {
 			child.familyId = newFamily.familyId;
 			total += base::read(file, child.shaderName);
 			total += base::read(file, child.weight);
-			std::cout << "Child name: " << child.shaderName << "\n";
-			std::cout << "Child weight: " << child.weight << "\n";
+			SWG_LOG(LOG_DEBUG) << "Child name: " << child.shaderName << "\n";
+			SWG_LOG(LOG_DEBUG) << "Child weight: " << child.weight << "\n";
 
 			child.weight = 1.0f / float(newFamily.numChildren);
 		}
@@ -340,18 +352,19 @@ std::size_t sgrp::readV5(std::istream& file) {
 	}
 
 	if (size0005 == total) {
-		std::cout << "Finished reading 0005\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0005\n";
 	}
 	else {
-		std::cout << "Failed in reading 0005\n";
-		std::cout << "Read " << total << " out of " << size0005 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0005: ";
+		msg << "Read " << total << " out of " << size0005;
+		base::fail(file, "0005", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t sgrp::readV6(std::istream& file) {
+std::size_t sgrp::readV6(iffReader& file) {
 	std::size_t size0006;
 	std::size_t total = base::readFormHeader(file, "0006", size0006);
 	size0006 += 8;
@@ -373,13 +386,13 @@ std::size_t sgrp::readV6(std::istream& file) {
 		total += base::read(file, newFamily.numChildren);
 
 		newFamily.children.resize(newFamily.numChildren);
-		std::cout << "Num children: " << newFamily.numChildren << "\n";
+		SWG_LOG(LOG_DEBUG) << "Num children: " << newFamily.numChildren << "\n";
 		for (auto& child : newFamily.children) {
 			child.familyId = newFamily.familyId;
 			total += base::read(file, child.shaderName);
 			total += base::read(file, child.weight);
-			std::cout << "Child name: " << child.shaderName << "\n";
-			std::cout << "Child weight: " << child.weight << "\n";
+			SWG_LOG(LOG_DEBUG) << "Child name: " << child.shaderName << "\n";
+			SWG_LOG(LOG_DEBUG) << "Child weight: " << child.weight << "\n";
 
 			child.weight = 1.0f / float(newFamily.numChildren);
 		}
@@ -387,12 +400,13 @@ std::size_t sgrp::readV6(std::istream& file) {
 	}
 
 	if (size0006 == total) {
-		std::cout << "Finished reading 0006\n";
+		SWG_LOG(LOG_INFO) << "Finished reading 0006\n";
 	}
 	else {
-		std::cout << "Failed in reading 0006\n";
-		std::cout << "Read " << total << " out of " << size0006 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0006: ";
+		msg << "Read " << total << " out of " << size0006;
+		base::fail(file, "0006", msg.str());
 	}
 
 	return total;
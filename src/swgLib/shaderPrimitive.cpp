@@ -25,6 +25,8 @@
 
 #include <swgLib/shaderPrimitive.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -40,14 +42,14 @@ std::size_t shaderPrimitive::readOld(std::istream& file, bool skipSIDX) {
 	std::size_t total = base::readFormHeader(file, type, spSize);
 	spSize += 8;
 	int32_t spNumber = base::typeToNumber(type);
-	std::cout << "Shader primitive type: " << spNumber << "\n";
+	SWG_LOG(LOG_INFO) << "Shader primitive type: " << spNumber << "\n";
 
 	// Read Shader filename
 	std::size_t size;
 	total += base::readRecordHeader(file, "NAME", size);
 	total += base::read(file, _name);
 	base::fixSlash(_name);
-	std::cout << "  name: " << _name << "\n";
+	SWG_LOG(LOG_INFO) << "  name: " << _name << "\n";
 
 	// Read Shader filename
 	total += base::readRecordHeader(file, "INFO", size);
@@ -55,7 +57,7 @@ std::size_t shaderPrimitive::readOld(std::istream& file, bool skipSIDX) {
 	// Read number of primitives...
 	int32_t numberOfPrimitives = 0;
 	total += base::read(file, numberOfPrimitives);
-	std::cout << "Number of primitives: " << numberOfPrimitives << "\n";
+	SWG_LOG(LOG_INFO) << "Number of primitives: " << numberOfPrimitives << "\n";
 	_primitives.resize(numberOfPrimitives);
 
 	for (auto& p : _primitives) {
@@ -64,13 +66,14 @@ std::size_t shaderPrimitive::readOld(std::istream& file, bool skipSIDX) {
 
 	if (spSize == total)
 	{
-		std::cout << "Finished reading shaderPrimitive\n";
+		SWG_LOG(LOG_INFO) << "Finished reading shaderPrimitive\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading shaderPrimitive\n";
-		std::cout << "Read " << total << " out of " << spSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading shaderPrimitive: ";
+		msg << "Read " << total << " out of " << spSize;
+		base::fail(file, type, msg.str());
 	}
 	return total;
 }
@@ -81,14 +84,14 @@ std::size_t shaderPrimitive::read(std::istream& file, bool skipSIDX) {
 	std::size_t total = base::readFormHeader(file, type, spSize);
 	spSize += 8;
 	int32_t spNumber = base::typeToNumber(type);
-	std::cout << "Shader primitive type: " << spNumber << "\n";
+	SWG_LOG(LOG_INFO) << "Shader primitive type: " << spNumber << "\n";
 
 	// Read Shader filename
 	std::size_t size;
 	total += base::readRecordHeader(file, "NAME", size);
 	total += base::read(file, _name);
 	base::fixSlash(_name);
-	std::cout << "  name: " << _name << "\n";
+	SWG_LOG(LOG_INFO) << "  name: " << _name << "\n";
 
 	// Read Shader filename
 	total += base::readRecordHeader(file, "INFO", size);
@@ -96,7 +99,7 @@ std::size_t shaderPrimitive::read(std::istream& file, bool skipSIDX) {
 	// Read number of primitives...
 	int32_t numberOfPrimitives = 0;
 	total += base::read(file, numberOfPrimitives);
-	std::cout << "Number of primitives: " << numberOfPrimitives << "\n";
+	SWG_LOG(LOG_INFO) << "Number of primitives: " << numberOfPrimitives << "\n";
 	_primitives.resize(numberOfPrimitives);
 
 	for (auto& p : _primitives) {
@@ -105,13 +108,14 @@ std::size_t shaderPrimitive::read(std::istream& file, bool skipSIDX) {
 
 	if (spSize == total)
 	{
-		std::cout << "Finished reading shaderPrimitive\n";
+		SWG_LOG(LOG_INFO) << "Finished reading shaderPrimitive\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading shaderPrimitive\n";
-		std::cout << "Read " << total << " out of " << spSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading shaderPrimitive: ";
+		msg << "Read " << total << " out of " << spSize;
+		base::fail(file, type, msg.str());
 	}
 	return total;
 }
@@ -25,9 +25,11 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/shot.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -74,7 +76,7 @@ std::size_t shot::readSHOT(std::istream& file)
 	std::size_t shotSize;
 	std::size_t total = base::readFormHeader(file, "SHOT", shotSize);
 	shotSize += 8;
-	std::cout << "Found SHOT form: " << shotSize << "\n";
+	SWG_LOG(LOG_INFO) << "Found SHOT form: " << shotSize << "\n";
 
 	std::string form, type;
 	std::size_t size;
@@ -83,12 +85,12 @@ std::size_t shot::readSHOT(std::istream& file)
 	// Optional
 	if ("DERV" == type) {
 		total += readDERV(file, _baseObjectFilename);
-		std::cout << "SHOT Base object filename: " << _baseObjectFilename << "\n";
+		SWG_LOG(LOG_INFO) << "SHOT Base object filename: " << _baseObjectFilename << "\n";
 	}
 
 	total += base::readFormHeader(file, type, size);
 	_shotVersion = base::tagToVersion(type);
-	std::cout << "SHOT version: " << (int)_shotVersion << "\n";
+	SWG_LOG(LOG_INFO) << "SHOT version: " << (int)_shotVersion << "\n";
 
 	// Read parameter count...
 	int32_t numParameters;
@@ -101,14 +103,14 @@ std::size_t shot::readSHOT(std::istream& file)
 
 	if (shotSize == total)
 	{
-		std::cout << "Finished reading SHOT" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading SHOT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading SHOT" << std::endl;
-		std::cout << "Read " << total << " out of " << shotSize
-			<< std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading SHOT: ";
+		msg << "Read " << total << " out of " << shotSize;
+		base::fail(file, "SHOT", msg.str());
 	}
 
 	return total;
@@ -128,10 +130,10 @@ std::size_t shot::readDERV(std::istream& file, std::string& filename)
 
 	if (dervSize != total)
 	{
-		std::cout << "FAILED in reading DERV" << std::endl;
-		std::cout << "Read " << total << " out of " << dervSize
-			<< std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading DERV: ";
+		msg << "Read " << total << " out of " << dervSize;
+		base::fail(file, "DERV", msg.str());
 	}
 
 	return total;
@@ -205,19 +207,20 @@ std::size_t shot::readPCNT(std::istream& file, int32_t& numParameters)
 	std::size_t total = base::readRecordHeader(file, "PCNT", pcntSize);
 
 	if (4 != pcntSize) {
-		std::cout << "Expected size 4: " << pcntSize << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected size 4: " << pcntSize;
+		base::fail(file, "PCNT", msg.str());
 	}
 	pcntSize += 8;
 
 	total += base::read(file, numParameters);
-	std::cout << "Number of parameters: " << numParameters << std::endl;
+	SWG_LOG(LOG_INFO) << "Number of parameters: " << numParameters << std::endl;
 
 	if (pcntSize != total) {
-		std::cout << "FAILED in reading PCNT" << std::endl;
-		std::cout << "Read " << total << " out of " << pcntSize
-			<< std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading PCNT: ";
+		msg << "Read " << total << " out of " << pcntSize;
+		base::fail(file, "PCNT", msg.str());
 	}
 
 	return total;
@@ -242,16 +245,15 @@ std::size_t shot::readSHOTParameter(std::istream& file)
 	total += base::read(file, dataType);
 
 	if ((0 != dataType) && (1 != dataType)) {
-		std::cout << "Parameter data type: ";
+		SWG_LOG(LOG_ERROR) << "Parameter data type: ";
 		switch (dataType) {
-		case 1: std::cout << "Single"; break;
-		case 2: std::cout << "Weighted list"; break;
-		case 3: std::cout << "Range"; break;
-		case 4: std::cout << "Die Roll"; break;
-		default: std::cout << "None:" << (int)dataType;
+		case 1: SWG_LOG(LOG_ERROR) << "Single"; break;
+		case 2: SWG_LOG(LOG_ERROR) << "Weighted list"; break;
+		case 3: SWG_LOG(LOG_ERROR) << "Range"; break;
+		case 4: SWG_LOG(LOG_ERROR) << "Die Roll"; break;
+		default: SWG_LOG(LOG_ERROR) << "None:" << (int)dataType;
 		}
-		std::cout << " not handled\n";
-		exit(0);
+		base::fail(file, "SHOT", "parameter data type not handled");
 	}
 
 	const std::size_t valueSize(xxxxSize - total);
@@ -260,28 +262,28 @@ std::size_t shot::readSHOTParameter(std::istream& file)
 	{
 		if (1 == dataType) {
 			total += base::read(file, _objectName, valueSize);
-			std::cout << "Object name: '" << _objectName << "'\n";
+			SWG_LOG(LOG_INFO) << "Object name: '" << _objectName << "'\n";
 		}
 	}
 	else if (parameter == "detailedDescription")
 	{
 		if (1 == dataType) {
 			total += base::read(file, _detailedDescription, valueSize);
-			std::cout << "Detailed description: " << _detailedDescription << "\n";
+			SWG_LOG(LOG_INFO) << "Detailed description: " << _detailedDescription << "\n";
 		}
 	}
 	else if (parameter == "lookAtText")
 	{
 		if (1 == dataType) {
 			total += base::read(file, _lookAtText, valueSize);
-			std::cout << "Look at text: " << _lookAtText << "\n";
+			SWG_LOG(LOG_INFO) << "Look at text: " << _lookAtText << "\n";
 		}
 	}
 	else if (parameter == "snapToTerrain")
 	{
 		if (1 == dataType) {
 			total += base::read(file, _snapToTerrain);
-			std::cout << "Snap to terrain: " << std::boolalpha << _snapToTerrain << "\n";
+			SWG_LOG(LOG_INFO) << "Snap to terrain: " << std::boolalpha << _snapToTerrain << "\n";
 		}
 	}
 	else if (parameter == "containerType")
@@ -290,7 +292,7 @@ std::size_t shot::readSHOTParameter(std::istream& file)
 		total += base::read(file, dataDeltaType);
 		if (1 == dataType) {
 			total += base::read(file, _containerType);
-			std::cout << "Container type: " << _containerType << "\n";
+			SWG_LOG(LOG_INFO) << "Container type: " << _containerType << "\n";
 		}
 	}
 	else if (parameter == "containerVolumeLimit")
@@ -299,49 +301,49 @@ std::size_t shot::readSHOTParameter(std::istream& file)
 		total += base::read(file, dataDeltaType);
 		if (1 == dataType) {
 			total += base::read(file, _containerVolumeLimit);
-			std::cout << "Container volume limit: " << _containerVolumeLimit << "\n";
+			SWG_LOG(LOG_INFO) << "Container volume limit: " << _containerVolumeLimit << "\n";
 		}
 	}
 	else if (parameter == "tintPalette")
 	{
 		if (1 == dataType) {
 			total += base::read(file, _tintPalette, valueSize);
-			std::cout << "Tint palette: '" << _tintPalette << "'\n";
+			SWG_LOG(LOG_INFO) << "Tint palette: '" << _tintPalette << "'\n";
 		}
 	}
 	else if (parameter == "slotDescriptorFilename")
 	{
 		if (1 == dataType) {
 			total += base::read(file, _slotDescriptorFilename, valueSize);
-			std::cout << "Slot descriptor filename: '" << _slotDescriptorFilename << "'\n";
+			SWG_LOG(LOG_INFO) << "Slot descriptor filename: '" << _slotDescriptorFilename << "'\n";
 		}
 	}
 	else if (parameter == "arrangementDescriptorFilename")
 	{
 		if (1 == dataType) {
 			total += base::read(file, _arrangementDescriptorFilename, valueSize);
-			std::cout << "Arrangement descriptor filename: '" << _arrangementDescriptorFilename << "'\n";
+			SWG_LOG(LOG_INFO) << "Arrangement descriptor filename: '" << _arrangementDescriptorFilename << "'\n";
 		}
 	}
 	else if (parameter == "appearanceFilename")
 	{
 		if (1 == dataType) {
 			total += base::read(file, _appearanceFilename, valueSize);
-			std::cout << "Appearance filename: '" << _appearanceFilename << "'\n";
+			SWG_LOG(LOG_INFO) << "Appearance filename: '" << _appearanceFilename << "'\n";
 		}
 	}
 	else if (parameter == "portalLayoutFilename")
 	{
 		if (1 == dataType) {
 			total += base::read(file, _portalLayoutFilename, valueSize);
-			std::cout << "Portal layout filename: '" << _portalLayoutFilename << "'\n";
+			SWG_LOG(LOG_INFO) << "Portal layout filename: '" << _portalLayoutFilename << "'\n";
 		}
 	}
 	else if (parameter == "clientDataFile")
 	{
 		if (1 == dataType) {
 			total += base::read(file, _clientDataFile, valueSize);
-			std::cout << "Client data file: '" << _clientDataFile << "'\n";
+			SWG_LOG(LOG_INFO) << "Client data file: '" << _clientDataFile << "'\n";
 		}
 	}
 	else if (parameter == "collisionMaterialFlags")
@@ -350,7 +352,7 @@ std::size_t shot::readSHOTParameter(std::istream& file)
 		total += base::read(file, dataDeltaType);
 		if (1 == dataType) {
 			total += base::read(file, _collisionMaterialFlags);
-			std::cout << "Collision material flags: 0x" << std::hex << _collisionMaterialFlags << std::dec << "\n";
+			SWG_LOG(LOG_INFO) << "Collision material flags: 0x" << std::hex << _collisionMaterialFlags << std::dec << "\n";
 		}
 	}
 	else if (parameter == "collisionMaterialPassFlags")
@@ -359,7 +361,7 @@ std::size_t shot::readSHOTParameter(std::istream& file)
 		total += base::read(file, dataDeltaType);
 		if (1 == dataType) {
 			total += base::read(file, _collisionMaterialPassFlags);
-			std::cout << "Collision material pass flags: 0x" << std::hex << _collisionMaterialPassFlags << std::dec << "\n";
+			SWG_LOG(LOG_INFO) << "Collision material pass flags: 0x" << std::hex << _collisionMaterialPassFlags << std::dec << "\n";
 		}
 	}
 	else if (parameter == "collisionMaterialBlockFlags")
@@ -368,7 +370,7 @@ std::size_t shot::readSHOTParameter(std::istream& file)
 		total += base::read(file, dataDeltaType);
 		if (1 == dataType) {
 			total += base::read(file, _collisionMaterialBlockFlags);
-			std::cout << "Collision material block flags: 0x" << std::hex << _collisionMaterialBlockFlags << std::dec << "\n";
+			SWG_LOG(LOG_INFO) << "Collision material block flags: 0x" << std::hex << _collisionMaterialBlockFlags << std::dec << "\n";
 		}
 	}
 	else if (parameter == "collisionActionFlags")
@@ -377,7 +379,7 @@ std::size_t shot::readSHOTParameter(std::istream& file)
 		total += base::read(file, dataDeltaType);
 		if (1 == dataType) {
 			total += base::read(file, _collisionActionFlags);
-			std::cout << "Collision action flags: 0x" << std::hex << _collisionActionFlags << std::dec << "\n";
+			SWG_LOG(LOG_INFO) << "Collision action flags: 0x" << std::hex << _collisionActionFlags << std::dec << "\n";
 		}
 	}
 	else if (parameter == "collisionActionPassFlags")
@@ -386,7 +388,7 @@ std::size_t shot::readSHOTParameter(std::istream& file)
 		total += base::read(file, dataDeltaType);
 		if (1 == dataType) {
 			total += base::read(file, _collisionActionPassFlags);
-			std::cout << "Collision action pass flags: 0x" << std::hex << _collisionActionPassFlags << std::dec << "\n";
+			SWG_LOG(LOG_INFO) << "Collision action pass flags: 0x" << std::hex << _collisionActionPassFlags << std::dec << "\n";
 		}
 	}
 	else if (parameter == "collisionActionBlockFlags")
@@ -395,7 +397,7 @@ std::size_t shot::readSHOTParameter(std::istream& file)
 		total += base::read(file, dataDeltaType);
 		if (1 == dataType) {
 			total += base::read(file, _collisionActionBlockFlags);
-			std::cout << "Collision action block flags: 0x" << std::hex << _collisionActionBlockFlags << std::dec << "\n";
+			SWG_LOG(LOG_INFO) << "Collision action block flags: 0x" << std::hex << _collisionActionBlockFlags << std::dec << "\n";
 		}
 	}
 	else if (parameter == "scale")
@@ -404,7 +406,7 @@ std::size_t shot::readSHOTParameter(std::istream& file)
 		total += base::read(file, dataDeltaType);
 		if (1 == dataType) {
 			total += base::read(file, _scale);
-			std::cout << "Scale: " << _scale << "\n";
+			SWG_LOG(LOG_INFO) << "Scale: " << _scale << "\n";
 		}
 	}
 	else if (parameter == "gameObjectType")
@@ -413,14 +415,14 @@ std::size_t shot::readSHOTParameter(std::istream& file)
 		total += base::read(file, dataDeltaType);
 		if (1 == dataType) {
 			total += base::read(file, _gameObjectType);
-			std::cout << "Game object type: " << _gameObjectType << "\n";
+			SWG_LOG(LOG_INFO) << "Game object type: " << _gameObjectType << "\n";
 		}
 	}
 	else if (parameter == "sendToClient")
 	{
 		if (1 == dataType) {
 			total += base::read(file, _sendToClient);
-			std::cout << "Send to client: " << std::boolalpha << _sendToClient << "\n";
+			SWG_LOG(LOG_INFO) << "Send to client: " << std::boolalpha << _sendToClient << "\n";
 		}
 	}
 	else if (parameter == "scaleThresholdBeforeExtentTest")
@@ -429,7 +431,7 @@ std::size_t shot::readSHOTParameter(std::istream& file)
 		total += base::read(file, dataDeltaType);
 		if (1 == dataType) {
 			total += base::read(file, _scaleThresholdBeforeExtentTest);
-			std::cout << "Scale threshold before extent test: " << _scaleThresholdBeforeExtentTest << "\n";
+			SWG_LOG(LOG_INFO) << "Scale threshold before extent test: " << _scaleThresholdBeforeExtentTest << "\n";
 		}
 	}
 	else if (parameter == "clearFloraRadius")
@@ -438,7 +440,7 @@ std::size_t shot::readSHOTParameter(std::istream& file)
 		total += base::read(file, dataDeltaType);
 		if (1 == dataType) {
 			total += base::read(file, _clearFloraRadius);
-			std::cout << "Clear flora radius: " << _clearFloraRadius << "\n";
+			SWG_LOG(LOG_INFO) << "Clear flora radius: " << _clearFloraRadius << "\n";
 		}
 	}
 	else if (parameter == "surfaceType")
@@ -447,7 +449,7 @@ std::size_t shot::readSHOTParameter(std::istream& file)
 		total += base::read(file, dataDeltaType);
 		if (1 == dataType) {
 			total += base::read(file, _surfaceType);
-			std::cout << "Surface type: " << _surfaceType << "\n";
+			SWG_LOG(LOG_INFO) << "Surface type: " << _surfaceType << "\n";
 		}
 	}
 	else if (parameter == "noBuildRadius")
@@ -456,14 +458,14 @@ std::size_t shot::readSHOTParameter(std::istream& file)
 		total += base::read(file, dataDeltaType);
 		if (1 == dataType) {
 			total += base::read(file, _noBuildRadius);
-			std::cout << "No build radius: " << _noBuildRadius << "\n";
+			SWG_LOG(LOG_INFO) << "No build radius: " << _noBuildRadius << "\n";
 		}
 	}
 	else if (parameter == "onlyVisibleInTools")
 	{
 		if (1 == dataType) {
 			total += base::read(file, _onlyVisibleInTools);
-			std::cout << "Only visible in tools: " << std::boolalpha << _onlyVisibleInTools << "\n";
+			SWG_LOG(LOG_INFO) << "Only visible in tools: " << std::boolalpha << _onlyVisibleInTools << "\n";
 		}
 	}
 	else if (parameter == "locationReservationRadius")
@@ -472,27 +474,28 @@ std::size_t shot::readSHOTParameter(std::istream& file)
 		total += base::read(file, dataDeltaType);
 		if (1 == dataType) {
 			total += base::read(file, _locationReservationRadius);
-			std::cout << "Location reservation radius: " << _locationReservationRadius << "\n";
+			SWG_LOG(LOG_INFO) << "Location reservation radius: " << _locationReservationRadius << "\n";
 		}
 	}
 	else if (parameter == "forceNoCollision")
 	{
 		if (1 == dataType) {
 			total += base::read(file, _forceNoCollision);
-			std::cout << "Force no collision: " << std::boolalpha << _forceNoCollision << "\n";
+			SWG_LOG(LOG_INFO) << "Force no collision: " << std::boolalpha << _forceNoCollision << "\n";
 		}
 	}
 	else
 	{
-		std::cout << "Unknown: " << parameter << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unknown: " << parameter;
+		base::fail(file, "SHOT", msg.str());
 	}
 
 	if (xxxxSize != total) {
-		std::cout << "FAILED in reading XXXX" << std::endl;
-		std::cout << "Read " << total << " out of " << xxxxSize
-			<< std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading XXXX: ";
+		msg << "Read " << total << " out of " << xxxxSize;
+		base::fail(file, "XXXX", msg.str());
 	}
 
 	return total;
@@ -24,6 +24,8 @@
 */
 
 #include <swgLib/sht.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -56,13 +58,13 @@ std::size_t sht::readSHT(std::istream& file)
 	std::size_t sshtSize;
 	std::size_t total = base::readFormHeader(file, "SSHT", sshtSize);
 	sshtSize += 8; // Include FORM/Size fields from header...
-	std::cout << "Found SSHT form: " << sshtSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found SSHT form: " << sshtSize << " bytes\n";
 
 	std::size_t size;
 	std::string form, type;
 	base::peekHeader(file, form, size, type);
 	_version = base::tagToVersion(type);
-	std::cout << "SSHT version: " << (int)_version << "\n";
+	SWG_LOG(LOG_INFO) << "SSHT version: " << (int)_version << "\n";
 
 	if (0 == _version) {
 		total += readV0(file);
@@ -71,16 +73,17 @@ std::size_t sht::readSHT(std::istream& file)
 		total += readV1(file);
 	}
 	else {
-		std::cout << "Unsupported Static Shader (SSHT) version: " << (int)_version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unsupported Static Shader (SSHT) version: " << (int)_version;
+		base::fail(file, "SHT ", msg.str());
 	}
 
 	if (sshtSize == total) {
-		std::cout << "Finished reading SSHT\n";
+		SWG_LOG(LOG_INFO) << "Finished reading SSHT\n";
 	}
 	else {
-		std::cout << "FAILED in reading SSHT\n";
-		std::cout << "Read " << total << " out of " << sshtSize << "\n";
+		SWG_LOG(LOG_ERROR) << "FAILED in reading SSHT\n";
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << sshtSize << "\n";
 	}
 
 	return total;
@@ -131,17 +134,18 @@ std::size_t sht::readV0(std::istream& file) {
 	base::peekHeader(file, form, size, type);
 	if ("NAME" == form) {
 		total += base::readRecordHeader(file, "NAME", size);
-		std::cout << "Found record NAME: " << size << "\n";
+		SWG_LOG(LOG_INFO) << "Found record NAME: " << size << "\n";
 		total += base::read(file, _effectName);
 		base::fixSlash(_effectName);
-		std::cout << "Effect: " << _effectName << "\n";
+		SWG_LOG(LOG_INFO) << "Effect: " << _effectName << "\n";
 	}
 	else if ("EFCT" == form) {
 		total += _effect.readEFCT(file);
 	}
 	else {
-		std::cout << "Unhandled effect type: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unhandled effect type: " << type;
+		base::fail(file, type, msg.str());
 	}
 
 	return total;
@@ -156,17 +160,18 @@ std::size_t sht::readV1(std::istream& file) {
 	base::peekHeader(file, form, size, type);
 	if ("NAME" == form) {
 		total += base::readRecordHeader(file, "NAME", size);
-		std::cout << "Found record NAME: " << size << "\n";
+		SWG_LOG(LOG_INFO) << "Found record NAME: " << size << "\n";
 		total += base::read(file, _effectName);
 		base::fixSlash(_effectName);
-		std::cout << "Effect: " << _effectName << "\n";
+		SWG_LOG(LOG_INFO) << "Effect: " << _effectName << "\n";
 	}
 	else if ("EFCT" == form) {
 		total += _effect.readEFCT(file);
 	}
 	else {
-		std::cout << "Unhandled effect type: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unhandled effect type: " << type;
+		base::fail(file, type, msg.str());
 	}
 
 	// Load materials...
@@ -219,27 +224,27 @@ std::size_t sht::readMATS(std::istream& file)
 	std::size_t matsSize;
 	std::size_t total = base::readFormHeader(file, "MATS", matsSize);
 	matsSize += 8;
-	std::cout << "Found FORM MATS: " << matsSize - 12 << " bytes"
+	SWG_LOG(LOG_INFO) << "Found FORM MATS: " << matsSize - 12 << " bytes"
 		<< std::endl;
 
 	std::size_t size;
 	total += base::readFormHeader(file, "0000", size);
 	size -= 4; // Subtract off form tag "0000"
-	std::cout << "Found FORM 0000: " << size << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM 0000: " << size << " bytes\n";
 
 	while (size > 0) {
-		std::cout << "Reading material " << _material.size() << ":\n";
+		SWG_LOG(LOG_DEBUG) << "Reading material " << _material.size() << ":\n";
 		_material.resize(_material.size() + 1);
 
 		// Read TAG record...
 		std::size_t tagSize;
 		std::size_t matSize = base::readRecordHeader(file, "TAG ", tagSize);
-		std::cout << "Found record TAG : " << tagSize << " bytes\n";
+		SWG_LOG(LOG_DEBUG) << "Found record TAG : " << tagSize << " bytes\n";
 
 		// Read material name...
 		tag nameTag;
 		matSize += base::read(file, nameTag);
-		std::cout << "Material name: " << nameTag << "\n";
+		SWG_LOG(LOG_DEBUG) << "Material name: " << nameTag << "\n";
 
 		// Set material name...
 		_material.back().setNameTag(nameTag);
@@ -253,13 +258,14 @@ std::size_t sht::readMATS(std::istream& file)
 
 	if (matsSize == total)
 	{
-		std::cout << "Finished reading MATS\n";
+		SWG_LOG(LOG_INFO) << "Finished reading MATS\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading MATS\n";
-		std::cout << "Read " << total << " out of " << matsSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading MATS: ";
+		msg << "Read " << total << " out of " << matsSize;
+		base::fail(file, "MATS", msg.str());
 	}
 
 	return total;
@@ -270,10 +276,10 @@ std::size_t sht::readTXMS(std::istream& file)
 	std::size_t txmsSize;
 	std::size_t total = base::readFormHeader(file, "TXMS", txmsSize);
 	txmsSize += 8;
-	std::cout << "Found FORM TXMS: " << txmsSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM TXMS: " << txmsSize << " bytes\n";
 
 	while (total < txmsSize ) {
-		std::cout << "Reading texture " << _texture.size() << ":\n";
+		SWG_LOG(LOG_DEBUG) << "Reading texture " << _texture.size() << ":\n";
 		_texture.resize(_texture.size() + 1);
 
 		// Read texture...
@@ -284,13 +290,14 @@ std::size_t sht::readTXMS(std::istream& file)
 
 	if (txmsSize == total)
 	{
-		std::cout << "Finished reading TXMS\n";
+		SWG_LOG(LOG_INFO) << "Finished reading TXMS\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading TXMS\n";
-		std::cout << "Read " << total << " out of " << txmsSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading TXMS: ";
+		msg << "Read " << total << " out of " << txmsSize;
+		base::fail(file, "TXMS", msg.str());
 	}
 
 	return total;
@@ -301,11 +308,11 @@ std::size_t sht::readTCSS(std::istream& file)
 	std::size_t tcssSize;
 	std::size_t total = base::readFormHeader(file, "TCSS", tcssSize);
 	tcssSize += 8;
-	std::cout << "Found FORM TCSS: " << tcssSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM TCSS: " << tcssSize - 12 << " bytes\n";
 
 	std::size_t size;
 	total += base::readRecordHeader(file, "0000", size);
-	std::cout << "Found record 0000: " << size << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found record 0000: " << size << " bytes\n";
 
 	const uint32_t num = uint32_t(size / 5);
 	tag texTag;
@@ -314,16 +321,17 @@ std::size_t sht::readTCSS(std::istream& file)
 		total += base::read(file, texTag);
 		total += base::read(file, index);
 		_texCoordSet[texTag] = index;
-		std::cout << "Tex Coord Set: " << texTag << ": " << (int)index << "\n";
+		SWG_LOG(LOG_DEBUG) << "Tex Coord Set: " << texTag << ": " << (int)index << "\n";
 	}
 
 	if (tcssSize == total) {
-		std::cout << "Finished reading TCSS\n";
+		SWG_LOG(LOG_INFO) << "Finished reading TCSS\n";
 	}
 	else {
-		std::cout << "FAILED in reading TCSS\n";
-		std::cout << "Read " << total << " out of " << tcssSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading TCSS: ";
+		msg << "Read " << total << " out of " << tcssSize;
+		base::fail(file, "TCSS", msg.str());
 	}
 
 	return total;
@@ -334,11 +342,11 @@ std::size_t sht::readTFNS(std::istream& file)
 	std::size_t tfnsSize;
 	std::size_t total = base::readFormHeader(file, "TFNS", tfnsSize);
 	tfnsSize += 8;
-	std::cout << "Found FORM TFNS: " << tfnsSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM TFNS: " << tfnsSize - 12 << " bytes\n";
 
 	std::size_t size;
 	total += base::readRecordHeader(file, "0000", size);
-	std::cout << "Found record 0000: " << size << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found record 0000: " << size << " bytes\n";
 
 	const uint32_t num = uint32_t(size / 8);
 	for (uint32_t i = 0; i < num; ++i) {
@@ -349,18 +357,19 @@ std::size_t sht::readTFNS(std::istream& file)
 		color4 c;
 		total += c.read8(file);
 		_texFactor[texTag] = c;
-		std::cout << "Texture factor " << i << ": " << texTag << ": " << c << "\n";
+		SWG_LOG(LOG_DEBUG) << "Texture factor " << i << ": " << texTag << ": " << c << "\n";
 	}
 
 	if (tfnsSize == total)
 	{
-		std::cout << "Finished reading TFNS\n";
+		SWG_LOG(LOG_INFO) << "Finished reading TFNS\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading TFNS\n";
-		std::cout << "Read " << total << " out of " << tfnsSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading TFNS: ";
+		msg << "Read " << total << " out of " << tfnsSize;
+		base::fail(file, "TFNS", msg.str());
 	}
 
 	return total;
@@ -370,11 +379,11 @@ std::size_t sht::readTSNS(std::istream& file) {
 	std::size_t tsnsSize;
 	std::size_t total = base::readFormHeader(file, "TSNS", tsnsSize);
 	tsnsSize += 8;
-	std::cout << "Found FORM TSNS: " << tsnsSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM TSNS: " << tsnsSize - 12 << " bytes\n";
 
 	std::size_t size;
 	total += base::readRecordHeader(file, "0000", size);
-	std::cout << "Found record 0000: " << size << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found record 0000: " << size << " bytes\n";
 
 	tag texTag;
 	total += base::read(file, texTag);
@@ -384,7 +393,7 @@ std::size_t sht::readTSNS(std::istream& file) {
 	total += base::read(file, scroll.u2);
 	total += base::read(file, scroll.v2);
 
-	std::cout << "Scroll texture: " << texTag.str() << "\n"
+	SWG_LOG(LOG_INFO) << "Scroll texture: " << texTag.str() << "\n"
 		<< "u1: " << scroll.u1 << "\n"
 		<< "v1: " << scroll.v1 << "\n"
 		<< "u2: " << scroll.u2 << "\n"
@@ -393,12 +402,13 @@ std::size_t sht::readTSNS(std::istream& file) {
 	_texScroll[texTag] = scroll;
 
 	if (tsnsSize == total) {
-		std::cout << "Finished reading TSNS\n";
+		SWG_LOG(LOG_INFO) << "Finished reading TSNS\n";
 	}
 	else {
-		std::cout << "FAILED in reading TSNS\n";
-		std::cout << "Read " << total << " out of " << tsnsSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading TSNS: ";
+		msg << "Read " << total << " out of " << tsnsSize;
+		base::fail(file, "TSNS", msg.str());
 	}
 
 	return total;
@@ -409,11 +419,11 @@ std::size_t sht::readARVS(std::istream& file)
 	std::size_t arvsSize;
 	std::size_t total = base::readFormHeader(file, "ARVS", arvsSize);
 	arvsSize += 8;
-	std::cout << "Found FORM ARVS: " << arvsSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM ARVS: " << arvsSize - 12 << " bytes\n";
 
 	std::size_t size;
 	total += base::readRecordHeader(file, "0000", size);
-	std::cout << "Found record 0000: " << size << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found record 0000: " << size << " bytes\n";
 
 	const uint32_t num = uint32_t(size / 5);
 
@@ -423,18 +433,19 @@ std::size_t sht::readARVS(std::istream& file)
 		total += base::read(file, alphaTag);
 		total += base::read(file, alphaReferenceValue);
 		_alphaReferenceValue[alphaTag] = alphaReferenceValue;
-		std::cout << "Alpha reference " << i << ": " << alphaTag << ": " << (int)alphaReferenceValue << "\n";
+		SWG_LOG(LOG_DEBUG) << "Alpha reference " << i << ": " << alphaTag << ": " << (int)alphaReferenceValue << "\n";
 	}
 
 	if (arvsSize == total)
 	{
-		std::cout << "Finished reading ARVS\n";
+		SWG_LOG(LOG_INFO) << "Finished reading ARVS\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading ARVS\n";
-		std::cout << "Read " << total << " out of " << arvsSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading ARVS: ";
+		msg << "Read " << total << " out of " << arvsSize;
+		base::fail(file, "ARVS", msg.str());
 	}
 
 	return total;
@@ -445,11 +456,11 @@ std::size_t sht::readSRVS(std::istream& file)
 	std::size_t srvsSize;
 	std::size_t total = base::readFormHeader(file, "SRVS", srvsSize);
 	srvsSize += 8;
-	std::cout << "Found FORM SRVS: " << srvsSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM SRVS: " << srvsSize - 12 << " bytes\n";
 
 	std::size_t size;
 	total += base::readRecordHeader(file, "0000", size);
-	std::cout << "Found record 0000: " << size << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found record 0000: " << size << " bytes\n";
 
 	const uint32_t num = uint32_t(size / 5);
 
@@ -459,18 +470,19 @@ std::size_t sht::readSRVS(std::istream& file)
 		total += base::read(file, stencilTag);
 		total += base::read(file, stencilReferenceValue);
 		_stencilReferenceValue[stencilTag] = stencilReferenceValue;
-		std::cout << "Stencil reference " << i << ": " << stencilTag << ": " << (int)stencilReferenceValue << "\n";
+		SWG_LOG(LOG_DEBUG) << "Stencil reference " << i << ": " << stencilTag << ": " << (int)stencilReferenceValue << "\n";
 	}
 
 	if (srvsSize == total)
 	{
-		std::cout << "Finished reading SRVS\n";
+		SWG_LOG(LOG_INFO) << "Finished reading SRVS\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading SRVS\n";
-		std::cout << "Read " << total << " out of " << srvsSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading SRVS: ";
+		msg << "Read " << total << " out of " << srvsSize;
+		base::fail(file, "SRVS", msg.str());
 	}
 
 	return total;
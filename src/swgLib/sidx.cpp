@@ -25,6 +25,7 @@
 
 #include <swgLib/sidx.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 
 using namespace ml;
 
@@ -36,15 +37,15 @@ sidx::~sidx() {
 
 std::size_t sidx::read(std::istream& file, bool sidx16) {
 	std::size_t total = base::read(file, _numArrays);
-	std::cout << "Directional Sorted Index buffers: " << _numArrays << "\n";
+	SWG_LOG(LOG_INFO) << "Directional Sorted Index buffers: " << _numArrays << "\n";
 
 	_first.resize(_numArrays);
 	_second.resize(_numArrays);
 
 	for (auto i = 0; i < _numArrays; ++i) {
-		std::cout << "Sorted index " << i << ":\n";
+		SWG_LOG(LOG_DEBUG) << "Sorted index " << i << ":\n";
 		total += base::read(file, _first[i]);
-		std::cout << "first: " << _first[i] << "\n";
+		SWG_LOG(LOG_DEBUG) << "first: " << _first[i] << "\n";
 		total += _second[i].read(file, sidx16);
 	}
 
@@ -29,13 +29,24 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/skmg.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
-skmg::skmg()
+skmg::skmg() :
+	numSkeletons(0),
+	numBones(0),
+	numPoints(0),
+	numNorm(0),
+	numPSDT(0),
+	numDot3(0),
+	numTwdt(0),
+	numIndex(0),
+	numBLT(0)
 {
 }
 
@@ -43,126 +54,277 @@ skmg::~skmg()
 {
 }
 
-unsigned int skmg::readSKMG(std::istream& file)
+bool skmg::open(std::istream& file)
 {
-	std::size_t skmgSize;
-	std::size_t total = readFormHeader(file, "SKMG", skmgSize);
+	if (!index.load(file))
+	{
+		SWG_LOG(LOG_ERROR) << "Failed to index SKMG form" << std::endl;
+		return false;
+	}
+	return openIndex();
+}
+
+bool skmg::open(const char* data, const std::size_t& size)
+{
+	if (!index.build(data, size))
+	{
+		SWG_LOG(LOG_ERROR) << "Failed to index SKMG form" << std::endl;
+		return false;
+	}
+	return openIndex();
+}
+
+bool skmg::openIndex()
+{
+	skeletonFilenameList.clear();
+	boneNames.clear();
+
+	if (index.empty() || (iffIndex::tagFromStr("SKMG") != index.at(0).type))
+	{
+		SWG_LOG(LOG_INFO) << "Expected SKMG form" << std::endl;
+		return false;
+	}
+
+	const uint32_t version = index.firstChild(0);
+	const uint32_t info = index.findChild(version, "INFO");
+	if (iffIndex::npos == info)
+	{
+		SWG_LOG(LOG_INFO) << "SKMG INFO record not found" << std::endl;
+		return false;
+	}
+
+	iffReader reader = index.reader(info);
+	readINFO(reader);
+	bool failed = reader.fail();
+
+	const uint32_t sktm = index.findChild(version, "SKTM");
+	if (iffIndex::npos != sktm)
+	{
+		iffReader sktmReader = index.reader(sktm);
+		readSKTM(sktmReader);
+		failed = failed || sktmReader.fail();
+	}
+
+	const uint32_t xfnm = index.findChild(version, "XFNM");
+	if (iffIndex::npos != xfnm)
+	{
+		iffReader xfnmReader = index.reader(xfnm);
+		readXFNM(xfnmReader);
+		failed = failed || xfnmReader.fail();
+	}
+
+	if (failed)
+	{
+		SWG_LOG(LOG_ERROR) << "Truncated SKMG metadata" << std::endl;
+	}
+	return !failed;
+}
+
+bool skmg::loadGeometry()
+{
+	if (index.empty())
+	{
+		return false;
+	}
+
+	// readSKMG decodes the metadata again, so start from a clean slate.
+	skeletonFilenameList.clear();
+	boneNames.clear();
+	x.clear();
+	y.clear();
+	z.clear();
+	nx.clear();
+	ny.clear();
+	nz.clear();
+	numVertexWeights.clear();
+	vertexWeights.clear();
+	bltList.clear();
+	psdtList.clear();
+
+	iffReader reader = index.reader(0);
+	readSKMG(reader);
+
+	return !reader.fail();
+}
+
+// SKMG form and its version form.
+template<typename S>
+static std::size_t readSKMGHeader(S& file, std::size_t& skmgSize)
+{
+	std::size_t total = base::readFormHeader(file, "SKMG", skmgSize);
 	skmgSize += 8;
-	std::cout << "Found SKMG form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found SKMG form" << std::endl;
 
 	std::size_t size;
 	std::string form, type;
-	total += readFormHeader(file, form, size, type);
+	total += base::readFormHeader(file, form, size, type);
 	if (form != "FORM")
 	{
-		std::cout << "Expected Form" << std::endl;
-		exit(0);
+		base::fail(file, form, "Expected Form");
+	}
+	SWG_LOG(LOG_INFO) << "Found form of type: " << type << std::endl;
+
+	return total;
+}
+
+static void checkSKMGSize(const std::size_t& total, const std::size_t& skmgSize)
+{
+	if (skmgSize == total)
+	{
+		SWG_LOG(LOG_INFO) << "Finished reading SKMG" << std::endl;
+	}
+	else
+	{
+		SWG_LOG(LOG_ERROR) << "FAILED in reading SKMG" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << skmgSize
+			<< std::endl;
+	}
+}
+
+unsigned int skmg::readSKMG(std::istream& file)
+{
+	// Headers come from the stream and each child is loaded on its own, so
+	// only one PSDT (or other child) is held in memory at a time.
+	std::size_t skmgSize;
+	std::size_t total = readSKMGHeader(file, skmgSize);
+
+	iffReader reader;
+	if (!reader.load(file))
+	{
+		base::fail(file, "INFO", "Truncated record");
+	}
+	total += readINFO(reader);
+
+	if (!reader.load(file))
+	{
+		base::fail(file, "SKTM", "Truncated record");
+	}
+	total += readSKTM(reader);
+
+	while (total < skmgSize)
+	{
+		if (!reader.load(file))
+		{
+			base::fail(file, "SKMG", "Truncated form");
+		}
+		total += readSKMGChild(reader);
 	}
-	std::cout << "Found form of type: " << type << std::endl;
+
+	checkSKMGSize(total, skmgSize);
+
+	return total;
+}
+
+unsigned int skmg::readSKMG(iffReader& file)
+{
+	std::size_t skmgSize;
+	std::size_t total = readSKMGHeader(file, skmgSize);
 
 	total += readINFO(file);
 	total += readSKTM(file);
 
 	while (total < skmgSize)
 	{
-		// Peek at next record, but keep file at same place.
-		peekHeader(file, form, size, type);
+		total += readSKMGChild(file);
+	}
 
-		if (form == "FORM")
-		{
-			if (type == "PSDT")
-			{
-				psdt newPsdt(this);
-				psdtList.push_back(newPsdt);
-				total += readPSDT(file, psdtList.back());
-			}
-			else if (type == "BLTS")
-			{
-				total += readBLTS(file);
-			}
-			else if (type == "HPTS")
-			{
-				total += readHPTS(file);
-			}
-			else if (type == "TRTS")
-			{
-				total += readTRTS(file);
-			}
-			else
-			{
-				std::cout << "Unexpected form: " << type << std::endl;
-				exit(0);
-			}
-		}
-		else if (form == "XFNM")
-		{
-			total += readXFNM(file);
-		}
-		else if (form == "POSN")
-		{
-			total += readPOSN(file);
-		}
-		else if (form == "TWHD")
-		{
-			total += readTWHD(file);
-		}
-		else if (form == "TWDT")
-		{
-			total += readTWDT(file);
-		}
-		else if (form == "NORM")
-		{
-			total += readNORM(file);
-		}
-		else if (form == "DOT3")
-		{
-			total += readDOT3(file);
-		}
-		else if (form == "OZN ")
+	checkSKMGSize(total, skmgSize);
+
+	return total;
+}
+
+unsigned int skmg::readSKMGChild(iffReader& file)
+{
+	std::size_t size;
+	std::string form, type;
+	// Peek at next record, but keep file at same place.
+	peekHeader(file, form, size, type);
+
+	if (form == "FORM")
+	{
+		if (type == "PSDT")
 		{
-			total += readOZN(file);
+			psdt newPsdt(this);
+			psdtList.push_back(newPsdt);
+			return readPSDT(file, psdtList.back());
 		}
-		else if (form == "FOZC")
+		else if (type == "BLTS")
 		{
-			total += readFOZC(file);
+			return readBLTS(file);
 		}
-		else if (form == "OZC ")
+		else if (type == "HPTS")
 		{
-			total += readOZC(file);
+			return readHPTS(file);
 		}
-		else if (form == "ZTO ")
+		else if (type == "TRTS")
 		{
-			total += readZTO(file);
+			return readTRTS(file);
 		}
 		else
 		{
-			std::cout << "Unexpected record: " << form << std::endl;
-			exit(0);
+			std::ostringstream msg;
+			msg << "Unexpected form: " << type;
+			base::fail(file, type, msg.str());
 		}
 	}
-
-	if (skmgSize == total)
+	else if (form == "XFNM")
+	{
+		return readXFNM(file);
+	}
+	else if (form == "POSN")
+	{
+		return readPOSN(file);
+	}
+	else if (form == "TWHD")
+	{
+		return readTWHD(file);
+	}
+	else if (form == "TWDT")
+	{
+		return readTWDT(file);
+	}
+	else if (form == "NORM")
+	{
+		return readNORM(file);
+	}
+	else if (form == "DOT3")
+	{
+		return readDOT3(file);
+	}
+	else if (form == "OZN ")
 	{
-		std::cout << "Finished reading SKMG" << std::endl;
+		return readOZN(file);
+	}
+	else if (form == "FOZC")
+	{
+		return readFOZC(file);
+	}
+	else if (form == "OZC ")
+	{
+		return readOZC(file);
+	}
+	else if (form == "ZTO ")
+	{
+		return readZTO(file);
 	}
 	else
 	{
-		std::cout << "FAILED in reading SKMG" << std::endl;
-		std::cout << "Read " << total << " out of " << skmgSize
-			<< std::endl;
+		std::ostringstream msg;
+		msg << "Unexpected record: " << form;
+		base::fail(file, form, msg.str());
 	}
 
-	return total;
+	return 0;
 }
 
-unsigned int skmg::readPSDT(std::istream& file, psdt& newPsdt)
+unsigned int skmg::readPSDT(iffReader& file, psdt& newPsdt)
 {
 	std::size_t psdtSize;
 	std::string type;
 
 	std::size_t total = readFormHeader(file, "PSDT", psdtSize);
 	psdtSize += 8;
-	std::cout << "Found PSDT form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found PSDT form" << std::endl;
 
 	std::size_t size;
 	std::string form;
@@ -183,8 +345,9 @@ unsigned int skmg::readPSDT(std::istream& file, psdt& newPsdt)
 			}
 			else
 			{
-				std::cout << "Unexpected form: " << type << std::endl;
-				exit(0);
+				std::ostringstream msg;
+				msg << "Unexpected form: " << type;
+				base::fail(file, type, msg.str());
 			}
 		}
 		else if (form == "NAME")
@@ -213,56 +376,57 @@ unsigned int skmg::readPSDT(std::istream& file, psdt& newPsdt)
 		}
 		else
 		{
-			std::cout << "Unexpected record: " << form << std::endl;
-			exit(0);
+			std::ostringstream msg;
+			msg << "Unexpected record: " << form;
+			base::fail(file, form, msg.str());
 		}
 	}
 
 	if (psdtSize == total)
 	{
-		std::cout << "Finished reading PSDT" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading PSDT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading PSDT" << std::endl;
-		std::cout << "Read " << total << " out of " << psdtSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading PSDT" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << psdtSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readTRTS(std::istream& file)
+unsigned int skmg::readTRTS(iffReader& file)
 {
 	std::size_t trtsSize;
 	std::size_t total = readFormHeader(file, "TRTS", trtsSize);
 	trtsSize += 8;
-	std::cout << "Found TRTS form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found TRTS form" << std::endl;
 
 	total += readUnknown(file, trtsSize - total);
 
 	if (trtsSize == total)
 	{
-		std::cout << "Finished reading TRTS" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading TRTS" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading TRTS" << std::endl;
-		std::cout << "Read " << total << " out of " << trtsSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading TRTS" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << trtsSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readBLTS(std::istream& file)
+unsigned int skmg::readBLTS(iffReader& file)
 {
 	std::size_t bltsSize;
 	std::size_t total = readFormHeader(file, "BLTS", bltsSize);
 	bltsSize += 8;
-	std::cout << "Found BLTS form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found BLTS form" << std::endl;
 
-	std::cout << "Num BLT: " << numBLT << std::endl;
+	SWG_LOG(LOG_INFO) << "Num BLT: " << numBLT << std::endl;
 	for (unsigned int i = 0; i < numBLT; ++i)
 	{
 		blt newBlt;
@@ -272,24 +436,24 @@ unsigned int skmg::readBLTS(std::istream& file)
 
 	if (bltsSize == total)
 	{
-		std::cout << "Finished reading BLTS" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading BLTS" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading BLTS" << std::endl;
-		std::cout << "Read " << total << " out of " << bltsSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading BLTS" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << bltsSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readBLT(std::istream& file, blt& newBlt)
+unsigned int skmg::readBLT(iffReader& file, blt& newBlt)
 {
 	std::size_t bltSize;
 	std::size_t total = readFormHeader(file, "BLT ", bltSize);
 	bltSize += 8;
-	std::cout << "Found BLT form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found BLT form" << std::endl;
 
 	total += readBLTINFO(file, newBlt);
 
@@ -307,19 +471,19 @@ unsigned int skmg::readBLT(std::istream& file, blt& newBlt)
 
 	if (bltSize == total)
 	{
-		std::cout << "Finished reading BLT" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading BLT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading BLT" << std::endl;
-		std::cout << "Read " << total << " out of " << bltSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading BLT" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << bltSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readOZN(std::istream& file)
+unsigned int skmg::readOZN(iffReader& file)
 {
 	std::string type;
 	std::size_t oznSize;
@@ -327,33 +491,34 @@ unsigned int skmg::readOZN(std::istream& file)
 	oznSize += 8;
 	if (type != "OZN ")
 	{
-		std::cout << "Expected record of type OZN: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type OZN: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	std::string name;
 	while (total < oznSize)
 	{
 		total += base::read(file, name);
-		std::cout << name << std::endl;
+		SWG_LOG(LOG_DEBUG) << name << std::endl;
 	}
 
 	if (oznSize == total)
 	{
-		std::cout << "Finished reading OZN" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading OZN" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading OZN" << std::endl;
-		std::cout << "Read " << total << " out of " << oznSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading OZN" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << oznSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readFOZC(std::istream& file)
+unsigned int skmg::readFOZC(iffReader& file)
 {
 	std::string type;
 	std::size_t fozcSize;
@@ -361,37 +526,38 @@ unsigned int skmg::readFOZC(std::istream& file)
 	fozcSize += 8;
 	if (type != "FOZC")
 	{
-		std::cout << "Expected record of type FOZC: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type FOZC: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	unsigned short num;
 	total += base::read(file, num);
-	std::cout << "Num: " << num << std::endl;
+	SWG_LOG(LOG_INFO) << "Num: " << num << std::endl;
 
 	unsigned short u1;
 	for (unsigned int i = 0; i < num; ++i)
 	{
 		total += base::read(file, u1);
-		std::cout << u1 << std::endl;
+		SWG_LOG(LOG_DEBUG) << u1 << std::endl;
 	}
 
 	if (fozcSize == total)
 	{
-		std::cout << "Finished reading FOZC" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading FOZC" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading FOZC" << std::endl;
-		std::cout << "Read " << total << " out of " << fozcSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading FOZC" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << fozcSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readOZC(std::istream& file)
+unsigned int skmg::readOZC(iffReader& file)
 {
 	std::string type;
 	std::size_t ozcSize;
@@ -399,36 +565,37 @@ unsigned int skmg::readOZC(std::istream& file)
 	ozcSize += 8;
 	if (type != "OZC ")
 	{
-		std::cout << "Expected record of type OZC: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type OZC: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	unsigned short u1;
 	while (total < ozcSize)
 	{
 		total += base::read(file, u1);
-		std::cout << u1 << " ";
+		SWG_LOG(LOG_DEBUG) << u1 << " ";
 
 		total += base::read(file, u1);
-		std::cout << u1 << std::endl;
+		SWG_LOG(LOG_DEBUG) << u1 << std::endl;
 	}
 
 	if (ozcSize == total)
 	{
-		std::cout << "Finished reading OZC" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading OZC" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading OZC" << std::endl;
-		std::cout << "Read " << total << " out of " << ozcSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading OZC" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << ozcSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readZTO(std::istream& file)
+unsigned int skmg::readZTO(iffReader& file)
 {
 	std::string type;
 	std::size_t ztoSize;
@@ -436,33 +603,34 @@ unsigned int skmg::readZTO(std::istream& file)
 	ztoSize += 8;
 	if (type != "ZTO ")
 	{
-		std::cout << "Expected record of type ZTO: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type ZTO: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	unsigned short u1;
 	while (total < ztoSize)
 	{
 		total += base::read(file, u1);
-		std::cout << u1 << std::endl;
+		SWG_LOG(LOG_DEBUG) << u1 << std::endl;
 	}
 
 	if (ztoSize == total)
 	{
-		std::cout << "Finished reading ZTO" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading ZTO" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading ZTO" << std::endl;
-		std::cout << "Read " << total << " out of " << ztoSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading ZTO" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << ztoSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readSKTM(std::istream& file)
+unsigned int skmg::readSKTM(iffReader& file)
 {
 	std::string type;
 	std::size_t sktmSize;
@@ -470,17 +638,18 @@ unsigned int skmg::readSKTM(std::istream& file)
 	sktmSize += 8;
 	if (type != "SKTM")
 	{
-		std::cout << "Expected record of type SKTM: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type SKTM: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	for (unsigned int i = 0; i < numSkeletons; ++i)
 		//while( total < sktmSize )
 	{
 		std::string skeletonFilename;
 		total += base::read(file, skeletonFilename);
-		std::cout << skeletonFilename << std::endl;
+		SWG_LOG(LOG_DEBUG) << skeletonFilename << std::endl;
 
 		skeletonFilenameList.push_back(skeletonFilename);
 	}
@@ -489,19 +658,19 @@ unsigned int skmg::readSKTM(std::istream& file)
 
 	if (sktmSize == total)
 	{
-		std::cout << "Finished reading SKTM" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading SKTM" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading SKTM" << std::endl;
-		std::cout << "Read " << total << " out of " << sktmSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading SKTM" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << sktmSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readTXCI(std::istream& file, psdt&/*newPsdt*/)
+unsigned int skmg::readTXCI(iffReader& file, psdt&/*newPsdt*/)
 {
 	std::string type;
 	std::size_t txciSize;
@@ -509,61 +678,62 @@ unsigned int skmg::readTXCI(std::istream& file, psdt&/*newPsdt*/)
 	txciSize += 8;
 	if (type != "TXCI")
 	{
-		std::cout << "Expected record of type TXCI: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type TXCI: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	unsigned int u1;
 	total += base::read(file, u1);
-	std::cout << u1 << std::endl;
+	SWG_LOG(LOG_INFO) << u1 << std::endl;
 
 	total += base::read(file, u1);
-	std::cout << u1 << std::endl;
+	SWG_LOG(LOG_INFO) << u1 << std::endl;
 
 	if (txciSize == total)
 	{
-		std::cout << "Finished reading TXCI" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading TXCI" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading TXCI" << std::endl;
-		std::cout << "Read " << total << " out of " << txciSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading TXCI" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << txciSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readTCSF(std::istream& file, psdt& newPsdt)
+unsigned int skmg::readTCSF(iffReader& file, psdt& newPsdt)
 {
 	std::size_t tcsfSize;
 	std::size_t total = readFormHeader(file, "TCSF", tcsfSize);
 	tcsfSize += 8;
-	std::cout << "Found TCSF form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found TCSF form" << std::endl;
 
 	total += readTCSD(file, newPsdt);
 
 	if (tcsfSize == total)
 	{
-		std::cout << "Finished reading TCSF" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading TCSF" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading TCSF" << std::endl;
-		std::cout << "Read " << total << " out of " << tcsfSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading TCSF" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << tcsfSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readPRIM(std::istream& file, psdt& newPsdt)
+unsigned int skmg::readPRIM(iffReader& file, psdt& newPsdt)
 {
 	std::size_t primSize;
 	std::size_t total = readFormHeader(file, "PRIM", primSize);
 	primSize += 8;
-	std::cout << "Found PRIM form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found PRIM form" << std::endl;
 
 	total += readPRIMINFO(file, newPsdt);
 
@@ -576,8 +746,9 @@ unsigned int skmg::readPRIM(std::istream& file, psdt& newPsdt)
 
 		if (form == "FORM")
 		{
-			std::cout << "Unexpected form: " << type << std::endl;
-			exit(0);
+			std::ostringstream msg;
+			msg << "Unexpected form: " << type;
+			base::fail(file, type, msg.str());
 		}
 		else if (form == "ITL ")
 		{
@@ -589,26 +760,27 @@ unsigned int skmg::readPRIM(std::istream& file, psdt& newPsdt)
 		}
 		else
 		{
-			std::cout << "Unexpected record: " << form << std::endl;
-			exit(0);
+			std::ostringstream msg;
+			msg << "Unexpected record: " << form;
+			base::fail(file, form, msg.str());
 		}
 	}
 
 	if (primSize == total)
 	{
-		std::cout << "Finished reading PRIM" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading PRIM" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading PRIM" << std::endl;
-		std::cout << "Read " << total << " out of " << primSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading PRIM" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << primSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readTCSD(std::istream& file, psdt& newPsdt)
+unsigned int skmg::readTCSD(iffReader& file, psdt& newPsdt)
 {
 	std::string type;
 	std::size_t tcsdSize;
@@ -616,12 +788,13 @@ unsigned int skmg::readTCSD(std::istream& file, psdt& newPsdt)
 	tcsdSize += 8;
 	if (type != "TCSD")
 	{
-		std::cout << "Expected record of type TCSD: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type TCSD: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
-	std::cout << "Num TCSD: " << numIndex << std::endl;
+	SWG_LOG(LOG_INFO) << "Num TCSD: " << numIndex << std::endl;
 	// Texture coords?
 	float tempU, tempV;
 	for (unsigned int i = 0; i < numIndex; ++i)
@@ -632,17 +805,17 @@ unsigned int skmg::readTCSD(std::istream& file, psdt& newPsdt)
 		newPsdt.u.push_back(tempU);
 		newPsdt.v.push_back(tempV);
 
-		std::cout << "UV: " << tempU << ", " << tempV << std::endl;;
+		SWG_LOG(LOG_DEBUG) << "UV: " << tempU << ", " << tempV << std::endl;;
 	}
 
 	if (tcsdSize == total)
 	{
-		std::cout << "Finished reading TCSD" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading TCSD" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading TCSD" << std::endl;
-		std::cout << "Read " << total << " out of " << tcsdSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading TCSD" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << tcsdSize
 			<< std::endl;
 	}
 
@@ -650,7 +823,7 @@ unsigned int skmg::readTCSD(std::istream& file, psdt& newPsdt)
 }
 
 // Index into Position/Normal/Texture index arrays.
-unsigned int skmg::readITL(std::istream& file, psdt& newPsdt)
+unsigned int skmg::readITL(iffReader& file, psdt& newPsdt)
 {
 	std::string type;
 	std::size_t itlSize;
@@ -658,14 +831,15 @@ unsigned int skmg::readITL(std::istream& file, psdt& newPsdt)
 	itlSize += 8;
 	if (type != "ITL ")
 	{
-		std::cout << "Expected record of type ITL: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type ITL: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	unsigned int numITL;
 	total += base::read(file, numITL);
-	std::cout << "Num ITL: " << numITL << std::endl;;
+	SWG_LOG(LOG_INFO) << "Num ITL: " << numITL << std::endl;;
 
 	unsigned int i1, i2, i3;
 	for (unsigned int i = 0; i < numITL; ++i)
@@ -678,17 +852,17 @@ unsigned int skmg::readITL(std::istream& file, psdt& newPsdt)
 		newPsdt.itl.push_back(i2);
 		newPsdt.itl.push_back(i3);
 
-		std::cout << i1 << ", " << i2 << ", " << i3 << std::endl;
+		SWG_LOG(LOG_DEBUG) << i1 << ", " << i2 << ", " << i3 << std::endl;
 	}
 
 	if (itlSize == total)
 	{
-		std::cout << "Finished reading ITL" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading ITL" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading ITL" << std::endl;
-		std::cout << "Read " << total << " out of " << itlSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading ITL" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << itlSize
 			<< std::endl;
 	}
 
@@ -696,7 +870,7 @@ unsigned int skmg::readITL(std::istream& file, psdt& newPsdt)
 }
 
 // Index into Position/Normal/Texture index arrays.
-unsigned int skmg::readOITL(std::istream& file, psdt& newPsdt)
+unsigned int skmg::readOITL(iffReader& file, psdt& newPsdt)
 {
 	std::string type;
 	std::size_t oitlSize;
@@ -704,14 +878,15 @@ unsigned int skmg::readOITL(std::istream& file, psdt& newPsdt)
 	oitlSize += 8;
 	if (type != "OITL")
 	{
-		std::cout << "Expected record of type OITL: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type OITL: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	unsigned int numOITL;
 	total += base::read(file, numOITL);
-	std::cout << "Num OITL: " << numOITL << std::endl;;
+	SWG_LOG(LOG_INFO) << "Num OITL: " << numOITL << std::endl;;
 
 	short group;
 	unsigned int i1, i2, i3;
@@ -726,7 +901,7 @@ unsigned int skmg::readOITL(std::istream& file, psdt& newPsdt)
 		newPsdt.oitl[group].push_back(i2);
 		newPsdt.oitl[group].push_back(i3);
 
-		std::cout << "Group " << group << ": "
+		SWG_LOG(LOG_DEBUG) << "Group " << group << ": "
 			<< i1 << ", "
 			<< i2 << ", "
 			<< i3 << std::endl;
@@ -734,19 +909,19 @@ unsigned int skmg::readOITL(std::istream& file, psdt& newPsdt)
 
 	if (oitlSize == total)
 	{
-		std::cout << "Finished reading OITL" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading OITL" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading OITL" << std::endl;
-		std::cout << "Read " << total << " out of " << oitlSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading OITL" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << oitlSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readINFO(std::istream& file)
+unsigned int skmg::readINFO(iffReader& file)
 {
 	std::string type;
 	std::size_t infoSize;
@@ -754,10 +929,11 @@ unsigned int skmg::readINFO(std::istream& file)
 	infoSize += 8;
 	if (type != "INFO")
 	{
-		std::cout << "Expected record of type INFO: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type INFO: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	unsigned int u1;
 	unsigned int u2;
@@ -767,60 +943,60 @@ unsigned int skmg::readINFO(std::istream& file)
 	short u13;
 
 	total += base::read(file, u1);
-	std::cout << u1 << std::endl;
+	SWG_LOG(LOG_INFO) << u1 << std::endl;
 
 	total += base::read(file, u2);
-	std::cout << u2 << std::endl;
+	SWG_LOG(LOG_INFO) << u2 << std::endl;
 
 	total += base::read(file, numSkeletons);
-	std::cout << "Num skeletons: " << numSkeletons << std::endl;
+	SWG_LOG(LOG_INFO) << "Num skeletons: " << numSkeletons << std::endl;
 
 	total += base::read(file, numBones);
-	std::cout << "Num bones: " << numBones << std::endl;
+	SWG_LOG(LOG_INFO) << "Num bones: " << numBones << std::endl;
 
 	total += base::read(file, numPoints);
-	std::cout << "Num points: " << numPoints << std::endl;
+	SWG_LOG(LOG_INFO) << "Num points: " << numPoints << std::endl;
 
 	total += base::read(file, numTwdt);
-	std::cout << "Num twdt: " << numTwdt << std::endl;
+	SWG_LOG(LOG_INFO) << "Num twdt: " << numTwdt << std::endl;
 
 	total += base::read(file, numNorm);
-	std::cout << "Num normals: " << numNorm << std::endl;
+	SWG_LOG(LOG_INFO) << "Num normals: " << numNorm << std::endl;
 
 	total += base::read(file, numPSDT);
-	std::cout << "Num PSDT: " << numPSDT << std::endl;
+	SWG_LOG(LOG_INFO) << "Num PSDT: " << numPSDT << std::endl;
 
 	total += base::read(file, numBLT);
-	std::cout << "Num blend tables: " << numBLT << std::endl;
+	SWG_LOG(LOG_INFO) << "Num blend tables: " << numBLT << std::endl;
 
 	total += base::read(file, u10);
-	std::cout << u10 << std::endl;
+	SWG_LOG(LOG_INFO) << u10 << std::endl;
 
 	total += base::read(file, u11);
-	std::cout << u11 << std::endl;
+	SWG_LOG(LOG_INFO) << u11 << std::endl;
 
 	// Something to do with OITL
 	total += base::read(file, u12);
-	std::cout << u12 << std::endl;
+	SWG_LOG(LOG_INFO) << u12 << std::endl;
 
 	total += base::read(file, u13);
-	std::cout << u13 << std::endl;
+	SWG_LOG(LOG_INFO) << u13 << std::endl;
 
 	if (infoSize == total)
 	{
-		std::cout << "Finished reading INFO" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading INFO" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading INFO" << std::endl;
-		std::cout << "Read " << total << " out of " << infoSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading INFO" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << infoSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readPRIMINFO(std::istream& file, psdt&/*newPsdt*/)
+unsigned int skmg::readPRIMINFO(iffReader& file, psdt&/*newPsdt*/)
 {
 	std::string type;
 	std::size_t priminfoSize;
@@ -828,30 +1004,31 @@ unsigned int skmg::readPRIMINFO(std::istream& file, psdt&/*newPsdt*/)
 	priminfoSize += 8;
 	if (type != "INFO")
 	{
-		std::cout << "Expected record of type PRIMINFO: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type PRIMINFO: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	unsigned int u1;
 	total += base::read(file, u1);
-	std::cout << u1 << std::endl;
+	SWG_LOG(LOG_INFO) << u1 << std::endl;
 
 	if (priminfoSize == total)
 	{
-		std::cout << "Finished reading PRIMINFO" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading PRIMINFO" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading PRIMINFO" << std::endl;
-		std::cout << "Read " << total << " out of " << priminfoSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading PRIMINFO" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << priminfoSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readBLTINFO(std::istream& file, blt& newBlt)
+unsigned int skmg::readBLTINFO(iffReader& file, blt& newBlt)
 {
 	std::string type;
 	std::size_t bltinfoSize;
@@ -859,35 +1036,36 @@ unsigned int skmg::readBLTINFO(std::istream& file, blt& newBlt)
 	bltinfoSize += 8;
 	if (type != "INFO")
 	{
-		std::cout << "Expected record of type BLTINFO: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type BLTINFO: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	total += base::read(file, newBlt.numPos);
-	std::cout << "Num points: " << newBlt.numPos << std::endl;
+	SWG_LOG(LOG_INFO) << "Num points: " << newBlt.numPos << std::endl;
 
 	total += base::read(file, newBlt.numNorm);
-	std::cout << "Num normals: " << newBlt.numNorm << std::endl;
+	SWG_LOG(LOG_INFO) << "Num normals: " << newBlt.numNorm << std::endl;
 
 	total += base::read(file, newBlt.name);
-	std::cout << newBlt.name << std::endl;
+	SWG_LOG(LOG_INFO) << newBlt.name << std::endl;
 
 	if (bltinfoSize == total)
 	{
-		std::cout << "Finished reading BLTINFO" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading BLTINFO" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading BLTINFO" << std::endl;
-		std::cout << "Read " << total << " out of " << bltinfoSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading BLTINFO" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << bltinfoSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readPOSN(std::istream& file)
+unsigned int skmg::readPOSN(iffReader& file)
 {
 	std::string type;
 	std::size_t posnSize;
@@ -895,12 +1073,13 @@ unsigned int skmg::readPOSN(std::istream& file)
 	posnSize += 8;
 	if (type != "POSN")
 	{
-		std::cout << "Expected record of type POSN: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type POSN: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found POSN: " << posnSize << std::endl;
+	SWG_LOG(LOG_INFO) << "Found POSN: " << posnSize << std::endl;
 
-	std::cout << "Num points: " << numPoints << std::endl;
+	SWG_LOG(LOG_INFO) << "Num points: " << numPoints << std::endl;
 
 	float tempX, tempY, tempZ;
 	for (unsigned int i = 0; i < numPoints; ++i)
@@ -908,7 +1087,7 @@ unsigned int skmg::readPOSN(std::istream& file)
 		total += base::read(file, tempX);
 		total += base::read(file, tempY);
 		total += base::read(file, tempZ);
-		std::cout << "Vertex " << i << ": "
+		SWG_LOG(LOG_DEBUG) << "Vertex " << i << ": "
 			<< tempX << ",  " << tempY << ", " << tempZ << std::endl;
 		x.push_back(tempX);
 		y.push_back(tempY);
@@ -917,19 +1096,19 @@ unsigned int skmg::readPOSN(std::istream& file)
 
 	if (posnSize == total)
 	{
-		std::cout << "Finished reading POSN" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading POSN" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading POSN" << std::endl;
-		std::cout << "Read " << total << " out of " << posnSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading POSN" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << posnSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readNORM(std::istream& file)
+unsigned int skmg::readNORM(iffReader& file)
 {
 	std::string type;
 	std::size_t normSize;
@@ -937,12 +1116,13 @@ unsigned int skmg::readNORM(std::istream& file)
 	normSize += 8;
 	if (type != "NORM")
 	{
-		std::cout << "Expected record of type NORM: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type NORM: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
-	std::cout << "Num Norm:  " << numNorm << std::endl;
+	SWG_LOG(LOG_INFO) << "Num Norm:  " << numNorm << std::endl;
 	float tempX, tempY, tempZ;
 	for (unsigned int i = 0; i < numNorm; ++i)
 	{
@@ -958,19 +1138,19 @@ unsigned int skmg::readNORM(std::istream& file)
 
 	if (normSize == total)
 	{
-		std::cout << "Finished reading NORM" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading NORM" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading NORM" << std::endl;
-		std::cout << "Read " << total << " out of " << normSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading NORM" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << normSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readDOT3(std::istream& file)
+unsigned int skmg::readDOT3(iffReader& file)
 {
 	std::string type;
 	std::size_t dot3Size;
@@ -978,45 +1158,46 @@ unsigned int skmg::readDOT3(std::istream& file)
 	dot3Size += 8;
 	if (type != "DOT3")
 	{
-		std::cout << "Expected record of type DOT3: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type DOT3: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	total += base::read(file, numDot3);
 
-	std::cout << "Num DOT3: " << numDot3 << std::endl;
+	SWG_LOG(LOG_INFO) << "Num DOT3: " << numDot3 << std::endl;
 	float tempX;
 	for (unsigned int i = 0; i < numDot3; ++i)
 	{
 		total += base::read(file, tempX);
-		std::cout << tempX << " ";
+		SWG_LOG(LOG_DEBUG) << tempX << " ";
 
 		total += base::read(file, tempX);
-		std::cout << tempX << " ";
+		SWG_LOG(LOG_DEBUG) << tempX << " ";
 
 		total += base::read(file, tempX);
-		std::cout << tempX << " ";
+		SWG_LOG(LOG_DEBUG) << tempX << " ";
 
 		total += base::read(file, tempX);
-		std::cout << tempX << std::endl;;
+		SWG_LOG(LOG_DEBUG) << tempX << std::endl;;
 	}
 
 	if (dot3Size == total)
 	{
-		std::cout << "Finished reading DOT3" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading DOT3" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading DOT3" << std::endl;
-		std::cout << "Read " << total << " out of " << dot3Size
+		SWG_LOG(LOG_ERROR) << "FAILED in reading DOT3" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << dot3Size
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readDOT3Index(std::istream& file, psdt&/*newPsdt*/)
+unsigned int skmg::readDOT3Index(iffReader& file, psdt&/*newPsdt*/)
 {
 	std::string type;
 	std::size_t dot3Size;
@@ -1024,33 +1205,34 @@ unsigned int skmg::readDOT3Index(std::istream& file, psdt&/*newPsdt*/)
 	dot3Size += 8;
 	if (type != "DOT3")
 	{
-		std::cout << "Expected record of type DOT3: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type DOT3: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	unsigned int index;
 	while (total < dot3Size)
 	{
 		total += base::read(file, index);
-		std::cout << index << std::endl;
+		SWG_LOG(LOG_DEBUG) << index << std::endl;
 	}
 
 	if (dot3Size == total)
 	{
-		std::cout << "Finished reading DOT3" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading DOT3" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading DOT3" << std::endl;
-		std::cout << "Read " << total << " out of " << dot3Size
+		SWG_LOG(LOG_ERROR) << "FAILED in reading DOT3" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << dot3Size
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readBLTPOSN(std::istream& file, unsigned int num)
+unsigned int skmg::readBLTPOSN(iffReader& file, unsigned int num)
 {
 	std::string type;
 	std::size_t posnSize;
@@ -1058,11 +1240,12 @@ unsigned int skmg::readBLTPOSN(std::istream& file, unsigned int num)
 	posnSize += 8;
 	if (type != "POSN")
 	{
-		std::cout << "Expected record of type POSN: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type POSN: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found POSN: " << posnSize << std::endl;
-	std::cout << "Num points: " << num << std::endl;
+	SWG_LOG(LOG_INFO) << "Found POSN: " << posnSize << std::endl;
+	SWG_LOG(LOG_INFO) << "Num points: " << num << std::endl;
 
 	float tempX, tempY, tempZ, tempW;
 	for (unsigned int i = 0; i < num; ++i)
@@ -1071,24 +1254,24 @@ unsigned int skmg::readBLTPOSN(std::istream& file, unsigned int num)
 		total += base::read(file, tempY);
 		total += base::read(file, tempZ);
 		total += base::read(file, tempW);
-		std::cout << tempX << ",  " << tempY << ", " << tempZ << ", " << tempW << std::endl;
+		SWG_LOG(LOG_DEBUG) << tempX << ",  " << tempY << ", " << tempZ << ", " << tempW << std::endl;
 	}
 
 	if (posnSize == total)
 	{
-		std::cout << "Finished reading POSN" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading POSN" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading POSN" << std::endl;
-		std::cout << "Read " << total << " out of " << posnSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading POSN" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << posnSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readBLTNORM(std::istream& file, unsigned int num)
+unsigned int skmg::readBLTNORM(iffReader& file, unsigned int num)
 {
 	std::string type;
 	std::size_t normSize;
@@ -1096,12 +1279,13 @@ unsigned int skmg::readBLTNORM(std::istream& file, unsigned int num)
 	normSize += 8;
 	if (type != "NORM")
 	{
-		std::cout << "Expected record of type NORM: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type NORM: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
-	std::cout << "Num Norm:  " << num << std::endl;
+	SWG_LOG(LOG_INFO) << "Num Norm:  " << num << std::endl;
 	float tempX, tempY, tempZ, tempW;
 	for (unsigned int i = 0; i < num; ++i)
 	{
@@ -1109,7 +1293,7 @@ unsigned int skmg::readBLTNORM(std::istream& file, unsigned int num)
 		total += base::read(file, tempY);
 		total += base::read(file, tempZ);
 		total += base::read(file, tempW);
-		std::cout << tempX << ", " << tempY << ", " << tempZ << ", " << tempW << std::endl;
+		SWG_LOG(LOG_DEBUG) << tempX << ", " << tempY << ", " << tempZ << ", " << tempW << std::endl;
 
 		nx.push_back(tempX);
 		ny.push_back(tempY);
@@ -1118,12 +1302,12 @@ unsigned int skmg::readBLTNORM(std::istream& file, unsigned int num)
 
 	if (normSize == total)
 	{
-		std::cout << "Finished reading NORM" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading NORM" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading NORM" << std::endl;
-		std::cout << "Read " << total << " out of " << normSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading NORM" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << normSize
 			<< std::endl;
 	}
 
@@ -1132,7 +1316,7 @@ unsigned int skmg::readBLTNORM(std::istream& file, unsigned int num)
 
 // One entry for each point.  Each record is number of bones to which
 // the point belongs.
-unsigned int skmg::readTWHD(std::istream& file)
+unsigned int skmg::readTWHD(iffReader& file)
 {
 	std::string type;
 	std::size_t twhdSize;
@@ -1140,30 +1324,31 @@ unsigned int skmg::readTWHD(std::istream& file)
 	twhdSize += 8;
 	if (type != "TWHD")
 	{
-		std::cout << "Expected record of type TWHD: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type TWHD: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
-	std::cout << "Num points: " << numPoints << std::endl;
+	SWG_LOG(LOG_INFO) << "Num points: " << numPoints << std::endl;
 	numVertexWeights.resize(numPoints);
 	unsigned int vertexWeight;
 	for (unsigned int i = 0; i < numPoints; ++i)
 	{
 		total += base::read(file, vertexWeight);
-		std::cout << "Num weights for vertex "
+		SWG_LOG(LOG_DEBUG) << "Num weights for vertex "
 			<< i << ": " << vertexWeight << std::endl;
 		numVertexWeights[i] = vertexWeight;
 	}
 
 	if (twhdSize == total)
 	{
-		std::cout << "Finished reading TWHD" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading TWHD" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading TWHD" << std::endl;
-		std::cout << "Read " << total << " out of " << twhdSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading TWHD" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << twhdSize
 			<< std::endl;
 	}
 
@@ -1171,7 +1356,7 @@ unsigned int skmg::readTWHD(std::istream& file)
 }
 
 // Each entry is a bone and weight factor
-unsigned int skmg::readTWDT(std::istream& file)
+unsigned int skmg::readTWDT(iffReader& file)
 {
 	std::string type;
 	std::size_t twdtSize;
@@ -1179,39 +1364,40 @@ unsigned int skmg::readTWDT(std::istream& file)
 	twdtSize += 8;
 	if (type != "TWDT")
 	{
-		std::cout << "Expected record of type TWDT: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type TWDT: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
-	std::cout << "Num TWDT:  " << numTwdt << std::endl;
+	SWG_LOG(LOG_INFO) << "Num TWDT:  " << numTwdt << std::endl;
 	vertexWeights.resize(numPoints);
 	unsigned int boneNum;
 	float weight;
 	for (unsigned int i = 0; i < numPoints; ++i)
 	{
-		std::cout << "Vertex " << i << ": ";
+		SWG_LOG(LOG_DEBUG) << "Vertex " << i << ": ";
 		for (unsigned int j = 0; j < numVertexWeights[i]; ++j)
 		{
 			total += base::read(file, boneNum);
-			std::cout << "(" << boneNames[boneNum] << ": ";
+			SWG_LOG(LOG_DEBUG) << "(" << boneNames[boneNum] << ": ";
 
 			total += base::read(file, weight);
-			std::cout << std::fixed << weight << ") ";
+			SWG_LOG(LOG_DEBUG) << std::fixed << weight << ") ";
 
 			(vertexWeights[i])[boneNum] = weight;
 		}
-		std::cout << std::endl;
+		SWG_LOG(LOG_DEBUG) << std::endl;
 	}
 
 	if (twdtSize == total)
 	{
-		std::cout << "Finished reading TWDT" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading TWDT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading TWDT" << std::endl;
-		std::cout << "Read " << total << " out of " << twdtSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading TWDT" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << twdtSize
 			<< std::endl;
 	}
 
@@ -1219,7 +1405,7 @@ unsigned int skmg::readTWDT(std::istream& file)
 }
 
 // Index into points list
-unsigned int skmg::readPIDX(std::istream& file, psdt& newPsdt)
+unsigned int skmg::readPIDX(iffReader& file, psdt& newPsdt)
 {
 	std::string type;
 	std::size_t pidxSize;
@@ -1227,30 +1413,31 @@ unsigned int skmg::readPIDX(std::istream& file, psdt& newPsdt)
 	pidxSize += 8;
 	if (type != "PIDX")
 	{
-		std::cout << "Expected record of type PIDX: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type PIDX: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	total += base::read(file, numIndex);
-	std::cout << "Num index: " << numIndex << std::endl;
+	SWG_LOG(LOG_INFO) << "Num index: " << numIndex << std::endl;
 
 	unsigned int index;
 	for (unsigned int i = 0; i < numIndex; ++i)
 	{
 		total += base::read(file, index);
 		newPsdt.pidx.push_back(index);
-		std::cout << "Vertex index " << i << ": " << index << std::endl;
+		SWG_LOG(LOG_DEBUG) << "Vertex index " << i << ": " << index << std::endl;
 	}
 
 	if (pidxSize == total)
 	{
-		std::cout << "Finished reading PIDX" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading PIDX" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading PIDX" << std::endl;
-		std::cout << "Read " << total << " out of " << pidxSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading PIDX" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << pidxSize
 			<< std::endl;
 	}
 
@@ -1258,7 +1445,7 @@ unsigned int skmg::readPIDX(std::istream& file, psdt& newPsdt)
 }
 
 // Index into Normal array
-unsigned int skmg::readNIDX(std::istream& file, psdt& newPsdt)
+unsigned int skmg::readNIDX(iffReader& file, psdt& newPsdt)
 {
 	std::string type;
 	std::size_t nidxSize;
@@ -1266,35 +1453,36 @@ unsigned int skmg::readNIDX(std::istream& file, psdt& newPsdt)
 	nidxSize += 8;
 	if (type != "NIDX")
 	{
-		std::cout << "Expected record of type NIDX: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type NIDX: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
-	std::cout << "Num index: " << numIndex << std::endl;
+	SWG_LOG(LOG_INFO) << "Num index: " << numIndex << std::endl;
 	unsigned int index;
 	for (unsigned int i = 0; i < numIndex; ++i)
 	{
 		total += base::read(file, index);
 		newPsdt.nidx.push_back(index);
-		std::cout << "Normal index " << i << ": " << index << std::endl;
+		SWG_LOG(LOG_DEBUG) << "Normal index " << i << ": " << index << std::endl;
 	}
 
 	if (nidxSize == total)
 	{
-		std::cout << "Finished reading NIDX" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading NIDX" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading NIDX" << std::endl;
-		std::cout << "Read " << total << " out of " << nidxSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading NIDX" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << nidxSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readVDCL(std::istream& file, psdt&/*newPsdt*/)
+unsigned int skmg::readVDCL(iffReader& file, psdt&/*newPsdt*/)
 {
 	std::string type;
 	std::size_t vdclSize;
@@ -1302,34 +1490,35 @@ unsigned int skmg::readVDCL(std::istream& file, psdt&/*newPsdt*/)
 	vdclSize += 8;
 	if (type != "VDCL")
 	{
-		std::cout << "Expected record of type VDCL: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type VDCL: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << ": " << vdclSize - 8 << " bytes"
+	SWG_LOG(LOG_INFO) << "Found " << type << ": " << vdclSize - 8 << " bytes"
 		<< std::endl;
 
 	int index;
 	for (unsigned int i = 0; i < numIndex; ++i)
 	{
 		total += base::read(file, index);
-		std::cout << "?: " << index << std::endl;
+		SWG_LOG(LOG_DEBUG) << "?: " << index << std::endl;
 	}
 
 	if (vdclSize == total)
 	{
-		std::cout << "Finished reading VDCL" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading VDCL" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading VDCL" << std::endl;
-		std::cout << "Read " << total << " out of " << vdclSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading VDCL" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << vdclSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readNAME(std::istream& file, psdt& newPsdt)
+unsigned int skmg::readNAME(iffReader& file, psdt& newPsdt)
 {
 	std::string type;
 	std::size_t nameSize;
@@ -1337,29 +1526,30 @@ unsigned int skmg::readNAME(std::istream& file, psdt& newPsdt)
 	nameSize += 8;
 	if (type != "NAME")
 	{
-		std::cout << "Expected record of type NAME: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type NAME: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	total += base::read(file, newPsdt.shaderFilename);
-	std::cout << newPsdt.shaderFilename << std::endl;
+	SWG_LOG(LOG_INFO) << newPsdt.shaderFilename << std::endl;
 
 	if (nameSize == total)
 	{
-		std::cout << "Finished reading NAME" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading NAME" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading NAME" << std::endl;
-		std::cout << "Read " << total << " out of " << nameSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading NAME" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << nameSize
 			<< std::endl;
 	}
 
 	return total;
 }
 
-unsigned int skmg::readXFNM(std::istream& file)
+unsigned int skmg::readXFNM(iffReader& file)
 {
 	std::string type;
 	std::size_t xfnmSize;
@@ -1367,27 +1557,28 @@ unsigned int skmg::readXFNM(std::istream& file)
 	xfnmSize += 8;
 	if (type != "XFNM")
 	{
-		std::cout << "Expected record of type XFNM: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type XFNM: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	std::string boneName;
 	for (unsigned int i = 0; i < numBones; ++i)
 	{
 		total += base::read(file, boneName);
 		boneNames.push_back(boneName);
-		std::cout << "Bone " << i << ": " << boneName << std::endl;
+		SWG_LOG(LOG_DEBUG) << "Bone " << i << ": " << boneName << std::endl;
 	}
 
 	if (xfnmSize == total)
 	{
-		std::cout << "Finished reading XFNM" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading XFNM" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading XFNM" << std::endl;
-		std::cout << "Read " << total << " out of " << xfnmSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading XFNM" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << xfnmSize
 			<< std::endl;
 	}
 
@@ -1445,7 +1636,7 @@ const std::vector<unsigned int>& skmg::psdt::getOTriangles(short group) const
 	}
 }
 
-unsigned int skmg::readBLTHPTS(std::istream& file)
+unsigned int skmg::readBLTHPTS(iffReader& file)
 {
 	std::string type;
 	std::size_t hptsSize;
@@ -1453,21 +1644,22 @@ unsigned int skmg::readBLTHPTS(std::istream& file)
 	hptsSize += 8;
 	if (type != "HPTS")
 	{
-		std::cout << "Expected record of type HPTS: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type HPTS: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	total += readUnknown(file, hptsSize - total);
 
 	if (hptsSize == total)
 	{
-		std::cout << "Finished reading HPTS" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading HPTS" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading HPTS" << std::endl;
-		std::cout << "Read " << total << " out of " << hptsSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading HPTS" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << hptsSize
 			<< std::endl;
 	}
 
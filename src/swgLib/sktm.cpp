@@ -29,9 +29,12 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/sktm.hpp>
+#include <swgLib/logger.hpp>
 
+#include <iomanip>
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -48,17 +51,16 @@ unsigned int sktm::readSKTM(std::istream& file)
 	std::size_t sktmSize;
 	std::size_t total = readFormHeader(file, "SKTM", sktmSize);
 	sktmSize += 8;
-	std::cout << "Found SKTM form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found SKTM form" << std::endl;
 
 	std::size_t size;
 	std::string form, type;
 	total += readFormHeader(file, form, size, type);
 	if (form != "FORM")
 	{
-		std::cout << "Expected Form" << std::endl;
-		exit(0);
+		base::fail(file, form, "Expected Form");
 	}
-	std::cout << "Found form of type: " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found form of type: " << type << std::endl;
 
 	total += readINFO(file);
 	total += readNAME(file);
@@ -71,12 +73,12 @@ unsigned int sktm::readSKTM(std::istream& file)
 
 	if (sktmSize == total)
 	{
-		std::cout << "Finished reading SKTM" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading SKTM" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading SKTM" << std::endl;
-		std::cout << "Read " << total << " out of " << sktmSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading SKTM" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << sktmSize
 			<< std::endl;
 	}
 
@@ -91,22 +93,23 @@ unsigned int sktm::readINFO(std::istream& file)
 	infoSize += 8;
 	if (type != "INFO")
 	{
-		std::cout << "Expected record of type INFO: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type INFO: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	total += base::read(file, numBones);
-	std::cout << "Num bones: " << numBones << std::endl;
+	SWG_LOG(LOG_INFO) << "Num bones: " << numBones << std::endl;
 
 	if (infoSize == total)
 	{
-		std::cout << "Finished reading INFO" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading INFO" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading INFO" << std::endl;
-		std::cout << "Read " << total << " out of " << infoSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading INFO" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << infoSize
 			<< std::endl;
 	}
 
@@ -121,27 +124,28 @@ unsigned int sktm::readNAME(std::istream& file)
 	nameSize += 8;
 	if (type != "NAME")
 	{
-		std::cout << "Expected record of type NAME: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type NAME: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	std::string filename;
 	for (unsigned int i = 0; i < numBones; ++i)
 	{
 		total += base::read(file, filename);
-		std::cout << i << ": " << filename << std::endl;
+		SWG_LOG(LOG_DEBUG) << i << ": " << filename << std::endl;
 		boneName.push_back(filename);
 	}
 
 	if (nameSize == total)
 	{
-		std::cout << "Finished reading NAME" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading NAME" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading NAME" << std::endl;
-		std::cout << "Read " << total << " out of " << nameSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading NAME" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << nameSize
 			<< std::endl;
 	}
 
@@ -161,15 +165,15 @@ unsigned int sktm::readPRNT(std::istream& file)
 	prntSize += 8;
 	if (type != "PRNT")
 	{
-		std::cout << "Expected record of type PRNT: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type PRNT: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	if ((prntSize - 8) / numBones != 4)
 	{
-		std::cout << "Expected 4 byte values" << std::endl;
-		exit(0);
+		base::fail(file, "PRNT", "Expected 4 byte values");
 	}
 
 	int parent;
@@ -178,26 +182,26 @@ unsigned int sktm::readPRNT(std::istream& file)
 		total += base::read(file, parent);
 		boneParent.push_back(parent);
 
-		std::cout << "Bone " << boneName[i];
+		SWG_LOG(LOG_DEBUG) << "Bone " << boneName[i];
 		if (parent < 0)
 		{
-			std::cout << " has no parent.";
+			SWG_LOG(LOG_DEBUG) << " has no parent.";
 		}
 		else
 		{
-			std::cout << " has parent bone " << boneName[parent];
+			SWG_LOG(LOG_DEBUG) << " has parent bone " << boneName[parent];
 		}
-		std::cout << std::endl;
+		SWG_LOG(LOG_DEBUG) << std::endl;
 	}
 
 	if (prntSize == total)
 	{
-		std::cout << "Finished reading PRNT" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading PRNT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading PRNT" << std::endl;
-		std::cout << "Read " << total << " out of " << prntSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading PRNT" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << prntSize
 			<< std::endl;
 	}
 
@@ -213,18 +217,18 @@ unsigned int sktm::readRPRE(std::istream& file)
 	rpreSize += 8;
 	if (type != "RPRE")
 	{
-		std::cout << "Expected record of type RPRE: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type RPRE: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	if ((rpreSize - 8) / numBones != 16)
 	{
-		std::cout << "Expected 16 byte values" << std::endl;
-		exit(0);
+		base::fail(file, "RPRE", "Expected 16 byte values");
 	}
 
-	std::cout << std::fixed;
+	SWG_LOG(LOG_INFO) << std::fixed;
 	float x, y, z, w;
 	for (unsigned int i = 0; i < numBones; ++i)
 	{
@@ -238,9 +242,9 @@ unsigned int sktm::readRPRE(std::istream& file)
 		bonePreQuatZ.push_back(z);
 		bonePreQuatW.push_back(w);
 
-		std::cout << "Bone ";
-		std::cout.width(10);
-		std::cout << boneName[i] << ": "
+		SWG_LOG(LOG_DEBUG) << "Bone ";
+		SWG_LOG(LOG_DEBUG) << std::setw(10);
+		SWG_LOG(LOG_DEBUG) << boneName[i] << ": "
 			<< x << " "
 			<< y << " "
 			<< z << " "
@@ -249,12 +253,12 @@ unsigned int sktm::readRPRE(std::istream& file)
 
 	if (rpreSize == total)
 	{
-		std::cout << "Finished reading RPRE" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading RPRE" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading RPRE" << std::endl;
-		std::cout << "Read " << total << " out of " << rpreSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading RPRE" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << rpreSize
 			<< std::endl;
 	}
 
@@ -269,18 +273,18 @@ unsigned int sktm::readRPST(std::istream& file)
 	rpstSize += 8;
 	if (type != "RPST")
 	{
-		std::cout << "Expected record of type RPST: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type RPST: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	if ((rpstSize - 8) / numBones != 16)
 	{
-		std::cout << "Expected 16 byte values" << std::endl;
-		exit(0);
+		base::fail(file, "RPST", "Expected 16 byte values");
 	}
 
-	std::cout << std::fixed;
+	SWG_LOG(LOG_INFO) << std::fixed;
 	float x, y, z, w;
 	for (unsigned int i = 0; i < numBones; ++i)
 	{
@@ -294,9 +298,9 @@ unsigned int sktm::readRPST(std::istream& file)
 		bonePostQuatZ.push_back(z);
 		bonePostQuatW.push_back(w);
 
-		std::cout << "Bone ";
-		std::cout.width(10);
-		std::cout << boneName[i] << ": "
+		SWG_LOG(LOG_DEBUG) << "Bone ";
+		SWG_LOG(LOG_DEBUG) << std::setw(10);
+		SWG_LOG(LOG_DEBUG) << boneName[i] << ": "
 			<< x << " "
 			<< y << " "
 			<< z << " "
@@ -305,12 +309,12 @@ unsigned int sktm::readRPST(std::istream& file)
 
 	if (rpstSize == total)
 	{
-		std::cout << "Finished reading RPST" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading RPST" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading RPST" << std::endl;
-		std::cout << "Read " << total << " out of " << rpstSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading RPST" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << rpstSize
 			<< std::endl;
 	}
 
@@ -325,15 +329,15 @@ unsigned int sktm::readBPTR(std::istream& file)
 	bptrSize += 8;
 	if (type != "BPTR")
 	{
-		std::cout << "Expected record of type BPTR: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type BPTR: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	if ((bptrSize - 8) / numBones != 12)
 	{
-		std::cout << "Expected 12 byte values" << std::endl;
-		exit(0);
+		base::fail(file, "BPTR", "Expected 12 byte values");
 	}
 
 	float x, y, z;
@@ -346,9 +350,9 @@ unsigned int sktm::readBPTR(std::istream& file)
 		boneYOffset.push_back(y);
 		boneZOffset.push_back(z);
 
-		std::cout << "Bone ";
-		std::cout.width(10);
-		std::cout << boneName[i] << ": "
+		SWG_LOG(LOG_DEBUG) << "Bone ";
+		SWG_LOG(LOG_DEBUG) << std::setw(10);
+		SWG_LOG(LOG_DEBUG) << boneName[i] << ": "
 			<< x << " "
 			<< y << " "
 			<< z << std::endl;
@@ -356,12 +360,12 @@ unsigned int sktm::readBPTR(std::istream& file)
 
 	if (bptrSize == total)
 	{
-		std::cout << "Finished reading BPTR" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading BPTR" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading BPTR" << std::endl;
-		std::cout << "Read " << total << " out of " << bptrSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading BPTR" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << bptrSize
 			<< std::endl;
 	}
 
@@ -376,46 +380,46 @@ unsigned int sktm::readBPRO(std::istream& file)
 	bproSize += 8;
 	if (type != "BPRO")
 	{
-		std::cout << "Expected record of type BPRO: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type BPRO: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	if ((bproSize - 8) / numBones != 16)
 	{
-		std::cout << "Expected 16 byte values" << std::endl;
-		exit(0);
+		base::fail(file, "BPRO", "Expected 16 byte values");
 	}
 
 	float value;
 	for (unsigned int i = 0; i < numBones; ++i)
 	{
-		std::cout << "Bone ";
-		std::cout.width(10);
-		std::cout << boneName[i] << ": ";
+		SWG_LOG(LOG_DEBUG) << "Bone ";
+		SWG_LOG(LOG_DEBUG) << std::setw(10);
+		SWG_LOG(LOG_DEBUG) << boneName[i] << ": ";
 
 		total += base::read(file, value);
-		std::cout << value << " ";
+		SWG_LOG(LOG_DEBUG) << value << " ";
 
 		total += base::read(file, value);
-		std::cout << value << " ";
+		SWG_LOG(LOG_DEBUG) << value << " ";
 
 		total += base::read(file, value);
-		std::cout << value << " ";
+		SWG_LOG(LOG_DEBUG) << value << " ";
 
 		total += base::read(file, value);
-		std::cout << value << " ";
-		std::cout << std::endl;
+		SWG_LOG(LOG_DEBUG) << value << " ";
+		SWG_LOG(LOG_DEBUG) << std::endl;
 	}
 
 	if (bproSize == total)
 	{
-		std::cout << "Finished reading BPRO" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading BPRO" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading BPRO" << std::endl;
-		std::cout << "Read " << total << " out of " << bproSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading BPRO" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << bproSize
 			<< std::endl;
 	}
 
@@ -430,37 +434,37 @@ unsigned int sktm::readJROR(std::istream& file)
 	jrorSize += 8;
 	if (type != "JROR")
 	{
-		std::cout << "Expected record of type JROR: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type JROR: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	if ((jrorSize - 8) / numBones != 4)
 	{
-		std::cout << "Expected 4 byte values" << std::endl;
-		exit(0);
+		base::fail(file, "JROR", "Expected 4 byte values");
 	}
 
 	unsigned int value;
 	for (unsigned int i = 0; i < numBones; ++i)
 	{
-		std::cout << "Bone ";
-		std::cout.width(10);
-		std::cout << boneName[i] << ": ";
+		SWG_LOG(LOG_DEBUG) << "Bone ";
+		SWG_LOG(LOG_DEBUG) << std::setw(10);
+		SWG_LOG(LOG_DEBUG) << boneName[i] << ": ";
 
 		total += base::read(file, value);
-		std::cout << value << std::endl;
+		SWG_LOG(LOG_DEBUG) << value << std::endl;
 	}
-	std::cout << std::endl;
+	SWG_LOG(LOG_INFO) << std::endl;
 
 	if (jrorSize == total)
 	{
-		std::cout << "Finished reading JROR" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading JROR" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading JROR" << std::endl;
-		std::cout << "Read " << total << " out of " << jrorSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading JROR" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << jrorSize
 			<< std::endl;
 	}
 
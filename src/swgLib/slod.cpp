@@ -29,9 +29,11 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/slod.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -50,17 +52,16 @@ unsigned int slod::readSLOD(std::istream& file)
 
 	std::size_t total = readFormHeader(file, "SLOD", slodSize);
 	slodSize += 8;
-	std::cout << "Found SLOD form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found SLOD form" << std::endl;
 
 	std::size_t size;
 	std::string form;
 	total += readFormHeader(file, form, size, type);
 	if (form != "FORM")
 	{
-		std::cout << "Expected Form" << std::endl;
-		exit(0);
+		base::fail(file, form, "Expected Form");
 	}
-	std::cout << "Found form of type: " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found form of type: " << type << std::endl;
 
 	unsigned short numSktm;
 	total += readINFO(file, numSktm);
@@ -74,12 +75,12 @@ unsigned int slod::readSLOD(std::istream& file)
 
 	if (slodSize == total)
 	{
-		std::cout << "Finished reading SLOD" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading SLOD" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading SLOD" << std::endl;
-		std::cout << "Read " << total << " out of " << slodSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading SLOD" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << slodSize
 			<< std::endl;
 	}
 
@@ -94,21 +95,22 @@ unsigned int slod::readINFO(std::istream& file, unsigned short& value)
 	infoSize += 8;
 	if (type != "INFO")
 	{
-		std::cout << "Expected record of type INFO: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type INFO: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	total += base::read(file, value);
 
 	if (infoSize == total)
 	{
-		std::cout << "Finished reading INFO" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading INFO" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading INFO" << std::endl;
-		std::cout << "Read " << total << " out of " << infoSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading INFO" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << infoSize
 			<< std::endl;
 	}
 
@@ -24,9 +24,11 @@
 */
 
 #include <swgLib/smat.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -43,7 +45,7 @@ unsigned int smat::readSMAT(std::istream& file)
 	std::size_t smatSize;
 	std::size_t total = readFormHeader(file, "SMAT", smatSize);
 	smatSize += 8;
-	std::cout << "Found SMAT form"
+	SWG_LOG(LOG_INFO) << "Found SMAT form"
 		<< ": " << smatSize - 12 << " bytes"
 		<< std::endl;
 
@@ -52,10 +54,11 @@ unsigned int smat::readSMAT(std::istream& file)
 	total += readFormHeader(file, form, size, type);
 	if (form != "FORM")
 	{
-		std::cout << "Expected FORM: " << form << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM: " << form;
+		base::fail(file, form, msg.str());
 	}
-	std::cout << "Found " << form << " " << type
+	SWG_LOG(LOG_INFO) << "Found " << form << " " << type
 		<< ": " << size - 4 << " bytes"
 		<< std::endl;
 
@@ -68,13 +71,13 @@ unsigned int smat::readSMAT(std::istream& file)
 
 	if (smatSize == total)
 	{
-		std::cout << "Finished reading SMAT" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading SMAT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading SMAT" << std::endl;
-		std::cout << "Possibly a corrupt or non-finished file" << std::endl;
-		std::cout << "Read " << total << " out of " << smatSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading SMAT" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Possibly a corrupt or non-finished file" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << smatSize
 			<< std::endl;
 	}
 
@@ -89,27 +92,28 @@ unsigned int smat::readINFO(std::istream& file)
 	infoSize += 8;
 	if (type != "INFO")
 	{
-		std::cout << "Expected record of type INFO: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type INFO: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	total += base::read(file, numMSGN);
-	std::cout << "Num MSGN: " << numMSGN << std::endl;
+	SWG_LOG(LOG_INFO) << "Num MSGN: " << numMSGN << std::endl;
 
 	total += base::read(file, numSKTI);
-	std::cout << "Num SKTI: " << numSKTI << std::endl;
+	SWG_LOG(LOG_INFO) << "Num SKTI: " << numSKTI << std::endl;
 
 	total += readUnknown(file, infoSize - total);
 
 	if (infoSize == total)
 	{
-		std::cout << "Finished reading INFO" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading INFO" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading INFO" << std::endl;
-		std::cout << "Read " << total << " out of " << infoSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading INFO" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << infoSize
 			<< std::endl;
 	}
 
@@ -124,26 +128,27 @@ unsigned int smat::readMSGN(std::istream& file)
 	msgnSize += 8;
 	if (type != "MSGN")
 	{
-		std::cout << "Expected record of type MSGN: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type MSGN: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	std::string name;
 	for (unsigned int i = 0; i < numMSGN; ++i)
 	{
 		total += base::read(file, name);
-		std::cout << name << std::endl;
+		SWG_LOG(LOG_DEBUG) << name << std::endl;
 	}
 
 	if (msgnSize == total)
 	{
-		std::cout << "Finished reading MSGN" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading MSGN" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading MSGN" << std::endl;
-		std::cout << "Read " << total << " out of " << msgnSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading MSGN" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << msgnSize
 			<< std::endl;
 	}
 
@@ -158,29 +163,30 @@ unsigned int smat::readSKTI(std::istream& file)
 	sktiSize += 8;
 	if (type != "SKTI")
 	{
-		std::cout << "Expected record of type SKTI: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type SKTI: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	std::string skeletonFile, name;
 	for (unsigned short i = 0; i < numSKTI; ++i)
 	{
 		total += base::read(file, skeletonFile);
-		std::cout << skeletonFile << " ";
+		SWG_LOG(LOG_DEBUG) << skeletonFile << " ";
 
 		total += base::read(file, name);
-		std::cout << name << std::endl;
+		SWG_LOG(LOG_DEBUG) << name << std::endl;
 	}
 
 	if (sktiSize == total)
 	{
-		std::cout << "Finished reading SKTI" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading SKTI" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading SKTI" << std::endl;
-		std::cout << "Read " << total << " out of " << sktiSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading SKTI" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << sktiSize
 			<< std::endl;
 	}
 
@@ -195,34 +201,35 @@ unsigned int smat::readLATX(std::istream& file)
 	latxSize += 8;
 	if (type != "LATX")
 	{
-		std::cout << "Expected record of type LATX: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type LATX: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << ": " << latxSize - 8 << " bytes"
+	SWG_LOG(LOG_INFO) << "Found " << type << ": " << latxSize - 8 << " bytes"
 		<< std::endl;
 
 	unsigned short num;
 	total += base::read(file, num);
-	std::cout << "Num: " << num << std::endl;
+	SWG_LOG(LOG_INFO) << "Num: " << num << std::endl;
 
 	std::string name;
 	for (unsigned short i = 0; i < numSKTI; ++i)
 	{
 		total += base::read(file, name);
-		std::cout << name << " ";
+		SWG_LOG(LOG_DEBUG) << name << " ";
 
 		total += base::read(file, name);
-		std::cout << name << std::endl;
+		SWG_LOG(LOG_DEBUG) << name << std::endl;
 	}
 
 	if (latxSize == total)
 	{
-		std::cout << "Finished reading LATX" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading LATX" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading LATX" << std::endl;
-		std::cout << "Read " << total << " out of " << latxSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading LATX" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << latxSize
 			<< std::endl;
 	}
 
@@ -234,7 +241,7 @@ unsigned int smat::readLDTB(std::istream& file)
 	std::size_t ldtbSize;
 	std::size_t total = readFormHeader(file, "LDTB", ldtbSize);
 	ldtbSize += 8;
-	std::cout << "Found LDTB form"
+	SWG_LOG(LOG_INFO) << "Found LDTB form"
 		<< ": " << ldtbSize - 12 << " bytes"
 		<< std::endl;
 
@@ -243,10 +250,11 @@ unsigned int smat::readLDTB(std::istream& file)
 	total += readFormHeader(file, form, size, type);
 	if (form != "FORM")
 	{
-		std::cout << "Expected FORM: " << form << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM: " << form;
+		base::fail(file, form, msg.str());
 	}
-	std::cout << "Found " << form << " " << type
+	SWG_LOG(LOG_INFO) << "Found " << form << " " << type
 		<< ": " << size - 4 << " bytes"
 		<< std::endl;
 
@@ -256,12 +264,12 @@ unsigned int smat::readLDTB(std::istream& file)
 
 	if (ldtbSize == total)
 	{
-		std::cout << "Finished reading LDTB" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading LDTB" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading LDTB" << std::endl;
-		std::cout << "Read " << total << " out of " << ldtbSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading LDTB" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << ldtbSize
 			<< std::endl;
 	}
 
@@ -276,52 +284,53 @@ unsigned int smat::readLDTBINFO(std::istream& file)
 	infoSize += 8;
 	if (type != "INFO")
 	{
-		std::cout << "Expected record of type INFO: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type INFO: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << ": " << infoSize - 8 << " bytes"
+	SWG_LOG(LOG_INFO) << "Found " << type << ": " << infoSize - 8 << " bytes"
 		<< std::endl;
 
 	unsigned short num;
 	total += base::read(file, num);
-	std::cout << num << std::endl;
+	SWG_LOG(LOG_INFO) << num << std::endl;
 
 	for (unsigned int i = 0; i < num; ++i)
 	{
 		unsigned char u1;
 		total += base::read(file, u1);
-		std::cout << (int)u1 << " ";
+		SWG_LOG(LOG_DEBUG) << (int)u1 << " ";
 
 		total += base::read(file, u1);
-		std::cout << (int)u1 << " ";
+		SWG_LOG(LOG_DEBUG) << (int)u1 << " ";
 
 		total += base::read(file, u1);
-		std::cout << (int)u1 << " ";
+		SWG_LOG(LOG_DEBUG) << (int)u1 << " ";
 
 		total += base::read(file, u1);
-		std::cout << (int)u1 << " ";
+		SWG_LOG(LOG_DEBUG) << (int)u1 << " ";
 
 		total += base::read(file, u1);
-		std::cout << (int)u1 << " ";
+		SWG_LOG(LOG_DEBUG) << (int)u1 << " ";
 
 		total += base::read(file, u1);
-		std::cout << (int)u1 << " ";
+		SWG_LOG(LOG_DEBUG) << (int)u1 << " ";
 
 		total += base::read(file, u1);
-		std::cout << (int)u1 << " ";
+		SWG_LOG(LOG_DEBUG) << (int)u1 << " ";
 
 		total += base::read(file, u1);
-		std::cout << (int)u1 << std::endl;
+		SWG_LOG(LOG_DEBUG) << (int)u1 << std::endl;
 	}
 
 	if (infoSize == total)
 	{
-		std::cout << "Finished reading INFO" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading INFO" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading INFO" << std::endl;
-		std::cout << "Read " << total << " out of " << infoSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading INFO" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << infoSize
 			<< std::endl;
 	}
 
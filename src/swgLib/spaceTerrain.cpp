@@ -29,9 +29,11 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/spaceTerrain.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -75,7 +77,7 @@ std::size_t ml::spaceTerrain::read(std::istream& file)
 	std::size_t spaceTerrainSize;
 	std::size_t total = base::readFormHeader(file, "STAT", spaceTerrainSize);
 	spaceTerrainSize += 8;
-	std::cout << "Found STAT form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found STAT form" << std::endl;
 
 	std::string form, type;
 	std::size_t size0000;
@@ -83,11 +85,11 @@ std::size_t ml::spaceTerrain::read(std::istream& file)
 	size0000 += 8;
 
 	if ("0000" != type) {
-		std::cout << "Space Terrain (STAT) file not detected\n";
+		SWG_LOG(LOG_INFO) << "Space Terrain (STAT) file not detected\n";
 		if ("DERV" == type) {
-			std::cout << "File appears to be Shared Static Object Template (STAT) type.\n";
+			SWG_LOG(LOG_INFO) << "File appears to be Shared Static Object Template (STAT) type.\n";
 		}
-		std::cout << "Resetting file pointer\n";
+		SWG_LOG(LOG_INFO) << "Resetting file pointer\n";
 		file.seekg(streamStart);
 		return 0;
 	}
@@ -99,7 +101,7 @@ std::size_t ml::spaceTerrain::read(std::istream& file)
 		if ("INFO" == type) {
 			total += base::readFormHeader(file, "INFO", size);
 			total += base::read(file, _mapWidthInMeters);
-			std::cout << "Map width (m): " << _mapWidthInMeters << "\n\n";
+			SWG_LOG(LOG_DEBUG) << "Map width (m): " << _mapWidthInMeters << "\n\n";
 		}
 		else if ("CLEA" == type) {
 			total += base::readFormHeader(file, "CLEA", size);
@@ -107,7 +109,7 @@ std::size_t ml::spaceTerrain::read(std::istream& file)
 			total += base::read(file, _clearColorRed);
 			total += base::read(file, _clearColorGreen);
 			total += base::read(file, _clearColorBlue);
-			std::cout << "Clear color (rgb): "
+			SWG_LOG(LOG_DEBUG) << "Clear color (rgb): "
 				<< _clearColorRed << ", "
 				<< _clearColorGreen << ", "
 				<< _clearColorBlue << "\n\n";
@@ -119,7 +121,7 @@ std::size_t ml::spaceTerrain::read(std::istream& file)
 			total += base::read(file, _ambientRed);
 			total += base::read(file, _ambientGreen);
 			total += base::read(file, _ambientBlue);
-			std::cout << "Ambient color (rgba): "
+			SWG_LOG(LOG_DEBUG) << "Ambient color (rgba): "
 				<< _ambientRed << ", "
 				<< _ambientGreen << ", "
 				<< _ambientBlue << ", "
@@ -130,16 +132,19 @@ std::size_t ml::spaceTerrain::read(std::istream& file)
 			total += base::readRecordHeader(file, "0000", size);
 			light newLight;
 			total += newLight.read(file);
-			std::cout << "Light " << _light.size() << ": \n";
-			newLight.print(std::cout);
+			SWG_LOG(LOG_DEBUG) << "Light " << _light.size() << ": \n";
+			if (logger::enabled(logger::LOG_DEBUG))
+			{
+				newLight.print(logger::stream(logger::LOG_DEBUG));
+			}
 			_light.push_back(newLight);
-			std::cout << "\n";
+			SWG_LOG(LOG_DEBUG) << "\n";
 		}
 		else if ("ENVI" == type) {
 			total += base::readFormHeader(file, "ENVI", size);
 			total += base::readRecordHeader(file, "0000", size);
 			total += base::read(file, _environmentTextureName);
-			std::cout << "Environmental texture: " << _environmentTextureName << "\n\n";
+			SWG_LOG(LOG_DEBUG) << "Environmental texture: " << _environmentTextureName << "\n\n";
 		}
 		else if ("FOG " == type) {
 			total += base::readFormHeader(file, "FOG ", size);
@@ -150,7 +155,7 @@ std::size_t ml::spaceTerrain::read(std::istream& file)
 			total += base::read(file, _fogGreen);
 			total += base::read(file, _fogBlue);
 			_fogDensity = _fogAlpha;
-			std::cout << "Fog enabled: true\n"
+			SWG_LOG(LOG_DEBUG) << "Fog enabled: true\n"
 				<< "Fog color (rgba): "
 				<< _fogRed << ", "
 				<< _fogGreen << ", "
@@ -163,7 +168,7 @@ std::size_t ml::spaceTerrain::read(std::istream& file)
 			total += base::readRecordHeader(file, "0000", size);
 			total += base::read(file, _starColorRampName);
 			total += base::read(file, _numberOfStars);
-			std::cout << "Star color ramp: " << _starColorRampName << "\n"
+			SWG_LOG(LOG_DEBUG) << "Star color ramp: " << _starColorRampName << "\n"
 				<< "Number of stars: " << _numberOfStars << "\n\n";
 		}
 		else if ("DUST" == type) {
@@ -171,7 +176,7 @@ std::size_t ml::spaceTerrain::read(std::istream& file)
 			total += base::readRecordHeader(file, "0000", size);
 			total += base::read(file, _numberOfDust);
 			total += base::read(file, _dustRadius);
-			std::cout << "Number of dust: " << _numberOfDust << "\n"
+			SWG_LOG(LOG_DEBUG) << "Number of dust: " << _numberOfDust << "\n"
 				<< "Dust radius: " << _dustRadius << "\n\n";
 		}
 		else if ("SKYB" == type) {
@@ -181,7 +186,7 @@ std::size_t ml::spaceTerrain::read(std::istream& file)
 			total += base::read(file, _skyboxTextureName);
 			// Add full texture path to name
 			_skyboxTextureName = std::string("texture/") + _skyboxTextureName;
-			std::cout << "Skybox cube map enabled: " << std::boolalpha << _skyboxCubeMap << "\n"
+			SWG_LOG(LOG_DEBUG) << "Skybox cube map enabled: " << std::boolalpha << _skyboxCubeMap << "\n"
 				<< "Skybox texture: " << _skyboxTextureName << "\n\n";
 		}
 		else if ("DIST" == type) {
@@ -190,9 +195,12 @@ std::size_t ml::spaceTerrain::read(std::istream& file)
 			distance newDist;
 			total += newDist.readDIST(file);
 			_distance.push_back(newDist);
-			std::cout << "Distant object:\n";
-			newDist.print(std::cout);
-			std::cout << "\n";
+			SWG_LOG(LOG_DEBUG) << "Distant object:\n";
+			if (logger::enabled(logger::LOG_DEBUG))
+			{
+				newDist.print(logger::stream(logger::LOG_DEBUG));
+			}
+			SWG_LOG(LOG_DEBUG) << "\n";
 		}
 		else if ("PLAN" == type) {
 			total += base::readFormHeader(file, "PLAN", size);
@@ -200,36 +208,43 @@ std::size_t ml::spaceTerrain::read(std::istream& file)
 			distance newPlan;
 			total += newPlan.readPLAN(file);
 			_distance.push_back(newPlan);
-			std::cout << "Distant planet:\n";
-			newPlan.print(std::cout);
-			std::cout << "\n";
+			SWG_LOG(LOG_DEBUG) << "Distant planet:\n";
+			if (logger::enabled(logger::LOG_DEBUG))
+			{
+				newPlan.print(logger::stream(logger::LOG_DEBUG));
+			}
+			SWG_LOG(LOG_DEBUG) << "\n";
 		}
 		else if ("CELE" == type) {
 			total += base::readFormHeader(file, "CELE", size);
 			total += base::readRecordHeader(file, "0000", size);
 			celestial newCele;
 			total += newCele.read(file);
-			std::cout << "Celestial " << _celestial.size() << ":\n";
-			newCele.print(std::cout);
+			SWG_LOG(LOG_DEBUG) << "Celestial " << _celestial.size() << ":\n";
+			if (logger::enabled(logger::LOG_DEBUG))
+			{
+				newCele.print(logger::stream(logger::LOG_DEBUG));
+			}
 			_celestial.push_back(newCele);
-			std::cout << "\n";
+			SWG_LOG(LOG_DEBUG) << "\n";
 		}
 		else {
-			std::cout << "Unhandled type: " << type << "\n";
-			exit(0);
+			std::ostringstream msg;
+			msg << "Unhandled type: " << type;
+			base::fail(file, type, msg.str());
 		}
 	}
 
 	if (spaceTerrainSize == total)
 	{
-		std::cout << "Finished reading STAT\n";
+		SWG_LOG(LOG_INFO) << "Finished reading STAT\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading STAT\n"
-			<< "Read " << total << " out of " << spaceTerrainSize
-			<< "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading STAT: "
+			<< "Read " << total << " out of " << spaceTerrainSize;
+		base::fail(file, "STAT", msg.str());
 	}
 
 	return total;
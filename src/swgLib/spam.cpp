@@ -24,9 +24,11 @@
 */
 
 #include <swgLib/spam.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 #define MAX_SWG_STRING 2048
 
@@ -45,7 +47,7 @@ unsigned int spam::readSPAM(std::istream& file)
 	std::size_t spamSize;
 	std::size_t total = readFormHeader(file, "SPAM", spamSize);
 	spamSize += 8;
-	std::cout << "Found SPAM form"
+	SWG_LOG(LOG_INFO) << "Found SPAM form"
 		<< ": " << spamSize - 12 << " bytes"
 		<< std::endl;
 
@@ -54,10 +56,11 @@ unsigned int spam::readSPAM(std::istream& file)
 	total += readFormHeader(file, form, size, type);
 	if (form != "FORM")
 	{
-		std::cout << "Expected FORM: " << form << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM: " << form;
+		base::fail(file, form, msg.str());
 	}
-	std::cout << "Found " << form << " " << type
+	SWG_LOG(LOG_INFO) << "Found " << form << " " << type
 		<< ": " << size - 4 << " bytes"
 		<< std::endl;
 
@@ -68,13 +71,13 @@ unsigned int spam::readSPAM(std::istream& file)
 
 	if (spamSize == total)
 	{
-		std::cout << "Finished reading SPAM" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading SPAM" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading SPAM" << std::endl;
-		std::cout << "Possibly a corrupt or non-finished file" << std::endl;
-		std::cout << "Read " << total << " out of " << spamSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading SPAM" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Possibly a corrupt or non-finished file" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << spamSize
 			<< std::endl;
 	}
 
@@ -87,7 +90,7 @@ unsigned int spam::readAPPE(std::istream& file)
 	std::size_t formSize;
 	std::size_t total = readFormHeader(file, "APPE", formSize);
 	formSize += 8;
-	std::cout << "Found APPE form"
+	SWG_LOG(LOG_INFO) << "Found APPE form"
 		<< ": " << formSize - 8 << " bytes"
 		<< std::endl;
 
@@ -97,8 +100,9 @@ unsigned int spam::readAPPE(std::istream& file)
 	size += 8;
 	if (type != "0000")
 	{
-		std::cout << "Expected record of type 0000: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type 0000: " << type;
+		base::fail(file, type, msg.str());
 	}
 
 	while (total < size)
@@ -110,12 +114,12 @@ unsigned int spam::readAPPE(std::istream& file)
 
 	if (formSize == total)
 	{
-		std::cout << "Finished reading APPE" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading APPE" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading APPE" << std::endl;
-		std::cout << "Read " << total << " out of " << formSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading APPE" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << formSize
 			<< std::endl;
 	}
 
@@ -127,7 +131,7 @@ unsigned int spam::readCLIE(std::istream& file)
 	std::size_t formSize;
 	std::size_t total = readFormHeader(file, "CLIE", formSize);
 	formSize += 8;
-	std::cout << "Found CLIE form"
+	SWG_LOG(LOG_INFO) << "Found CLIE form"
 		<< ": " << formSize - 8 << " bytes"
 		<< std::endl;
 
@@ -137,8 +141,9 @@ unsigned int spam::readCLIE(std::istream& file)
 	size += 8;
 	if (type != "0000")
 	{
-		std::cout << "Expected record of type 0000: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type 0000: " << type;
+		base::fail(file, type, msg.str());
 	}
 
 	while (total < size)
@@ -150,12 +155,12 @@ unsigned int spam::readCLIE(std::istream& file)
 
 	if (formSize == total)
 	{
-		std::cout << "Finished reading CLIE" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading CLIE" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading CLIE" << std::endl;
-		std::cout << "Read " << total << " out of " << formSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading CLIE" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << formSize
 			<< std::endl;
 	}
 
@@ -167,7 +172,7 @@ unsigned int spam::readPORT(std::istream& file)
 	std::size_t formSize;
 	std::size_t total = readFormHeader(file, "PORT", formSize);
 	formSize += 8;
-	std::cout << "Found PORT form"
+	SWG_LOG(LOG_INFO) << "Found PORT form"
 		<< ": " << formSize - 8 << " bytes"
 		<< std::endl;
 
@@ -177,8 +182,9 @@ unsigned int spam::readPORT(std::istream& file)
 	size += 8;
 	if (type != "0000")
 	{
-		std::cout << "Expected record of type 0000: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type 0000: " << type;
+		base::fail(file, type, msg.str());
 	}
 
 	while (total < size)
@@ -190,12 +196,12 @@ unsigned int spam::readPORT(std::istream& file)
 
 	if (formSize == total)
 	{
-		std::cout << "Finished reading PORT" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading PORT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading PORT" << std::endl;
-		std::cout << "Read " << total << " out of " << formSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading PORT" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << formSize
 			<< std::endl;
 	}
 
@@ -207,7 +213,7 @@ unsigned int spam::readSOUN(std::istream& file)
 	std::size_t formSize;
 	std::size_t total = readFormHeader(file, "SOUN", formSize);
 	formSize += 8;
-	std::cout << "Found SOUN form: " << formSize - 8 << " bytes"
+	SWG_LOG(LOG_INFO) << "Found SOUN form: " << formSize - 8 << " bytes"
 		<< std::endl;
 
 	std::size_t size;
@@ -216,8 +222,9 @@ unsigned int spam::readSOUN(std::istream& file)
 	size += 8;
 	if (type != "0000")
 	{
-		std::cout << "Expected record of type 0000: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type 0000: " << type;
+		base::fail(file, type, msg.str());
 	}
 
 	while (total < size)
@@ -229,12 +236,12 @@ unsigned int spam::readSOUN(std::istream& file)
 
 	if (formSize == total)
 	{
-		std::cout << "Finished reading SOUN" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading SOUN" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading SOUN" << std::endl;
-		std::cout << "Read " << total << " out of " << formSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading SOUN" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << formSize
 			<< std::endl;
 	}
 
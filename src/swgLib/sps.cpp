@@ -25,6 +25,8 @@
 
 #include <swgLib/sps.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -38,7 +40,7 @@ std::size_t sps::read(std::istream& file, bool skipSIDX) {
 	std::size_t spsSize;
 	std::size_t total = base::readFormHeader(file, "SPS ", spsSize);
 	spsSize += 8;// Add omitted fields from form header...
-	std::cout << "Found form SPS: " << spsSize << "\n";
+	SWG_LOG(LOG_INFO) << "Found form SPS: " << spsSize << "\n";
 
 	std::size_t size;
 	std::string type;
@@ -46,15 +48,16 @@ std::size_t sps::read(std::istream& file, bool skipSIDX) {
 
 	_version = base::tagToVersion(type);
 	if (_version > 1) {
-		std::cout << "Expected FORM of type 0000 or 0001. Found: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM of type 0000 or 0001. Found: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "SPS version " << (int)_version << "\n";
+	SWG_LOG(LOG_INFO) << "SPS version " << (int)_version << "\n";
 
 	total += base::readRecordHeader(file, "CNT ", size);
 	total += base::read(file, _numberOfShaders);
 	_shaderPrimitives.resize(_numberOfShaders);
-	std::cout << "Number of shaders: " << _numberOfShaders << "\n";
+	SWG_LOG(LOG_INFO) << "Number of shaders: " << _numberOfShaders << "\n";
 
 	for (auto& sp : _shaderPrimitives) {
 		if (0 == _version) {
@@ -67,13 +70,14 @@ std::size_t sps::read(std::istream& file, bool skipSIDX) {
 
 	if (total == spsSize)
 	{
-		std::cout << "Finished reading SPS\n";
+		SWG_LOG(LOG_INFO) << "Finished reading SPS\n";
 	}
 	else
 	{
-		std::cout << "Error reading SPS!\n";
-		std::cout << "Read " << total << " out of " << spsSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Error reading SPS!: ";
+		msg << "Read " << total << " out of " << spsSize;
+		base::fail(file, "SPS ", msg.str());
 	}
 
 	return total;
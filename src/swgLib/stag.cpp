@@ -25,6 +25,8 @@
 
 #include <swgLib/stag.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -38,70 +40,71 @@ std::size_t stag::read(std::istream& file) {
 	std::size_t stagSize;
 	std::size_t total = base::readFormHeader(file, "STAG", stagSize);
 	stagSize += 8;
-	std::cout << "Found FORM STAG: " << stagSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM STAG: " << stagSize - 12 << " bytes\n";
 
 	std::size_t size;
 	std::string type;
 	std::string form;
 	base::peekHeader(file, form, size, type);
-	std::cout << "Peek: " << form << " " << type << "\n";
+	SWG_LOG(LOG_INFO) << "Peek: " << form << " " << type << "\n";
 	total += base::readRecordHeader(file, type, size);
 
 	_version = base::tagToVersion(type);
 	if (_version > 2)
 	{
-		std::cout << "Expected FORM of type 0000 or 0001. Found: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM of type 0000 or 0001. Found: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found FORM " << type << ": " << size - 4 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM " << type << ": " << size - 4 << " bytes\n";
 
 	total += base::read(file, _colorOperation);
-	std::cout << "Color operation: " << (int)_colorOperation << "\n";
+	SWG_LOG(LOG_INFO) << "Color operation: " << (int)_colorOperation << "\n";
 
 	total += base::read(file, _colorArgument0);
 	total += base::read(file, _colorArgument0Complement);
 	total += base::read(file, _colorArgument0AlphaReplicate);
 
-	std::cout << "Color argument 0: " << (int)_colorArgument0 << "\n";
-	std::cout << "Color argument 0 complement: " << std::boolalpha << _colorArgument0Complement << "\n";
-	std::cout << "Color argument 0 alpha replicate: " << std::boolalpha << _colorArgument0AlphaReplicate << "\n";
+	SWG_LOG(LOG_INFO) << "Color argument 0: " << (int)_colorArgument0 << "\n";
+	SWG_LOG(LOG_INFO) << "Color argument 0 complement: " << std::boolalpha << _colorArgument0Complement << "\n";
+	SWG_LOG(LOG_INFO) << "Color argument 0 alpha replicate: " << std::boolalpha << _colorArgument0AlphaReplicate << "\n";
 
 	total += base::read(file, _colorArgument1);
 	total += base::read(file, _colorArgument1Complement);
 	total += base::read(file, _colorArgument1AlphaReplicate);
 
-	std::cout << "Color argument 1: " << (int)_colorArgument1 << "\n";
-	std::cout << "Color argument 1 complement: " << std::boolalpha << _colorArgument1Complement << "\n";
-	std::cout << "Color argument 1 alpha replicate: " << std::boolalpha << _colorArgument1AlphaReplicate << "\n";
+	SWG_LOG(LOG_INFO) << "Color argument 1: " << (int)_colorArgument1 << "\n";
+	SWG_LOG(LOG_INFO) << "Color argument 1 complement: " << std::boolalpha << _colorArgument1Complement << "\n";
+	SWG_LOG(LOG_INFO) << "Color argument 1 alpha replicate: " << std::boolalpha << _colorArgument1AlphaReplicate << "\n";
 
 	total += base::read(file, _colorArgument2);
 	total += base::read(file, _colorArgument2Complement);
 	total += base::read(file, _colorArgument2AlphaReplicate);
 
-	std::cout << "Color argument 2: " << (int)_colorArgument2 << "\n";
-	std::cout << "Color argument 2 complement: " << std::boolalpha << _colorArgument2Complement << "\n";
-	std::cout << "Color argument 2 alpha replicate: " << std::boolalpha << _colorArgument2AlphaReplicate << "\n";
+	SWG_LOG(LOG_INFO) << "Color argument 2: " << (int)_colorArgument2 << "\n";
+	SWG_LOG(LOG_INFO) << "Color argument 2 complement: " << std::boolalpha << _colorArgument2Complement << "\n";
+	SWG_LOG(LOG_INFO) << "Color argument 2 alpha replicate: " << std::boolalpha << _colorArgument2AlphaReplicate << "\n";
 
 	total += base::read(file, _alphaOperation);
-	std::cout << "Alpha operation: " << (int)_alphaOperation << "\n";
+	SWG_LOG(LOG_INFO) << "Alpha operation: " << (int)_alphaOperation << "\n";
 
 	total += base::read(file, _alphaArgument0);
 	total += base::read(file, _alphaArgument0Complement);
 
-	std::cout << "Alpha argument 0: " << (int)_alphaArgument0 << "\n";
-	std::cout << "Alpha argument 0 complement: " << std::boolalpha << _alphaArgument0Complement << "\n";
+	SWG_LOG(LOG_INFO) << "Alpha argument 0: " << (int)_alphaArgument0 << "\n";
+	SWG_LOG(LOG_INFO) << "Alpha argument 0 complement: " << std::boolalpha << _alphaArgument0Complement << "\n";
 
 	total += base::read(file, _alphaArgument1);
 	total += base::read(file, _alphaArgument1Complement);
 
-	std::cout << "Alpha argument 1: " << (int)_alphaArgument1 << "\n";
-	std::cout << "Alpha argument 1 complement: " << std::boolalpha << _alphaArgument1Complement << "\n";
+	SWG_LOG(LOG_INFO) << "Alpha argument 1: " << (int)_alphaArgument1 << "\n";
+	SWG_LOG(LOG_INFO) << "Alpha argument 1 complement: " << std::boolalpha << _alphaArgument1Complement << "\n";
 
 	total += base::read(file, _alphaArgument2);
 	total += base::read(file, _alphaArgument2Complement);
 
-	std::cout << "Alpha argument 2: " << (int)_alphaArgument2 << "\n";
-	std::cout << "Alpha argument 2 complement: " << std::boolalpha << _alphaArgument2Complement << "\n";
+	SWG_LOG(LOG_INFO) << "Alpha argument 2: " << (int)_alphaArgument2 << "\n";
+	SWG_LOG(LOG_INFO) << "Alpha argument 2 complement: " << std::boolalpha << _alphaArgument2Complement << "\n";
 
 	total += base::read(file, _resultArgument);
 	total += base::read(file, _textureTag);
@@ -118,13 +121,14 @@ std::size_t stag::read(std::istream& file) {
 
 	if (stagSize == total)
 	{
-		std::cout << "Finished reading STAG\n";
+		SWG_LOG(LOG_INFO) << "Finished reading STAG\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading STAG\n";
-		std::cout << "Read " << total << " out of " << stagSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading STAG: ";
+		msg << "Read " << total << " out of " << stagSize;
+		base::fail(file, "STAG", msg.str());
 	}
 
 	return total;
@@ -25,9 +25,11 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/stat.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 ml::stat::stat() :
 	shot(),
@@ -48,32 +50,32 @@ std::size_t ml::stat::readSTAT(std::istream& file)
 	std::size_t statSize;
 	std::size_t total = base::readFormHeader(file, "STAT", statSize);
 	statSize += 8;
-	std::cout << "Found STAT form\n";
+	SWG_LOG(LOG_INFO) << "Found STAT form\n";
 
 	std::string form, type;
 	std::size_t size;
 	base::peekHeader(file, form, size, type);
 
 	if ("DERV" != type) {
-		std::cout << "Shared Static Object Template (STAT) file not detected\n";
+		SWG_LOG(LOG_INFO) << "Shared Static Object Template (STAT) file not detected\n";
 		if ("0000" == type) {
-			std::cout << "File appears to be Space Terrain (STAT) type.\n";
+			SWG_LOG(LOG_INFO) << "File appears to be Space Terrain (STAT) type.\n";
 		}
-		std::cout << "Resetting file pointer\n";
+		SWG_LOG(LOG_INFO) << "Resetting file pointer\n";
 		file.seekg(streamStart);
 		return 0;
 	}
 
 	total += readDERV(file, _statBaseObjectFilename);
-	std::cout << "STAT Base object filename: " << _statBaseObjectFilename << "\n";
+	SWG_LOG(LOG_INFO) << "STAT Base object filename: " << _statBaseObjectFilename << "\n";
 
 	total += base::readFormHeader(file, type, size);
 	_statVersion = base::tagToVersion(type);
-	std::cout << "STAT version: " << (int)_statVersion << "\n";
+	SWG_LOG(LOG_INFO) << "STAT version: " << (int)_statVersion << "\n";
 
 	int32_t numParameters;
 	total += readPCNT(file, numParameters);
-	std::cout << "Num parameters: " << numParameters << "\n";
+	SWG_LOG(LOG_INFO) << "Num parameters: " << numParameters << "\n";
 
 	// Doesn't look like STAT supports parameters..
 	//for (int32_t i = 0; i < numParameters; ++i)	{}
@@ -82,13 +84,14 @@ std::size_t ml::stat::readSTAT(std::istream& file)
 
 	if (statSize == total)
 	{
-		std::cout << "Finished reading STOT\n";
+		SWG_LOG(LOG_INFO) << "Finished reading STOT\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading STAT\n"
-			<< "Read " << total << " out of " << statSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading STAT: "
+			<< "Read " << total << " out of " << statSize;
+		base::fail(file, "STAT", msg.str());
 	}
 
 	return total;
@@ -25,9 +25,11 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/ster.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -46,17 +48,18 @@ unsigned int ster::readSTER(std::istream& file)
 
 	std::size_t total = readFormHeader(file, "STER", sterSize);
 	sterSize += 8;
-	std::cout << "Found STER form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found STER form" << std::endl;
 
 	std::size_t size;
 	std::string form;
 	total += readFormHeader(file, form, size, type);
 	if (form != "FORM")
 	{
-		std::cout << "Expected FORM: " << form << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM: " << form;
+		base::fail(file, form, msg.str());
 	}
-	std::cout << "Found " << form << " " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << form << " " << type << std::endl;
 
 	total += readPCNT(file);
 	for (unsigned int i = 0; i < numNodes; ++i)
@@ -66,12 +69,12 @@ unsigned int ster::readSTER(std::istream& file)
 
 	if (sterSize == total)
 	{
-		std::cout << "Finished reading STER" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading STER" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading STER" << std::endl;
-		std::cout << "Read " << total << " out of " << sterSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading STER" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << sterSize
 			<< std::endl;
 	}
 
@@ -91,28 +94,30 @@ unsigned int ster::readPCNT(std::istream& file)
 	pcntSize += 8;
 	if (type != "PCNT")
 	{
-		std::cout << "Expected record of type PCNT: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type PCNT: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	if (4 != pcntSize)
 	{
-		std::cout << "Expected size 4: " << pcntSize << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected size 4: " << pcntSize;
+		base::fail(file, "PCNT", msg.str());
 	}
 
 	total += base::read(file, numNodes);
-	std::cout << "numNodes: " << numNodes << std::endl;
+	SWG_LOG(LOG_INFO) << "numNodes: " << numNodes << std::endl;
 
 	if (pcntSize == total)
 	{
-		std::cout << "Finished reading PCNT" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading PCNT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading PCNT" << std::endl;
-		std::cout << "Read " << total << " out of " << pcntSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading PCNT" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << pcntSize
 			<< std::endl;
 	}
 
@@ -129,42 +134,43 @@ unsigned int ster::readXXXX(std::istream& file)
 	xxxxSize += 8;
 	if (type != "XXXX")
 	{
-		std::cout << "Expected record of type XXXX: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type XXXX: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	std::string name;
 	total += base::read(file, name);
-	std::cout << "name: " << name << std::endl;
+	SWG_LOG(LOG_INFO) << "name: " << name << std::endl;
 
 	unsigned char x;
 	total += base::read(file, x);
-	std::cout << "?: " << (unsigned int)x << std::endl;
+	SWG_LOG(LOG_INFO) << "?: " << (unsigned int)x << std::endl;
 
 	std::string name2;
 	total += base::read(file, name2);
-	std::cout << "name2: " << name2 << std::endl;
+	SWG_LOG(LOG_INFO) << "name2: " << name2 << std::endl;
 
 	if ("cover" == name)
 	{
 		unsigned short y;
 		total += base::read(file, y);
-		std::cout << "?: " << y << std::endl;
+		SWG_LOG(LOG_INFO) << "?: " << y << std::endl;
 
 		unsigned char z;
 		total += base::read(file, z);
-		std::cout << "?: " << (unsigned int)z << std::endl;
+		SWG_LOG(LOG_INFO) << "?: " << (unsigned int)z << std::endl;
 	}
 
 	if (xxxxSize == total)
 	{
-		std::cout << "Finished reading XXXX" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading XXXX" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading XXXX" << std::endl;
-		std::cout << "Read " << total << " out of " << xxxxSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading XXXX" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << xxxxSize
 			<< std::endl;
 	}
 
@@ -25,9 +25,11 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/stot.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -49,16 +51,16 @@ std::size_t stot::readSTOT(std::istream& file)
 	std::size_t stotSize;
 	std::size_t total = base::readFormHeader(file, "STOT", stotSize);
 	stotSize += 8;
-	std::cout << "Found STOT form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found STOT form" << std::endl;
 
 	total += readDERV(file, _stotBaseObjectFilename);
-	std::cout << "STOT Base object filename: " << _stotBaseObjectFilename << "\n";
+	SWG_LOG(LOG_INFO) << "STOT Base object filename: " << _stotBaseObjectFilename << "\n";
 
 	std::string type;
 	std::size_t size;
 	total += base::readFormHeader(file, type, size);
 	_stotVersion = base::tagToVersion(type);
-	std::cout << "STOT version: " << (int)_stotVersion << "\n";
+	SWG_LOG(LOG_INFO) << "STOT version: " << (int)_stotVersion << "\n";
 
 	int32_t numParameters;
 	total += readPCNT(file, numParameters);
@@ -71,14 +73,14 @@ std::size_t stot::readSTOT(std::istream& file)
 
 	if (stotSize == total)
 	{
-		std::cout << "Finished reading STOT" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading STOT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading STOT" << std::endl;
-		std::cout << "Read " << total << " out of " << stotSize
-			<< std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading STOT: ";
+		msg << "Read " << total << " out of " << stotSize;
+		base::fail(file, "STOT", msg.str());
 	}
 
 	return total;
@@ -106,33 +108,36 @@ std::size_t stot::readSTOTParameter(std::istream& file)
 	total += base::read(file, dataType);
 
 #if 1
-	std::cout << "Parameter: " << parameter << std::endl;
-	std::cout << "Parameter data type: ";
+	SWG_LOG(LOG_INFO) << "Parameter: " << parameter << std::endl;
+	SWG_LOG(LOG_INFO) << "Parameter data type: ";
 	switch (dataType) {
-	case 1: std::cout << "Single"; break;
-	case 2: std::cout << "Weighted list"; break;
-	case 3: std::cout << "Range"; break;
-	case 4: std::cout << "Die Roll"; break;
-	default: std::cout << "None:" << (int)dataType;
+	case 1: SWG_LOG(LOG_INFO) << "Single"; break;
+	case 2: SWG_LOG(LOG_INFO) << "Weighted list"; break;
+	case 3: SWG_LOG(LOG_INFO) << "Range"; break;
+	case 4: SWG_LOG(LOG_INFO) << "Die Roll"; break;
+	default: SWG_LOG(LOG_INFO) << "None:" << (int)dataType;
 	}
 	//std::cout << " not handled\n";
-	std::cout << "\n";
+	SWG_LOG(LOG_INFO) << "\n";
 
 	const std::size_t valueSize(xxxxSize - total);
-	std::cout << "Value size: " << valueSize << "\n";
+	SWG_LOG(LOG_INFO) << "Value size: " << valueSize << "\n";
 #endif
 	if (parameter == "paletteColorCustomizationVariables")
 	{
 		int32_t numPCCV;
 		total += base::read(file, numPCCV);
-		std::cout << "Num PCCV records: " << numPCCV << "\n";
+		SWG_LOG(LOG_INFO) << "Num PCCV records: " << numPCCV << "\n";
 		if (1 == dataType) {
 			for (auto i = 0; i < numPCCV; ++i) {
 				pccv newPCCV;
 				total += newPCCV.read(file);
 				_paletteColorCustomizationVariables.push_back(newPCCV);
-				std::cout << "Palette color customization variable: \n";
-				newPCCV.print(std::cout);
+				SWG_LOG(LOG_DEBUG) << "Palette color customization variable: \n";
+				if (logger::enabled(logger::LOG_DEBUG))
+				{
+					newPCCV.print(logger::stream(logger::LOG_DEBUG));
+				}
 			}
 		}
 	}
@@ -140,14 +145,17 @@ std::size_t stot::readSTOTParameter(std::istream& file)
 	{
 		int32_t numRICV;
 		total += base::read(file, numRICV);
-		std::cout << "Num RICV records: " << numRICV << "\n";
+		SWG_LOG(LOG_INFO) << "Num RICV records: " << numRICV << "\n";
 		if (1 == dataType) {
 			for (auto i = 0; i < numRICV; ++i) {
 				ricv newRICV;
 				total += newRICV.read(file);
 				_rangedIntCustomizationVariables.push_back(newRICV);
-				std::cout << "Ranged int customization variable: \n";
-				newRICV.print(std::cout);
+				SWG_LOG(LOG_DEBUG) << "Ranged int customization variable: \n";
+				if (logger::enabled(logger::LOG_DEBUG))
+				{
+					newRICV.print(logger::stream(logger::LOG_DEBUG));
+				}
 			}
 		}
 	}
@@ -155,21 +163,24 @@ std::size_t stot::readSTOTParameter(std::istream& file)
 	{
 		int32_t numCSCV;
 		total += base::read(file, numCSCV);
-		std::cout << "Num CSCV records: " << numCSCV << "\n";
+		SWG_LOG(LOG_INFO) << "Num CSCV records: " << numCSCV << "\n";
 		if (1 == dataType) {
 			for (auto i = 0; i < numCSCV; ++i) {
 				cscv newCSCV;
 				total += newCSCV.read(file);
 				_constStringCustomizationVariables.push_back(newCSCV);
-				std::cout << "Const string customization variable: \n";
-				newCSCV.print(std::cout);
+				SWG_LOG(LOG_DEBUG) << "Const string customization variable: \n";
+				if (logger::enabled(logger::LOG_DEBUG))
+				{
+					newCSCV.print(logger::stream(logger::LOG_DEBUG));
+				}
 			}
 		}
 	}
 	else if (parameter == "socketDestinations") {
 		int32_t socketDest;
 		total += base::read(file, socketDest);
-		std::cout << "Socket destination: " << socketDest << "\n";
+		SWG_LOG(LOG_INFO) << "Socket destination: " << socketDest << "\n";
 		if (1 == dataType) {
 			_socketDestinations.push_back(socketDest);
 		}
@@ -177,29 +188,28 @@ std::size_t stot::readSTOTParameter(std::istream& file)
 	else if (parameter == "structureFootprintFileName") {
 		if (1 == dataType) {
 			total += base::read(file, _structureFootprintFileName);
-			std::cout << "Structure footprint filename: " << _structureFootprintFileName << "\n";
+			SWG_LOG(LOG_INFO) << "Structure footprint filename: " << _structureFootprintFileName << "\n";
 		}
 	}
 	else if (parameter == "useStructureFootprintOutline") {
 		if (1 == dataType) {
 			total += base::read(file, _useStructureFootprintOutline);
-			std::cout << "Use structure footprint outline: " << std::boolalpha << _useStructureFootprintOutline << "\n";
+			SWG_LOG(LOG_INFO) << "Use structure footprint outline: " << std::boolalpha << _useStructureFootprintOutline << "\n";
 		}
 	}
 	else if (parameter == "targetable") {
 		if (1 == dataType) {
 			total += base::read(file, _targetable);
-			std::cout << "Targetable: " << std::boolalpha << _targetable << "\n";
+			SWG_LOG(LOG_INFO) << "Targetable: " << std::boolalpha << _targetable << "\n";
 		}
 	}
 	else if (parameter == "certificationsRequired") {
 		int32_t numCert;
 		total += base::read(file, numCert);
-		std::cout << "Num Certification records: " << numCert << "\n";
+		SWG_LOG(LOG_INFO) << "Num Certification records: " << numCert << "\n";
 		if (1 == dataType) {
 			for (auto i = 0; i < numCert; ++i) {
-				std::cout << "****************** certificationsRequired not finished ******************\n";
-				exit(0);
+				base::fail(file, "STOT", "****************** certificationsRequired not finished ******************");
 
 				//total += base::read(file, _);
 			}
@@ -209,34 +219,38 @@ std::size_t stot::readSTOTParameter(std::istream& file)
 	{
 		int32_t numCVM;
 		total += base::read(file, numCVM);
-		std::cout << "Num CVM records: " << numCVM << "\n";
+		SWG_LOG(LOG_INFO) << "Num CVM records: " << numCVM << "\n";
 		if (1 == dataType) {
 			for (auto i = 0; i < numCVM; ++i) {
 				cvm newCVM;
 				total += newCVM.read(file);
 				_customizationVariableMapping.push_back(newCVM);
-				std::cout << "Customization variable mapping: \n";
-				newCVM.print(std::cout);
+				SWG_LOG(LOG_DEBUG) << "Customization variable mapping: \n";
+				if (logger::enabled(logger::LOG_DEBUG))
+				{
+					newCVM.print(logger::stream(logger::LOG_DEBUG));
+				}
 			}
 		}
 	}
 	else if (parameter == "clientVisabilityFlag") {
 		if (1 == dataType) {
 			total += base::read(file, _clientVisabilityFlag);
-			std::cout << "Client visability flag: 0x" << std::hex << _clientVisabilityFlag << std::dec << "\n";
+			SWG_LOG(LOG_INFO) << "Client visability flag: 0x" << std::hex << _clientVisabilityFlag << std::dec << "\n";
 		}
 	}
 	else
 	{
-		std::cout << "Unknown: " << parameter << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unknown: " << parameter;
+		base::fail(file, "STOT", msg.str());
 	}
 
 	if (xxxxSize != total) {
-		std::cout << "FAILED in reading XXXX" << std::endl;
-		std::cout << "Read " << total << " out of " << xxxxSize
-			<< std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading XXXX: ";
+		msg << "Read " << total << " out of " << xxxxSize;
+		base::fail(file, "XXXX", msg.str());
 	}
 
 	return total;
@@ -25,6 +25,7 @@
 
 #include <swgLib/base.hpp>
 #include <swgLib/str.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <string>
@@ -59,23 +60,23 @@ unsigned int str::readSTR( std::istream &file )
     // Check for .str header data
     if( header != 0xabcd )
     {
-	std::cout << ".str header not found" << std::endl;
+	SWG_LOG(LOG_INFO) << ".str header not found" << std::endl;
 	file.seekg( position, std::ios_base::beg );
 	return 0;
     }
 
     unsigned char unknown;
     total += base::read( file, unknown );
-    std::cout << "Unknown: " << (unsigned int)unknown << std::endl;
+    SWG_LOG(LOG_WARNING) << "Unknown: " << (unsigned int)unknown << std::endl;
 
     unsigned int unknown1;
     total += base::read( file, unknown1 );
-    std::cout << "Unknown: " << unknown1 << std::endl;
+    SWG_LOG(LOG_WARNING) << "Unknown: " << unknown1 << std::endl;
     
     // Number of ids and descriptions
     unsigned int numStrings;
     total += base::read( file, numStrings );
-    std::cout << "Num strings: " << numStrings << std::endl;
+    SWG_LOG(LOG_INFO) << "Num strings: " << numStrings << std::endl;
 
     // Allocate vectors to hold IDs and descriptions...
     std::vector< std::string > id( numStrings );
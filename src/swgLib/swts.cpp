@@ -23,9 +23,11 @@
  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 #include <swgLib/swts.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -45,17 +47,18 @@ unsigned int swts::readSWTS(std::istream& file, std::string path)
 
 	std::size_t total = readFormHeader(file, "SWTS", swtsSize);
 	swtsSize += 8;
-	std::cout << "Found SWTS form" << std::endl;
+	SWG_LOG(LOG_INFO) << "Found SWTS form" << std::endl;
 
 	std::size_t size;
 	std::string form;
 	total += readFormHeader(file, form, size, type);
 	if (form != "FORM")
 	{
-		std::cout << "Expected FORM: " << form << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected FORM: " << form;
+		base::fail(file, form, msg.str());
 	}
-	std::cout << "Found " << form << " " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << form << " " << type << std::endl;
 
 	while (total < swtsSize)
 	{
@@ -74,8 +77,9 @@ unsigned int swts::readSWTS(std::istream& file, std::string path)
 			}
 			else
 			{
-				std::cout << "Unexpected form: " << type << std::endl;
-				exit(0);
+				std::ostringstream msg;
+				msg << "Unexpected form: " << type;
+				base::fail(file, type, msg.str());
 			}
 		}
 		else if (form == "TEXT")
@@ -88,19 +92,20 @@ unsigned int swts::readSWTS(std::istream& file, std::string path)
 		}
 		else
 		{
-			std::cout << "Unexpected record: " << form << std::endl;
-			exit(0);
+			std::ostringstream msg;
+			msg << "Unexpected record: " << form;
+			base::fail(file, form, msg.str());
 		}
 	}
 
 	if (swtsSize == total)
 	{
-		std::cout << "Finished reading SWTS" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading SWTS" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading SWTS" << std::endl;
-		std::cout << "Read " << total << " out of " << swtsSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading SWTS" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << swtsSize
 			<< std::endl;
 	}
 
@@ -114,38 +119,39 @@ unsigned int swts::readDTST(std::istream& file)
 
 	std::size_t total = readFormHeader(file, "DTST", dtstSize);
 	dtstSize += 8; // Add size of FORM and size fields.
-	std::cout << "Found FORM " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found FORM " << type << std::endl;
 
 	std::size_t size;
 	total += readRecordHeader(file, type, size);
 	if (type != "0000")
 	{
-		std::cout << "Expected record of type 0000: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type 0000: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	if (size != 8)
 	{
-		std::cout << "Expected size of 8: " << size << std::endl;
+		SWG_LOG(LOG_INFO) << "Expected size of 8: " << size << std::endl;
 	}
 
 	total += base::read(file, numTextures);
 	total += base::read(file, deltaTime);
 
-	std::cout << "Num textures: " << numTextures << std::endl;
-	std::cout << "Delta time: " << deltaTime << std::endl;
+	SWG_LOG(LOG_INFO) << "Num textures: " << numTextures << std::endl;
+	SWG_LOG(LOG_INFO) << "Delta time: " << deltaTime << std::endl;
 
 	sequenceTime = deltaTime * numTextures;
 
 	if (dtstSize == total)
 	{
-		std::cout << "Finished reading DTST" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading DTST" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading DTST" << std::endl;
-		std::cout << "Read " << total << " out of " << dtstSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading DTST" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << dtstSize
 			<< std::endl;
 	}
 
@@ -159,20 +165,21 @@ unsigned int swts::readDRTS(std::istream& file)
 
 	std::size_t total = readFormHeader(file, "DRTS", dtstSize);
 	dtstSize += 8; // Add size of FORM and size fields.
-	std::cout << "Found FORM " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found FORM " << type << std::endl;
 
 	std::size_t size;
 	total += readRecordHeader(file, type, size);
 	if (type != "0000")
 	{
-		std::cout << "Expected record of type 0000: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type 0000: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	if (size != 12)
 	{
-		std::cout << "Expected size of 12: " << size << std::endl;
+		SWG_LOG(LOG_INFO) << "Expected size of 12: " << size << std::endl;
 	}
 
 	float u1;
@@ -181,20 +188,20 @@ unsigned int swts::readDRTS(std::istream& file)
 	total += base::read(file, deltaTime);
 	total += base::read(file, u1);
 
-	std::cout << "Num textures: " << numTextures << std::endl;
-	std::cout << "Delta time: " << deltaTime << std::endl;
-	std::cout << "Unknown: " << u1 << std::endl;
+	SWG_LOG(LOG_INFO) << "Num textures: " << numTextures << std::endl;
+	SWG_LOG(LOG_INFO) << "Delta time: " << deltaTime << std::endl;
+	SWG_LOG(LOG_WARNING) << "Unknown: " << u1 << std::endl;
 
 	sequenceTime = deltaTime * numTextures;
 
 	if (dtstSize == total)
 	{
-		std::cout << "Finished reading DRTS" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading DRTS" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading DRTS" << std::endl;
-		std::cout << "Read " << total << " out of " << dtstSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading DRTS" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << dtstSize
 			<< std::endl;
 	}
 
@@ -210,21 +217,22 @@ unsigned int swts::readNAME(std::istream& file)
 	nameSize += 8;
 	if (type != "NAME")
 	{
-		std::cout << "Expected record of type NAME: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type NAME: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	total += base::read(file, shaderFilename);
 
 	if (nameSize == total)
 	{
-		std::cout << "Finished reading NAME" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading NAME" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading NAME" << std::endl;
-		std::cout << "Read " << total << " out of " << nameSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading NAME" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << nameSize
 			<< std::endl;
 	}
 
@@ -240,10 +248,11 @@ unsigned int swts::readTEXT(std::istream& file)
 	textSize += 8;
 	if (type != "TEXT")
 	{
-		std::cout << "Expected record of type TEXT: " << type << std::endl;
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected record of type TEXT: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Found " << type << std::endl;
+	SWG_LOG(LOG_INFO) << "Found " << type << std::endl;
 
 	char temp[255];
 	file.read(temp, 4);
@@ -257,12 +266,12 @@ unsigned int swts::readTEXT(std::istream& file)
 
 	if (textSize == total)
 	{
-		std::cout << "Finished reading TEXT" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading TEXT" << std::endl;
 	}
 	else
 	{
-		std::cout << "FAILED in reading TEXT" << std::endl;
-		std::cout << "Read " << total << " out of " << textSize
+		SWG_LOG(LOG_ERROR) << "FAILED in reading TEXT" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Read " << total << " out of " << textSize
 			<< std::endl;
 	}
 
@@ -25,31 +25,63 @@
 
 #include <swgLib/tgen.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
 tgen::tgen() :
-	_tgenVersion(0) {
+	_tgenVersion(0),
+	_versionChunk(iffIndex::npos),
+	_loaded(LOADED_ALL) {
 }
 
 tgen::~tgen() {
 }
 
-std::size_t tgen::read(std::istream& file) {
+tgen::tgen(const tgen& other) : tgen() {
+	*this = other;
+}
+
+tgen& tgen::operator=(const tgen& other) {
+	if (this == &other) {
+		return *this;
+	}
+
+	// A decode in progress on other must not be copied half done
+	std::lock_guard<std::mutex> lock(other._loadMutex);
+
+	_tgenVersion = other._tgenVersion;
+	_shaderGroup = other._shaderGroup;
+	_floraGroup = other._floraGroup;
+	_radialGroup = other._radialGroup;
+	_environmentGroup = other._environmentGroup;
+	_fractalGroup = other._fractalGroup;
+	_layers = other._layers;
+	_index = other._index;
+	_versionChunk = other._versionChunk;
+	_loaded.store(other._loaded.load(std::memory_order_relaxed),
+		std::memory_order_relaxed);
+
+	return *this;
+}
+
+std::size_t tgen::read(iffReader& file) {
 	std::size_t tgenSize;
 	std::size_t total = base::readFormHeader(file, "TGEN", tgenSize);
 	tgenSize += 8;
-	std::cout << "Found TGEN form: " << tgenSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found TGEN form: " << tgenSize << " bytes\n";
 
 	std::size_t size;
 	std::string type;
 	total += base::readFormHeader(file, type, size);
 	_tgenVersion = base::tagToVersion(type);
 	if (0 != _tgenVersion) {
-		std::cout << "Expected type [0000]: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0000]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Terrain Generator version: " << _tgenVersion << "\n";
+	SWG_LOG(LOG_INFO) << "Terrain Generator version: " << _tgenVersion << "\n";
 
 	// Read Shader group
 	std::string form;
@@ -58,7 +90,7 @@ std::size_t tgen::read(std::istream& file) {
 		std::string form, type;
 		std::size_t size;
 		base::peekHeader(file, form, size, type);
-		std::cout << "Peek: " << form << ":" << type << "\n";
+		SWG_LOG(LOG_INFO) << "Peek: " << form << ":" << type << "\n";
 	}
 	if ("SGRP" == type) { total += _shaderGroup.read(file); }
 
@@ -87,10 +119,10 @@ std::size_t tgen::read(std::istream& file) {
 		std::size_t lyrsRead = 0;
 		std::size_t lyrsSize;
 		lyrsRead += base::readFormHeader(file, "LYRS", lyrsSize);
-		std::cout << "lyrsSize: " << lyrsSize << "\n";
+		SWG_LOG(LOG_INFO) << "lyrsSize: " << lyrsSize << "\n";
 		lyrsSize += 8;
 		while (lyrsRead < lyrsSize) {
-			std::cout << "lyrsRead: " << lyrsRead << "\n";
+			SWG_LOG(LOG_DEBUG) << "lyrsRead: " << lyrsRead << "\n";
 			tgenLayer newLayer;
 			lyrsRead += newLayer.read(file);
 			_layers.push_back(newLayer);
@@ -98,14 +130,122 @@ std::size_t tgen::read(std::istream& file) {
 		total += lyrsRead;
 	}
 
+	// Reads past the end are zero filled and still counted in total
+	if (file.fail()) {
+		base::fail(file, "TGEN", "Truncated form");
+	}
+	_loaded = LOADED_ALL;
+
 	if (tgenSize == total) {
-		std::cout << "Finished reading TGEN\n";
+		SWG_LOG(LOG_INFO) << "Finished reading TGEN\n";
 	}
 	else {
-		std::cout << "Failed in reading TGEN\n";
-		std::cout << "Read " << total << " out of " << tgenSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading TGEN: ";
+		msg << "Read " << total << " out of " << tgenSize;
+		base::fail(file, "TGEN", msg.str());
 	}
 
 	return total;
 }
+
+void tgen::clear() {
+	_shaderGroup = sgrp();
+	_floraGroup = fgrp();
+	_radialGroup = rgrp();
+	_environmentGroup = egrp();
+	_fractalGroup = mgrp();
+	_layers.clear();
+	_index.clear();
+	_versionChunk = iffIndex::npos;
+	_loaded = LOADED_ALL;
+}
+
+bool tgen::open(const iffIndex& index, const uint32_t& chunk) {
+	clear();
+
+	if (!_index.build(index, chunk) || _index.empty()) {
+		return false;
+	}
+	if (iffIndex::tagFromStr("TGEN") != _index.at(0).type) {
+		SWG_LOG(LOG_INFO) << "Expected TGEN form\n";
+		return false;
+	}
+
+	_versionChunk = _index.firstChild(0);
+	if (iffIndex::npos == _versionChunk) {
+		return false;
+	}
+	_tgenVersion = base::tagToVersion(base::tagToStr(_index.at(_versionChunk).type));
+	_loaded = 0;
+
+	return true;
+}
+
+template<typename T>
+void tgen::loadGroup(const uint32_t& flag, const char* type, T& group) const {
+	if (_loaded.load(std::memory_order_acquire) & flag) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(_loadMutex);
+	if (_loaded.load(std::memory_order_relaxed) & flag) {
+		return;
+	}
+
+	const uint32_t i = _index.findChild(_versionChunk, type);
+	if (iffIndex::npos != i) {
+		group = T();
+		iffReader reader = _index.reader(i);
+		group.read(reader);
+	}
+	_loaded.fetch_or(flag, std::memory_order_release);
+}
+
+const sgrp& tgen::getShaderGroup() const {
+	loadGroup(LOADED_SHADER_GROUP, "SGRP", _shaderGroup);
+	return _shaderGroup;
+}
+
+const fgrp& tgen::getFloraGroup() const {
+	loadGroup(LOADED_FLORA_GROUP, "FGRP", _floraGroup);
+	return _floraGroup;
+}
+
+const rgrp& tgen::getRadialGroup() const {
+	loadGroup(LOADED_RADIAL_GROUP, "RGRP", _radialGroup);
+	return _radialGroup;
+}
+
+const egrp& tgen::getEnvironmentGroup() const {
+	loadGroup(LOADED_ENVIRONMENT_GROUP, "EGRP", _environmentGroup);
+	return _environmentGroup;
+}
+
+const mgrp& tgen::getFractalGroup() const {
+	loadGroup(LOADED_FRACTAL_GROUP, "MGRP", _fractalGroup);
+	return _fractalGroup;
+}
+
+const std::vector<tgenLayer>& tgen::getLayers() const {
+	if (0 == (_loaded.load(std::memory_order_acquire) & LOADED_LAYERS)) {
+		std::lock_guard<std::mutex> lock(_loadMutex);
+		if (_loaded.load(std::memory_order_relaxed) & LOADED_LAYERS) {
+			return _layers;
+		}
+
+		_layers.clear();
+		const uint32_t lyrs = _index.findChild(_versionChunk, "LYRS");
+		if (iffIndex::npos != lyrs) {
+			for (uint32_t i = _index.firstChild(lyrs); iffIndex::npos != i;
+				i = _index.nextSibling(i)) {
+				iffReader reader = _index.reader(i);
+				tgenLayer newLayer;
+				newLayer.read(reader);
+				_layers.push_back(newLayer);
+			}
+		}
+		_loaded.fetch_or(LOADED_LAYERS, std::memory_order_release);
+	}
+	return _layers;
+}
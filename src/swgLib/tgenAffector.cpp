@@ -25,10 +25,12 @@
 
 #include <swgLib/tgenAffector.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
-bool tgenAffector::peekAffector(std::istream& file) {
+bool tgenAffector::peekAffector(iffReader& file) {
 	std::string form, type;
 	std::size_t size;
 	base::peekHeader(file, form, size, type);
@@ -60,11 +62,11 @@ bool tgenAffector::peekAffector(std::istream& file) {
 		("ARIV" == type)); // Affector River
 }
 
-std::size_t tgenAffector::read(std::istream& file) {
+std::size_t tgenAffector::read(iffReader& file) {
 	return 0;
 }
 
-std::size_t tgenAffector::read(std::istream& file, tgenAffectorPtr& affectorPtr) {
+std::size_t tgenAffector::read(iffReader& file, tgenAffectorPtr& affectorPtr) {
 	std::string form, type;
 	std::size_t size;
 	base::peekHeader(file, form, size, type);
@@ -130,7 +132,7 @@ std::size_t tgenAffector::read(std::istream& file, tgenAffectorPtr& affectorPtr)
 		}
 	}
 	else {
-		std::cout << "Expected FORM instead of record: " << type << "\n";
+		SWG_LOG(LOG_INFO) << "Expected FORM instead of record: " << type << "\n";
 		return 0;
 	}
 
@@ -146,7 +148,7 @@ affectorEnvironment::affectorEnvironment() :
 affectorEnvironment::~affectorEnvironment() {
 }
 
-std::size_t affectorEnvironment::read(std::istream& file) {
+std::size_t affectorEnvironment::read(iffReader& file) {
 	std::size_t aenvSize;
 	std::size_t total = base::readFormHeader(file, "AENV", aenvSize);
 	aenvSize += 8;
@@ -157,10 +159,11 @@ std::size_t affectorEnvironment::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 0) {
-		std::cout << "Unexpected AENV version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected AENV version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "AENV version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "AENV version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
@@ -170,9 +173,10 @@ std::size_t affectorEnvironment::read(std::istream& file) {
 	total += base::read(file, _featherClampOverride);
 
 	if (aenvSize != total) {
-		std::cout << "Failed in reading AENV\n";
-		std::cout << "Read " << total << " out of " << aenvSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading AENV: ";
+		msg << "Read " << total << " out of " << aenvSize;
+		base::fail(file, "AENV", msg.str());
 	}
 
 	return total;
@@ -187,7 +191,7 @@ affectorHeightTerrace::affectorHeightTerrace() :
 affectorHeightTerrace::~affectorHeightTerrace() {
 }
 
-std::size_t affectorHeightTerrace::read(std::istream& file) {
+std::size_t affectorHeightTerrace::read(iffReader& file) {
 	std::size_t ahtrSize;
 	std::size_t total = base::readFormHeader(file, "AHTR", ahtrSize);
 	ahtrSize += 8;
@@ -198,10 +202,11 @@ std::size_t affectorHeightTerrace::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 4) {
-		std::cout << "Unexpected AHTR version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected AHTR version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "AHTR version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "AHTR version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
@@ -218,9 +223,10 @@ std::size_t affectorHeightTerrace::read(std::istream& file) {
 	}
 
 	if (ahtrSize != total) {
-		std::cout << "Failed in reading AHTR\n";
-		std::cout << "Read " << total << " out of " << ahtrSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading AHTR: ";
+		msg << "Read " << total << " out of " << ahtrSize;
+		base::fail(file, "AHTR", msg.str());
 	}
 
 	return total;
@@ -235,7 +241,7 @@ affectorHeightConstant::affectorHeightConstant() :
 affectorHeightConstant::~affectorHeightConstant() {
 }
 
-std::size_t affectorHeightConstant::read(std::istream& file) {
+std::size_t affectorHeightConstant::read(iffReader& file) {
 	std::size_t ahcnSize;
 	std::size_t total = base::readFormHeader(file, "AHCN", ahcnSize);
 	ahcnSize += 8;
@@ -246,10 +252,11 @@ std::size_t affectorHeightConstant::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 0) {
-		std::cout << "Unexpected AHCN version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected AHCN version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "AHCN version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "AHCN version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
@@ -258,9 +265,10 @@ std::size_t affectorHeightConstant::read(std::istream& file) {
 	total += base::read(file, _height);
 
 	if (ahcnSize != total) {
-		std::cout << "Failed in reading AHCN\n";
-		std::cout << "Read " << total << " out of " << ahcnSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading AHCN: ";
+		msg << "Read " << total << " out of " << ahcnSize;
+		base::fail(file, "AHCN", msg.str());
 	}
 
 	return total;
@@ -275,7 +283,7 @@ affectorHeightFractal::affectorHeightFractal() :
 affectorHeightFractal::~affectorHeightFractal() {
 }
 
-std::size_t affectorHeightFractal::read(std::istream& file) {
+std::size_t affectorHeightFractal::read(iffReader& file) {
 	std::size_t ahfrSize;
 	std::size_t total = base::readFormHeader(file, "AHFR", ahfrSize);
 	ahfrSize += 8;
@@ -286,10 +294,11 @@ std::size_t affectorHeightFractal::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 3) {
-		std::cout << "Unexpected AHFR version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected AHFR version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Affector Height Fractal version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "Affector Height Fractal version: " << version << "\n";
 
 	switch (version) {
 	case 0: total += readV0(file); break;
@@ -299,15 +308,16 @@ std::size_t affectorHeightFractal::read(std::istream& file) {
 	}
 
 	if (ahfrSize != total) {
-		std::cout << "Failed in reading AHFR\n";
-		std::cout << "Read " << total << " out of " << ahfrSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading AHFR: ";
+		msg << "Read " << total << " out of " << ahfrSize;
+		base::fail(file, "AHFR", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorHeightFractal::readV0(std::istream& file) {
+std::size_t affectorHeightFractal::readV0(iffReader& file) {
 	std::size_t size0000;
 	std::size_t total = base::readFormHeader(file, "0000", size0000);
 	size0000 += 8;
@@ -334,15 +344,16 @@ std::size_t affectorHeightFractal::readV0(std::istream& file) {
 	_multifractal.setScale(scaleX, scaleZ);
 
 	if (size0000 != total) {
-		std::cout << "Failed in reading 0000\n";
-		std::cout << "Read " << total << " out of " << size0000 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0000: ";
+		msg << "Read " << total << " out of " << size0000;
+		base::fail(file, "0000", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorHeightFractal::readV1(std::istream& file) {
+std::size_t affectorHeightFractal::readV1(iffReader& file) {
 	std::size_t size0001;
 	std::size_t total = base::readFormHeader(file, "0001", size0001);
 	size0001 += 8;
@@ -388,15 +399,16 @@ std::size_t affectorHeightFractal::readV1(std::istream& file) {
 	_multifractal.setScale(scaleX, scaleZ);
 
 	if (size0001 != total) {
-		std::cout << "Failed in reading 0001\n";
-		std::cout << "Read " << total << " out of " << size0001 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0001: ";
+		msg << "Read " << total << " out of " << size0001;
+		base::fail(file, "0001", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorHeightFractal::readV2(std::istream& file) {
+std::size_t affectorHeightFractal::readV2(iffReader& file) {
 	std::size_t size0002;
 	std::size_t total = base::readFormHeader(file, "0002", size0002);
 	size0002 += 8;
@@ -414,15 +426,16 @@ std::size_t affectorHeightFractal::readV2(std::istream& file) {
 	total += base::read(file, _scaleVertical);
 
 	if (size0002 != total) {
-		std::cout << "Failed in reading 0002\n";
-		std::cout << "Read " << total << " out of " << size0002 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0002: ";
+		msg << "Read " << total << " out of " << size0002;
+		base::fail(file, "0002", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorHeightFractal::readV3(std::istream& file) {
+std::size_t affectorHeightFractal::readV3(iffReader& file) {
 	std::size_t size0003;
 	std::size_t total = base::readFormHeader(file, "0003", size0003);
 	size0003 += 8;
@@ -438,9 +451,10 @@ std::size_t affectorHeightFractal::readV3(std::istream& file) {
 	total += base::read(file, _scaleVertical);
 
 	if (size0003 != total) {
-		std::cout << "Failed in reading 0003\n";
-		std::cout << "Read " << total << " out of " << size0003 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0003: ";
+		msg << "Read " << total << " out of " << size0003;
+		base::fail(file, "0003", msg.str());
 	}
 
 	return total;
@@ -455,7 +469,7 @@ affectorColorConstant::affectorColorConstant() :
 affectorColorConstant::~affectorColorConstant() {
 }
 
-std::size_t affectorColorConstant::read(std::istream& file) {
+std::size_t affectorColorConstant::read(iffReader& file) {
 	std::size_t accnSize;
 	std::size_t total = base::readFormHeader(file, "ACCN", accnSize);
 	accnSize += 8;
@@ -466,10 +480,11 @@ std::size_t affectorColorConstant::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 0) {
-		std::cout << "Unexpected ACCN version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected ACCN version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "ACCN version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "ACCN version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
@@ -480,9 +495,10 @@ std::size_t affectorColorConstant::read(std::istream& file) {
 	total += base::read(file, _b);
 
 	if (accnSize != total) {
-		std::cout << "Failed in reading ACCN\n";
-		std::cout << "Read " << total << " out of " << accnSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading ACCN: ";
+		msg << "Read " << total << " out of " << accnSize;
+		base::fail(file, "ACCN", msg.str());
 	}
 
 	return total;
@@ -497,7 +513,7 @@ affectorColorRampHeight::affectorColorRampHeight() :
 affectorColorRampHeight::~affectorColorRampHeight() {
 }
 
-std::size_t affectorColorRampHeight::read(std::istream& file) {
+std::size_t affectorColorRampHeight::read(iffReader& file) {
 	std::size_t acrhSize;
 	std::size_t total = base::readFormHeader(file, "ACRH", acrhSize);
 	acrhSize += 8;
@@ -508,10 +524,11 @@ std::size_t affectorColorRampHeight::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 0) {
-		std::cout << "Unexpected ACRH version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected ACRH version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "ACRH version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "ACRH version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
@@ -522,9 +539,10 @@ std::size_t affectorColorRampHeight::read(std::istream& file) {
 	total += base::read(file, _imageName);
 
 	if (acrhSize != total) {
-		std::cout << "Failed in reading ACRH\n";
-		std::cout << "Read " << total << " out of " << acrhSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading ACRH: ";
+		msg << "Read " << total << " out of " << acrhSize;
+		base::fail(file, "ACRH", msg.str());
 	}
 
 	return total;
@@ -539,7 +557,7 @@ affectorColorFractal::affectorColorFractal() :
 affectorColorFractal::~affectorColorFractal() {
 }
 
-std::size_t affectorColorFractal::read(std::istream& file) {
+std::size_t affectorColorFractal::read(iffReader& file) {
 	std::size_t acrfSize;
 	std::size_t total = base::readFormHeader(file, "ACRF", acrfSize);
 	acrfSize += 8;
@@ -550,10 +568,11 @@ std::size_t affectorColorFractal::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 1) {
-		std::cout << "Unexpected ACRF version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected ACRF version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "ACRF version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "ACRF version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readFormHeader(file, "DATA", size);
@@ -572,9 +591,10 @@ std::size_t affectorColorFractal::read(std::istream& file) {
 	total += base::read(file, _imageName);
 
 	if (acrfSize != total) {
-		std::cout << "Failed in reading ACRF\n";
-		std::cout << "Read " << total << " out of " << acrfSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading ACRF: ";
+		msg << "Read " << total << " out of " << acrfSize;
+		base::fail(file, "ACRF", msg.str());
 	}
 
 	return total;
@@ -589,7 +609,7 @@ affectorShaderConstant::affectorShaderConstant() :
 affectorShaderConstant::~affectorShaderConstant() {
 }
 
-std::size_t affectorShaderConstant::read(std::istream& file) {
+std::size_t affectorShaderConstant::read(iffReader& file) {
 	std::size_t ascnSize;
 	std::size_t total = base::readFormHeader(file, "ASCN", ascnSize);
 	ascnSize += 8;
@@ -600,10 +620,11 @@ std::size_t affectorShaderConstant::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 1) {
-		std::cout << "Unexpected ASCN version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected ASCN version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "ASCN version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "ASCN version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
@@ -613,9 +634,10 @@ std::size_t affectorShaderConstant::read(std::istream& file) {
 	total += base::read(file, _featherClampOverride);
 
 	if (ascnSize != total) {
-		std::cout << "Failed in reading ASCN\n";
-		std::cout << "Read " << total << " out of " << ascnSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading ASCN: ";
+		msg << "Read " << total << " out of " << ascnSize;
+		base::fail(file, "ASCN", msg.str());
 	}
 
 	return total;
@@ -630,7 +652,7 @@ affectorShaderReplace::affectorShaderReplace() :
 affectorShaderReplace::~affectorShaderReplace() {
 }
 
-std::size_t affectorShaderReplace::read(std::istream& file) {
+std::size_t affectorShaderReplace::read(iffReader& file) {
 	std::size_t asrpSize;
 	std::size_t total = base::readFormHeader(file, "ASRP", asrpSize);
 	asrpSize += 8;
@@ -641,10 +663,11 @@ std::size_t affectorShaderReplace::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 1) {
-		std::cout << "Unexpected ASRP version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected ASRP version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "ASRP version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "ASRP version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
@@ -655,9 +678,10 @@ std::size_t affectorShaderReplace::read(std::istream& file) {
 	total += base::read(file, _featherClampOverride);
 
 	if (asrpSize != total) {
-		std::cout << "Failed in reading ASRP\n";
-		std::cout << "Read " << total << " out of " << asrpSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading ASRP: ";
+		msg << "Read " << total << " out of " << asrpSize;
+		base::fail(file, "ASRP", msg.str());
 	}
 
 	return total;
@@ -673,14 +697,15 @@ affectorFloraSCC::affectorFloraSCC() :
 affectorFloraSCC::~affectorFloraSCC() {
 }
 
-std::size_t affectorFloraSCC::read(std::istream& file) {
+std::size_t affectorFloraSCC::read(iffReader& file) {
 	std::size_t fsccSize;
 	std::string fsccType;
 	std::size_t total = base::readFormHeader(file, fsccType, fsccSize);
 	fsccSize += 8;
 	if (("AFCN" != fsccType) && ("AFSC" != fsccType)) {
-		std::cout << "Expected types AFCN or AFSC. Found type: " << fsccType << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected types AFCN or AFSC. Found type: " << fsccType;
+		base::fail(file, "AFCN", msg.str());
 	}
 
 	std::size_t size;
@@ -689,10 +714,11 @@ std::size_t affectorFloraSCC::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 4) {
-		std::cout << "Unexpected AFCN or AFSC version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected AFCN or AFSC version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "AFCN version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "AFCN version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
@@ -718,9 +744,10 @@ std::size_t affectorFloraSCC::read(std::istream& file) {
 	}
 
 	if (fsccSize != total) {
-		std::cout << "Failed in reading AFCN or AFSC\n";
-		std::cout << "Read " << total << " out of " << fsccSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading AFCN or AFSC: ";
+		msg << "Read " << total << " out of " << fsccSize;
+		base::fail(file, "AFCN", msg.str());
 	}
 
 	return total;
@@ -736,7 +763,7 @@ affectorFloraSNCC::affectorFloraSNCC() :
 affectorFloraSNCC::~affectorFloraSNCC() {
 }
 
-std::size_t affectorFloraSNCC::read(std::istream& file) {
+std::size_t affectorFloraSNCC::read(iffReader& file) {
 	std::size_t afsnSize;
 	std::size_t total = base::readFormHeader(file, "AFSN", afsnSize);
 	afsnSize += 8;
@@ -747,10 +774,11 @@ std::size_t affectorFloraSNCC::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 4) {
-		std::cout << "Unexpected AFSN version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected AFSN version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "AFSN version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "AFSN version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
@@ -776,9 +804,10 @@ std::size_t affectorFloraSNCC::read(std::istream& file) {
 	}
 
 	if (afsnSize != total) {
-		std::cout << "Failed in reading AFSN\n";
-		std::cout << "Read " << total << " out of " << afsnSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading AFSN: ";
+		msg << "Read " << total << " out of " << afsnSize;
+		base::fail(file, "AFSN", msg.str());
 	}
 
 	return total;
@@ -794,14 +823,15 @@ affectorFDNC::affectorFDNC() :
 affectorFDNC::~affectorFDNC() {
 }
 
-std::size_t affectorFDNC::read(std::istream& file) {
+std::size_t affectorFDNC::read(iffReader& file) {
 	std::string fdncType;
 	std::size_t fdncSize;
 	std::size_t total = base::readFormHeader(file, fdncType, fdncSize);
 	fdncSize += 8;
 	if (("ARCN" != fdncType) && ("AFDN" != fdncType)) {
-		std::cout << "Expected types ARCN or AFDN. Found type: " << fdncType << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected types ARCN or AFDN. Found type: " << fdncType;
+		base::fail(file, "ARCN", msg.str());
 	}
 
 	std::size_t size;
@@ -810,10 +840,11 @@ std::size_t affectorFDNC::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 3) {
-		std::cout << "Unexpected ARCN or AFDN version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected ARCN or AFDN version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "ARCN/AFDN version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "ARCN/AFDN version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
@@ -831,9 +862,10 @@ std::size_t affectorFDNC::read(std::istream& file) {
 	}
 
 	if (fdncSize != total) {
-		std::cout << "Failed in reading ARCN or AFDN\n";
-		std::cout << "Read " << total << " out of " << fdncSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading ARCN or AFDN: ";
+		msg << "Read " << total << " out of " << fdncSize;
+		base::fail(file, "ARCN", msg.str());
 	}
 
 	return total;
@@ -849,7 +881,7 @@ affectorFDFC::affectorFDFC() :
 affectorFDFC::~affectorFDFC() {
 }
 
-std::size_t affectorFDFC::read(std::istream& file) {
+std::size_t affectorFDFC::read(iffReader& file) {
 	std::size_t afdfSize;
 	std::size_t total = base::readFormHeader(file, "AFDF", afdfSize);
 	afdfSize += 8;
@@ -860,10 +892,11 @@ std::size_t affectorFDFC::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 3) {
-		std::cout << "Unexpected AFDF version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected AFDF version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "AFDF version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "AFDF version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
@@ -881,9 +914,10 @@ std::size_t affectorFDFC::read(std::istream& file) {
 	}
 
 	if (afdfSize != total) {
-		std::cout << "Failed in reading AFDF\n";
-		std::cout << "Read " << total << " out of " << afdfSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading AFDF: ";
+		msg << "Read " << total << " out of " << afdfSize;
+		base::fail(file, "AFDF", msg.str());
 	}
 
 	return total;
@@ -898,7 +932,7 @@ affectorRibbon::affectorRibbon() :
 affectorRibbon::~affectorRibbon() {
 }
 
-std::size_t affectorRibbon::read(std::istream& file) {
+std::size_t affectorRibbon::read(iffReader& file) {
 	std::size_t aribSize;
 	std::size_t total = base::readFormHeader(file, "ARIB", aribSize);
 	aribSize += 8;
@@ -909,10 +943,11 @@ std::size_t affectorRibbon::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 5) {
-		std::cout << "Unexpected ARIB version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected ARIB version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "ARIB version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "ARIB version: " << version << "\n";
 
 	switch (version) {
 	case 0: total += readV0(file); break;
@@ -924,15 +959,16 @@ std::size_t affectorRibbon::read(std::istream& file) {
 	}
 
 	if (aribSize != total) {
-		std::cout << "Failed in reading ARIB\n";
-		std::cout << "Read " << total << " out of " << aribSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading ARIB: ";
+		msg << "Read " << total << " out of " << aribSize;
+		base::fail(file, "ARIB", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorRibbon::readV0(std::istream& file) {
+std::size_t affectorRibbon::readV0(iffReader& file) {
 
 	std::size_t size0000;
 	std::size_t total = base::readFormHeader(file, "0000", size0000);
@@ -965,15 +1001,16 @@ std::size_t affectorRibbon::readV0(std::istream& file) {
 	total += base::read(file, _waterShaderName);
 
 	if (size0000 != total) {
-		std::cout << "Failed in reading 0000\n";
-		std::cout << "Read " << total << " out of " << size0000 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0000: ";
+		msg << "Read " << total << " out of " << size0000;
+		base::fail(file, "0000", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorRibbon::readV1(std::istream& file) {
+std::size_t affectorRibbon::readV1(iffReader& file) {
 
 	std::size_t size0001;
 	std::size_t total = base::readFormHeader(file, "0001", size0001);
@@ -1006,15 +1043,16 @@ std::size_t affectorRibbon::readV1(std::istream& file) {
 	total += base::read(file, _waterShaderName);
 
 	if (size0001 != total) {
-		std::cout << "Failed in reading 0001\n";
-		std::cout << "Read " << total << " out of " << size0001 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0001: ";
+		msg << "Read " << total << " out of " << size0001;
+		base::fail(file, "0001", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorRibbon::readV2(std::istream& file) {
+std::size_t affectorRibbon::readV2(iffReader& file) {
 
 	std::size_t size0002;
 	std::size_t total = base::readFormHeader(file, "0002", size0002);
@@ -1048,15 +1086,16 @@ std::size_t affectorRibbon::readV2(std::istream& file) {
 	total += base::read(file, _waterType);
 
 	if (size0002 != total) {
-		std::cout << "Failed in reading 0002\n";
-		std::cout << "Read " << total << " out of " << size0002 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0002: ";
+		msg << "Read " << total << " out of " << size0002;
+		base::fail(file, "0002", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorRibbon::readV3(std::istream& file) {
+std::size_t affectorRibbon::readV3(iffReader& file) {
 
 	std::size_t size0003;
 	std::size_t total = base::readFormHeader(file, "0003", size0003);
@@ -1086,15 +1125,16 @@ std::size_t affectorRibbon::readV3(std::istream& file) {
 	total += base::read(file, _waterType);
 
 	if (size0003 != total) {
-		std::cout << "Failed in reading 0003\n";
-		std::cout << "Read " << total << " out of " << size0003 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0003: ";
+		msg << "Read " << total << " out of " << size0003;
+		base::fail(file, "0003", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorRibbon::readV4(std::istream& file) {
+std::size_t affectorRibbon::readV4(iffReader& file) {
 
 	std::size_t size0004;
 	std::size_t total = base::readFormHeader(file, "0004", size0004);
@@ -1123,15 +1163,16 @@ std::size_t affectorRibbon::readV4(std::istream& file) {
 	total += base::read(file, _waterType);
 
 	if (size0004 != total) {
-		std::cout << "Failed in reading 0004\n";
-		std::cout << "Read " << total << " out of " << size0004 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0004: ";
+		msg << "Read " << total << " out of " << size0004;
+		base::fail(file, "0004", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorRibbon::readV5(std::istream& file) {
+std::size_t affectorRibbon::readV5(iffReader& file) {
 
 	std::size_t size0005;
 	std::size_t total = base::readFormHeader(file, "0005", size0005);
@@ -1161,9 +1202,10 @@ std::size_t affectorRibbon::readV5(std::istream& file) {
 	total += base::read(file, _waterType);
 
 	if (size0005 != total) {
-		std::cout << "Failed in reading 0005\n";
-		std::cout << "Read " << total << " out of " << size0005 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0005: ";
+		msg << "Read " << total << " out of " << size0005;
+		base::fail(file, "0005", msg.str());
 	}
 
 	return total;
@@ -1178,7 +1220,7 @@ affectorExclude::affectorExclude() :
 affectorExclude::~affectorExclude() {
 }
 
-std::size_t affectorExclude::read(std::istream& file) {
+std::size_t affectorExclude::read(iffReader& file) {
 	std::size_t aexcSize;
 	std::size_t total = base::readFormHeader(file, "AEXC", aexcSize);
 	aexcSize += 8;
@@ -1189,18 +1231,20 @@ std::size_t affectorExclude::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 0) {
-		std::cout << "Unexpected AEXC version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected AEXC version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "AEXC version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "AEXC version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
 
 	if (aexcSize != total) {
-		std::cout << "Failed in reading AEXC\n";
-		std::cout << "Read " << total << " out of " << aexcSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading AEXC: ";
+		msg << "Read " << total << " out of " << aexcSize;
+		base::fail(file, "AEXC", msg.str());
 	}
 
 	return total;
@@ -1215,7 +1259,7 @@ affectorPassable::affectorPassable() :
 affectorPassable::~affectorPassable() {
 }
 
-std::size_t affectorPassable::read(std::istream& file) {
+std::size_t affectorPassable::read(iffReader& file) {
 	std::size_t apasSize;
 	std::size_t total = base::readFormHeader(file, "APAS", apasSize);
 	apasSize += 8;
@@ -1226,10 +1270,11 @@ std::size_t affectorPassable::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 0) {
-		std::cout << "Unexpected APAS version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected APAS version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "APAS version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "APAS version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
@@ -1237,9 +1282,10 @@ std::size_t affectorPassable::read(std::istream& file) {
 	total += base::read(file, _featherThreshold);
 
 	if (apasSize != total) {
-		std::cout << "Failed in reading APAS\n";
-		std::cout << "Read " << total << " out of " << apasSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading APAS: ";
+		msg << "Read " << total << " out of " << apasSize;
+		base::fail(file, "APAS", msg.str());
 	}
 
 	return total;
@@ -1254,7 +1300,7 @@ affectorRoad::affectorRoad() :
 affectorRoad::~affectorRoad() {
 }
 
-std::size_t affectorRoad::read(std::istream& file) {
+std::size_t affectorRoad::read(iffReader& file) {
 	std::size_t aroaSize;
 	std::size_t total = base::readFormHeader(file, "AROA", aroaSize);
 	aroaSize += 8;
@@ -1265,10 +1311,11 @@ std::size_t affectorRoad::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 6) {
-		std::cout << "Unexpected AROA version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected AROA version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "AROA version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "AROA version: " << version << "\n";
 
 	switch (version) {
 	case 0: total += readV0(file); break;
@@ -1281,15 +1328,16 @@ std::size_t affectorRoad::read(std::istream& file) {
 	}
 
 	if (aroaSize != total) {
-		std::cout << "Failed in reading AROA\n";
-		std::cout << "Read " << total << " out of " << aroaSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading AROA: ";
+		msg << "Read " << total << " out of " << aroaSize;
+		base::fail(file, "AROA", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorRoad::readV0(std::istream& file) {
+std::size_t affectorRoad::readV0(iffReader& file) {
 
 	std::size_t size0000;
 	std::size_t total = base::readFormHeader(file, "0000", size0000);
@@ -1300,15 +1348,16 @@ std::size_t affectorRoad::readV0(std::istream& file) {
 	total += base::readRecordHeader(file, "DATA", size);
 
 	if (size0000 != total) {
-		std::cout << "Failed in reading 0000\n";
-		std::cout << "Read " << total << " out of " << size0000 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0000: ";
+		msg << "Read " << total << " out of " << size0000;
+		base::fail(file, "0000", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorRoad::readV1(std::istream& file) {
+std::size_t affectorRoad::readV1(iffReader& file) {
 
 	std::size_t size0001;
 	std::size_t total = base::readFormHeader(file, "0001", size0001);
@@ -1327,15 +1376,16 @@ std::size_t affectorRoad::readV1(std::istream& file) {
 	total += base::read(file, _width);
 
 	if (size0001 != total) {
-		std::cout << "Failed in reading 0001\n";
-		std::cout << "Read " << total << " out of " << size0001 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0001: ";
+		msg << "Read " << total << " out of " << size0001;
+		base::fail(file, "0001", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorRoad::readV2(std::istream& file) {
+std::size_t affectorRoad::readV2(iffReader& file) {
 
 	std::size_t size0002;
 	std::size_t total = base::readFormHeader(file, "0002", size0002);
@@ -1358,15 +1408,16 @@ std::size_t affectorRoad::readV2(std::istream& file) {
 	total += base::read(file, _width);
 
 	if (size0002 != total) {
-		std::cout << "Failed in reading 0002\n";
-		std::cout << "Read " << total << " out of " << size0002 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0002: ";
+		msg << "Read " << total << " out of " << size0002;
+		base::fail(file, "0002", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorRoad::readV3(std::istream& file) {
+std::size_t affectorRoad::readV3(iffReader& file) {
 
 	std::size_t size0003;
 	std::size_t total = base::readFormHeader(file, "0003", size0003);
@@ -1394,15 +1445,16 @@ std::size_t affectorRoad::readV3(std::istream& file) {
 	_featherDistanceShader = _featherDistance;
 
 	if (size0003 != total) {
-		std::cout << "Failed in reading 0003\n";
-		std::cout << "Read " << total << " out of " << size0003 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0003: ";
+		msg << "Read " << total << " out of " << size0003;
+		base::fail(file, "0003", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorRoad::readV4(std::istream& file) {
+std::size_t affectorRoad::readV4(iffReader& file) {
 
 	std::size_t size0004;
 	std::size_t total = base::readFormHeader(file, "0004", size0004);
@@ -1432,15 +1484,16 @@ std::size_t affectorRoad::readV4(std::istream& file) {
 	_featherDistanceShader = _featherDistance;
 
 	if (size0004 != total) {
-		std::cout << "Failed in reading 0004\n";
-		std::cout << "Read " << total << " out of " << size0004 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0004: ";
+		msg << "Read " << total << " out of " << size0004;
+		base::fail(file, "0004", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorRoad::readV5(std::istream& file) {
+std::size_t affectorRoad::readV5(iffReader& file) {
 
 	std::size_t size0005;
 	std::size_t total = base::readFormHeader(file, "0005", size0005);
@@ -1470,15 +1523,16 @@ std::size_t affectorRoad::readV5(std::istream& file) {
 	total += base::read(file, _featherDistanceShader);
 
 	if (size0005 != total) {
-		std::cout << "Failed in reading 0005\n";
-		std::cout << "Read " << total << " out of " << size0005 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0005: ";
+		msg << "Read " << total << " out of " << size0005;
+		base::fail(file, "0005", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorRoad::readV6(std::istream& file) {
+std::size_t affectorRoad::readV6(iffReader& file) {
 
 	std::size_t size0006;
 	std::size_t total = base::readFormHeader(file, "0006", size0006);
@@ -1515,9 +1569,10 @@ std::size_t affectorRoad::readV6(std::istream& file) {
 	int32_t temp; total += base::read(file, temp); _hasFixedHeights = (0 != temp);
 
 	if (size0006 != total) {
-		std::cout << "Failed in reading 0006\n";
-		std::cout << "Read " << total << " out of " << size0006 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0006: ";
+		msg << "Read " << total << " out of " << size0006;
+		base::fail(file, "0006", msg.str());
 	}
 
 	return total;
@@ -1532,7 +1587,7 @@ affectorRiver::affectorRiver() :
 affectorRiver::~affectorRiver() {
 }
 
-std::size_t affectorRiver::read(std::istream& file) {
+std::size_t affectorRiver::read(iffReader& file) {
 	std::size_t arivSize;
 	std::size_t total = base::readFormHeader(file, "ARIV", arivSize);
 	arivSize += 8;
@@ -1543,10 +1598,11 @@ std::size_t affectorRiver::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 6) {
-		std::cout << "Unexpected ARIV version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected ARIV version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "ARIV version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "ARIV version: " << version << "\n";
 
 	switch (version) {
 	case 0: total += readV0(file); break;
@@ -1559,15 +1615,16 @@ std::size_t affectorRiver::read(std::istream& file) {
 	}
 
 	if (arivSize != total) {
-		std::cout << "Failed in reading ARIV\n";
-		std::cout << "Read " << total << " out of " << arivSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading ARIV: ";
+		msg << "Read " << total << " out of " << arivSize;
+		base::fail(file, "ARIV", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorRiver::readV0(std::istream& file) {
+std::size_t affectorRiver::readV0(iffReader& file) {
 
 	std::size_t size0000;
 	std::size_t total = base::readFormHeader(file, "0000", size0000);
@@ -1594,15 +1651,16 @@ std::size_t affectorRiver::readV0(std::istream& file) {
 	total += base::read(file, _featherDistance);
 
 	if (size0000 != total) {
-		std::cout << "Failed in reading 0000\n";
-		std::cout << "Read " << total << " out of " << size0000 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0000: ";
+		msg << "Read " << total << " out of " << size0000;
+		base::fail(file, "0000", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorRiver::readV1(std::istream& file) {
+std::size_t affectorRiver::readV1(iffReader& file) {
 
 	std::size_t size0001;
 	std::size_t total = base::readFormHeader(file, "0001", size0001);
@@ -1635,15 +1693,16 @@ std::size_t affectorRiver::readV1(std::istream& file) {
 	total += base::read(file, _localWaterTableShaderName);
 
 	if (size0001 != total) {
-		std::cout << "Failed in reading 0001\n";
-		std::cout << "Read " << total << " out of " << size0001 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0001: ";
+		msg << "Read " << total << " out of " << size0001;
+		base::fail(file, "0001", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorRiver::readV2(std::istream& file) {
+std::size_t affectorRiver::readV2(iffReader& file) {
 
 	std::size_t size0002;
 	std::size_t total = base::readFormHeader(file, "0002", size0002);
@@ -1680,15 +1739,16 @@ std::size_t affectorRiver::readV2(std::istream& file) {
 	total += base::read(file, _localWaterTableShaderName);
 
 	if (size0002 != total) {
-		std::cout << "Failed in reading 0002\n";
-		std::cout << "Read " << total << " out of " << size0002 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0002: ";
+		msg << "Read " << total << " out of " << size0002;
+		base::fail(file, "0002", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorRiver::readV3(std::istream& file) {
+std::size_t affectorRiver::readV3(iffReader& file) {
 
 	std::size_t size0003;
 	std::size_t total = base::readFormHeader(file, "0003", size0003);
@@ -1725,15 +1785,16 @@ std::size_t affectorRiver::readV3(std::istream& file) {
 	total += base::read(file, _localWaterTableShaderName);
 
 	if (size0003 != total) {
-		std::cout << "Failed in reading 0003\n";
-		std::cout << "Read " << total << " out of " << size0003 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0003: ";
+		msg << "Read " << total << " out of " << size0003;
+		base::fail(file, "0003", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorRiver::readV4(std::istream& file) {
+std::size_t affectorRiver::readV4(iffReader& file) {
 
 	std::size_t size0004;
 	std::size_t total = base::readFormHeader(file, "0004", size0004);
@@ -1772,15 +1833,16 @@ std::size_t affectorRiver::readV4(std::istream& file) {
 	total += base::read(file, _localWaterTableShaderName);
 
 	if (size0004 != total) {
-		std::cout << "Failed in reading 0004\n";
-		std::cout << "Read " << total << " out of " << size0004 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0004: ";
+		msg << "Read " << total << " out of " << size0004;
+		base::fail(file, "0004", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorRiver::readV5(std::istream& file) {
+std::size_t affectorRiver::readV5(iffReader& file) {
 
 	std::size_t size0005;
 	std::size_t total = base::readFormHeader(file, "0005", size0005);
@@ -1819,15 +1881,16 @@ std::size_t affectorRiver::readV5(std::istream& file) {
 	total += base::read(file, _localWaterTableShaderName);
 
 	if (size0005 != total) {
-		std::cout << "Failed in reading 0005\n";
-		std::cout << "Read " << total << " out of " << size0005 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0005: ";
+		msg << "Read " << total << " out of " << size0005;
+		base::fail(file, "0005", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t affectorRiver::readV6(std::istream& file) {
+std::size_t affectorRiver::readV6(iffReader& file) {
 
 	std::size_t size0006;
 	std::size_t total = base::readFormHeader(file, "0006", size0006);
@@ -1868,9 +1931,10 @@ std::size_t affectorRiver::readV6(std::istream& file) {
 	total += base::read(file, _waterType);
 
 	if (size0006 != total) {
-		std::cout << "Failed in reading 0006\n";
-		std::cout << "Read " << total << " out of " << size0006 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0006: ";
+		msg << "Read " << total << " out of " << size0006;
+		base::fail(file, "0006", msg.str());
 	}
 
 	return total;
@@ -25,6 +25,7 @@
 
 #include <swgLib/tgenBaseLayer.hpp>
 #include <swgLib/base.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -39,7 +40,7 @@ tgenBaseLayer::tgenBaseLayer() :
 tgenBaseLayer::~tgenBaseLayer() {
 }
 
-std::size_t tgenBaseLayer::read(std::istream& file) {
+std::size_t tgenBaseLayer::read(iffReader& file) {
 	std::size_t ihdrSize;
 	std::size_t total = base::readFormHeader(file, "IHDR", ihdrSize);
 	ihdrSize += 8;
@@ -49,8 +50,9 @@ std::size_t tgenBaseLayer::read(std::istream& file) {
 	total += base::readFormHeader(file, type, size);
 	uint32_t version = base::tagToVersion(type);
 	if (version > 1) {
-		std::cout << "Expected type [0000...0001]: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0000...0001]: " << type;
+		base::fail(file, type, msg.str());
 	}
 	total += base::readRecordHeader(file, "DATA", size);
 
@@ -66,9 +68,10 @@ std::size_t tgenBaseLayer::read(std::istream& file) {
 	}
 
 	if (ihdrSize != total) {
-		std::cout << "Failed in reading Base Layer\n";
-		std::cout << "Read " << total << " out of " << ihdrSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading Base Layer: ";
+		msg << "Read " << total << " out of " << ihdrSize;
+		base::fail(file, "IHDR", msg.str());
 	}
 
 	return total;
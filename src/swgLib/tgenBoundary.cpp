@@ -25,6 +25,8 @@
 
 #include <swgLib/tgenBoundary.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -37,7 +39,7 @@ tgenBoundary::tgenBoundary() :
 tgenBoundary::~tgenBoundary() {
 }
 
-bool tgenBoundary::peekBoundary(std::istream& file) {
+bool tgenBoundary::peekBoundary(iffReader& file) {
 	std::string form, type;
 	std::size_t size;
 	base::peekHeader(file, form, size, type);
@@ -50,11 +52,11 @@ bool tgenBoundary::peekBoundary(std::istream& file) {
 		("BPLN" == type));
 }
 
-std::size_t tgenBoundary::read(std::istream& file) {
+std::size_t tgenBoundary::read(iffReader& file) {
 	return 0;
 }
 
-std::size_t tgenBoundary::read(std::istream& file, tgenBoundaryPtr& boundaryPtr) {
+std::size_t tgenBoundary::read(iffReader& file, tgenBoundaryPtr& boundaryPtr) {
 	std::string form, type;
 	std::size_t size;
 	base::peekHeader(file, form, size, type);
@@ -73,7 +75,7 @@ std::size_t tgenBoundary::read(std::istream& file, tgenBoundaryPtr& boundaryPtr)
 			boundaryPtr = boundaryPolylinePtr(new ml::boundaryPolyline);
 		}
 		else {
-			std::cout << "Unknown boundary primitive: " << type << "\n";
+			SWG_LOG(LOG_WARNING) << "Unknown boundary primitive: " << type << "\n";
 			return 0;
 		}
 
@@ -82,7 +84,7 @@ std::size_t tgenBoundary::read(std::istream& file, tgenBoundaryPtr& boundaryPtr)
 		}
 	}
 	else {
-		std::cout << "Expected FORM instead of record: " << type << "\n";
+		SWG_LOG(LOG_INFO) << "Expected FORM instead of record: " << type << "\n";
 		return 0;
 	}
 
@@ -102,7 +104,7 @@ boundaryCircle::boundaryCircle() :
 boundaryCircle::~boundaryCircle() {
 }
 
-std::size_t boundaryCircle::read(std::istream& file) {
+std::size_t boundaryCircle::read(iffReader& file) {
 	std::size_t bcirSize;
 	std::size_t total = base::readFormHeader(file, "BCIR", bcirSize);
 	bcirSize += 8;
@@ -113,9 +115,9 @@ std::size_t boundaryCircle::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 2) {
-		std::cout << "Unexpected BCIR version: " << version << "\n";
+		SWG_LOG(LOG_WARNING) << "Unexpected BCIR version: " << version << "\n";
 	}
-	std::cout << "BCIR version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "BCIR version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
@@ -128,7 +130,7 @@ std::size_t boundaryCircle::read(std::istream& file) {
 	total += base::read(file, _centerNorth);
 	total += base::read(file, _radius);
 
-	std::cout
+	SWG_LOG(LOG_INFO)
 		<< "Boundary Circle:\n"
 		<< "       Center East: " << _centerEast << "\n"
 		<< "      Center North: " << _centerNorth << "\n"
@@ -137,15 +139,16 @@ std::size_t boundaryCircle::read(std::istream& file) {
 	if (2 == version) {
 		total += base::read(file, _featherFunction);
 		total += base::read(file, _featherDistance);
-		std::cout
+		SWG_LOG(LOG_INFO)
 			<< "  Feather function: " << _featherFunction << "\n"
 			<< "  Feather distance: " << _featherDistance << "\n";
 	}
 
 	if (bcirSize != total) {
-		std::cout << "Failed in reading BCIR\n";
-		std::cout << "Read " << total << " out of " << bcirSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading BCIR: ";
+		msg << "Read " << total << " out of " << bcirSize;
+		base::fail(file, "BCIR", msg.str());
 	}
 
 	return total;
@@ -169,7 +172,7 @@ boundaryRectangle::boundaryRectangle() :
 boundaryRectangle::~boundaryRectangle() {
 }
 
-std::size_t boundaryRectangle::read(std::istream& file) {
+std::size_t boundaryRectangle::read(iffReader& file) {
 	std::size_t brecSize;
 	std::size_t total = base::readFormHeader(file, "BREC", brecSize);
 	brecSize += 8;
@@ -180,9 +183,9 @@ std::size_t boundaryRectangle::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 4) {
-		std::cout << "Unexpected BREC version: " << version << "\n";
+		SWG_LOG(LOG_WARNING) << "Unexpected BREC version: " << version << "\n";
 	}
-	std::cout << "BREC version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "BREC version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
@@ -196,7 +199,7 @@ std::size_t boundaryRectangle::read(std::istream& file) {
 	total += base::read(file, _east);
 	total += base::read(file, _north);
 
-	std::cout
+	SWG_LOG(LOG_INFO)
 		<< "Boundary Rectangle:\n"
 		<< "                          West: " << _west << "\n"
 		<< "                         South: " << _south << "\n"
@@ -206,7 +209,7 @@ std::size_t boundaryRectangle::read(std::istream& file) {
 	if (version > 1) {
 		total += base::read(file, _featherFunction);
 		total += base::read(file, _featherDistance);
-		std::cout
+		SWG_LOG(LOG_INFO)
 			<< "              Feather function: " << _featherFunction << "\n"
 			<< "              Feather distance: " << _featherDistance << "\n";
 	}
@@ -219,7 +222,7 @@ std::size_t boundaryRectangle::read(std::istream& file) {
 		total += base::read(file, _localWaterTableShaderSize);
 		total += base::read(file, _localWaterTableShaderName);
 
-		std::cout
+		SWG_LOG(LOG_INFO)
 			<< "             Local water table: " << std::boolalpha << _localWaterTable << "\n"
 			<< "            Global water table: " << std::boolalpha << _localGlobalWaterTable << "\n"
 			<< "      Local water table height: " << _localWaterTableHeight << "\n"
@@ -229,14 +232,15 @@ std::size_t boundaryRectangle::read(std::istream& file) {
 
 	if (version > 3) {
 		total += base::read(file, _waterType);
-		std::cout
+		SWG_LOG(LOG_INFO)
 			<< "                    Water type: " << _waterType << "\n";
 	}
 
 	if (brecSize != total) {
-		std::cout << "Failed in reading BREC\n";
-		std::cout << "Read " << total << " out of " << brecSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading BREC: ";
+		msg << "Read " << total << " out of " << brecSize;
+		base::fail(file, "BREC", msg.str());
 	}
 
 	return total;
@@ -264,7 +268,7 @@ boundaryPolygon::boundaryPolygon() :
 boundaryPolygon::~boundaryPolygon() {
 }
 
-std::size_t boundaryPolygon::read(std::istream& file) {
+std::size_t boundaryPolygon::read(iffReader& file) {
 	std::size_t bpolSize;
 	std::size_t total = base::readFormHeader(file, "BPOL", bpolSize);
 	bpolSize += 8;
@@ -275,14 +279,14 @@ std::size_t boundaryPolygon::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 7) {
-		std::cout << "Unexpected BPOL version: " << version << "\n";
+		SWG_LOG(LOG_WARNING) << "Unexpected BPOL version: " << version << "\n";
 	}
-	std::cout << "BPOL version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "BPOL version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
 
-	std::cout
+	SWG_LOG(LOG_INFO)
 		<< "Boundary Polygon:\n";
 
 	if (version < 5) {
@@ -293,7 +297,7 @@ std::size_t boundaryPolygon::read(std::istream& file) {
 		if (version > 1) {
 			total += base::read(file, _featherFunction);
 			total += base::read(file, _featherDistance);
-			std::cout
+			SWG_LOG(LOG_INFO)
 				<< "              Feather function: " << _featherFunction << "\n"
 				<< "              Feather distance: " << _featherDistance << "\n";
 		}
@@ -302,18 +306,18 @@ std::size_t boundaryPolygon::read(std::istream& file) {
 			int32_t temp;
 			total += base::read(file, temp); _localWaterTable = (0 != temp);
 			total += base::read(file, _localWaterTableHeight);
-			std::cout
+			SWG_LOG(LOG_INFO)
 				<< "             Local water table: " << std::boolalpha << _localWaterTable << "\n"
 				<< "      Local water table height: " << _localWaterTableHeight << "\n";
 
 			if (version > 3) {
 				total += base::read(file, _localWaterTableShaderSize);
-				std::cout
+				SWG_LOG(LOG_INFO)
 					<< " Local water table shader size: " << _localWaterTableShaderSize << "\n";
 			}
 
 			total += base::read(file, _localWaterTableShaderName);
-			std::cout
+			SWG_LOG(LOG_INFO)
 				<< " Local water table shader name: " << _localWaterTableShaderName << "\n";
 		}
 
@@ -353,7 +357,7 @@ std::size_t boundaryPolygon::read(std::istream& file) {
 		}
 		total += base::read(file, _localWaterTableShaderName);
 
-		std::cout
+		SWG_LOG(LOG_INFO)
 			<< "              Feather function: " << _featherFunction << "\n"
 			<< "              Feather distance: " << _featherDistance << "\n"
 			<< "             Local water table: " << std::boolalpha << _localWaterTable << "\n"
@@ -363,9 +367,10 @@ std::size_t boundaryPolygon::read(std::istream& file) {
 	}
 
 	if (bpolSize != total) {
-		std::cout << "Failed in reading BPOL\n";
-		std::cout << "Read " << total << " out of " << bpolSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading BPOL: ";
+		msg << "Read " << total << " out of " << bpolSize;
+		base::fail(file, "BPOL", msg.str());
 	}
 
 	return total;
@@ -389,7 +394,7 @@ boundaryPolyline::boundaryPolyline() :
 boundaryPolyline::~boundaryPolyline() {
 }
 
-std::size_t boundaryPolyline::read(std::istream& file) {
+std::size_t boundaryPolyline::read(iffReader& file) {
 	std::size_t bplnSize;
 	std::size_t total = base::readFormHeader(file, "BPLN", bplnSize);
 	bplnSize += 8;
@@ -400,21 +405,21 @@ std::size_t boundaryPolyline::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 2) {
-		std::cout << "Unexpected BPLN version: " << version << "\n";
+		SWG_LOG(LOG_WARNING) << "Unexpected BPLN version: " << version << "\n";
 	}
-	std::cout << "BPLN version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "BPLN version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
 
-	std::cout
+	SWG_LOG(LOG_INFO)
 		<< "Boundary Polyline:\n";
 
 	if (0 == version) {
 		total += base::read(file, _featherFunction);
 		total += base::read(file, _featherDistance);
 		total += base::read(file, _width);
-		std::cout
+		SWG_LOG(LOG_INFO)
 			<< "              Feather function: " << _featherFunction << "\n"
 			<< "              Feather distance: " << _featherDistance << "\n"
 			<< "                         Width: " << _width << "\n";
@@ -452,16 +457,17 @@ std::size_t boundaryPolyline::read(std::istream& file) {
 			total += base::skip(file, sizeof(int32_t));
 		}
 
-		std::cout
+		SWG_LOG(LOG_INFO)
 			<< "              Feather function: " << _featherFunction << "\n"
 			<< "              Feather distance: " << _featherDistance << "\n"
 			<< "                         Width: " << _width << "\n";
 	}
 
 	if (bplnSize != total) {
-		std::cout << "Failed in reading BPLN\n";
-		std::cout << "Read " << total << " out of " << bplnSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading BPLN: ";
+		msg << "Read " << total << " out of " << bplnSize;
+		base::fail(file, "BPLN", msg.str());
 	}
 
 	return total;
@@ -25,6 +25,8 @@
 
 #include <swgLib/tgenFilter.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -34,7 +36,7 @@ tgenFilter::tgenFilter() {
 tgenFilter::~tgenFilter() {
 }
 
-bool tgenFilter::peekFilter(std::istream& file) {
+bool tgenFilter::peekFilter(iffReader& file) {
 	std::string form, type;
 	std::size_t size;
 	base::peekHeader(file, form, size, type);
@@ -47,11 +49,11 @@ bool tgenFilter::peekFilter(std::istream& file) {
 		("FSHD" == type)); // Filter Shader
 }
 
-std::size_t tgenFilter::read(std::istream& file) {
+std::size_t tgenFilter::read(iffReader& file) {
 	return 0;
 }
 
-std::size_t tgenFilter::read(std::istream& file, tgenFilterPtr& filterPtr) {
+std::size_t tgenFilter::read(iffReader& file, tgenFilterPtr& filterPtr) {
 	std::string form, type;
 	std::size_t size;
 	base::peekHeader(file, form, size, type);
@@ -78,7 +80,7 @@ std::size_t tgenFilter::read(std::istream& file, tgenFilterPtr& filterPtr) {
 		}
 	}
 	else {
-		std::cout << "Expected FORM instead of record: " << type << "\n";
+		SWG_LOG(LOG_INFO) << "Expected FORM instead of record: " << type << "\n";
 		return 0;
 	}
 
@@ -94,7 +96,7 @@ filterHeight::filterHeight() :
 filterHeight::~filterHeight() {
 }
 
-std::size_t filterHeight::read(std::istream& file) {
+std::size_t filterHeight::read(iffReader& file) {
 	std::size_t fhgtSize;
 	std::size_t total = base::readFormHeader(file, "FHGT", fhgtSize);
 	fhgtSize += 8;
@@ -105,10 +107,11 @@ std::size_t filterHeight::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 2) {
-		std::cout << "Unexpected FHGT version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected FHGT version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "FHGT version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "FHGT version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
@@ -117,7 +120,7 @@ std::size_t filterHeight::read(std::istream& file) {
 	total += base::read(file, _low);
 	total += base::read(file, _high);
 
-	std::cout
+	SWG_LOG(LOG_INFO)
 		<< "Filter Height:\n"
 		<< "               Low: " << _low << "\n"
 		<< "              High: " << _high << "\n";
@@ -125,15 +128,16 @@ std::size_t filterHeight::read(std::istream& file) {
 	if (2 == version) {
 		total += base::read(file, _featherFunction);
 		total += base::read(file, _featherDistance);
-		std::cout
+		SWG_LOG(LOG_INFO)
 			<< "  Feather Function: " << _featherFunction << "\n"
 			<< "  Feather Distance: " << _featherDistance << "\n";
 	}
 
 	if (fhgtSize != total) {
-		std::cout << "Failed in reading FHGT\n";
-		std::cout << "Read " << total << " out of " << fhgtSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading FHGT: ";
+		msg << "Read " << total << " out of " << fhgtSize;
+		base::fail(file, "FHGT", msg.str());
 	}
 
 	return total;
@@ -148,7 +152,7 @@ filterFractal::filterFractal() :
 filterFractal::~filterFractal() {
 }
 
-std::size_t filterFractal::read(std::istream& file) {
+std::size_t filterFractal::read(iffReader& file) {
 	std::size_t ffraSize;
 	std::size_t total = base::readFormHeader(file, "FFRA", ffraSize);
 	ffraSize += 8;
@@ -159,10 +163,11 @@ std::size_t filterFractal::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 5) {
-		std::cout << "Unexpected FFRA version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected FFRA version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Filter Fractal version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "Filter Fractal version: " << version << "\n";
 
 	switch (version) {
 	case 0: total += readV0(file); break;
@@ -174,15 +179,16 @@ std::size_t filterFractal::read(std::istream& file) {
 	}
 
 	if (ffraSize != total) {
-		std::cout << "Failed in reading FFRA\n";
-		std::cout << "Read " << total << " out of " << ffraSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading FFRA: ";
+		msg << "Read " << total << " out of " << ffraSize;
+		base::fail(file, "FFRA", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t filterFractal::readV0(std::istream& file) {
+std::size_t filterFractal::readV0(iffReader& file) {
 	std::size_t size0000;
 	std::size_t total = base::readFormHeader(file, "0000", size0000);
 	size0000 += 8;
@@ -209,15 +215,16 @@ std::size_t filterFractal::readV0(std::istream& file) {
 	total += base::read(file, _highLimit);
 
 	if (size0000 != total) {
-		std::cout << "Failed in reading 0000\n";
-		std::cout << "Read " << total << " out of " << size0000 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0000: ";
+		msg << "Read " << total << " out of " << size0000;
+		base::fail(file, "0000", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t filterFractal::readV1(std::istream& file) {
+std::size_t filterFractal::readV1(iffReader& file) {
 	std::size_t size0001;
 	std::size_t total = base::readFormHeader(file, "0001", size0001);
 	size0001 += 8;
@@ -264,15 +271,16 @@ std::size_t filterFractal::readV1(std::istream& file) {
 	_multifractal.setScale(scaleX, scaleZ);
 
 	if (size0001 != total) {
-		std::cout << "Failed in reading 0001\n";
-		std::cout << "Read " << total << " out of " << size0001 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0001: ";
+		msg << "Read " << total << " out of " << size0001;
+		base::fail(file, "0001", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t filterFractal::readV2(std::istream& file) {
+std::size_t filterFractal::readV2(iffReader& file) {
 	std::size_t size0002;
 	std::size_t total = base::readFormHeader(file, "0002", size0002);
 	size0002 += 8;
@@ -321,15 +329,16 @@ std::size_t filterFractal::readV2(std::istream& file) {
 	_multifractal.setScale(scaleX, scaleZ);
 
 	if (size0002 != total) {
-		std::cout << "Failed in reading 0002\n";
-		std::cout << "Read " << total << " out of " << size0002 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0002: ";
+		msg << "Read " << total << " out of " << size0002;
+		base::fail(file, "0002", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t filterFractal::readV3(std::istream& file) {
+std::size_t filterFractal::readV3(iffReader& file) {
 	std::size_t size0003;
 	std::size_t total = base::readFormHeader(file, "0003", size0003);
 	size0003 += 8;
@@ -379,15 +388,16 @@ std::size_t filterFractal::readV3(std::istream& file) {
 	_multifractal.setScale(scaleX, scaleZ);
 
 	if (size0003 != total) {
-		std::cout << "Failed in reading 0003\n";
-		std::cout << "Read " << total << " out of " << size0003 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0003: ";
+		msg << "Read " << total << " out of " << size0003;
+		base::fail(file, "0003", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t filterFractal::readV4(std::istream& file) {
+std::size_t filterFractal::readV4(iffReader& file) {
 	std::size_t size0004;
 	std::size_t total = base::readFormHeader(file, "0004", size0004);
 	size0004 += 8;
@@ -409,15 +419,16 @@ std::size_t filterFractal::readV4(std::istream& file) {
 	total += base::read(file, _scaleVertical);
 
 	if (size0004 != total) {
-		std::cout << "Failed in reading 0004\n";
-		std::cout << "Read " << total << " out of " << size0004 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0004: ";
+		msg << "Read " << total << " out of " << size0004;
+		base::fail(file, "0004", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t filterFractal::readV5(std::istream& file) {
+std::size_t filterFractal::readV5(iffReader& file) {
 	std::size_t size0005;
 	std::size_t total = base::readFormHeader(file, "0005", size0005);
 	size0005 += 8;
@@ -438,9 +449,10 @@ std::size_t filterFractal::readV5(std::istream& file) {
 	total += base::read(file, _scaleVertical);
 
 	if (size0005 != total) {
-		std::cout << "Failed in reading 0005\n";
-		std::cout << "Read " << total << " out of " << size0005 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0005: ";
+		msg << "Read " << total << " out of " << size0005;
+		base::fail(file, "0005", msg.str());
 	}
 
 	return total;
@@ -455,7 +467,7 @@ filterSlope::filterSlope() :
 filterSlope::~filterSlope() {
 }
 
-std::size_t filterSlope::read(std::istream& file) {
+std::size_t filterSlope::read(iffReader& file) {
 	std::size_t fslpSize;
 	std::size_t total = base::readFormHeader(file, "FSLP", fslpSize);
 	fslpSize += 8;
@@ -466,10 +478,11 @@ std::size_t filterSlope::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 2) {
-		std::cout << "Unexpected FSLP version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected FSLP version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "FSLP version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "FSLP version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
@@ -485,9 +498,10 @@ std::size_t filterSlope::read(std::istream& file) {
 	}
 
 	if (fslpSize != total) {
-		std::cout << "Failed in reading FSLP\n";
-		std::cout << "Read " << total << " out of " << fslpSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading FSLP: ";
+		msg << "Read " << total << " out of " << fslpSize;
+		base::fail(file, "FSLP", msg.str());
 	}
 
 	return total;
@@ -502,7 +516,7 @@ filterDirection::filterDirection() :
 filterDirection::~filterDirection() {
 }
 
-std::size_t filterDirection::read(std::istream& file) {
+std::size_t filterDirection::read(iffReader& file) {
 	std::size_t fdirSize;
 	std::size_t total = base::readFormHeader(file, "FDIR", fdirSize);
 	fdirSize += 8;
@@ -513,10 +527,11 @@ std::size_t filterDirection::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 0) {
-		std::cout << "Unexpected FDIR version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected FDIR version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "FDIR version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "FDIR version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
@@ -527,9 +542,10 @@ std::size_t filterDirection::read(std::istream& file) {
 	total += base::read(file, _featherDistance);
 
 	if (fdirSize != total) {
-		std::cout << "Failed in reading FDIR\n";
-		std::cout << "Read " << total << " out of " << fdirSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading FDIR: ";
+		msg << "Read " << total << " out of " << fdirSize;
+		base::fail(file, "FDIR", msg.str());
 	}
 
 	return total;
@@ -544,7 +560,7 @@ filterShader::filterShader() :
 filterShader::~filterShader() {
 }
 
-std::size_t filterShader::read(std::istream& file) {
+std::size_t filterShader::read(iffReader& file) {
 	std::size_t fshdSize;
 	std::size_t total = base::readFormHeader(file, "FSHD", fshdSize);
 	fshdSize += 8;
@@ -555,10 +571,11 @@ std::size_t filterShader::read(std::istream& file) {
 
 	uint32_t version = base::tagToVersion(type);
 	if (version > 0) {
-		std::cout << "Unexpected FSHD version: " << version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unexpected FSHD version: " << version;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "FSHD version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "FSHD version: " << version << "\n";
 
 	total += tgenBaseLayer::read(file);
 	total += base::readRecordHeader(file, "DATA", size);
@@ -566,9 +583,10 @@ std::size_t filterShader::read(std::istream& file) {
 	total += base::read(file, _familyId);
 
 	if (fshdSize != total) {
-		std::cout << "Failed in reading FSHD\n";
-		std::cout << "Read " << total << " out of " << fshdSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading FSHD: ";
+		msg << "Read " << total << " out of " << fshdSize;
+		base::fail(file, "FSHD", msg.str());
 	}
 
 	return total;
@@ -25,6 +25,8 @@
 
 #include <swgLib/tgenLayer.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -39,7 +41,7 @@ tgenLayer::~tgenLayer() {
 
 }
 
-std::size_t tgenLayer::read(std::istream& file) {
+std::size_t tgenLayer::read(iffReader& file) {
 	std::size_t layrSize;
 	std::size_t total = base::readFormHeader(file, "LAYR", layrSize);
 	layrSize += 8;
@@ -49,7 +51,7 @@ std::size_t tgenLayer::read(std::istream& file) {
 	base::peekHeader(file, form, size, type);
 
 	uint32_t version = base::tagToVersion(type);
-	std::cout << "LAYR version: " << version << "\n";
+	SWG_LOG(LOG_INFO) << "LAYR version: " << version << "\n";
 
 	switch (version) {
 	case 0: total += readV0(file); break;
@@ -58,23 +60,27 @@ std::size_t tgenLayer::read(std::istream& file) {
 	case 3: total += readV3(file); break;
 	case 4: total += readV4(file); break;
 	default:
-		std::cout << "Unexpected LAYR version: " << version << "\n";
-		exit(0);
+		{
+			std::ostringstream msg;
+			msg << "Unexpected LAYR version: " << version;
+			base::fail(file, type, msg.str());
+		}
 	}
 
 	if (layrSize == total) {
-		std::cout << "Finished reading LAYR\n";
+		SWG_LOG(LOG_INFO) << "Finished reading LAYR\n";
 	}
 	else {
-		std::cout << "Failed in reading LAYR\n";
-		std::cout << "Read " << total << " out of " << layrSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading LAYR: ";
+		msg << "Read " << total << " out of " << layrSize;
+		base::fail(file, "LAYR", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t tgenLayer::readACTN(std::istream& file) {
+std::size_t tgenLayer::readACTN(iffReader& file) {
 	std::size_t actnSize;
 	std::size_t total = base::readFormHeader(file, "ACTN", actnSize);
 	actnSize += 8;
@@ -90,20 +96,24 @@ std::size_t tgenLayer::readACTN(std::istream& file) {
 	case 1: total += readACTNv1(file); break;
 	case 2: total += readACTNv2(file); break;
 	default:
-		std::cout << "Unexpected ACTN version: " << version << "\n";
-		exit(0);
+		{
+			std::ostringstream msg;
+			msg << "Unexpected ACTN version: " << version;
+			base::fail(file, type, msg.str());
+		}
 	}
 
 	if (actnSize != total) {
-		std::cout << "Failed in reading ACTN\n";
-		std::cout << "Read " << total << " out of " << actnSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading ACTN: ";
+		msg << "Read " << total << " out of " << actnSize;
+		base::fail(file, "ACTN", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t tgenLayer::readV0(std::istream& file) {
+std::size_t tgenLayer::readV0(iffReader& file) {
 	std::size_t size0000;
 	std::size_t total = base::readFormHeader(file, "0000", size0000);
 	size0000 += 8;
@@ -116,15 +126,16 @@ std::size_t tgenLayer::readV0(std::istream& file) {
 	}
 
 	if (size0000 != total) {
-		std::cout << "Failed in reading 0000\n";
-		std::cout << "Read " << total << " out of " << size0000 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0000: ";
+		msg << "Read " << total << " out of " << size0000;
+		base::fail(file, "0000", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t tgenLayer::readV1(std::istream& file) {
+std::size_t tgenLayer::readV1(iffReader& file) {
 	std::size_t size0001;
 	std::size_t total = base::readFormHeader(file, "0001", size0001);
 	size0001 += 8;
@@ -165,23 +176,25 @@ std::size_t tgenLayer::readV1(std::istream& file) {
 				total += _sublayers.back().read(file);
 			}
 			else {
-				std::cout << "Unsupported layer type:" << type << "\n";
-				exit(0);
+				std::ostringstream msg;
+				msg << "Unsupported layer type:" << type;
+				base::fail(file, type, msg.str());
 			}
 		}
 
 	}
 
 	if (size0001 != total) {
-		std::cout << "Failed in reading 0001\n";
-		std::cout << "Read " << total << " out of " << size0001 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0001: ";
+		msg << "Read " << total << " out of " << size0001;
+		base::fail(file, "0001", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t tgenLayer::readV2(std::istream& file) {
+std::size_t tgenLayer::readV2(iffReader& file) {
 	std::size_t size0002;
 	std::size_t total = base::readFormHeader(file, "0002", size0002);
 	size0002 += 8;
@@ -223,22 +236,24 @@ std::size_t tgenLayer::readV2(std::istream& file) {
 				total += _sublayers.back().read(file);
 			}
 			else {
-				std::cout << "Unsupported layer type:" << type << "\n";
-				exit(0);
+				std::ostringstream msg;
+				msg << "Unsupported layer type:" << type;
+				base::fail(file, type, msg.str());
 			}
 		}
 	}
 
 	if (size0002 != total) {
-		std::cout << "Failed in reading 0002\n";
-		std::cout << "Read " << total << " out of " << size0002 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0002: ";
+		msg << "Read " << total << " out of " << size0002;
+		base::fail(file, "0002", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t tgenLayer::readV3(std::istream& file) {
+std::size_t tgenLayer::readV3(iffReader& file) {
 	std::size_t size0003;
 	std::size_t total = base::readFormHeader(file, "0003", size0003);
 	size0003 += 8;
@@ -282,22 +297,24 @@ std::size_t tgenLayer::readV3(std::istream& file) {
 				total += _sublayers.back().read(file);
 			}
 			else {
-				std::cout << "Unsupported layer type:" << type << "\n";
-				exit(0);
+				std::ostringstream msg;
+				msg << "Unsupported layer type:" << type;
+				base::fail(file, type, msg.str());
 			}
 		}
 	}
 
 	if (size0003 != total) {
-		std::cout << "Failed in reading 0003\n";
-		std::cout << "Read " << total << " out of " << size0003 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0003: ";
+		msg << "Read " << total << " out of " << size0003;
+		base::fail(file, "0003", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t tgenLayer::readV4(std::istream& file) {
+std::size_t tgenLayer::readV4(iffReader& file) {
 	std::size_t size0004;
 	std::size_t total = base::readFormHeader(file, "0004", size0004);
 	size0004 += 8;
@@ -342,22 +359,24 @@ std::size_t tgenLayer::readV4(std::istream& file) {
 				total += _sublayers.back().read(file);
 			}
 			else {
-				std::cout << "Unsupported layer type:" << type << "\n";
-				exit(0);
+				std::ostringstream msg;
+				msg << "Unsupported layer type:" << type;
+				base::fail(file, type, msg.str());
 			}
 		}
 	}
 
 	if (size0004 != total) {
-		std::cout << "Failed in reading 0004\n";
-		std::cout << "Read " << total << " out of " << size0004 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0004: ";
+		msg << "Read " << total << " out of " << size0004;
+		base::fail(file, "0004", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t tgenLayer::readACTNv0(std::istream& file) {
+std::size_t tgenLayer::readACTNv0(iffReader& file) {
 	std::size_t size0000;
 	std::size_t total = base::readFormHeader(file, "0000", size0000);
 	size0000 += 8;
@@ -392,22 +411,24 @@ std::size_t tgenLayer::readACTNv0(std::istream& file) {
 				total += _sublayers.back().read(file);
 			}
 			else {
-				std::cout << "Unsupported layer type:" << type << "\n";
-				exit(0);
+				std::ostringstream msg;
+				msg << "Unsupported layer type:" << type;
+				base::fail(file, type, msg.str());
 			}
 		}
 	}
 
 	if (size0000 != total) {
-		std::cout << "Failed in reading 0000\n";
-		std::cout << "Read " << total << " out of " << size0000 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0000: ";
+		msg << "Read " << total << " out of " << size0000;
+		base::fail(file, "0000", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t tgenLayer::readACTNv1(std::istream& file) {
+std::size_t tgenLayer::readACTNv1(iffReader& file) {
 	std::size_t size0001;
 	std::size_t total = base::readFormHeader(file, "0001", size0001);
 	size0001 += 8;
@@ -446,22 +467,24 @@ std::size_t tgenLayer::readACTNv1(std::istream& file) {
 				total += _sublayers.back().read(file);
 			}
 			else {
-				std::cout << "Unsupported layer type:" << type << "\n";
-				exit(0);
+				std::ostringstream msg;
+				msg << "Unsupported layer type:" << type;
+				base::fail(file, type, msg.str());
 			}
 		}
 	}
 
 	if (size0001 != total) {
-		std::cout << "Failed in reading 0001\n";
-		std::cout << "Read " << total << " out of " << size0001 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0001: ";
+		msg << "Read " << total << " out of " << size0001;
+		base::fail(file, "0001", msg.str());
 	}
 
 	return total;
 }
 
-std::size_t tgenLayer::readACTNv2(std::istream& file) {
+std::size_t tgenLayer::readACTNv2(iffReader& file) {
 	std::size_t size0002;
 	std::size_t total = base::readFormHeader(file, "0002", size0002);
 	size0002 += 8;
@@ -501,16 +524,18 @@ std::size_t tgenLayer::readACTNv2(std::istream& file) {
 				total += _sublayers.back().read(file);
 			}
 			else {
-				std::cout << "Unsupported layer type:" << type << "\n";
-				exit(0);
+				std::ostringstream msg;
+				msg << "Unsupported layer type:" << type;
+				base::fail(file, type, msg.str());
 			}
 		}
 	}
 
 	if (size0002 != total) {
-		std::cout << "Failed in reading 0002\n";
-		std::cout << "Read " << total << " out of " << size0002 << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading 0002: ";
+		msg << "Read " << total << " out of " << size0002;
+		base::fail(file, "0002", msg.str());
 	}
 
 	return total;
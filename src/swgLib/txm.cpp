@@ -25,6 +25,8 @@
 
 #include <swgLib/txm.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -46,37 +48,39 @@ std::size_t txm::read(std::istream& file) {
 	std::size_t txmSize;
 	std::size_t total = base::readFormHeader(file, "TXM ", txmSize);
 	txmSize += 8; // Include Form/Size from header...
-	std::cout << "Found record TXM : " << txmSize << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found record TXM : " << txmSize << " bytes\n";
 
 	std::string form, type;
 	std::size_t size;
 	base::peekHeader(file, form, size, type);
 
 	if ("0000" == type) {
-		std::cout << "TXM version: 0\n";
+		SWG_LOG(LOG_INFO) << "TXM version: 0\n";
 		total += readV0(file);
 	}
 	else if ("0001" == type) {
-		std::cout << "TXM version: 1\n";
+		SWG_LOG(LOG_INFO) << "TXM version: 1\n";
 		total += readV1(file);
 	}
 	else if ("0002" == type) {
 		total += readV2(file);
 	}
 	else {
-		std::cout << "Unhandled TXM version: " << (int)_version << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Unhandled TXM version: " << (int)_version;
+		base::fail(file, "TXM ", msg.str());
 	}
 
 	if (txmSize == total)
 	{
-		std::cout << "Finished reading txm\n";
+		SWG_LOG(LOG_INFO) << "Finished reading txm\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading txm\n";
-		std::cout << "Read " << total << " out of " << txmSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading txm: ";
+		msg << "Read " << total << " out of " << txmSize;
+		base::fail(file, "TXM ", msg.str());
 	}
 
 	return total;
@@ -88,23 +92,23 @@ std::size_t txm::readV0(std::istream& file) {
 	_version = 0;
 
 	total += base::readRecordHeader(file, "DATA", size);
-	std::cout << "Found record DATA: " << size << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found record DATA: " << size << " bytes\n";
 
 	total += base::read(file, _placeHolder);
-	std::cout << "Placeholder: " << std::boolalpha << _placeHolder << "\n";
+	SWG_LOG(LOG_INFO) << "Placeholder: " << std::boolalpha << _placeHolder << "\n";
 
 	total += base::read(file, _nameTag);
-	std::cout << "Name: " << _nameTag << "\n";
+	SWG_LOG(LOG_INFO) << "Name: " << _nameTag << "\n";
 
 	if ("ENVM" == _nameTag.str()) { _placeHolder = true; }
 
 	if (!_placeHolder) {
 		total += base::readRecordHeader(file, "NAME", size);
-		std::cout << "Found record NAME: " << size << " bytes\n";
+		SWG_LOG(LOG_INFO) << "Found record NAME: " << size << " bytes\n";
 
 		total += base::read(file, _textureName);
 		base::fixSlash(_textureName);
-		std::cout << "Texture name: " << _textureName << "\n";
+		SWG_LOG(LOG_INFO) << "Texture name: " << _textureName << "\n";
 	}
 
 	return total;
@@ -116,13 +120,13 @@ std::size_t txm::readV1(std::istream& file) {
 	_version = 1;
 
 	total += base::readRecordHeader(file, "DATA", size);
-	std::cout << "Found record DATA: " << size << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found record DATA: " << size << " bytes\n";
 
 	total += base::read(file, _nameTag);
-	std::cout << "Name: " << _nameTag << "\n";
+	SWG_LOG(LOG_INFO) << "Name: " << _nameTag << "\n";
 
 	total += base::read(file, _placeHolder);
-	std::cout << "Placeholder: " << std::boolalpha << _placeHolder << "\n";
+	SWG_LOG(LOG_INFO) << "Placeholder: " << std::boolalpha << _placeHolder << "\n";
 
 	//if ("ENVM" == _nameTag.str()) { _placeHolder = true; }
 
@@ -146,21 +150,21 @@ std::size_t txm::readV1(std::istream& file) {
 
 	_maxAnisotropy = 1;
 
-	std::cout << "U texture wrap mode: " << getWrapModeStr(_uWrapMode) << "\n";
-	std::cout << "V texture wrap mode: " << getWrapModeStr(_vWrapMode) << "\n";
-	std::cout << "W texture wrap mode: " << getWrapModeStr(_wWrapMode) << "\n";
+	SWG_LOG(LOG_INFO) << "U texture wrap mode: " << getWrapModeStr(_uWrapMode) << "\n";
+	SWG_LOG(LOG_INFO) << "V texture wrap mode: " << getWrapModeStr(_vWrapMode) << "\n";
+	SWG_LOG(LOG_INFO) << "W texture wrap mode: " << getWrapModeStr(_wWrapMode) << "\n";
 
-	std::cout << "Mip texture filter mode: " << getFilterModeStr(_mipFilterMode) << "\n";
-	std::cout << "Min texture filter mode: " << getFilterModeStr(_minFilterMode) << "\n";
-	std::cout << "Mag texture filter mode: " << getFilterModeStr(_magFilterMode) << "\n";
+	SWG_LOG(LOG_INFO) << "Mip texture filter mode: " << getFilterModeStr(_mipFilterMode) << "\n";
+	SWG_LOG(LOG_INFO) << "Min texture filter mode: " << getFilterModeStr(_minFilterMode) << "\n";
+	SWG_LOG(LOG_INFO) << "Mag texture filter mode: " << getFilterModeStr(_magFilterMode) << "\n";
 
 	if (!_placeHolder) {
 		total += base::readRecordHeader(file, "NAME", size);
-		std::cout << "Found record NAME: " << size << " bytes\n";
+		SWG_LOG(LOG_INFO) << "Found record NAME: " << size << " bytes\n";
 
 		total += base::read(file, _textureName);
 		base::fixSlash(_textureName);
-		std::cout << "Texture name: " << _textureName << "\n";
+		SWG_LOG(LOG_INFO) << "Texture name: " << _textureName << "\n";
 	}
 
 	return total;
@@ -172,13 +176,13 @@ std::size_t txm::readV2(std::istream& file) {
 	_version = 2;
 
 	total += base::readRecordHeader(file, "DATA", size);
-	std::cout << "Found record DATA: " << size << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found record DATA: " << size << " bytes\n";
 
 	total += base::read(file, _nameTag);
-	std::cout << "Name: " << _nameTag << "\n";
+	SWG_LOG(LOG_INFO) << "Name: " << _nameTag << "\n";
 
 	total += base::read(file, _placeHolder);
-	std::cout << "Placeholder: " << std::boolalpha << _placeHolder << "\n";
+	SWG_LOG(LOG_INFO) << "Placeholder: " << std::boolalpha << _placeHolder << "\n";
 
 	if ("ENVM" == _nameTag.str()) { _placeHolder = true; }
 
@@ -203,23 +207,23 @@ std::size_t txm::readV2(std::istream& file) {
 	// Read max anisotropy
 	total += base::read(file, _maxAnisotropy);
 
-	std::cout << "U texture wrap mode: " << getWrapModeStr(_uWrapMode) << "\n";
-	std::cout << "V texture wrap mode: " << getWrapModeStr(_vWrapMode) << "\n";
-	std::cout << "W texture wrap mode: " << getWrapModeStr(_wWrapMode) << "\n";
+	SWG_LOG(LOG_INFO) << "U texture wrap mode: " << getWrapModeStr(_uWrapMode) << "\n";
+	SWG_LOG(LOG_INFO) << "V texture wrap mode: " << getWrapModeStr(_vWrapMode) << "\n";
+	SWG_LOG(LOG_INFO) << "W texture wrap mode: " << getWrapModeStr(_wWrapMode) << "\n";
 
-	std::cout << "Mip texture filter mode: " << getFilterModeStr(_mipFilterMode) << "\n";
-	std::cout << "Min texture filter mode: " << getFilterModeStr(_minFilterMode) << "\n";
-	std::cout << "Mag texture filter mode: " << getFilterModeStr(_magFilterMode) << "\n";
+	SWG_LOG(LOG_INFO) << "Mip texture filter mode: " << getFilterModeStr(_mipFilterMode) << "\n";
+	SWG_LOG(LOG_INFO) << "Min texture filter mode: " << getFilterModeStr(_minFilterMode) << "\n";
+	SWG_LOG(LOG_INFO) << "Mag texture filter mode: " << getFilterModeStr(_magFilterMode) << "\n";
 
-	std::cout << "Max anisotrophy: " << (int)_maxAnisotropy << "\n";
+	SWG_LOG(LOG_INFO) << "Max anisotrophy: " << (int)_maxAnisotropy << "\n";
 
 	if (!_placeHolder) {
 		total += base::readRecordHeader(file, "NAME", size);
-		std::cout << "Found record NAME: " << size << " bytes\n";
+		SWG_LOG(LOG_INFO) << "Found record NAME: " << size << " bytes\n";
 
 		total += base::read(file, _textureName);
 		base::fixSlash(_textureName);
-		std::cout << "Texture name: " << _textureName << "\n";
+		SWG_LOG(LOG_INFO) << "Texture name: " << _textureName << "\n";
 	}
 
 	return total;
@@ -26,8 +26,10 @@
 #include <swgLib/vtxa.hpp>
 #include <swgLib/vertex.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 
 #include <bitset>
+#include <sstream>
 
 using namespace ml;
 
@@ -47,7 +49,7 @@ std::size_t vtxa::read(std::istream& file) {
 	total += base::readFormHeader(file, type, size);
 
 	uint8_t version = base::tagToVersion(type);
-	std::cout << "VTXA version: " << (int)version << "\n";
+	SWG_LOG(LOG_INFO) << "VTXA version: " << (int)version << "\n";
 
 	total += base::readRecordHeader(file, "INFO", size);
 
@@ -66,10 +68,10 @@ std::size_t vtxa::read(std::istream& file) {
 	}
 
 	total += base::readRecordHeader(file, "DATA", size);
-	std::cout << "Num vertices: " << _numVertices << "\n";
-	std::cout << "Data size: " << size << "\n";
+	SWG_LOG(LOG_INFO) << "Num vertices: " << _numVertices << "\n";
+	SWG_LOG(LOG_INFO) << "Data size: " << size << "\n";
 	_bytesPerVertex = uint32_t(size / _numVertices);
-	std::cout << "Bytes per vertex: " << _bytesPerVertex << "\n";
+	SWG_LOG(LOG_INFO) << "Bytes per vertex: " << _bytesPerVertex << "\n";
 
 	// Read all raw vertex data into an array...
 	_vertexData.resize(size);
@@ -78,13 +80,14 @@ std::size_t vtxa::read(std::istream& file) {
 
 	if (total == vtxaSize)
 	{
-		std::cout << "Finished reading VTXA.\n";
+		SWG_LOG(LOG_INFO) << "Finished reading VTXA.\n";
 	}
 	else
 	{
-		std::cout << "Error reading VTXA!\n";
-		std::cout << "Read " << total << " out of " << vtxaSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Error reading VTXA!: ";
+		msg << "Read " << total << " out of " << vtxaSize;
+		base::fail(file, "VTXA", msg.str());
 	}
 	return total;
 }
@@ -162,8 +165,8 @@ void vtxa::processD3DFVF(uint32_t& codes, uint32_t& numTex)
 
 	std::bitset <32> bs(codes);
 
-	std::cout << "D3D Flexible Vertex Format Bits: ";
-	std::cout << bs << "\n";
+	SWG_LOG(LOG_INFO) << "D3D Flexible Vertex Format Bits: ";
+	SWG_LOG(LOG_INFO) << bs << "\n";
 
 	_hasPosition = bs.test(0);
 	_hasTransformed = bs.test(0);
@@ -176,61 +179,61 @@ void vtxa::processD3DFVF(uint32_t& codes, uint32_t& numTex)
 		_hasTexCoord[i] = (numTex > i);
 	}
 
-	std::cout << " -   Vertex has position: " << std::boolalpha << _hasPosition << "\n";
-	std::cout << " -Vertex has transformed: " << std::boolalpha << _hasTransformed << "\n";
-	std::cout << " -     Vertex has normal: " << std::boolalpha << _hasNormal << "\n";
-	std::cout << " -    Vertex has color 0: " << std::boolalpha << _hasColor0 << "\n";
-	std::cout << " -    Vertex has color 1: " << std::boolalpha << _hasColor1 << "\n";
+	SWG_LOG(LOG_INFO) << " -   Vertex has position: " << std::boolalpha << _hasPosition << "\n";
+	SWG_LOG(LOG_INFO) << " -Vertex has transformed: " << std::boolalpha << _hasTransformed << "\n";
+	SWG_LOG(LOG_INFO) << " -     Vertex has normal: " << std::boolalpha << _hasNormal << "\n";
+	SWG_LOG(LOG_INFO) << " -    Vertex has color 0: " << std::boolalpha << _hasColor0 << "\n";
+	SWG_LOG(LOG_INFO) << " -    Vertex has color 1: " << std::boolalpha << _hasColor1 << "\n";
 
 	for (unsigned int i = 0; i < 8; ++i) {
-		std::cout << " -Vertex has Tex Coord " << i << ": " << std::boolalpha << _hasTexCoord[i] << "\n";
+		SWG_LOG(LOG_DEBUG) << " -Vertex has Tex Coord " << i << ": " << std::boolalpha << _hasTexCoord[i] << "\n";
 	}
 
-	std::cout << "Tex 0 dim: " << ((codes >> 12) & 0x00000003) + 1 << "\n";
-	std::cout << "Tex 1 dim: " << ((codes >> 14) & 0x00000003) + 1 << "\n";
-	std::cout << "Tex 2 dim: " << ((codes >> 16) & 0x00000003) + 1 << "\n";
-	std::cout << "Tex 3 dim: " << ((codes >> 18) & 0x00000003) + 1 << "\n";
-	std::cout << "Tex 4 dim: " << ((codes >> 20) & 0x00000003) + 1 << "\n";
-	std::cout << "Tex 5 dim: " << ((codes >> 22) & 0x00000003) + 1 << "\n";
-	std::cout << "Tex 6 dim: " << ((codes >> 24) & 0x00000003) + 1 << "\n";
-	std::cout << "Tex 7 dim: " << ((codes >> 26) & 0x00000003) + 1 << "\n";
+	SWG_LOG(LOG_INFO) << "Tex 0 dim: " << ((codes >> 12) & 0x00000003) + 1 << "\n";
+	SWG_LOG(LOG_INFO) << "Tex 1 dim: " << ((codes >> 14) & 0x00000003) + 1 << "\n";
+	SWG_LOG(LOG_INFO) << "Tex 2 dim: " << ((codes >> 16) & 0x00000003) + 1 << "\n";
+	SWG_LOG(LOG_INFO) << "Tex 3 dim: " << ((codes >> 18) & 0x00000003) + 1 << "\n";
+	SWG_LOG(LOG_INFO) << "Tex 4 dim: " << ((codes >> 20) & 0x00000003) + 1 << "\n";
+	SWG_LOG(LOG_INFO) << "Tex 5 dim: " << ((codes >> 22) & 0x00000003) + 1 << "\n";
+	SWG_LOG(LOG_INFO) << "Tex 6 dim: " << ((codes >> 24) & 0x00000003) + 1 << "\n";
+	SWG_LOG(LOG_INFO) << "Tex 7 dim: " << ((codes >> 26) & 0x00000003) + 1 << "\n";
 
 	switch (codes & D3DFVF_TEXCOUNT_MASK)
 	{
 	case D3DFVF_TEX0:
-		std::cout << " -Vertex format includes no tex coords.\n";
+		SWG_LOG(LOG_INFO) << " -Vertex format includes no tex coords.\n";
 		break;
 
 	case D3DFVF_TEX1:
-		std::cout << " -Vertex format includes 1 set of tex coords.\n";
+		SWG_LOG(LOG_INFO) << " -Vertex format includes 1 set of tex coords.\n";
 		break;
 
 	case D3DFVF_TEX2:
-		std::cout << " -Vertex format includes 2 sets of tex coords.\n";
+		SWG_LOG(LOG_INFO) << " -Vertex format includes 2 sets of tex coords.\n";
 		break;
 
 	case D3DFVF_TEX3:
-		std::cout << " -Vertex format includes 3 sets of tex coords.\n";
+		SWG_LOG(LOG_INFO) << " -Vertex format includes 3 sets of tex coords.\n";
 		break;
 
 	case D3DFVF_TEX4:
-		std::cout << " -Vertex format includes 4 sets of tex coords.\n";
+		SWG_LOG(LOG_INFO) << " -Vertex format includes 4 sets of tex coords.\n";
 		break;
 
 	case D3DFVF_TEX5:
-		std::cout << " -Vertex format includes 5 sets of tex coords.\n";
+		SWG_LOG(LOG_INFO) << " -Vertex format includes 5 sets of tex coords.\n";
 		break;
 
 	case D3DFVF_TEX6:
-		std::cout << " -Vertex format includes 6 sets of tex coords.\n";
+		SWG_LOG(LOG_INFO) << " -Vertex format includes 6 sets of tex coords.\n";
 		break;
 
 	case D3DFVF_TEX7:
-		std::cout << " -Vertex format includes 7 sets of tex coords.\n";
+		SWG_LOG(LOG_INFO) << " -Vertex format includes 7 sets of tex coords.\n";
 		break;
 
 	case D3DFVF_TEX8:
-		std::cout << " -Vertex format includes 8 sets of tex coords.\n";
+		SWG_LOG(LOG_INFO) << " -Vertex format includes 8 sets of tex coords.\n";
 		break;
 	}
 
@@ -24,6 +24,7 @@
 */
 
 #include <swgLib/ws.hpp>
+#include <swgLib/logger.hpp>
 
 #include <cstdlib>
 #include <iostream>
@@ -41,41 +42,104 @@ ws::ws() :
 ws::~ws() {
 }
 
-std::size_t ws::read(std::istream& file)
+template<typename S>
+static std::size_t readWSHeader(S& file, std::size_t& wsSize)
 {
-	std::size_t wsSize;
 	std::size_t total = base::readFormHeader(file, "WSNP", wsSize);
 	wsSize += 8;
 
 	std::size_t size;
 	total += base::readFormHeader(file, "0001", size);
-	_version = 1;
 
-	total += readNODS(file);
-	total += readOTNL(file);
+	return total;
+}
 
-	for (auto& n : _nodes) {
-		n.setObjectFilename(this->getName(n.getObjectNameIndex()));
-		n.print(std::cout);
+template<typename S>
+static void checkWSSize(S& file, const std::size_t& total, const std::size_t& wsSize)
+{
+	if (wsSize == total)
+	{
+		SWG_LOG(LOG_INFO) << "Finished reading WS\n";
 	}
+	else
+	{
+		std::ostringstream msg;
+		msg << "FAILED in reading WS: "
+			<< "Read " << total << " out of " << wsSize;
+		base::fail(file, "WSNP", msg.str());
+	}
+}
 
-	std::cout << "Num nodes: " << _nodes.size() << "\n";
-	std::cout << "Num names: " << _names.size() << "\n";
+std::size_t ws::read(std::istream& file)
+{
+	// Headers come from the stream and NODS and OTNL are loaded one at a
+	// time. A NODE form nests its children, so NODS is the smallest unit.
+	std::size_t wsSize;
+	std::size_t total = readWSHeader(file, wsSize);
+	_version = 1;
 
-	if (wsSize == total)
+	iffReader reader;
+	if (!reader.load(file))
 	{
-		std::cout << "Finished reading WS\n";
+		base::fail(file, "NODS", "Truncated form");
 	}
-	else
+	total += readNODS(reader);
+	if (reader.fail())
+	{
+		base::fail(file, "NODS", "Truncated form");
+	}
+
+	if (!reader.load(file))
+	{
+		base::fail(file, "OTNL", "Truncated record");
+	}
+	total += readOTNL(reader);
+	if (reader.fail())
 	{
-		std::cout << "FAILED in reading WS\n"
-			<< "Read " << total << " out of " << wsSize << "\n";
-		exit(0);
+		base::fail(file, "OTNL", "Truncated record");
 	}
 
+	linkNodes();
+	checkWSSize(file, total, wsSize);
+
+	return total;
+}
+
+std::size_t ws::read(iffReader& file)
+{
+	std::size_t wsSize;
+	std::size_t total = readWSHeader(file, wsSize);
+	_version = 1;
+
+	total += readNODS(file);
+	total += readOTNL(file);
+
+	// Reads past the end are zero filled and still counted in total
+	if (file.fail())
+	{
+		base::fail(file, "WSNP", "Truncated form");
+	}
+
+	linkNodes();
+	checkWSSize(file, total, wsSize);
+
 	return total;
 }
 
+void ws::linkNodes()
+{
+	for (auto& n : _nodes) {
+		n.setObjectFilename(this->getName(n.getObjectNameIndex()));
+		if (logger::enabled(logger::LOG_DEBUG))
+		{
+			n.print(logger::stream(logger::LOG_DEBUG));
+		}
+	}
+
+	SWG_LOG(LOG_INFO) << "Num nodes: " << _nodes.size() << "\n";
+	SWG_LOG(LOG_INFO) << "Num names: " << _names.size() << "\n";
+}
+
 #if 0
 std::size_t ws::create(std::ofstream& outfile)
 {
@@ -244,13 +308,13 @@ std::size_t ws::writeNODS(std::ofstream& outfile)
 }
 #endif
 
-std::size_t ws::readNODS(std::istream& file)
+std::size_t ws::readNODS(iffReader& file)
 {
 	std::size_t nodsSize;
 	std::size_t total = base::readFormHeader(file, "NODS", nodsSize);
 	nodsSize += 8;
 #ifdef DEBUG
-	std::cout << "Found NODS form"
+	SWG_LOG(LOG_INFO) << "Found NODS form"
 		<< ": " << nodsSize - 12 << " bytes"
 		<< std::endl;
 #endif
@@ -266,20 +330,21 @@ std::size_t ws::readNODS(std::istream& file)
 	}
 
 #ifdef DEBUG
-	std::cout << "Number of nodes found: " << numNodes << std::endl;
+	SWG_LOG(LOG_INFO) << "Number of nodes found: " << numNodes << std::endl;
 #endif
 
 	if (nodsSize == total)
 	{
 #ifdef DEBUG
-		std::cout << "Finished reading NODS" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading NODS" << std::endl;
 #endif
 	}
 	else
 	{
-		std::cout << "FAILED in reading NODS\n"
-			<< "Read " << total << " out of " << nodsSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading NODS: "
+			<< "Read " << total << " out of " << nodsSize;
+		base::fail(file, "NODS", msg.str());
 	}
 
 	return total;
@@ -301,7 +366,10 @@ std::size_t ws::writeNODE(std::ofstream& outfile)
 	base::writeFormHeader(outfile, 0, "0000");
 
 	total += base::writeRecordHeader(outfile, "DATA", 52);
-	_currentNode->print(std::cout);
+	if (logger::enabled(logger::LOG_DEBUG))
+	{
+		_currentNode->print(logger::stream(logger::LOG_DEBUG));
+	}
 	total += _currentNode->write(outfile);
 	unsigned int thisLevel = _currentNode->_level;
 	++_currentNode;
@@ -334,7 +402,7 @@ std::size_t ws::writeNODE(std::ofstream& outfile)
 std::size_t ws::writeOTNL(std::ofstream& outfile)
 {
 	++maxObjectIndex;
-	std::cout << "Resizing vector to " << maxObjectIndex << std::endl;
+	SWG_LOG(LOG_INFO) << "Resizing vector to " << maxObjectIndex << std::endl;
 	_objectNames.resize(maxObjectIndex);
 	for (_currentNode = _nodes.begin(); _currentNode != _nodes.end();
 		++_currentNode)
@@ -352,7 +420,7 @@ std::size_t ws::writeOTNL(std::ofstream& outfile)
 	outfile.write((char*)&numObjects, sizeof(numObjects));
 	total += sizeof(numObjects);
 
-	std::cout << "numObjects: " << numObjects << std::endl;
+	SWG_LOG(LOG_INFO) << "numObjects: " << numObjects << std::endl;
 	for (unsigned int i = 0; i < numObjects; ++i)
 	{
 		outfile.write(
@@ -374,7 +442,7 @@ std::size_t ws::writeOTNL(std::ofstream& outfile)
 }
 #endif
 
-std::size_t ws::readOTNL(std::istream& file)
+std::size_t ws::readOTNL(iffReader& file)
 {
 	std::size_t otnlSize;
 	std::size_t total = base::readRecordHeader(file, "OTNL", otnlSize);
@@ -390,15 +458,15 @@ std::size_t ws::readOTNL(std::istream& file)
 	if (otnlSize == total)
 	{
 #ifdef DEBUG
-		std::cout << "Finished reading OTNL" << std::endl;
+		SWG_LOG(LOG_INFO) << "Finished reading OTNL" << std::endl;
 #endif
 	}
 	else
 	{
-		std::cout << "FAILED in reading OTNL\n"
-			<< "Read " << total << " out of " << otnlSize
-			<< "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading OTNL: "
+			<< "Read " << total << " out of " << otnlSize;
+		base::fail(file, "OTNL", msg.str());
 	}
 
 	return total;
@@ -412,7 +480,7 @@ ws::node::node() {
 ws::node::~node() {
 }
 
-std::size_t ws::node::read(std::istream& file)
+std::size_t ws::node::read(iffReader& file)
 {
 	std::size_t nodeSize, size;
 	std::size_t total = base::readFormHeader(file, "NODE", nodeSize);
@@ -486,7 +554,7 @@ std::size_t ws::node::write(std::ofstream& file)
 
 void ws::node::print(std::ostream& os) const
 {
-	std::cout << "Node ID: " << _nodeID << "\n"
+	os << "Node ID: " << _nodeID << "\n"
 		"Parent node ID: " << _parentNodeID << "\n"
 		"Object name index: " << _objectNameIndex << "\n"
 		"Object filename: " << _objectFilename << "\n"
@@ -25,17 +25,23 @@
 
 #include <swgLib/wsMap.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
 wsMap::wsMap() :
-	_version(0) {
+	_version(0),
+	_mapWidth(0.0f),
+	_chunkWidth(0.0f),
+	_width(0),
+	_height(0) {
 }
 
 wsMap::~wsMap() {
 }
 
-std::size_t wsMap::read(std::istream& file) {
+std::size_t wsMap::read(iffReader& file) {
 	uint32_t type;
 	std::size_t wsMapSize;
 	std::size_t total = base::readFormHeader(file, type, wsMapSize);
@@ -43,9 +49,9 @@ std::size_t wsMap::read(std::istream& file) {
 
 	_version = base::tagToVersion(type);
 	if (_version > 1) {
-		std::cout << "Unexpected version: " << _version << "\n";
+		SWG_LOG(LOG_WARNING) << "Unexpected version: " << _version << "\n";
 	}
-	std::cout << "W/S Map version: " << _version << "\n";
+	SWG_LOG(LOG_INFO) << "W/S Map version: " << _version << "\n";
 
 	if (1 == _version) {
 		total += base::readRecordHeader(file, tag::TAG_DATA);
@@ -54,12 +60,12 @@ std::size_t wsMap::read(std::istream& file) {
 		total += base::read(file, _width);
 		total += base::read(file, _height);
 
-		std::cout
+		SWG_LOG(LOG_INFO)
 			<< "  Map width: " << _mapWidth << "m\n"
 			<< "Chunk width: " << _chunkWidth << "m\n"
 			<< "      Width: " << _width << "\n"
 			<< "     Height: " << _height << "\n";
-		std::cout
+		SWG_LOG(LOG_INFO)
 			<< "Calculated data:\n"
 			<< "Chunks horizontally: " << (_mapWidth / _chunkWidth) << "\n"
 			<< "  Chunks vertically: " << (_mapWidth / _chunkWidth) << "\n";
@@ -70,7 +76,7 @@ std::size_t wsMap::read(std::istream& file) {
 			file.read((char*)_waterMap.data(), (wmapSize));
 			wmapRead += wmapSize;
 			total += wmapRead;
-			std::cout << "WmapSize: " << wmapSize << "\n";
+			SWG_LOG(LOG_INFO) << "WmapSize: " << wmapSize << "\n";
 		}
 
 		{
@@ -80,18 +86,26 @@ std::size_t wsMap::read(std::istream& file) {
 			file.read((char*)_slopeMap.data(), (smapSize));
 			smapRead += smapSize;
 			total += smapRead;
-			std::cout << "SmapSize: " << smapSize << "\n";
+			SWG_LOG(LOG_INFO) << "SmapSize: " << smapSize << "\n";
 		}
 	}
 
 	if (wsMapSize == total) {
-		std::cout << "Finished reading wsMap\n";
+		SWG_LOG(LOG_INFO) << "Finished reading wsMap\n";
 	}
 	else {
-		std::cout << "Failed in reading wsMap\n";
-		std::cout << "Read " << total << " out of " << wsMapSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Failed in reading wsMap: ";
+		msg << "Read " << total << " out of " << wsMapSize;
+		base::fail(file, base::tagToStr(type), msg.str());
 	}
 
 	return total;
 }
+
+const float& wsMap::getMapWidth() const { return _mapWidth; }
+const float& wsMap::getChunkWidth() const { return _chunkWidth; }
+const int32_t& wsMap::getWidth() const { return _width; }
+const int32_t& wsMap::getHeight() const { return _height; }
+const std::vector<uint8_t>& wsMap::getWaterMap() const { return _waterMap; }
+const std::vector<uint8_t>& wsMap::getSlopeMap() const { return _slopeMap; }
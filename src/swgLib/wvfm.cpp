@@ -24,10 +24,12 @@
 */
 #include <swgLib/wvfm.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
 
 #include <iostream>
 #include <bitset>
 #include <cstdlib>
+#include <sstream>
 
 using namespace ml;
 
@@ -49,34 +51,35 @@ std::size_t wvfm::read(std::istream& file)
 	std::size_t wvfmSize;
 	std::size_t total = base::readFormHeader(file, "WVFM", wvfmSize);
 	wvfmSize += 8;
-	std::cout << "Found WVFM: " << wvfmSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found WVFM: " << wvfmSize - 12 << " bytes\n";
 
 	std::string type;
 	std::size_t size;
 	total += base::readRecordHeader(file, type, size);
 	_version = base::tagToVersion(type);
 	if (_version > 1) {
-		std::cout << "Expected type [0000..0002]: " << type << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Expected type [0000..0002]: " << type;
+		base::fail(file, type, msg.str());
 	}
-	std::cout << "Waveform Version: " << (int)_version << "\n";
+	SWG_LOG(LOG_INFO) << "Waveform Version: " << (int)_version << "\n";
 
 	total += base::read(file, _interpolationType);
-	std::cout << "Interpolation type: " << _interpolationType << "\n";
+	SWG_LOG(LOG_INFO) << "Interpolation type: " << _interpolationType << "\n";
 
 	if (_version > 0) {
 		total += base::read(file, _sampleType);
-		std::cout << "Sample type: " << _sampleType << "\n";
+		SWG_LOG(LOG_INFO) << "Sample type: " << _sampleType << "\n";
 	}
 
 	if (_version > 1) {
 		total += base::read(file, _valueMin);
 		total += base::read(file, _valueMax);
-		std::cout << "Value range: [" << _valueMin << "..." << _valueMax << "]\n";
+		SWG_LOG(LOG_INFO) << "Value range: [" << _valueMin << "..." << _valueMax << "]\n";
 	}
 
 	total += base::read(file, _controlPointCount);
-	std::cout << "Num control points: " << _controlPointCount << "\n";
+	SWG_LOG(LOG_INFO) << "Num control points: " << _controlPointCount << "\n";
 
 	_controlPoint.resize(_controlPointCount);
 
@@ -86,7 +89,7 @@ std::size_t wvfm::read(std::istream& file)
 		total += base::read(file, cp._value);
 		total += base::read(file, cp._randomMax);
 		total += base::read(file, cp._randomMin);
-		std::cout
+		SWG_LOG(LOG_DEBUG)
 			<< "Control point " << cpNum++ << ": \n"
 			<< "       Percent: " << cp._percent << "\n"
 			<< "         Value: " << cp._value << "\n"
@@ -95,12 +98,13 @@ std::size_t wvfm::read(std::istream& file)
 	}
 
 	if (wvfmSize == total) {
-		std::cout << "Finished reading WVFM\n";
+		SWG_LOG(LOG_INFO) << "Finished reading WVFM\n";
 	}
 	else {
-		std::cout << "FAILED in reading WVFM\n"
-			<< "Read " << total << " out of " << wvfmSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading WVFM: "
+			<< "Read " << total << " out of " << wvfmSize;
+		base::fail(file, "WVFM", msg.str());
 	}
 
 	return total;
@@ -26,6 +26,8 @@
 #include <swgLib/xcyl.hpp>
 #include <swgLib/base.hpp>
 #include <swgLib/collisionUtil.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -43,31 +45,32 @@ std::size_t xcyl::read(std::istream& file) {
 	std::size_t xcylSize;
 	std::size_t total = base::readFormHeader(file, "XCYL", xcylSize);
 	xcylSize += 8;
-	std::cout << "Found FORM XCYL: " << xcylSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM XCYL: " << xcylSize - 12 << " bytes\n";
 
 	std::size_t size;
 	total += base::readFormHeader(file, "0000", size);
-	std::cout << "Found FORM 0000: " << size - 4 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM 0000: " << size - 4 << " bytes\n";
 
 	total += base::readRecordHeader(file, "CYLN", size);
 
 	total += base::read(file, _base);
 	total += base::read(file, _radius);
 	total += base::read(file, _height);
-	std::cout
+	SWG_LOG(LOG_INFO)
 		<< "Base: " << _base << "\n"
 		<< "Radius: " << _radius << "\n"
 		<< "Height: " << _height << "\n";
 
 	if (xcylSize == total)
 	{
-		std::cout << "Finished reading XCYL\n";
+		SWG_LOG(LOG_INFO) << "Finished reading XCYL\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading XCYL\n"
-			<< "Read " << total << " out of " << xcylSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading XCYL: "
+			<< "Read " << total << " out of " << xcylSize;
+		base::fail(file, "XCYL", msg.str());
 	}
 
 	return total;
@@ -26,6 +26,8 @@
 #include <swgLib/xocl.hpp>
 #include <swgLib/base.hpp>
 #include <swgLib/collisionUtil.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -44,11 +46,11 @@ std::size_t xocl::read(std::istream& file) {
 	std::size_t xoclSize;
 	std::size_t total = base::readFormHeader(file, "XOCL", xoclSize);
 	xoclSize += 8;
-	std::cout << "Found FORM XOCL: " << xoclSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM XOCL: " << xoclSize - 12 << " bytes\n";
 
 	std::size_t size;
 	total += base::readFormHeader(file, "0000", size);
-	std::cout << "Found FORM 0000: " << size - 4 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found FORM 0000: " << size - 4 << " bytes\n";
 
 	total += base::readRecordHeader(file, "OCYL", size);
 
@@ -56,7 +58,7 @@ std::size_t xocl::read(std::istream& file) {
 	total += base::read(file, _axis);
 	total += base::read(file, _radius);
 	total += base::read(file, _height);
-	std::cout
+	SWG_LOG(LOG_INFO)
 		<< "Base: " << _base << "\n"
 		<< "Axis: " << _axis << "\n"
 		<< "Radius: " << _radius << "\n"
@@ -64,13 +66,14 @@ std::size_t xocl::read(std::istream& file) {
 
 	if (xoclSize == total)
 	{
-		std::cout << "Finished reading XOCL\n";
+		SWG_LOG(LOG_INFO) << "Finished reading XOCL\n";
 	}
 	else
 	{
-		std::cout << "FAILED in reading XOCL\n"
-			<< "Read " << total << " out of " << xoclSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "FAILED in reading XOCL: "
+			<< "Read " << total << " out of " << xoclSize;
+		base::fail(file, "XOCL", msg.str());
 	}
 
 	return total;
@@ -25,6 +25,8 @@
 
 #include <swgLib/xsmp.hpp>
 #include <swgLib/base.hpp>
+#include <swgLib/logger.hpp>
+#include <sstream>
 
 using namespace ml;
 
@@ -45,7 +47,7 @@ std::size_t xsmp::read(std::istream& file) {
 	std::size_t xsmpSize;
 	std::size_t total = base::readFormHeader(file, "XSMP", xsmpSize);
 	xsmpSize += 8;
-	std::cout << "Found XSMP form: " << xsmpSize - 12 << " bytes\n";
+	SWG_LOG(LOG_INFO) << "Found XSMP form: " << xsmpSize - 12 << " bytes\n";
 
 	std::size_t size;
 	total += base::readFormHeader(file, "0000", size);
@@ -61,7 +63,7 @@ std::size_t xsmp::read(std::istream& file) {
 	total += base::read(file, _yExtent);
 	total += base::read(file, _zExtent);
 
-	std::cout << "Center: " << _center << "\n"
+	SWG_LOG(LOG_INFO) << "Center: " << _center << "\n"
 		<< "X-Axis: " << _xAxis << "\n"
 		<< "Y-Axis: " << _yAxis << "\n"
 		<< "Z-Axis: " << _zAxis << "\n"
@@ -71,13 +73,14 @@ std::size_t xsmp::read(std::istream& file) {
 
 	if (total == xsmpSize)
 	{
-		std::cout << "Finished reading XSMP.\n";
+		SWG_LOG(LOG_INFO) << "Finished reading XSMP.\n";
 	}
 	else
 	{
-		std::cout << "Error reading XSMP!\n"
-			<< "Read " << total << " out of " << xsmpSize << "\n";
-		exit(0);
+		std::ostringstream msg;
+		msg << "Error reading XSMP!: "
+			<< "Read " << total << " out of " << xsmpSize;
+		base::fail(file, "XSMP", msg.str());
 	}
 
 	return total;
@@ -24,14 +24,43 @@
 */
 
 #include <treLib/treArchive.hpp>
+#include <swgLib/logger.hpp>
 #include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <thread>
 
 treArchive::treArchive()
+	:
+	mapped(false),
+	md5Mode(treClass::MD5_OFF),
+	indexSidecar(false),
+	sortedValid(false),
+	collectStats(false),
+	statLookups(0),
+	statMisses(0),
+	traceStream(nullptr),
+	prefetchStop(false),
+	prefetchStarted(false),
+	prefetched(0)
 {
+	prefetchCurrent.tre = nullptr;
+	prefetchCurrent.index = 0;
 }
 
 treArchive::~treArchive()
 {
+	{
+		std::lock_guard<std::mutex> lock(prefetchMutex);
+		prefetchStop = true;
+	}
+	prefetchReady.notify_all();
+	if (prefetchThread.joinable())
+	{
+		prefetchThread.join();
+	}
+
+	removeAllFiles();
 }
 
 void treArchive::fixSlash(std::string& filename)
@@ -47,12 +76,18 @@ void treArchive::fixSlash(std::string& filename)
 
 bool treArchive::removeAllFiles()
 {
+	cancelPrefetch();
+
 	// Delete and pop all tre files
 	while (!treList.empty())
 	{
 		delete treList.front();
 		treList.pop_front();
 	}
+	fileIndex.clear();
+	sortedNames.clear();
+	sortedValid = false;
+	cache.clear();
 	return true;
 }
 
@@ -62,11 +97,29 @@ bool treArchive::addFile(const std::string& filename)
 	std::string correctedFilename(filename);
 	fixSlash(correctedFilename);
 
+	// Queued hints may now resolve to other records
+	cancelPrefetch();
+
 	// Else open was successful
 	treClass* newTRE = new treClass();
+	newTRE->setMD5Mode(md5Mode);
+	newTRE->setCollectStats(getCollectStats());
+	newTRE->setIndexSidecar(indexSidecar);
+	newTRE->setIndexDirectory(indexDirectory);
 	if (newTRE->readFile(correctedFilename))
 	{
+		// Keep archive mapped for its lifetime if requested...
+		if (mapped && !newTRE->mapFile())
+		{
+			delete newTRE;
+			return false;
+		}
+
 		treList.push_front(newTRE);
+		addToIndex(newTRE);
+
+		// Cached records may now be overridden
+		cache.clear();
 
 		return true;
 	}
@@ -88,6 +141,9 @@ bool treArchive::removeFile(const std::string& filename)
 	// Don't bother looking if list is empty
 	if (!treList.empty())
 	{
+		// Prefetch thread may be reading the file about to be deleted
+		cancelPrefetch();
+
 		for (std::list<treClass*>::iterator i = treList.begin();
 			i != treList.end();
 			++i
@@ -97,6 +153,11 @@ bool treArchive::removeFile(const std::string& filename)
 			{
 				delete (*i);
 				treList.erase(i);
+
+				// Names owned by this file fall back to older files
+				rebuildIndex();
+				cache.clear();
+
 				// Found and erased file
 				return true;
 			}
@@ -122,112 +183,993 @@ void treArchive::printArchiveContents(std::ostream& os) const
 }
 
 void treArchive::getArchiveContents(std::vector<std::string>& content) const {
-	// Do nothing if list is empty...
-	if (treList.empty()) { return; }
-	
-	// Loop through all tre files
-	std::vector<std::string> tempContent;
-	for (const auto& treFile : treList) {
-		// For each tre file list loop through its contents
-		for (const auto& record : treFile->getFileRecordList()) {
-			// Only add non-zero sized files...
-			if (record.getUncompressedSize() > 0) {
-				tempContent.push_back(record.getFileName());
-			}
+	// Sorted index already holds each effective name once...
+	const auto& names = getSortedNames();
+	content.reserve(content.size() + names.size());
+	for (const auto name : names) {
+		content.push_back(name->str());
+	}
+}
+
+void treArchive::getArchiveContents(const std::string& substr, std::vector<std::string>& content) const {
+	for (const auto name : getSortedNames()) {
+		// Match substring...
+		if (name->find(substr) != std::string::npos) {
+			content.push_back(name->str());
 		}
 	}
+}
 
-	// Sort vector...
-	std::sort(tempContent.begin(), tempContent.end());
+const std::vector<const treNameView*>& treArchive::getSortedNames() const
+{
+	std::lock_guard<std::mutex> lock(sortedMutex);
+	if (!sortedValid)
+	{
+		// Keys of fileIndex stay put until the file set changes
+		sortedNames.clear();
+		sortedNames.reserve(fileIndex.size());
+		for (const auto& entry : fileIndex)
+		{
+			sortedNames.push_back(&entry.first);
+		}
 
-	// Remove duplicates...
-	auto it = std::unique(tempContent.begin(), tempContent.end());
-	tempContent.resize(std::distance(tempContent.begin(), it));
+		std::sort(sortedNames.begin(), sortedNames.end(),
+			[](const treNameView* a, const treNameView* b)
+			{
+				return (*a < *b);
+			});
+		sortedValid = true;
+	}
 
-	content.insert(content.end(), tempContent.begin(), tempContent.end());
+	return sortedNames;
 }
 
-void treArchive::getArchiveContents(const std::string& substr, std::vector<std::string>& content) const {
-	// Do nothing if list is empty...
-	if (treList.empty()) { return; }
+std::vector<const treNameView*>::const_iterator
+treArchive::lowerBound(const std::string& name) const
+{
+	const auto& names = getSortedNames();
+	return std::lower_bound(names.begin(), names.end(), treNameView(name),
+		[](const treNameView* a, const treNameView& b)
+		{
+			return (*a < b);
+		});
+}
 
-	// Loop through all tre files
-	std::vector<std::string> tempContent;
-	for (const auto& treFile : treList) {
-		// For each tre file list loop through its contents
-		for (const auto& record : treFile->getFileRecordList()) {
-			// Only add non-zero sized files...
-			if (record.getUncompressedSize() > 0) {
-				// Match substring...
-				if (record.getFileName().find(substr) != std::string::npos) {
-					tempContent.push_back(record.getFileName());
-				}
+void treArchive::listPrefix(const std::string& prefix,
+	std::vector<std::string>& content) const
+{
+	std::string correctedPrefix(prefix);
+	fixSlash(correctedPrefix);
+
+	const auto end = getSortedNames().end();
+	for (auto i = lowerBound(correctedPrefix); i != end; ++i)
+	{
+		if (!(*i)->startsWith(correctedPrefix))
+		{
+			break;
+		}
+		content.push_back((*i)->str());
+	}
+}
+
+void treArchive::listGlob(const std::string& pattern,
+	std::vector<std::string>& content) const
+{
+	std::string correctedPattern(pattern);
+	fixSlash(correctedPattern);
+
+	// Only names starting with the literal part can match...
+	const std::string prefix =
+		correctedPattern.substr(0, correctedPattern.find_first_of("*?"));
+
+	const auto end = getSortedNames().end();
+	for (auto i = lowerBound(prefix); i != end; ++i)
+	{
+		if (!(*i)->startsWith(prefix))
+		{
+			break;
+		}
+		if (globMatch(correctedPattern.c_str(), (*i)->c_str()))
+		{
+			content.push_back((*i)->str());
+		}
+	}
+}
+
+void treArchive::listDirectory(const std::string& directory,
+	std::vector<std::string>& files,
+	std::vector<std::string>* subdirs) const
+{
+	std::string prefix(directory);
+	fixSlash(prefix);
+	if (!prefix.empty() && ('/' != prefix.back()))
+	{
+		prefix += '/';
+	}
+
+	const auto end = getSortedNames().end();
+	auto i = lowerBound(prefix);
+	while (i != end)
+	{
+		const treNameView& name = **i;
+		if (!name.startsWith(prefix))
+		{
+			break;
+		}
+
+		const size_t slash = name.find("/", prefix.size());
+		if (std::string::npos == slash)
+		{
+			files.push_back(name.str());
+			++i;
+			continue;
+		}
+
+		// Report the subdirectory once and jump past everything in it;
+		// '0' is the character after '/'.
+		const std::string subdir(name.data(), slash);
+		if (nullptr != subdirs)
+		{
+			subdirs->push_back(subdir.substr(prefix.size()));
+		}
+		i = lowerBound(subdir + '0');
+	}
+}
+
+bool treArchive::globMatch(const char* pattern, const char* name)
+{
+	while ('\0' != *pattern)
+	{
+		if (('*' == pattern[0]) && ('*' == pattern[1]))
+		{
+			// Any characters, including '/'
+			pattern += 2;
+			for (;; ++name)
+			{
+				if (globMatch(pattern, name)) { return true; }
+				if ('\0' == *name) { return false; }
+			}
+		}
+		else if ('*' == *pattern)
+		{
+			// Any characters inside one directory
+			++pattern;
+			for (;; ++name)
+			{
+				if (globMatch(pattern, name)) { return true; }
+				if (('\0' == *name) || ('/' == *name)) { return false; }
 			}
 		}
+		else if ('?' == *pattern)
+		{
+			if (('\0' == *name) || ('/' == *name)) { return false; }
+		}
+		else if (*pattern != *name)
+		{
+			return false;
+		}
+
+		++pattern;
+		++name;
 	}
 
-	// Sort vector...
-	std::sort(tempContent.begin(), tempContent.end());
+	return ('\0' == *name);
+}
+
+void treArchive::addToIndex(treClass* tre)
+{
+	sortedValid = false;
+
+	const std::vector<treFileRecord>& records = tre->getFileRecordList();
 
-	// Remove duplicates...
-	auto it = std::unique(tempContent.begin(), tempContent.end());
-	tempContent.resize(std::distance(tempContent.begin(), it));
+	// Walk backwards so the first record with a given name wins inside
+	// this file, while still overriding entries from older files.
+	for (uint32_t i = static_cast<uint32_t>(records.size()); i > 0; --i)
+	{
+		const treFileRecord& record = records[i - 1];
 
-	content.insert(content.end(), tempContent.begin(), tempContent.end());
+		// Zero sized records never match, see getFileRecordIndex
+		if (record.getUncompressedSize() > 0)
+		{
+			indexEntry& entry = fileIndex[record.getFileName()];
+			entry.tre = tre;
+			entry.index = i - 1;
+		}
+	}
 }
 
-bool treArchive::fileExists(const std::string& filename) const {
-	// Don't bother if list is empty
-	if (treList.empty())
+void treArchive::rebuildIndex()
+{
+	fileIndex.clear();
+	sortedNames.clear();
+	sortedValid = false;
+
+	// Oldest file is at the back of the list, newer files override it
+	for (auto i = treList.rbegin(); i != treList.rend(); ++i)
 	{
+		addToIndex(*i);
+	}
+}
+
+bool treArchive::findFile(const std::string& filename,
+	treClass*& tre,
+	uint32_t& index) const
+{
+	auto entry = fileIndex.find(treNameView(filename));
+	if (fileIndex.end() == entry)
+	{
+		return false;
+	}
+
+	tre = entry->second.tre;
+	index = entry->second.index;
+
+	return true;
+}
+
+bool treArchive::findRecord(const std::string& filename,
+	treClass*& tre,
+	uint32_t& index) const
+{
+	if (!findFile(filename, tre, index))
+	{
+		if (collectStats)
+		{
+			++statLookups;
+			++statMisses;
+		}
 		return false;
 	}
 
+	if (collectStats)
+	{
+		++statLookups;
+		tre->countLookup();
+	}
+
+	if (nullptr != traceStream)
+	{
+		std::lock_guard<std::mutex> lock(traceMutex);
+		std::ostream* os = traceStream;
+		if (nullptr == os)
+		{
+			return true;
+		}
+
+		const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now() - traceStart).count();
+		*os << micros << "\t" << tre->getFilename() << "\t"
+			<< filename << "\t"
+			<< tre->getFileRecordList()[index].getUncompressedSize() << "\n";
+	}
+
+	return true;
+}
+
+bool treArchive::fileExists(const std::string& filename) const {
 	std::string correctedFilename(filename);
 	fixSlash(correctedFilename);
 
-	unsigned int index = 0;
-	// Loop through all tre files
-	for (std::list<treClass*>::const_iterator i = treList.begin();
-		i != treList.end();
-		++i
-		)
+	const bool found =
+		(fileIndex.end() != fileIndex.find(treNameView(correctedFilename)));
+	if (collectStats)
 	{
-		// Ask each treClass to find the file
-		if ((*i)->getFileRecordIndex(correctedFilename, index) == true)
+		++statLookups;
+		if (!found)
 		{
-			return true;
+			++statMisses;
 		}
 	}
 
-	return false;
+	return found;
 }
 
-std::stringstream* treArchive::getFileStream(const std::string& filename)
+std::stringstream* treArchive::getFileStream(const std::string& filename) const
 {
-	// Don't bother if list is empty
-	if (treList.empty())
+	std::string correctedFilename(filename);
+	fixSlash(correctedFilename);
+
+	treClass* tre = nullptr;
+	uint32_t index = 0;
+	if (!findRecord(correctedFilename, tre, index))
 	{
 		return NULL;
 	}
 
+	if (cache.isEnabled())
+	{
+		std::shared_ptr<const treDataBlock> block =
+			getRecordBlock(tre, index);
+		if (!block)
+		{
+			return NULL;
+		}
+
+		std::stringstream* sstr = new std::stringstream;
+		sstr->write(block->getUncompressedDataPtr(),
+			block->getUncompressedSize());
+		return sstr;
+	}
+
+	return tre->saveRecordAsStream(index);
+}
+
+treRecordStream* treArchive::openFileStream(const std::string& filename) const
+{
 	std::string correctedFilename(filename);
 	fixSlash(correctedFilename);
 
-	unsigned int index = 0;
-	// Loop through all tre files
-	for (std::list<treClass*>::const_iterator i = treList.begin();
-		i != treList.end();
-		++i
-		)
+	treClass* tre = nullptr;
+	uint32_t index = 0;
+	if (!findRecord(correctedFilename, tre, index))
+	{
+		return NULL;
+	}
+
+	return tre->openRecordStream(index);
+}
+
+std::shared_ptr<const treDataBlock>
+treArchive::getFileBlock(const std::string& filename) const
+{
+	std::string correctedFilename(filename);
+	fixSlash(correctedFilename);
+
+	treClass* tre = nullptr;
+	uint32_t index = 0;
+	if (!findRecord(correctedFilename, tre, index))
+	{
+		return std::shared_ptr<const treDataBlock>();
+	}
+
+	return getRecordBlock(tre, index);
+}
+
+std::shared_ptr<const treDataBlock>
+treArchive::getRecordBlock(const treClass* tre, const uint32_t& index) const
+{
+	std::shared_ptr<const treDataBlock> block;
+	if (cache.isEnabled())
 	{
-		// Ask each treClass to find the file
-		if ((*i)->getFileRecordIndex(correctedFilename, index) == true)
+		// Let a prefetch of this record finish rather than repeat it
+		waitForPrefetch(tre, index);
+
+		block = cache.find(tre, index);
+		if (block)
 		{
-			// First instance of file was found, return stream
-			return ((*i)->saveRecordAsStream(index));
+			return block;
+		}
+	}
+
+	// Not cached, read outside of any lock...
+	std::shared_ptr<treDataBlock> newBlock(new treDataBlock);
+	if (!tre->readRecord(index, *newBlock))
+	{
+		return std::shared_ptr<const treDataBlock>();
+	}
+
+	if (cache.isEnabled())
+	{
+		return cache.insert(tre, index, newBlock);
+	}
+
+	return newBlock;
+}
+
+bool treArchive::getFileData(const std::string& filename,
+	treDataBlock& dataBlock) const
+{
+	std::string correctedFilename(filename);
+	fixSlash(correctedFilename);
+
+	treClass* tre = nullptr;
+	uint32_t index = 0;
+	if (!findRecord(correctedFilename, tre, index))
+	{
+		return false;
+	}
+
+	return tre->readRecord(index, dataBlock);
+}
+
+bool treArchive::setMapped(const bool m)
+{
+	cancelPrefetch();
+	mapped = m;
+
+	// Apply to archives already loaded...
+	bool rv = true;
+	for (auto& treFile : treList) {
+		if (mapped) {
+			// mapFile() logs and falls back to positional reads
+			if (!treFile->mapFile()) {
+				rv = false;
+			}
+		}
+		else {
+			treFile->unmapFile();
+		}
+	}
+
+	return rv;
+}
+
+void treArchive::setMD5Mode(const treClass::md5Modes& m)
+{
+	cancelPrefetch();
+	md5Mode = m;
+	for (auto& treFile : treList) {
+		treFile->setMD5Mode(md5Mode);
+	}
+}
+
+uint32_t treArchive::scrub(std::ostream& os, const unsigned int& threads) const
+{
+	uint32_t total = 0;
+	for (const auto& treFile : treList) {
+		std::vector<uint32_t> mismatches;
+		treFile->scrub(mismatches, threads);
+		for (const auto& i : mismatches) {
+			os << treFile->getFilename() << ": "
+				<< treFile->getFileRecordList()[i].getFileName() << "\n";
 		}
+		total += static_cast<uint32_t>(mismatches.size());
 	}
 
-	return NULL;
+	return total;
+}
+
+bool treArchive::getFileView(const std::string& filename,
+	treRecordView& view) const
+{
+	std::string correctedFilename(filename);
+	fixSlash(correctedFilename);
+
+	treClass* tre = nullptr;
+	uint32_t index = 0;
+	if (!findRecord(correctedFilename, tre, index))
+	{
+		return false;
+	}
+
+	// View is only possible if the record is uncompressed
+	return tre->getRecordView(index, view);
+}
+
+void treArchive::readFiles(const std::vector<std::string>& filenames,
+	const readCallback& callback,
+	const unsigned int& numThreads) const
+{
+	class request
+	{
+	public:
+		uint32_t index;
+		uint64_t offset;
+		uint32_t size;
+		const std::string* name;
+	};
+
+	// One read of a contiguous range of a single archive
+	class readRun
+	{
+	public:
+		const treClass* tre;
+		uint64_t start;
+		uint64_t end;
+		std::vector<request> requests;
+	};
+
+	// Group requests by archive, answer the missing ones now...
+	std::unordered_map<const treClass*, std::vector<request> > byArchive;
+	for (const auto& name : filenames)
+	{
+		std::string correctedFilename(name);
+		fixSlash(correctedFilename);
+
+		treClass* tre = nullptr;
+		uint32_t index = 0;
+		if (!findRecord(correctedFilename, tre, index))
+		{
+			callback(name, std::shared_ptr<const treDataBlock>());
+			continue;
+		}
+
+		if (cache.isEnabled())
+		{
+			std::shared_ptr<const treDataBlock> block = cache.find(tre, index);
+			if (block)
+			{
+				callback(name, block);
+				continue;
+			}
+		}
+
+		request r;
+		r.index = index;
+		r.offset = tre->getFileRecordList()[index].getOffset();
+		r.size = tre->getStoredSize(index);
+		r.name = &name;
+		byArchive[tre].push_back(r);
+	}
+
+	// Sort each archive by offset and merge neighbours into runs...
+	std::vector<readRun> runs;
+	for (auto& archive : byArchive)
+	{
+		std::vector<request>& requests = archive.second;
+		std::sort(requests.begin(), requests.end(),
+			[](const request& a, const request& b)
+			{
+				return a.offset < b.offset;
+			});
+
+		for (const auto& r : requests)
+		{
+			const uint64_t end = r.offset + r.size;
+			if (!runs.empty() && (runs.back().tre == archive.first) &&
+				(r.offset <= runs.back().end + maxReadGap) &&
+				((std::max(end, runs.back().end) - runs.back().start) <=
+					maxReadSize))
+			{
+				runs.back().end = std::max(end, runs.back().end);
+			}
+			else
+			{
+				readRun run;
+				run.tre = archive.first;
+				run.start = r.offset;
+				run.end = end;
+				runs.push_back(run);
+			}
+			runs.back().requests.push_back(r);
+		}
+	}
+
+	std::atomic<size_t> nextRun(0);
+	auto worker = [&]()
+	{
+		for (;;)
+		{
+			const size_t runIndex = nextRun++;
+			if (runIndex >= runs.size())
+			{
+				return;
+			}
+			const readRun& run = runs[runIndex];
+			const uint32_t runSize = static_cast<uint32_t>(run.end - run.start);
+
+			// Use the mapping if there is one, otherwise one big read...
+			std::unique_ptr<char[]> buffer;
+			const char* data = run.tre->getMappedRange(run.start, runSize);
+			if (nullptr == data)
+			{
+				buffer.reset(new char[runSize]);
+				if (run.tre->readRange(run.start, buffer.get(), runSize))
+				{
+					data = buffer.get();
+				}
+			}
+
+			for (const auto& r : run.requests)
+			{
+				std::shared_ptr<treDataBlock> block(new treDataBlock);
+				if (nullptr != data)
+				{
+					if (!run.tre->uncompressRecord(r.index,
+						data + (r.offset - run.start), *block))
+					{
+						block.reset();
+					}
+				}
+				else
+				{
+					// The combined read failed, read this record on its
+					// own so one bad record doesn't take its neighbours
+					// with it...
+					if (!run.tre->readRecord(r.index, *block))
+					{
+						block.reset();
+					}
+				}
+
+				if (block && cache.isEnabled())
+				{
+					callback(*r.name, cache.insert(run.tre, r.index, block));
+				}
+				else
+				{
+					callback(*r.name, block);
+				}
+			}
+		}
+	};
+
+	unsigned int threads = numThreads;
+	if (0 == threads)
+	{
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+	threads = static_cast<unsigned int>(
+		std::min<size_t>(threads, runs.size()));
+
+	std::vector<std::thread> pool;
+	for (unsigned int i = 1; i < threads; ++i)
+	{
+		pool.push_back(std::thread(worker));
+	}
+
+	// Calling thread works too...
+	worker();
+
+	for (auto& t : pool)
+	{
+		t.join();
+	}
+}
+
+uint32_t treArchive::getNumRecords() const
+{
+	uint32_t total = 0;
+	for (const auto tre : treList)
+	{
+		total += static_cast<uint32_t>(tre->getFileRecordList().size());
+	}
+	return total;
+}
+
+uint32_t treArchive::getNumEmptyRecords() const
+{
+	uint32_t total = 0;
+	for (const auto tre : treList)
+	{
+		for (const auto& record : tre->getFileRecordList())
+		{
+			if (0 == record.getUncompressedSize())
+			{
+				++total;
+			}
+		}
+	}
+	return total;
+}
+
+/// Length of name up to its last '/', 0 if there is none.
+static uint32_t getDirectoryLength(const treNameView& name)
+{
+	for (uint32_t i = name.size(); i > 0; --i)
+	{
+		if ('/' == name.data()[i - 1])
+		{
+			return i - 1;
+		}
+	}
+	return 0;
+}
+
+bool treArchive::repack(const std::string& treName,
+	std::vector<std::string>& outputFiles,
+	const uint64_t& maxSize,
+	const bool& deduplicate) const
+{
+	if (fileIndex.empty())
+	{
+		return false;
+	}
+
+	// Sort by directory, then by name, so files that are used together
+	// end up next to each other on disk.
+	typedef std::pair<const treNameView, indexEntry> entryType;
+	std::vector<const entryType*> entries;
+	entries.reserve(fileIndex.size());
+	for (const auto& entry : fileIndex)
+	{
+		entries.push_back(&entry);
+	}
+
+	std::sort(entries.begin(), entries.end(),
+		[](const entryType* a, const entryType* b)
+		{
+			const treNameView& nameA = a->first;
+			const treNameView& nameB = b->first;
+			const treNameView dirA(nameA.data(), getDirectoryLength(nameA));
+			const treNameView dirB(nameB.data(), getDirectoryLength(nameB));
+
+			if (dirA != dirB)
+			{
+				return (dirA < dirB);
+			}
+			return (nameA < nameB);
+		});
+
+	// Output file names when splitting...
+	std::string stem(treName);
+	std::string extension;
+	const size_t dot = treName.rfind('.');
+	const size_t slash = treName.rfind('/');
+	if ((std::string::npos != dot) &&
+		((std::string::npos == slash) || (dot > slash)))
+	{
+		stem = treName.substr(0, dot);
+		extension = treName.substr(dot);
+	}
+
+	treClass output;
+	output.setVersion("5000");
+	output.setFileBlockCompression(2);
+	output.setNameBlockCompression(2);
+	output.setDeduplicate(deduplicate);
+
+	bool writing = false;
+	uint64_t written = 0;
+	std::vector<char> stored;
+
+	for (const entryType* entry : entries)
+	{
+		const treNameView& name = entry->first;
+		treClass* tre = entry->second.tre;
+		const uint32_t index = entry->second.index;
+
+		const treFileRecord& record = tre->getFileRecordList()[index];
+		const uint32_t storedSize = tre->getStoredSize(index);
+
+		// Start the next output file if this record won't fit...
+		if (writing && (maxSize > 0) && (written + storedSize > maxSize))
+		{
+			if (!output.endWrite())
+			{
+				return false;
+			}
+			writing = false;
+		}
+
+		if (!writing)
+		{
+			std::string outName(treName);
+			if (maxSize > 0)
+			{
+				std::ostringstream number;
+				number << "_" << (outputFiles.size() < 10 ? "0" : "")
+					<< outputFiles.size();
+				outName = stem + number.str() + extension;
+			}
+
+			// beginWrite() truncates, so never aim it at an input...
+			for (const auto tre : treList)
+			{
+				if (treClass::isSameFile(outName, tre->getFilename()))
+				{
+					SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+						<< ": Output is an input archive: " << outName
+						<< std::endl;
+					return false;
+				}
+			}
+
+			if (!output.beginWrite(outName))
+			{
+				SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+					<< ": Failed to open: " << outName << std::endl;
+				return false;
+			}
+			outputFiles.push_back(outName);
+			writing = true;
+			written = 0;
+		}
+
+		stored.resize(storedSize);
+		if (!tre->readStoredData(index, 0, stored.data(), storedSize) ||
+			!output.addStoredRecord(name.str(),
+				stored.data(),
+				storedSize,
+				record.getUncompressedSize(),
+				record.getFormat()))
+		{
+			SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+				<< ": Failed to copy: " << name << std::endl;
+			output.endWrite();
+			return false;
+		}
+
+		written += storedSize;
+	}
+
+	return output.endWrite();
+}
+
+void treArchive::prefetch(const std::string& filename) const
+{
+	queuePrefetch(filename);
+	prefetchReady.notify_one();
+}
+
+void treArchive::prefetch(const std::vector<std::string>& filenames) const
+{
+	for (const auto& filename : filenames)
+	{
+		queuePrefetch(filename);
+	}
+	prefetchReady.notify_one();
+}
+
+void treArchive::queuePrefetch(const std::string& filename) const
+{
+	std::string correctedFilename(filename);
+	fixSlash(correctedFilename);
+
+	indexEntry entry;
+	if (!findFile(correctedFilename, entry.tre, entry.index))
+	{
+		return;
+	}
+
+	// Already warm...
+	if (cache.isEnabled() && cache.contains(entry.tre, entry.index))
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(prefetchMutex);
+	if (prefetchStop || (prefetchQueue.size() >= maxPrefetchQueue))
+	{
+		return;
+	}
+
+	prefetchQueue.push_back(entry);
+
+	if (!prefetchStarted)
+	{
+		prefetchThread = std::thread(&treArchive::prefetchWorker, this);
+		prefetchStarted = true;
+	}
+}
+
+void treArchive::cancelPrefetch() const
+{
+	if (!prefetchStarted)
+	{
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(prefetchMutex);
+	prefetchQueue.clear();
+	prefetchDone.wait(lock, [&]() { return (nullptr == prefetchCurrent.tre); });
+}
+
+void treArchive::waitForPrefetch(const treClass* tre,
+	const uint32_t& index) const
+{
+	if (!prefetchStarted)
+	{
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(prefetchMutex);
+	prefetchDone.wait(lock, [&]()
+		{
+			return (tre != prefetchCurrent.tre) ||
+				(index != prefetchCurrent.index);
+		});
+}
+
+void treArchive::prefetchWorker() const
+{
+	std::vector<char> stored;
+	for (;;)
+	{
+		indexEntry entry;
+		{
+			std::unique_lock<std::mutex> lock(prefetchMutex);
+			prefetchCurrent.tre = nullptr;
+			prefetchDone.notify_all();
+
+			prefetchReady.wait(lock, [&]()
+				{
+					return prefetchStop || !prefetchQueue.empty();
+				});
+			if (prefetchStop)
+			{
+				return;
+			}
+
+			entry = prefetchQueue.front();
+			prefetchQueue.pop_front();
+			prefetchCurrent = entry;
+		}
+
+		if (cache.isEnabled())
+		{
+			if (!cache.contains(entry.tre, entry.index))
+			{
+				std::shared_ptr<treDataBlock> block(new treDataBlock);
+				if (entry.tre->readRecord(entry.index, *block))
+				{
+					cache.insert(entry.tre, entry.index, block);
+				}
+			}
+		}
+		else
+		{
+			// No cache to fill, pull the data into the OS file cache
+			stored.resize(entry.tre->getStoredSize(entry.index));
+			entry.tre->readStoredData(entry.index, 0,
+				stored.data(), static_cast<uint32_t>(stored.size()));
+		}
+
+		++prefetched;
+	}
+}
+
+void treArchive::setCollectStats(const bool& s)
+{
+	cancelPrefetch();
+	collectStats.store(s, std::memory_order_relaxed);
+	for (auto& treFile : treList)
+	{
+		treFile->setCollectStats(s);
+	}
+}
+
+void treArchive::resetStats()
+{
+	statLookups = 0;
+	statMisses = 0;
+	for (auto& treFile : treList)
+	{
+		treFile->resetReadStats();
+	}
+	cache.resetCounters();
+}
+
+void treArchive::printStats(std::ostream& os) const
+{
+	treClass::readStats total = {};
+	for (const auto& treFile : treList)
+	{
+		treClass::readStats stats;
+		treFile->getReadStats(stats);
+		total.lookups += stats.lookups;
+		total.records += stats.records;
+		total.bytesRead += stats.bytesRead;
+		total.bytesInflated += stats.bytesInflated;
+		total.ioNanoseconds += stats.ioNanoseconds;
+		total.inflateNanoseconds += stats.inflateNanoseconds;
+	}
+
+	os << "Lookups: " << statLookups << " (" << statMisses << " missed)\n"
+		<< "Records read: " << total.records << "\n"
+		<< "Bytes read: " << total.bytesRead << "\n"
+		<< "Bytes inflated: " << total.bytesInflated << "\n"
+		<< "I/O ms: " << (total.ioNanoseconds / 1000000) << "\n"
+		<< "Inflate ms: " << (total.inflateNanoseconds / 1000000) << "\n"
+		<< "Cache hits: " << cache.getHits()
+		<< ", misses: " << cache.getMisses()
+		<< ", evictions: " << cache.getEvictions() << "\n";
+
+	// Newest archive first, same order as lookups search them...
+	os << "archive\tlookups\trecords\tbytes read\tbytes inflated"
+		<< "\tio ms\tinflate ms\n";
+	for (const auto& treFile : treList)
+	{
+		treClass::readStats stats;
+		treFile->getReadStats(stats);
+		os << treFile->getFilename()
+			<< "\t" << stats.lookups
+			<< "\t" << stats.records
+			<< "\t" << stats.bytesRead
+			<< "\t" << stats.bytesInflated
+			<< "\t" << (stats.ioNanoseconds / 1000000)
+			<< "\t" << (stats.inflateNanoseconds / 1000000) << "\n";
+	}
+	os.flush();
+}
+
+void treArchive::setTrace(std::ostream* os)
+{
+	std::lock_guard<std::mutex> lock(traceMutex);
+	if (nullptr != traceStream)
+	{
+		traceStream.load()->flush();
+	}
+	traceStream = os;
+	traceStart = std::chrono::steady_clock::now();
 }
@@ -24,10 +24,20 @@
  */
 
 #include <treLib/treClass.hpp>
+#include <swgLib/logger.hpp>
 #include <iostream>
 #include <sstream>
 #include <md5.h> // For md5
 #include <cstring> // For memcpy
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility> // For std::move
+#include <cstdio> // For rename()
+#include <zlib.h> // For crc32()
 
 #include <sys/stat.h> // For mkdir()
 #include <sys/types.h> // For mkdir()
@@ -36,6 +46,34 @@
 #include <direct.h> // For _mkdir()
 #endif
 
+/// Adds the time until it goes out of scope to a counter, if enabled.
+class statTimer
+{
+public:
+	statTimer(const bool& enabled, std::atomic<uint64_t>& c)
+		:
+		counter(enabled ? &c : nullptr)
+	{
+		if (nullptr != counter)
+		{
+			start = std::chrono::steady_clock::now();
+		}
+	}
+
+	~statTimer()
+	{
+		if (nullptr != counter)
+		{
+			*counter += std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now() - start).count();
+		}
+	}
+
+protected:
+	std::atomic<uint64_t>* counter;
+	std::chrono::steady_clock::time_point start;
+};
+
 treClass::treClass()
 	:
 	version("0000"),
@@ -46,17 +84,31 @@ treClass::treClass()
 	fileFinalSize(0),
 	nameCompression(0),
 	nameSize(0),
-	nameFinalSize(0)
+	nameFinalSize(0),
+	md5Mode(MD5_OFF),
+	collectStats(false),
+	statLookups(0),
+	statRecords(0),
+	statBytesRead(0),
+	statBytesInflated(0),
+	statIoNanoseconds(0),
+	statInflateNanoseconds(0),
+	useIndexSidecar(false),
+	numThreads(1),
+	compressionLevel(-1),
+	deduplicate(false),
+	nameBlockOffset(0),
+	dedupRecords(0),
+	dedupBytes(0),
+	reusedRecords(0),
+	reusedBytes(0)
 {
 }
 
 treClass::~treClass()
 {
 	// indexBlock and nameBlock are cleaned up by treDataBlock destructor.
-	if (treFile.is_open())
-	{
-		treFile.close();
-	}
+	treMap.close();
 }
 
 bool treClass::readHeader(std::istream& file)
@@ -69,7 +121,7 @@ bool treClass::readHeader(std::istream& file)
 	file >> fileType;
 	if ("EERT" != fileType)
 	{
-		std::cout << "Not a .tre file!" << std::endl;
+		SWG_LOG(LOG_ERROR) << "Not a .tre file!" << std::endl;
 		return false;
 	}
 	// Second 4 bytes is format version in ascii
@@ -184,7 +236,7 @@ bool treClass::readFileBlock(std::istream& file)
 		fileFinalSize
 	))
 	{
-		std::cout << __FILE__ << ": " << __LINE__
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
 			<< ": Failed to read/uncompress data!" << std::endl;
 		return false;
 	}
@@ -192,22 +244,25 @@ bool treClass::readFileBlock(std::istream& file)
 	// Fail if block is null...
 	if (NULL == fileBlock.getUncompressedDataPtr()) { return false; }
 
+	parseFileBlock(fileBlock.getUncompressedDataPtr());
+
+	return true;
+}
+
+void treClass::parseFileBlock(const char* buffer)
+{
 	// Allocate enough space for records
 	fileRecordList.clear();
 	fileRecordList.reserve(numRecords);
 
 	// One index should exist for each record...
 	treFileRecord fr;
-	int offset = 0;
+	uint32_t offset = 0;
 	for (uint32_t i = 0; i < numRecords; ++i)
 	{
-		offset += fr.readFromBuffer(
-			fileBlock.getUncompressedDataPtr() + offset
-		);
+		offset += fr.readFromBuffer(buffer + offset);
 		fileRecordList.push_back(fr);
 	}
-
-	return true;
 }
 
 void treClass::printFileBlock(std::ostream& os) const
@@ -236,7 +291,7 @@ bool treClass::readNameBlock(std::istream& file)
 		nameFinalSize
 	))
 	{
-		std::cout << __FILE__ << ": " << __LINE__
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
 			<< ": Failed to read/uncompress data!" << std::endl;
 		return false;
 	}
@@ -244,23 +299,37 @@ bool treClass::readNameBlock(std::istream& file)
 	// Fail if block is null...
 	if (NULL == nameBlock.getUncompressedDataPtr()) { return false; }
 
+	return parseNameBlock(nameBlock.getUncompressedDataPtr(),
+		nameBlock.getUncompressedSize());
+}
+
+bool treClass::parseNameBlock(const char* names, const uint32_t& size)
+{
 	// One name should exist for each record...
-	std::vector<treFileRecord>::iterator i;
-	for (i = fileRecordList.begin(); i != fileRecordList.end(); ++i)
+	for (auto& record : fileRecordList)
 	{
-		uint32_t charOffset = i->getNameOffset();
+		const uint32_t charOffset = record.getNameOffset();
+		if (charOffset >= size)
+		{
+			SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+				<< ": Name offset out of range: " << charOffset << std::endl;
+			return false;
+		}
 
-		std::string name;
 		// Stop when a null is found...
-		while (0 != nameBlock.getUncompressedDataPtr()[charOffset])
+		const char* name = names + charOffset;
+		const char* end = static_cast<const char*>(
+			memchr(name, 0, size - charOffset));
+
+		// Point the record at the retained block, copy if unterminated...
+		if (NULL != end)
 		{
-			// Append char and move on to next...
-			name.push_back(nameBlock.getUncompressedDataPtr()[charOffset]);
-			++charOffset;
+			record.setFileNameView(name, static_cast<uint32_t>(end - name));
+		}
+		else
+		{
+			record.setFileName(std::string(name, names + size));
 		}
-
-		// Add name to file record...
-		i->setFileName(name);
 	}
 
 	return true;
@@ -287,388 +356,1310 @@ bool treClass::readMD5sums(std::istream& file)
 	// Seek to position just after the name block...
 	file.seekg(fileOffset + fileSize + nameSize, std::ios_base::beg);
 
-	// One MD5 should exist for each record...
+	// One MD5 should exist for each record, read them all at once...
+	const size_t sumSize = std::tuple_size<treFileRecord::md5Type>::value;
+	std::vector<unsigned char> sums(size_t(numRecords) * sumSize, 0);
+	file.read(reinterpret_cast<char*>(sums.data()), sums.size());
+
 	for (uint32_t i = 0; i < numRecords; ++i)
 	{
-		std::vector<unsigned char> sum;
-		sum.reserve(16);
+		fileRecordList[i].setMD5sum(&sums[i * sumSize]);
+	}
 
-		unsigned char c;
-		for (int j = 0; j < 16; ++j)
-		{
-			file.read(reinterpret_cast<char*>(&c), sizeof(c));
-			sum.push_back(c);
-		}
+	return true;
+}
+
+std::string treClass::getIndexSidecarName() const
+{
+	if (indexDirectory.empty())
+	{
+		return filename + ".idx";
+	}
+
+	const size_t slash = filename.find_last_of("/\\");
+	const std::string base = (std::string::npos == slash) ?
+		filename : filename.substr(slash + 1);
+
+	return indexDirectory + "/" + base + ".idx";
+}
 
-		fileRecordList[i].setMD5sum(sum);
+bool treClass::getArchiveKey(uint64_t& size, int64_t& mtime) const
+{
+	struct stat info;
+	if (0 != stat(filename.c_str(), &info))
+	{
+		return false;
 	}
 
+	size = static_cast<uint64_t>(info.st_size);
+	mtime = static_cast<int64_t>(info.st_mtime);
+
 	return true;
 }
 
-std::stringstream*
-treClass::saveRecordAsStream(const uint32_t& recordNum, bool verbose)
+bool treClass::readIndexSidecar()
 {
-	// Fail if record is out of range...
-	if (recordNum >= fileRecordList.size())
+	uint64_t archiveSize = 0;
+	int64_t archiveTime = 0;
+	if (!getArchiveKey(archiveSize, archiveTime))
 	{
-		std::cout << "Record out of range" << std::endl;
-		return NULL;
+		return false;
 	}
 
-	if (verbose)
+	// Names are views into the sidecar, so the mapping is kept open...
+	treMappedFile& sidecar = indexMap;
+	sidecar.close();
+	if (!sidecar.open(getIndexSidecarName()) ||
+		(sidecar.getSize() < indexHeaderSize))
 	{
-		std::cout << "Found record: " << fileRecordList[recordNum].getFileName()
-			<< std::endl;
-		fileRecordList[recordNum].print(std::cout);
+		sidecar.close();
+		return false;
 	}
 
-	// Open file, exit on failure...
-	treFile.open(filename.c_str(), std::ios_base::binary);
-	if (!treFile.is_open())
+	const char* buffer = sidecar.getData();
+	uint32_t sidecarVersion = 0;
+	uint64_t size = 0;
+	int64_t mtime = 0;
+	uint32_t crc = 0;
+	memcpy(&sidecarVersion, buffer + 4, sizeof(sidecarVersion));
+	memcpy(&size, buffer + 8, sizeof(size));
+	memcpy(&mtime, buffer + 16, sizeof(mtime));
+	memcpy(&crc, buffer + 24, sizeof(crc));
+
+	// Stale or foreign sidecars are ignored, the archive is read instead
+	if ((0 != memcmp(buffer, "TIDX", 4)) ||
+		(indexVersion != sidecarVersion) ||
+		(archiveSize != size) ||
+		(archiveTime != mtime) ||
+		(crc != crc32(0L, reinterpret_cast<const Bytef*>(buffer + 28),
+			static_cast<uInt>(sidecar.getSize() - 28))))
 	{
-		return NULL;
+		sidecar.close();
+		return false;
 	}
 
-	// Seek to location of datablock...
-	treFile.seekg(fileRecordList[recordNum].getOffset(), std::ios_base::beg);
-	treDataBlock dataBlock;
+	uint32_t fields[7];
+	memcpy(fields, buffer + 32, sizeof(fields));
 
-	// Read and uncompress(if required)...
-	if (!dataBlock.readAndUncompress(
-		treFile,
-		fileRecordList[recordNum].getFormat(),
-		fileRecordList[recordNum].getSize(),
-		fileRecordList[recordNum].getUncompressedSize()
-	))
+	const uint64_t expectedSize = indexHeaderSize +
+		uint64_t(fields[0]) * (treFileRecord::SIZE + 16) + fields[6];
+	if (sidecar.getSize() != expectedSize)
 	{
-		std::cout << __FILE__ << ": " << __LINE__
-			<< ": Failed to read/uncompress data!" << std::endl;
-		return NULL;
+		sidecar.close();
+		return false;
+	}
+
+	version.assign(buffer + 28, 4);
+	numRecords = fields[0];
+	fileOffset = fields[1];
+	fileCompression = fields[2];
+	fileSize = fields[3];
+	fileFinalSize = numRecords * treFileRecord::SIZE;
+	nameCompression = fields[4];
+	nameSize = fields[5];
+	nameFinalSize = fields[6];
+
+	const char* records = buffer + indexHeaderSize;
+	const char* sums = records + fileFinalSize;
+	const char* names = sums + numRecords * 16;
+
+	parseFileBlock(records);
+	for (uint32_t i = 0; i < numRecords; ++i)
+	{
+		fileRecordList[i].setMD5sum(
+			reinterpret_cast<const unsigned char*>(sums + i * 16));
 	}
 
-	treFile.close();
+	// Names in the archive's own blocks are no longer referenced...
+	nameBlock.freeCompressedData();
+	nameBlock.freeUncompressedData();
 
-	// Get a pointer to the uncompressed data...
-	char* data = dataBlock.getUncompressedDataPtr();
-	if (NULL == data)
+	return parseNameBlock(names, nameFinalSize);
+}
+
+bool treClass::writeIndexSidecar() const
+{
+	uint64_t archiveSize = 0;
+	int64_t archiveTime = 0;
+	if (!getArchiveKey(archiveSize, archiveTime) ||
+		(NULL == fileBlock.getUncompressedDataPtr()) ||
+		(NULL == nameBlock.getUncompressedDataPtr()) ||
+		(fileBlock.getUncompressedSize() != fileFinalSize) ||
+		(nameBlock.getUncompressedSize() != nameFinalSize) ||
+		(fileRecordList.size() != numRecords))
 	{
-		return NULL;
+		return false;
 	}
 
-	md5_context md5;
-	md5_starts(&md5);
+	std::string buffer(indexHeaderSize, '\0');
+	buffer.reserve(indexHeaderSize +
+		numRecords * (treFileRecord::SIZE + 16) + nameFinalSize);
 
-	// Calculate MD5 sum 
-	if (2 == fileRecordList[recordNum].getFormat())
+	const uint32_t fields[7] = {
+		numRecords,
+		fileOffset,
+		fileCompression,
+		fileSize,
+		nameCompression,
+		nameSize,
+		nameFinalSize
+	};
+
+	memcpy(&buffer[0], "TIDX", 4);
+	const uint32_t sidecarVersion = indexVersion;
+	memcpy(&buffer[4], &sidecarVersion, sizeof(sidecarVersion));
+	memcpy(&buffer[8], &archiveSize, sizeof(archiveSize));
+	memcpy(&buffer[16], &archiveTime, sizeof(archiveTime));
+	memcpy(&buffer[28], version.c_str(), std::min<size_t>(version.size(), 4));
+	memcpy(&buffer[32], fields, sizeof(fields));
+
+	buffer.append(fileBlock.getUncompressedDataPtr(), fileFinalSize);
+	for (const auto& record : fileRecordList)
 	{
-		// 2 - ZLib compression
-		md5_update(
-			&md5,
-			(unsigned char*)dataBlock.getCompressedDataPtr(),
-			fileRecordList[recordNum].getSize()
-		);
+		buffer.append(record.getMD5sum().begin(), record.getMD5sum().end());
 	}
-	else if (0 == fileRecordList[recordNum].getFormat())
+	buffer.append(nameBlock.getUncompressedDataPtr(), nameFinalSize);
+
+	const uint32_t crc = crc32(0L,
+		reinterpret_cast<const Bytef*>(buffer.data() + 28),
+		static_cast<uInt>(buffer.size() - 28));
+	memcpy(&buffer[24], &crc, sizeof(crc));
+
+	// Write beside and rename, readers never see a partial sidecar
+	const std::string sidecarName = getIndexSidecarName();
+	const std::string tempName = sidecarName + ".tmp";
+	std::ofstream sidecar(tempName.c_str(), std::ios_base::binary);
+	if (!sidecar.is_open())
 	{
-		// 0 - No compression
-		md5_update(
-			&md5,
-			(unsigned char*)dataBlock.getUncompressedDataPtr(),
-			fileRecordList[recordNum].getUncompressedSize()
-		);
+		return false;
 	}
 
-	unsigned char mdArray[16];
-	md5_finish(&md5, mdArray);
-
-	std::cout << "Calculated MD5: ";
-	for (int i = 0; i < 16; ++i)
+	sidecar.write(buffer.data(), buffer.size());
+	sidecar.close();
+	if (sidecar.fail())
 	{
-		std::cout << std::hex << (uint32_t)mdArray[i];
+		remove(tempName.c_str());
+		return false;
 	}
-	std::cout << std::dec << std::endl;
 
-	// Write uncompressed data to stringstream...
-	std::stringstream* sstr = new std::stringstream;
-	sstr->write(data, fileRecordList[recordNum].getUncompressedSize());
+#ifdef WIN32
+	// rename() does not replace an existing file on Windows...
+	remove(sidecarName.c_str());
+#endif
+	if (0 != rename(tempName.c_str(), sidecarName.c_str()))
+	{
+		remove(tempName.c_str());
+		return false;
+	}
 
-	return sstr;
+	return true;
 }
 
-bool treClass::saveRecordAsFile(const uint32_t& recordNum)
+bool treClass::mapFile()
 {
-	// Fail if record is out of range...
-	if (recordNum >= fileRecordList.size())
+	if (filename.empty())
 	{
-		std::cout << "Record out of range" << std::endl;
 		return false;
 	}
 
-	std::cout << "Found record: " << fileRecordList[recordNum].getFileName()
-		<< std::endl;
-	fileRecordList[recordNum].print(std::cout);
-
-
-	// Starting at the root directory of the filename..
-	// make each directory, then save file
-	std::string fullpath;
-	std::string::size_type start = 0, end;
-	bool done = false;
-	while (!done)
+	if (treMap.open(filename, true))
 	{
-		// Search for directory deliminators...
-		end = (fileRecordList[recordNum].getFileName()).find("/", start);
-
-		// "/" was successfully found...
-		if (std::string::npos != end)
-		{
-			// Extract directory substring...
-			std::string directory(fileRecordList[recordNum].getFileName(),
-				start, end - start);
-
-			// Append a "/" unless this is the first directory...
-			if (!fullpath.empty())
-			{
-				fullpath += "/";
-			}
-			fullpath += directory;
+		return true;
+	}
 
-			//std::cout << "Making directory: " << fullpath << std::endl;
-#ifdef WIN32
-			_mkdir(fullpath.c_str());
-#else
-			mkdir(fullpath.c_str(), 0777);
-#endif
+	// open() closed the old handle, keep the archive readable...
+	SWG_LOG(LOG_ERROR) << "Failed to map: " << filename << std::endl;
+	treMap.open(filename, false);
+	return false;
+}
 
-			// Point start to character just after last '/'...
-			start = end + 1;
-		}
-		else
-		{
-			// End of string was found...
-			done = true;
-		}
+void treClass::unmapFile()
+{
+	// Fall back to positional reads through a plain file handle...
+	if (treMap.isMapped())
+	{
+		treMap.open(filename, false);
 	}
+}
 
-	// Open file, exit on failure...
-	treFile.open(filename.c_str(), std::ios_base::binary);
-	if (!treFile.is_open())
+bool treClass::getRecordView(const uint32_t& recordNum,
+	treRecordView& view) const
+{
+	// Only uncompressed records can be viewed in place...
+	if (!treMap.isMapped() || (recordNum >= fileRecordList.size()))
 	{
 		return false;
 	}
 
-	// Seek to location of datablock...
-	treFile.seekg(fileRecordList[recordNum].getOffset(), std::ios_base::beg);
-	treDataBlock dataBlock;
+	const treFileRecord& record = fileRecordList[recordNum];
+	if (0 != record.getFormat())
+	{
+		return false;
+	}
 
-	// Read and uncompress(if required)...
-	if (!dataBlock.readAndUncompress(
-		treFile,
-		fileRecordList[recordNum].getFormat(),
-		fileRecordList[recordNum].getSize(),
-		fileRecordList[recordNum].getUncompressedSize()
-	))
+	// Make sure record lies completely inside the mapping...
+	const uint64_t end =
+		uint64_t(record.getOffset()) + record.getUncompressedSize();
+	if (end > treMap.getSize())
 	{
-		std::cout << __FILE__ << ": " << __LINE__
-			<< ": Failed to read/uncompress data!" << std::endl;
 		return false;
 	}
 
-	treFile.close();
+	view = treRecordView(treMap.getData() + record.getOffset(),
+		record.getUncompressedSize());
 
-	// Get a pointer to the uncompressed data...
-	char* data = dataBlock.getUncompressedDataPtr();
-	if (NULL == data)
+	return true;
+}
+
+bool treClass::readRecord(const uint32_t& recordNum,
+	treDataBlock& dataBlock,
+	unsigned char* md5sum) const
+{
+	// Fail if record is out of range...
+	if (recordNum >= fileRecordList.size())
 	{
+		SWG_LOG(LOG_ERROR) << "Record out of range" << std::endl;
 		return false;
 	}
 
-	md5_context md5;
-	md5_starts(&md5);
+	const treFileRecord& record = fileRecordList[recordNum];
+
+	// Pointer to the data as stored in the archive, used for the MD5...
+	const char* storedData = nullptr;
+	const uint32_t storedSize = getStoredSize(recordNum);
 
-	// Calculate MD5 sum 
-	if (2 == fileRecordList[recordNum].getFormat())
+	// Only touch the file through positional reads or the mapping so
+	// that any number of threads can read records at the same time.
+	std::unique_ptr<char[]> storedCopy;
+	if (treMap.isMapped())
 	{
-		md5_update(
-			&md5,
-			(unsigned char*)dataBlock.getCompressedDataPtr(),
-			fileRecordList[recordNum].getSize()
-		);
+		if ((uint64_t(record.getOffset()) + storedSize) > treMap.getSize())
+		{
+			SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+				<< ": Record extends past end of file!" << std::endl;
+			return false;
+		}
+		storedData = treMap.getData() + record.getOffset();
 	}
-	else if (0 == fileRecordList[recordNum].getFormat())
+	else
 	{
-		md5_update(
-			&md5,
-			(unsigned char*)dataBlock.getUncompressedDataPtr(),
-			fileRecordList[recordNum].getUncompressedSize()
-		);
+		storedCopy.reset(new char[storedSize]);
+		statTimer timer(collectStats, statIoNanoseconds);
+		if (!treMap.readAt(record.getOffset(), storedCopy.get(), storedSize))
+		{
+			SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+				<< ": Failed to read record!" << std::endl;
+			return false;
+		}
+		storedData = storedCopy.get();
 	}
 
-	unsigned char mdArray[16];
-	md5_finish(&md5, mdArray);
-
-	std::cout << "Calculated MD5: ";
-	for (int i = 0; i < 16; ++i)
+	if (collectStats)
 	{
-		std::cout << std::hex << (uint32_t)mdArray[i];
+		statBytesRead += storedSize;
 	}
-	std::cout << std::dec << std::endl;
 
-
-	// Attempt to open output file...
-	std::ofstream dataFile;
-	dataFile.open(fileRecordList[recordNum].getFileName().c_str(),
-		std::ofstream::binary);
-	if (!dataFile.is_open())
+	// Uncompress(if required)...
+	if (!uncompressRecord(recordNum, storedData, dataBlock))
 	{
-		std::cout << __FILE__ << ": " << __LINE__
-			<< ": Failed to open output file!" << std::endl;
 		return false;
 	}
 
-	// Write uncompressed data to file...
-	dataFile.write(data, fileRecordList[recordNum].getUncompressedSize());
+	// Get a pointer to the uncompressed data...
+	if (NULL == dataBlock.getUncompressedDataPtr())
+	{
+		return false;
+	}
 
-	// Close output file...
-	dataFile.close();
+	// Calculate MD5 sum of the stored data if requested
+	if (nullptr != md5sum)
+	{
+		md5_context md5;
+		md5_starts(&md5);
+		md5_update(&md5, (unsigned char*)storedData, storedSize);
+		md5_finish(&md5, md5sum);
+	}
 
 	return true;
 }
 
-bool treClass::readFile(std::ifstream& file)
-{
-	// Only call these functions if the previous ones were successful.
-	bool rv = readHeader(file);
-	if (rv) { readFileBlock(file); }
-	if (rv) { readNameBlock(file); }
-	if (rv) { readMD5sums(file); }
-
-	return rv;
-}
-
-bool treClass::readFile(const std::string& treName)
+bool treClass::readStoredData(const uint32_t& recordNum,
+	const uint32_t& offset,
+	char* buffer,
+	const uint32_t& size) const
 {
-	filename = treName;
-
-	// Open file, exit on failure...
-	treFile.open(filename.c_str(), std::ios_base::binary);
-	if (!treFile.is_open())
+	if (recordNum >= fileRecordList.size())
 	{
 		return false;
 	}
 
-	bool rv = readFile(treFile);
+	const treFileRecord& record = fileRecordList[recordNum];
+	if ((uint64_t(offset) + size) > getStoredSize(recordNum))
+	{
+		return false;
+	}
 
-	// Close input file...
-	treFile.close();
+	statTimer timer(collectStats, statIoNanoseconds);
+	if (collectStats)
+	{
+		statBytesRead += size;
+	}
 
-	return rv;
+	return treMap.readAt(uint64_t(record.getOffset()) + offset, buffer, size);
 }
 
-bool treClass::writeFile(const std::string& treName)
+uint32_t treClass::getStoredSize(const uint32_t& recordNum) const
 {
-	filename = treName;
+	const treFileRecord& record = fileRecordList[recordNum];
+	return (2 == record.getFormat()) ?
+		record.getSize() : record.getUncompressedSize();
+}
 
-	std::ofstream outTreFile;
-	// Open file, exit on failure...
-	outTreFile.open(filename.c_str(), std::ios_base::binary);
-	if (!outTreFile.is_open())
+bool treClass::readRange(const uint64_t& offset,
+	char* buffer,
+	const uint32_t& size) const
+{
+	statTimer timer(collectStats, statIoNanoseconds);
+	if (collectStats)
 	{
-		return false;
+		statBytesRead += size;
 	}
 
-	// Only call these functions if the previous ones were successful.
-	bool rv = writeHeader(outTreFile);
-	if (rv) { writeFileBlock(outTreFile); }
+	return treMap.readAt(offset, buffer, size);
+}
 
-	// Close input file...
-	outTreFile.close();
+const char* treClass::getMappedRange(const uint64_t& offset,
+	const uint32_t& size) const
+{
+	if (!treMap.isMapped() || ((offset + size) > treMap.getSize()))
+	{
+		return nullptr;
+	}
 
-	return rv;
+	if (collectStats)
+	{
+		statBytesRead += size;
+	}
+
+	return treMap.getData() + offset;
 }
 
-bool treClass::writeFileBlock(std::ostream& file)
+bool treClass::uncompressRecord(const uint32_t& recordNum,
+	const char* storedData,
+	treDataBlock& dataBlock) const
 {
-	if (fileRecordList.empty())
+	const treFileRecord& record = fileRecordList[recordNum];
+	statTimer timer(collectStats, statInflateNanoseconds);
+
+	// Check stored data against the archive's MD5 table first...
+	if ((MD5_VERIFY == md5Mode) && hasStoredMD5(recordNum) &&
+		!isStoredMD5Correct(recordNum, storedData))
 	{
-		std::cout << "No file records to write!" << std::endl;
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+			<< ": MD5 mismatch: " << record.getFileName() << std::endl;
 		return false;
 	}
 
-	// Seek to position just after header...
-	file.seekp(36, std::ios_base::beg);
-
-	uint32_t totalDataSize = 0;
-	uint32_t totalNameBlockSize = 0;
+	if (!dataBlock.uncompressFromBuffer(
+		storedData,
+		record.getFormat(),
+		record.getSize(),
+		record.getUncompressedSize()
+	))
+	{
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+			<< ": Failed to read/uncompress data!" << std::endl;
+		return false;
+	}
 
-	std::vector<treFileRecord>::iterator i;
-	for (i = fileRecordList.begin(); i != fileRecordList.end(); ++i)
+	if (collectStats)
 	{
-		// Try to open file, return false if failed...
-		std::ifstream dataFile(i->getFileName().c_str());
-		if (!dataFile.is_open())
-		{
-			std::cout << __FILE__ << ": " << __LINE__
-				<< ": Failed to open file: "
-				<< i->getFileName() << std::endl;
-			return false;
-		}
+		++statRecords;
+		statBytesInflated += dataBlock.getUncompressedSize();
+	}
 
-		// Get file size...
-		dataFile.seekg(0, std::ios::end);
-		std::streamoff dataFileSize = dataFile.tellg();
+	return true;
+}
 
-		if (!(i->getDataBlock().allocateUncompressedData((uint32_t)dataFileSize)))
-		{
-			std::cout << __FILE__ << ": " << __LINE__
-				<< ": Failed to allocate " << dataFileSize
-				<< " bytes for data file!" << std::endl;
-			return false;
-		}
+void treClass::getReadStats(readStats& stats) const
+{
+	stats.lookups = statLookups;
+	stats.records = statRecords;
+	stats.bytesRead = statBytesRead;
+	stats.bytesInflated = statBytesInflated;
+	stats.ioNanoseconds = statIoNanoseconds;
+	stats.inflateNanoseconds = statInflateNanoseconds;
+}
 
-		// Position file pointer and beginning of file...
-		dataFile.seekg(0, std::ios::beg);
-		dataFile.read(i->getDataBlock().getUncompressedDataPtr(),
-			dataFileSize);
+void treClass::resetReadStats()
+{
+	statLookups = 0;
+	statRecords = 0;
+	statBytesRead = 0;
+	statBytesInflated = 0;
+	statIoNanoseconds = 0;
+	statInflateNanoseconds = 0;
+}
+
+bool treClass::hasStoredMD5(const uint32_t& recordNum) const
+{
+	// Archives without an MD5 table read back as all zero (or nothing)
+	const treFileRecord::md5Type& sum = fileRecordList[recordNum].getMD5sum();
+	for (const auto& c : sum)
+	{
+		if (0 != c) { return true; }
+	}
+	return false;
+}
+
+bool treClass::isStoredMD5Correct(const uint32_t& recordNum,
+	const char* storedData) const
+{
+	md5_context md5;
+	md5_starts(&md5);
+	md5_update(&md5, (unsigned char*)storedData, getStoredSize(recordNum));
+
+	unsigned char mdArray[16];
+	md5_finish(&md5, mdArray);
+
+	const treFileRecord::md5Type& sum = fileRecordList[recordNum].getMD5sum();
+
+	return (0 == memcmp(mdArray, sum.data(), sum.size()));
+}
+
+uint32_t treClass::scrub(std::vector<uint32_t>& mismatches,
+	const unsigned int& threads) const
+{
+	// Check records in the order they are stored...
+	std::vector<uint32_t> work;
+	work.reserve(fileRecordList.size());
+	for (uint32_t i = 0; i < fileRecordList.size(); ++i)
+	{
+		if (hasStoredMD5(i))
+		{
+			work.push_back(i);
+		}
+	}
+	std::sort(work.begin(), work.end(),
+		[this](const uint32_t& a, const uint32_t& b)
+		{
+			return fileRecordList[a].getOffset() <
+				fileRecordList[b].getOffset();
+		});
+
+	std::mutex mutex;
+	std::atomic<size_t> next(0);
+	auto worker = [&]()
+	{
+		std::vector<char> buffer;
+		for (;;)
+		{
+			const size_t i = next++;
+			if (i >= work.size())
+			{
+				return;
+			}
+
+			const uint32_t recordNum = work[i];
+			const uint32_t storedSize = getStoredSize(recordNum);
+			const uint64_t offset = fileRecordList[recordNum].getOffset();
+
+			const char* data = getMappedRange(offset, storedSize);
+			if (nullptr == data)
+			{
+				buffer.resize(std::max<uint32_t>(storedSize, 1));
+				if (readRange(offset, &buffer[0], storedSize))
+				{
+					data = &buffer[0];
+				}
+			}
+
+			if ((nullptr == data) || !isStoredMD5Correct(recordNum, data))
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				mismatches.push_back(recordNum);
+			}
+		}
+	};
+
+	unsigned int n = threads;
+	if (0 == n)
+	{
+		n = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	std::vector<std::thread> pool;
+	for (unsigned int t = 1; t < n; ++t)
+	{
+		pool.push_back(std::thread(worker));
+	}
+	worker();
+	for (auto& t : pool)
+	{
+		t.join();
+	}
+
+	std::sort(mismatches.begin(), mismatches.end());
+
+	return static_cast<uint32_t>(work.size());
+}
+
+treRecordStream* treClass::openRecordStream(const uint32_t& recordNum) const
+{
+	treRecordStream* stream = new treRecordStream(*this, recordNum);
+	if (!stream->isOpen())
+	{
+		delete stream;
+		return NULL;
+	}
+
+	return stream;
+}
+
+std::stringstream*
+treClass::saveRecordAsStream(const uint32_t& recordNum, bool verbose) const
+{
+	// Fail if record is out of range...
+	if (recordNum >= fileRecordList.size())
+	{
+		SWG_LOG(LOG_ERROR) << "Record out of range" << std::endl;
+		return NULL;
+	}
+
+	if (verbose)
+	{
+		SWG_LOG(LOG_INFO) << "Found record: " << fileRecordList[recordNum].getFileName()
+			<< std::endl;
+		if (ml::logger::enabled(ml::logger::LOG_INFO))
+		{
+			fileRecordList[recordNum].print(ml::logger::stream(ml::logger::LOG_INFO));
+		}
+	}
+
+	treDataBlock dataBlock;
+	if (!readRecord(recordNum, dataBlock))
+	{
+		return NULL;
+	}
+
+	// Write uncompressed data to stringstream...
+	std::stringstream* sstr = new std::stringstream;
+	sstr->write(dataBlock.getUncompressedDataPtr(),
+		fileRecordList[recordNum].getUncompressedSize());
+
+	return sstr;
+}
+
+bool treClass::saveRecordAsFile(const uint32_t& recordNum) const
+{
+	// Fail if record is out of range...
+	if (recordNum >= fileRecordList.size())
+	{
+		SWG_LOG(LOG_ERROR) << "Record out of range" << std::endl;
+		return false;
+	}
+
+	SWG_LOG(LOG_INFO) << "Found record: " << fileRecordList[recordNum].getFileName()
+		<< std::endl;
+	if (ml::logger::enabled(ml::logger::LOG_INFO))
+	{
+		fileRecordList[recordNum].print(ml::logger::stream(ml::logger::LOG_INFO));
+	}
+
+
+	// Never write outside the current directory...
+	const std::string recordName = fileRecordList[recordNum].getFileName();
+	if (!isSafeRecordName(recordName))
+	{
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+			<< ": Unsafe record name: " << recordName << std::endl;
+		return false;
+	}
+
+	// Starting at the root directory of the filename..
+	// make each directory, then save file
+	std::string fullpath;
+	std::string::size_type start = 0, end;
+	bool done = false;
+	while (!done)
+	{
+		// Search for directory deliminators...
+		end = recordName.find("/", start);
+
+		// "/" was successfully found...
+		if (std::string::npos != end)
+		{
+			// Extract directory substring...
+			std::string directory(recordName, start, end - start);
+
+			// Append a "/" unless this is the first directory...
+			if (!fullpath.empty())
+			{
+				fullpath += "/";
+			}
+			fullpath += directory;
+
+			//std::cout << "Making directory: " << fullpath << std::endl;
+#ifdef WIN32
+			_mkdir(fullpath.c_str());
+#else
+			mkdir(fullpath.c_str(), 0777);
+#endif
+
+			// Point start to character just after last '/'...
+			start = end + 1;
+		}
+		else
+		{
+			// End of string was found...
+			done = true;
+		}
+	}
+
+	treDataBlock dataBlock;
+	if (!readRecord(recordNum, dataBlock))
+	{
+		return false;
+	}
+
+	// Attempt to open output file...
+	std::ofstream dataFile;
+	dataFile.open(fileRecordList[recordNum].getFileName().c_str(),
+		std::ofstream::binary);
+	if (!dataFile.is_open())
+	{
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+			<< ": Failed to open output file!" << std::endl;
+		return false;
+	}
+
+	// Write uncompressed data to file...
+	dataFile.write(dataBlock.getUncompressedDataPtr(),
+		fileRecordList[recordNum].getUncompressedSize());
+
+	// Close output file...
+	dataFile.close();
+
+	return true;
+}
+
+bool treClass::readFile(std::ifstream& file)
+{
+	// Only call these functions if the previous ones were successful.
+	bool rv = readHeader(file);
+	if (rv) { readFileBlock(file); }
+	if (rv) { readNameBlock(file); }
+	if (rv) { readMD5sums(file); }
+
+	return rv;
+}
 
+bool treClass::readFile(const std::string& treName)
+{
+	filename = treName;
+
+	// A current sidecar saves inflating the file and name blocks...
+	bool rv = useIndexSidecar && readIndexSidecar();
+	if (!rv)
+	{
+		// Open file, exit on failure...
+		std::ifstream treFile(filename.c_str(), std::ios_base::binary);
+		if (!treFile.is_open())
+		{
+			return false;
+		}
+
+		rv = readFile(treFile);
+
+		// Close input file...
+		treFile.close();
+
+		// Best effort, the directory may be read-only...
+		if (rv && useIndexSidecar)
+		{
+			writeIndexSidecar();
+		}
+
+		// Names are views into the name block, the rest can go...
+		indexMap.close();
+		nameBlock.freeCompressedData();
+	}
+
+	fileBlock.freeCompressedData();
+	fileBlock.freeUncompressedData();
+
+	// Keep a handle for positional record reads...
+	if (rv && !treMap.isMapped())
+	{
+		rv = treMap.open(filename, false);
+	}
+
+	return rv;
+}
+
+bool treClass::writeFile(const std::string& treName)
+{
+	// Current record list is the list of input files...
+	std::vector<treFileRecord> inputList;
+	inputList.swap(fileRecordList);
+
+	if (inputList.empty())
+	{
+		SWG_LOG(LOG_ERROR) << "No file records to write!" << std::endl;
+		return false;
+	}
+
+	if (!beginWrite(treName))
+	{
+		return false;
+	}
+
+	bool rv = true;
+	if (numThreads > 1)
+	{
+		rv = writeRecordsParallel(inputList);
+	}
+	else
+	{
+		for (auto& record : inputList)
+		{
+			if (!prepareRecord(record) || !appendRecord(record))
+			{
+				rv = false;
+				break;
+			}
+		}
+	}
+
+	// Only finish the archive if all records were written...
+	if (rv)
+	{
+		rv = endWrite();
+	}
+	else
+	{
+		outTreFile.close();
+	}
+
+	return rv;
+}
+
+bool treClass::beginWrite(const std::string& treName)
+{
+	// Truncating the base archive would pull the data out from under us...
+	if (baseArchive && isSameFile(baseArchive->getFilename(), treName))
+	{
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+			<< ": Output file is the base archive: "
+			<< treName << std::endl;
+		return false;
+	}
+
+	filename = treName;
+	fileRecordList.clear();
+	nameBlockOffset = 0;
+	dedupIndex.clear();
+	dedupFile.close();
+	dedupRecords = 0;
+	dedupBytes = 0;
+	reusedRecords = 0;
+	reusedBytes = 0;
+
+	// Open file, exit on failure...
+	outTreFile.open(filename.c_str(), std::ios_base::binary);
+	if (!outTreFile.is_open())
+	{
+		return false;
+	}
+
+	// Header is rewritten by endWrite() once sizes are known...
+	return writeHeader(outTreFile);
+}
+
+bool treClass::addRecord(const std::string& name,
+	const char* data,
+	const uint32_t& size,
+	const uint32_t& format)
+{
+	treDataBlock block;
+	if (!block.setUncompressedData(data, size))
+	{
+		SWG_LOG(LOG_ERROR) << "compress failed: " << name << std::endl;
+		return false;
+	}
+
+	return addRecord(name, std::move(block), format);
+}
+
+bool treClass::addRecord(const std::string& name,
+	treDataBlock&& block,
+	const uint32_t& format)
+{
+	treFileRecord record;
+	record.setFileName(name);
+	record.setFormat(format);
+	record.setUncompressedSize(block.getUncompressedSize());
+	record.getDataBlock() = std::move(block);
+
+	// Compress into the record's data block, freed once written...
+	if (!record.getDataBlock().compressData(format, compressionLevel))
+	{
+		SWG_LOG(LOG_ERROR) << "compress failed: " << name << std::endl;
+		return false;
+	}
+
+	return appendRecord(record);
+}
+
+bool treClass::addStoredRecord(const std::string& name,
+	const char* storedData,
+	const uint32_t& storedSize,
+	const uint32_t& uncompressedSize,
+	const uint32_t& format)
+{
+	treFileRecord record;
+	record.setFileName(name);
+	record.setFormat(format);
+	record.setUncompressedSize(uncompressedSize);
+
+	bool rv = false;
+	if (2 == format)
+	{
+		rv = record.getDataBlock().setCompressedData(storedData, storedSize);
+	}
+	else if (0 == format)
+	{
+		// Nothing to compress, compressData() only calculates the MD5...
+		rv = record.getDataBlock().setUncompressedData(storedData,
+			storedSize) && record.getDataBlock().compressData(format);
+	}
+	else
+	{
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+			<< ": Unknown format: " << format << std::endl;
+	}
+
+	return rv && appendRecord(record);
+}
+
+bool treClass::prepareRecord(treFileRecord& record) const
+{
+	// Try to open file, return false if failed...
+	std::ifstream dataFile(record.getFileName().c_str(), std::ios_base::binary);
+	if (!dataFile.is_open())
+	{
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+			<< ": Failed to open file: "
+			<< record.getFileName() << std::endl;
+		return false;
+	}
+
+	// Get file size...
+	dataFile.seekg(0, std::ios::end);
+	std::streamoff dataFileSize = dataFile.tellg();
+
+	if (!(record.getDataBlock().allocateUncompressedData((uint32_t)dataFileSize)))
+	{
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+			<< ": Failed to allocate " << dataFileSize
+			<< " bytes for data file!" << std::endl;
+		return false;
+	}
+
+	// Position file pointer and beginning of file...
+	dataFile.seekg(0, std::ios::beg);
+	dataFile.read(record.getDataBlock().getUncompressedDataPtr(),
+		dataFileSize);
+
+	// Set uncompressed size...
+	record.setUncompressedSize((uint32_t)dataFileSize);
+
+	// Unchanged since the base archive, no need to compress again...
+	if (reuseBaseRecord(record))
+	{
+		return true;
+	}
+
+	// Compress and calculate MD5...
+	if (!(record.getDataBlock().compressData(record.getFormat(),
+		compressionLevel)))
+	{
+		SWG_LOG(LOG_ERROR) << "compress failed: " << record.getFileName() << std::endl;
+		return false;
+	}
+
+	return true;
+}
+
+bool treClass::isSafeRecordName(const std::string& name)
+{
+	if (name.empty() || ('/' == name[0]) || ('\\' == name[0]) ||
+		((name.size() > 1) && (':' == name[1])))
+	{
+		return false;
+	}
+
+	// Check each component, either slash separates them on Windows...
+	std::string::size_type start = 0;
+	while (start <= name.size())
+	{
+		std::string::size_type end = name.find_first_of("/\\", start);
+		if (std::string::npos == end)
+		{
+			end = name.size();
+		}
+		if (0 == name.compare(start, end - start, ".."))
+		{
+			return false;
+		}
+		start = end + 1;
+	}
+
+	return true;
+}
+
+bool treClass::isSameFile(const std::string& a, const std::string& b)
+{
+	struct stat statA;
+	struct stat statB;
+	if ((0 == stat(a.c_str(), &statA)) && (0 == stat(b.c_str(), &statB)))
+	{
+		return ((statA.st_dev == statB.st_dev) &&
+			(statA.st_ino == statB.st_ino));
+	}
+
+	// A file that doesn't exist yet can only match by name...
+	return (a == b);
+}
+
+bool treClass::setBaseArchive(const std::string& treName)
+{
+	clearBaseArchive();
+
+	std::unique_ptr<treClass> base(new treClass);
+	if (!base->readFile(treName))
+	{
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+			<< ": Failed to read base archive: " << treName << std::endl;
+		return false;
+	}
+
+	// First non-empty record with a name wins, like getFileRecordIndex...
+	const auto& records = base->getFileRecordList();
+	for (uint32_t i = 0; i < records.size(); ++i)
+	{
+		if (records[i].getUncompressedSize() > 0)
+		{
+			baseIndex.insert(std::make_pair(records[i].getFileName().str(), i));
+		}
+	}
+
+	baseArchive = std::move(base);
+	return true;
+}
+
+void treClass::clearBaseArchive()
+{
+	baseArchive.reset();
+	baseIndex.clear();
+}
+
+bool treClass::reuseBaseRecord(treFileRecord& record) const
+{
+	// Uncompressed records gain nothing from reuse...
+	if (!baseArchive || (2 != record.getFormat()))
+	{
+		return false;
+	}
+
+	auto entry = baseIndex.find(record.getFileName());
+	if (baseIndex.end() == entry)
+	{
+		return false;
+	}
+
+	const uint32_t baseNum = entry->second;
+	const treFileRecord& baseRecord = baseArchive->getFileRecordList()[baseNum];
+	if ((2 != baseRecord.getFormat()) ||
+		(0 == baseRecord.getSize()) ||
+		(baseRecord.getUncompressedSize() != record.getUncompressedSize()))
+	{
+		return false;
+	}
+
+	// The stored MD5 covers compressed bytes, so compare the content
+	// itself.  Inflating the old copy is much cheaper than deflating.
+	const uint32_t storedSize = baseRecord.getSize();
+	std::unique_ptr<char[]> stored(new char[storedSize]);
+	treDataBlock baseData;
+	if (!baseArchive->readStoredData(baseNum, 0, stored.get(), storedSize) ||
+		!baseArchive->uncompressRecord(baseNum, stored.get(), baseData) ||
+		(baseData.getUncompressedSize() != record.getUncompressedSize()) ||
+		(0 != memcmp(baseData.getUncompressedDataPtr(),
+			record.getDataBlock().getUncompressedDataPtr(),
+			record.getUncompressedSize())))
+	{
+		return false;
+	}
+
+	if (!record.getDataBlock().setCompressedData(stored.get(), storedSize))
+	{
+		return false;
+	}
+
+	++reusedRecords;
+	reusedBytes += record.getUncompressedSize();
+
+	return true;
+}
+
+bool treClass::appendRecord(treFileRecord& record)
+{
+	if (!outTreFile.is_open())
+	{
+		return false;
+	}
+
+	// Size is 0 for uncompressed records..
+	uint32_t storedSize = 0;
+	if (record.getFormat() == 0) // No Compression
+	{
+		record.setSize(0);
+		storedSize = record.getUncompressedSize();
+	}
+	else
+	{
+		// Store size of actual data written to file...
+		record.setSize(record.getDataBlock().getCompressedSize());
+		storedSize = record.getSize();
+	}
+
+	// MD5 is calculated when compressed, store in file record now...
+	record.setMD5sum(record.getDataBlock().getMD5sum());
+
+	// Point duplicate payloads at the copy already written...
+	bool duplicate = false;
+	std::string key;
+	if (deduplicate)
+	{
+		key = getDedupKey(record);
+		auto entry = dedupIndex.find(key);
+		if ((dedupIndex.end() != entry) &&
+			isWrittenCopy(record, entry->second, storedSize))
+		{
+			record.setOffset(entry->second);
+			duplicate = true;
+			++dedupRecords;
+			dedupBytes += storedSize;
+		}
+	}
+
+	if (!duplicate)
+	{
 		// Get offset (from beginning of file) to where data will be written.
-		i->setOffset((uint32_t)file.tellp());
+		record.setOffset((uint32_t)outTreFile.tellp());
 
 		// Write datablock...
-		if (!(i->getDataBlock().compressAndWrite(file, i->getFormat())))
+		if (!(record.getDataBlock().writeData(outTreFile, record.getFormat())))
 		{
-			std::cout << "compress/write failed!" << std::endl;
+			SWG_LOG(LOG_ERROR) << "write failed!" << std::endl;
 			return false;
 		}
 
-		// Set uncompressed size...
-		i->setUncompressedSize((uint32_t)dataFileSize);
+		// First copy of a key stays the target if a collision follows...
+		if (deduplicate)
+		{
+			dedupIndex.insert(std::make_pair(key, record.getOffset()));
+		}
+	}
+
+	// Store offset to filename in uncompressed nameblock...
+	record.setNameOffset(nameBlockOffset);
+
+	// Calculate total size for uncompressed nameblock...
+	nameBlockOffset +=
+		static_cast<uint32_t>(record.getFileName().size()) + 1;
+
+	// Payload is on disk, only keep the record itself...
+	record.freeDataBlock();
+	fileRecordList.push_back(std::move(record));
+
+	return true;
+}
+
+bool treClass::isWrittenCopy(treFileRecord& record,
+	const uint32_t& offset,
+	const uint32_t& storedSize)
+{
+	const char* stored = (0 == record.getFormat()) ?
+		record.getDataBlock().getUncompressedDataPtr() :
+		record.getDataBlock().getCompressedDataPtr();
+	if (NULL == stored)
+	{
+		return false;
+	}
+
+	// An MD5 match is not proof, compare against the bytes on disk...
+	outTreFile.flush();
+	if (!dedupFile.is_open())
+	{
+		dedupFile.open(filename.c_str(), std::ios_base::binary);
+	}
+	dedupFile.clear();
+	dedupFile.seekg(offset, std::ios_base::beg);
 
-		// Size is 0 for uncompressed records..
-		if (i->getFormat() == 0) // No Compression
+	char buffer[64 * 1024];
+	uint32_t compared = 0;
+	while (compared < storedSize)
+	{
+		const uint32_t length = std::min<uint32_t>(sizeof(buffer),
+			storedSize - compared);
+		dedupFile.read(buffer, length);
+		if (!dedupFile || (0 != memcmp(buffer, stored + compared, length)))
 		{
-			i->setSize(0);
-			totalDataSize += (uint32_t)dataFileSize;
+			return false;
 		}
-		else
+		compared += length;
+	}
+
+	return true;
+}
+
+std::string treClass::getDedupKey(const treFileRecord& record)
+{
+	// Same format, sizes and MD5 of the stored bytes means same payload
+	const uint32_t values[3] = {
+		record.getFormat(),
+		record.getSize(),
+		record.getUncompressedSize()
+	};
+
+	std::string key(reinterpret_cast<const char*>(values), sizeof(values));
+	key.append(record.getMD5sum().begin(), record.getMD5sum().end());
+
+	return key;
+}
+
+bool treClass::writeRecordsParallel(std::vector<treFileRecord>& inputList)
+{
+	// Workers read and compress records ahead of the writer, which
+	// writes them strictly in list order so offsets (and output bytes)
+	// are the same as the serial path.  At most depth records are held
+	// in memory at once.
+	const size_t numRecs = inputList.size();
+	const size_t depth = size_t(numThreads) * 4;
+
+	enum { PENDING, READY, FAILED };
+	std::vector<char> state(numRecs, PENDING);
+	size_t nextRecord = 0;
+	size_t written = 0;
+	bool abort = false;
+
+	std::mutex mutex;
+	std::condition_variable workReady;
+	std::condition_variable recordReady;
+
+	auto worker = [&]()
+	{
+		for (;;)
+		{
+			size_t index;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				// Don't get more than depth records ahead of writer...
+				workReady.wait(lock, [&]()
+					{
+						return abort || (nextRecord >= numRecs) ||
+							(nextRecord < written + depth);
+					});
+				if (abort || (nextRecord >= numRecs))
+				{
+					return;
+				}
+				index = nextRecord++;
+			}
+
+			const bool ok = prepareRecord(inputList[index]);
+
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				state[index] = ok ? READY : FAILED;
+			}
+			recordReady.notify_all();
+		}
+	};
+
+	std::vector<std::thread> pool;
+	for (unsigned int t = 0; t < numThreads; ++t)
+	{
+		pool.push_back(std::thread(worker));
+	}
+
+	bool rv = true;
+	for (size_t i = 0; i < numRecs; ++i)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			recordReady.wait(lock, [&]() { return PENDING != state[i]; });
+		}
+
+		if ((FAILED == state[i]) || !appendRecord(inputList[i]))
+		{
+			rv = false;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			written = i + 1;
+			abort = !rv;
+		}
+		workReady.notify_all();
+
+		if (!rv)
 		{
-			// Store size of actual data written to file...
-			i->setSize(i->getDataBlock().getCompressedSize());
-			totalDataSize += i->getDataBlock().getCompressedSize();
+			break;
 		}
+	}
+
+	for (auto& t : pool)
+	{
+		t.join();
+	}
 
-		// MD5 is calculated when written, store in file record now...
-		i->setMD5sum(i->getDataBlock().getMD5sum());
+	return rv;
+}
 
-		// Store offset to filename in uncompressed nameblock...
-		i->setNameOffset(totalNameBlockSize);
+bool treClass::endWrite()
+{
+	if (!outTreFile.is_open())
+	{
+		return false;
+	}
 
-		// Calculate total size for uncompressed nameblock...
-		totalNameBlockSize +=
-			static_cast<uint32_t>(i->getFileName().size()) + 1;
+	if (fileRecordList.empty())
+	{
+		SWG_LOG(LOG_ERROR) << "No file records to write!" << std::endl;
+		outTreFile.close();
+		return false;
 	}
 
+	bool rv = writeFileBlock(outTreFile);
+
+	// Close output file...
+	outTreFile.close();
+	dedupIndex.clear();
+	dedupFile.close();
+
+	return rv && !outTreFile.fail();
+}
+
+bool treClass::writeFileBlock(std::ostream& file)
+{
+	// Separate from the read side blocks that record names point into
+	treDataBlock outFileBlock;
+	treDataBlock outNameBlock;
+
+	std::vector<treFileRecord>::iterator i;
 
 	// Get postion in file where compressed file records start...
 	fileOffset = (uint32_t)file.tellp();
@@ -676,8 +1667,8 @@ bool treClass::writeFileBlock(std::ostream& file)
 	// Allocate file record block...
 	fileFinalSize =
 		static_cast<uint32_t>(fileRecordList.size()) * treFileRecord::SIZE;
-	fileBlock.allocateUncompressedData(fileFinalSize);
-	char* fileData = fileBlock.getUncompressedDataPtr();
+	outFileBlock.allocateUncompressedData(fileFinalSize);
+	char* fileData = outFileBlock.getUncompressedDataPtr();
 	uint32_t currentOffset = 0;
 	for (i = fileRecordList.begin(); i != fileRecordList.end(); ++i)
 	{
@@ -685,9 +1676,9 @@ bool treClass::writeFileBlock(std::ostream& file)
 		currentOffset += i->writeToBuffer(&(fileData[currentOffset]));
 	}
 	// Write file datablock...
-	if (!(fileBlock.compressAndWrite(file, fileCompression)))
+	if (!(outFileBlock.compressAndWrite(file, fileCompression, compressionLevel)))
 	{
-		std::cout << "compress/write failed!" << std::endl;
+		SWG_LOG(LOG_ERROR) << "compress/write failed!" << std::endl;
 		return false;
 	}
 
@@ -701,13 +1692,13 @@ bool treClass::writeFileBlock(std::ostream& file)
 	}
 	else
 	{
-		fileSize = fileBlock.getCompressedSize();
+		fileSize = outFileBlock.getCompressedSize();
 	}
 
 	// Allocate uncompressed name block...
-	nameFinalSize = totalNameBlockSize;
-	nameBlock.allocateUncompressedData(nameFinalSize);
-	char* nameData = nameBlock.getUncompressedDataPtr();
+	nameFinalSize = nameBlockOffset;
+	outNameBlock.allocateUncompressedData(nameFinalSize);
+	char* nameData = outNameBlock.getUncompressedDataPtr();
 	for (i = fileRecordList.begin(); i != fileRecordList.end(); ++i)
 	{
 		// Copy filename(with terminating null) into datablock...
@@ -719,9 +1710,9 @@ bool treClass::writeFileBlock(std::ostream& file)
 	}
 
 	// Write name datablock...
-	if (!(nameBlock.compressAndWrite(file, nameCompression)))
+	if (!(outNameBlock.compressAndWrite(file, nameCompression, compressionLevel)))
 	{
-		std::cout << "compress/write failed!" << std::endl;
+		SWG_LOG(LOG_ERROR) << "compress/write failed!" << std::endl;
 		return false;
 	}
 
@@ -735,7 +1726,7 @@ bool treClass::writeFileBlock(std::ostream& file)
 	}
 	else
 	{
-		nameSize = nameBlock.getCompressedSize();
+		nameSize = outNameBlock.getCompressedSize();
 	}
 
 	// Write MD5 sums...
@@ -762,7 +1753,7 @@ void treClass::setFileBlockCompression(const uint32_t& f)
 	}
 	else
 	{
-		std::cout << __FILE__ << ": " << __LINE__
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
 			<< ": Failed: Unknown compression" << std::endl;
 	}
 }
@@ -775,7 +1766,7 @@ void treClass::setNameBlockCompression(const uint32_t& f)
 	}
 	else
 	{
-		std::cout << __FILE__ << ": " << __LINE__
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
 			<< ": Failed: Unknown compression" << std::endl;
 	}
 }
@@ -24,12 +24,17 @@
  */
 
 #include <treLib/treDataBlock.hpp>
+#include <swgLib/logger.hpp>
 #include <iostream>
 #include <zlib.h>
 #include <md5.h> // For md5
 #include <memory.h>
 
 treDataBlock::treDataBlock()
+	:
+	checksum(0),
+	uncompressedSize(0),
+	compressedSize(0)
 {
 }
 
@@ -107,12 +112,7 @@ bool treDataBlock::allocateUncompressedData(const uint32_t& size)
 bool treDataBlock::setUncompressedData(const char* newData,
 	const uint32_t& newDataSize)
 {
-	freeCompressedData();
-	freeUncompressedData();
-
-	allocateUncompressedData(newDataSize);
-	data.reset( new char[uncompressedSize] );
-	if (nullptr == data)
+	if (!allocateUncompressedData(newDataSize))
 	{
 		return false;
 	}
@@ -122,6 +122,21 @@ bool treDataBlock::setUncompressedData(const char* newData,
 	return true;
 }
 
+bool treDataBlock::setCompressedData(const char* newData,
+	const uint32_t& newDataSize)
+{
+	freeCompressedData();
+
+	compData.reset(new char[newDataSize]);
+	compressedSize = newDataSize;
+	memcpy(compData.get(), newData, compressedSize);
+
+	// Calculate md5sum
+	calculateMD5sum(compData.get(), compressedSize);
+
+	return true;
+}
+
 bool treDataBlock::readAndUncompress(
 	std::istream& file,
 	const int& format,
@@ -133,64 +148,51 @@ bool treDataBlock::readAndUncompress(
 
 	if (2 == format)
 	{
-		data.reset(new char[uncompSize]);
-
 		compressedSize = compSize;
 		compData.reset( new char[compSize]);
 		file.read(compData.get(), compSize);
+
+		return uncompressData(compData.get(), compSize, uncompSize);
+	}
+	else if (0 == format) // No compression
+	{
 		uncompressedSize = uncompSize;
+		data.reset( new char[uncompSize]);
+		file.read(data.get(), uncompSize);
+	}
+	else
+	{
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+			<< ": Unknown format: " << format << std::endl;
+		return false;
+	}
 
-		//std::cout << "Uncompressing data block...";
-		int result = uncompress((Bytef*)data.get(),
-			(uLongf*)&uncompressedSize,
-			(Bytef*)compData.get(),
-			compSize);
+	return true;
+}
 
-		if (Z_OK == result)
-		{
-			//std::cout << "success." << std::endl;
-		}
-		else if (Z_MEM_ERROR == result)
-		{
-			std::cout << __FILE__ << ": " << __LINE__
-				<< ": uncompress: Memory error!" << std::endl;
-			return false;
-		}
-		else if (Z_BUF_ERROR == result)
-		{
-			std::cout << __FILE__ << ": " << __LINE__
-				<< ": uncompress: Buffer error!" << std::endl;
-			return false;
-		}
-		else if (Z_DATA_ERROR == result)
-		{
-			std::cout << __FILE__ << ": " << __LINE__
-				<< ": uncompress: Data error!" << std::endl;
-			return false;
-		}
-		else
-		{
-			std::cout << __FILE__ << ": " << __LINE__
-				<< ": uncompress: Unknown error!" << std::endl;
-			return false;
-		}
+bool treDataBlock::uncompressFromBuffer(
+	const char* buffer,
+	const int& format,
+	const uint32_t& compSize,
+	const uint32_t& uncompSize )
+{
+	freeCompressedData();
+	freeUncompressedData();
 
-		if (uncompressedSize != uncompSize)
-		{
-			std::cout << __FILE__ << ": " << __LINE__
-				<< ": Uncompressed size does not match expected size!"
-				<< std::endl;
-			return false;
-		}
+	if (2 == format)
+	{
+		// Inflate straight from caller's buffer, no compressed copy...
+		return uncompressData(buffer, compSize, uncompSize);
 	}
 	else if (0 == format) // No compression
 	{
+		uncompressedSize = uncompSize;
 		data.reset( new char[uncompSize]);
-		file.read(data.get(), uncompSize);
+		memcpy(data.get(), buffer, uncompSize);
 	}
 	else
 	{
-		std::cout << __FILE__ << ": " << __LINE__
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
 			<< ": Unknown format: " << format << std::endl;
 		return false;
 	}
@@ -198,9 +200,79 @@ bool treDataBlock::readAndUncompress(
 	return true;
 }
 
+bool treDataBlock::uncompressData(
+	const char* src,
+	const uint32_t& compSize,
+	const uint32_t& uncompSize )
+{
+	data.reset(new char[uncompSize]);
+	uncompressedSize = uncompSize;
+
+	//std::cout << "Uncompressing data block...";
+	uLongf destSize = uncompSize;
+	int result = uncompress((Bytef*)data.get(),
+		&destSize,
+		(const Bytef*)src,
+		compSize);
+	uncompressedSize = (uint32_t)destSize;
+
+	if (Z_OK == result)
+	{
+		//std::cout << "success." << std::endl;
+	}
+	else if (Z_MEM_ERROR == result)
+	{
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+			<< ": uncompress: Memory error!" << std::endl;
+		return false;
+	}
+	else if (Z_BUF_ERROR == result)
+	{
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+			<< ": uncompress: Buffer error!" << std::endl;
+		return false;
+	}
+	else if (Z_DATA_ERROR == result)
+	{
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+			<< ": uncompress: Data error!" << std::endl;
+		return false;
+	}
+	else
+	{
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+			<< ": uncompress: Unknown error!" << std::endl;
+		return false;
+	}
+
+	if (uncompressedSize != uncompSize)
+	{
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+			<< ": Uncompressed size does not match expected size!"
+			<< std::endl;
+		return false;
+	}
+
+	return true;
+}
+
 bool treDataBlock::compressAndWrite(
 	std::ostream& file,
-	const int& format
+	const int& format,
+	const int& level
+)
+{
+	if (!compressData(format, level))
+	{
+		return false;
+	}
+
+	return writeData(file, format);
+}
+
+bool treDataBlock::compressData(
+	const int& format,
+	const int& level
 )
 {
 	// Fail if no data to write...
@@ -215,16 +287,17 @@ bool treDataBlock::compressAndWrite(
 	// Zlib compression...
 	if (2 == format)
 	{
-		// Allocate temp buffer to compress data into...
-		uint32_t tempDataLength = uncompressedSize * 2;
-		char* tempData = new char[tempDataLength];
+		// Allocate buffer large enough for the worst case...
+		uLongf tempDataLength = compressBound(uncompressedSize);
+		std::unique_ptr<char[]> tempData(new char[tempDataLength]);
 
 		// Compress the data...
-		int result = compress(
-			(Bytef*)tempData,
-			(uLongf*)&tempDataLength,
+		int result = compress2(
+			(Bytef*)tempData.get(),
+			&tempDataLength,
 			(const Bytef*)data.get(),
-			uncompressedSize
+			uncompressedSize,
+			level
 		);
 
 		if (Z_OK == result)
@@ -233,49 +306,75 @@ bool treDataBlock::compressAndWrite(
 		}
 		else if (Z_MEM_ERROR == result)
 		{
-			std::cout << "compress: Memory error!" << std::endl;
-			delete[] tempData;
+			SWG_LOG(LOG_ERROR) << "compress: Memory error!" << std::endl;
 			return false;
 		}
 		else if (Z_BUF_ERROR == result)
 		{
-			std::cout << "compress: Buffer error!" << std::endl;
-			delete[] tempData;
+			SWG_LOG(LOG_ERROR) << "compress: Buffer error!" << std::endl;
+			return false;
+		}
+		else if (Z_STREAM_ERROR == result)
+		{
+			SWG_LOG(LOG_ERROR) << "compress: Invalid level: " << level << std::endl;
 			return false;
 		}
 		else
 		{
-			std::cout << "compress: Unknown error!" << std::endl;
-			delete[] tempData;
+			SWG_LOG(LOG_ERROR) << "compress: Unknown error!" << std::endl;
 			return false;
 		}
 
-		// Create final compressed data and copy into it...
-		compressedSize = tempDataLength;
-		compData.reset( new char[compressedSize]);
-		memcpy(compData.get(), tempData, compressedSize);
+		// The temp buffer is sized for incompressible input, so keep an
+		// exact copy rather than holding the slack for the block's life...
+		compressedSize = (uint32_t)tempDataLength;
+		compData.reset(new char[compressedSize]);
+		memcpy(compData.get(), tempData.get(), compressedSize);
 
 		// Calculate md5sum
 		calculateMD5sum(compData.get(), compressedSize);
+	}
+	else if (0 == format) // No compression
+	{
+		// Calculate md5sum
+		calculateMD5sum(data.get(), uncompressedSize);
+	}
+	else
+	{
+		SWG_LOG(LOG_ERROR) << "Unknown format: " << format << std::endl;
+		return false;
+	}
 
-		// Delete the temp buffer...
-		delete[] tempData;
+	return true;
+}
 
+bool treDataBlock::writeData(
+	std::ostream& file,
+	const int& format
+)
+{
+	if (2 == format)
+	{
 		// Write compressed data...
+		if (NULL == compData)
+		{
+			return false;
+		}
 		file.write(compData.get(), compressedSize);
 	}
 	else if (0 == format) // No compression
 	{
-		// Calculate md5sum
-		calculateMD5sum(data.get(), uncompressedSize);
-
+		if (NULL == data)
+		{
+			return false;
+		}
 		file.write(data.get(), uncompressedSize);
 	}
 	else
 	{
-		std::cout << "Unknown format: " << format << std::endl;
+		SWG_LOG(LOG_ERROR) << "Unknown format: " << format << std::endl;
 		return false;
 	}
 
-	return true;
+	return file.good();
 }
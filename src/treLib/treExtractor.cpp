@@ -0,0 +1,254 @@
+/** -*-c++-*-
+ *  \class  treExtractor
+ *  \file   treExtractor.cpp
+ *  \author Ken Sewell
+
+ treLib is used for the creation and deconstruction of .TRE files.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of treLib.
+
+ treLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ treLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with treLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <treLib/treExtractor.hpp>
+#include <swgLib/logger.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <thread>
+#include <unordered_map>
+
+#include <sys/stat.h> // For mkdir()
+#include <sys/types.h> // For mkdir()
+
+#ifdef WIN32
+#include <direct.h> // For _mkdir()
+#endif
+
+treExtractor::treExtractor(const treClass& t)
+	:
+	tre(t),
+	numThreads(0),
+	nextWork(0),
+	numExtracted(0),
+	numFailed(0),
+	bytesWritten(0)
+{
+}
+
+treExtractor::~treExtractor()
+{
+}
+
+bool treExtractor::extract()
+{
+	if (0 == tre.getNumRecords())
+	{
+		return true;
+	}
+
+	return extract(0, tre.getNumRecords() - 1);
+}
+
+bool treExtractor::extract(const uint32_t& first, const uint32_t& last)
+{
+	numExtracted = 0;
+	numFailed = 0;
+	bytesWritten = 0;
+
+	const std::vector<treFileRecord>& records = tre.getFileRecordList();
+	if ((first > last) || (last >= records.size()))
+	{
+		SWG_LOG(LOG_ERROR) << "Record out of range" << std::endl;
+		return false;
+	}
+
+	// When a name is repeated the later record overwrote the earlier one
+	// when extracting serially, so only keep the last one.
+	// Names that would land outside outputDir count as failures.
+	std::unordered_map<std::string, uint32_t> lastByName;
+	for (uint32_t i = first; i <= last; ++i)
+	{
+		const std::string name = records[i].getFileName();
+		if (!treClass::isSafeRecordName(name))
+		{
+			SWG_LOG(LOG_ERROR) << "Unsafe record name " << i << ": "
+				<< name << std::endl;
+			++numFailed;
+			continue;
+		}
+		lastByName[name] = i;
+	}
+
+	workList.clear();
+	workList.reserve(lastByName.size());
+	for (const auto& entry : lastByName)
+	{
+		workList.push_back(entry.second);
+	}
+
+	// Hand out records in the order they are stored on disk...
+	std::sort(workList.begin(), workList.end(),
+		[&records](const uint32_t& a, const uint32_t& b)
+		{
+			return records[a].getOffset() < records[b].getOffset();
+		});
+
+	if (!makeDirectories(workList))
+	{
+		return false;
+	}
+
+	unsigned int threads = numThreads;
+	if (0 == threads)
+	{
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+	threads = static_cast<unsigned int>(
+		std::min<size_t>(threads, workList.size()));
+
+	nextWork = 0;
+	std::vector<std::thread> pool;
+	for (unsigned int i = 1; i < threads; ++i)
+	{
+		pool.push_back(std::thread(&treExtractor::worker, this));
+	}
+
+	// Calling thread works too...
+	worker();
+
+	for (auto& t : pool)
+	{
+		t.join();
+	}
+
+	return (0 == numFailed);
+}
+
+std::string treExtractor::getOutputPath(const std::string& name) const
+{
+	if (outputDir.empty())
+	{
+		return name;
+	}
+
+	return outputDir + "/" + name;
+}
+
+bool treExtractor::makeDirectories(const std::vector<uint32_t>& records) const
+{
+	const std::vector<treFileRecord>& fileRecords = tre.getFileRecordList();
+
+	// Collect every distinct parent directory.  A std::set keeps parents
+	// sorted in front of their children.
+	std::set<std::string> directories;
+	for (const auto& i : records)
+	{
+		const std::string name = fileRecords[i].getFileName();
+		std::string::size_type end = name.find('/');
+		while (std::string::npos != end)
+		{
+			directories.insert(name.substr(0, end));
+			end = name.find('/', end + 1);
+		}
+	}
+
+	if (!outputDir.empty())
+	{
+#ifdef WIN32
+		_mkdir(outputDir.c_str());
+#else
+		mkdir(outputDir.c_str(), 0777);
+#endif
+	}
+
+	for (const auto& dir : directories)
+	{
+		const std::string fullpath(getOutputPath(dir));
+#ifdef WIN32
+		_mkdir(fullpath.c_str());
+#else
+		mkdir(fullpath.c_str(), 0777);
+#endif
+	}
+
+	return true;
+}
+
+void treExtractor::worker()
+{
+	for (;;)
+	{
+		const size_t work = nextWork++;
+		if (work >= workList.size())
+		{
+			return;
+		}
+
+		if (extractRecord(workList[work]))
+		{
+			++numExtracted;
+		}
+		else
+		{
+			++numFailed;
+		}
+	}
+}
+
+bool treExtractor::extractRecord(const uint32_t& recordNum)
+{
+	const treFileRecord& record = tre.getFileRecordList()[recordNum];
+
+	treDataBlock dataBlock;
+	if (!tre.readRecord(recordNum, dataBlock))
+	{
+		std::lock_guard<std::mutex> lock(printMutex);
+		SWG_LOG(LOG_ERROR) << "Failed to read record " << recordNum << ": "
+			<< record.getFileName() << std::endl;
+		return false;
+	}
+
+	// Attempt to open output file...
+	std::ofstream dataFile(getOutputPath(record.getFileName()).c_str(),
+		std::ofstream::binary);
+	if (!dataFile.is_open())
+	{
+		std::lock_guard<std::mutex> lock(printMutex);
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+			<< ": Failed to open output file: "
+			<< record.getFileName() << std::endl;
+		return false;
+	}
+
+	// Write uncompressed data to file...
+	dataFile.write(dataBlock.getUncompressedDataPtr(),
+		record.getUncompressedSize());
+	dataFile.close();
+	if (dataFile.fail())
+	{
+		std::lock_guard<std::mutex> lock(printMutex);
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+			<< ": Failed to write output file: "
+			<< record.getFileName() << std::endl;
+		return false;
+	}
+
+	bytesWritten += record.getUncompressedSize();
+
+	return true;
+}
@@ -27,6 +27,7 @@
 #include <iostream>
 #include <bitset>
 #include <cstring> // For memcpy
+#include <algorithm>
 
 treFileRecord::treFileRecord() :
 	checksum(0),
@@ -34,8 +35,11 @@ treFileRecord::treFileRecord() :
 	offset(0),
 	format(0),
 	size(0),
-	nameOffset(0)
+	nameOffset(0),
+	nameSize(0),
+	name("")
 {
+	md5sum.fill(0);
 }
 
 treFileRecord::treFileRecord(const treFileRecord& rec) :
@@ -44,8 +48,71 @@ treFileRecord::treFileRecord(const treFileRecord& rec) :
 	offset(rec.offset),
 	format(rec.format),
 	size(rec.size),
-	nameOffset(rec.nameOffset)
+	nameOffset(rec.nameOffset),
+	nameSize(rec.nameSize),
+	name(rec.name),
+	md5sum(rec.md5sum)
 {
+	// Owned names are copied, views keep pointing at the name block
+	if (rec.ownedName)
+	{
+		setFileName(rec.getFileName());
+	}
+}
+
+treFileRecord::treFileRecord(treFileRecord&& rec) :
+	checksum(rec.checksum),
+	uncompressedSize(rec.uncompressedSize),
+	offset(rec.offset),
+	format(rec.format),
+	size(rec.size),
+	nameOffset(rec.nameOffset),
+	nameSize(rec.nameSize),
+	name(rec.name),
+	md5sum(rec.md5sum),
+	ownedName(std::move(rec.ownedName)),
+	dataBlock(std::move(rec.dataBlock))
+{
+	rec.name = "";
+	rec.nameSize = 0;
+}
+
+void treFileRecord::setFileName(const std::string& fn)
+{
+	ownedName.reset(new char[fn.size() + 1]);
+	memcpy(ownedName.get(), fn.c_str(), fn.size() + 1);
+	name = ownedName.get();
+	nameSize = static_cast<uint32_t>(fn.size());
+}
+
+void treFileRecord::setFileNameView(const char* n, const uint32_t& s)
+{
+	ownedName.reset();
+	name = n;
+	nameSize = s;
+}
+
+void treFileRecord::setMD5sum(const std::vector<unsigned char>& newSum)
+{
+	md5sum.fill(0);
+	std::copy(newSum.begin(),
+		newSum.begin() + std::min(newSum.size(), md5sum.size()),
+		md5sum.begin());
+}
+
+void treFileRecord::setMD5sum(const unsigned char* newSum)
+{
+	memcpy(md5sum.data(), newSum, md5sum.size());
+}
+
+treDataBlock& treFileRecord::getDataBlock()
+{
+	if (!dataBlock)
+	{
+		dataBlock.reset(new treDataBlock);
+	}
+
+	return *dataBlock;
 }
 
 bool treFileRecord::read(std::istream& file)
@@ -215,6 +282,37 @@ void treFileRecord::operator=(const treFileRecord& src)
 		this->format = src.format;
 		this->size = src.size;
 		this->nameOffset = src.nameOffset;
+		this->md5sum = src.md5sum;
+		if (src.ownedName)
+		{
+			setFileName(src.getFileName());
+		}
+		else
+		{
+			setFileNameView(src.name, src.nameSize);
+		}
+		// Like the copy constructor, don't keep a payload of our own
+		this->dataBlock.reset();
+	}
+}
+
+void treFileRecord::operator=(treFileRecord&& src)
+{
+	if (this != &src)
+	{
+		this->checksum = src.checksum;
+		this->uncompressedSize = src.uncompressedSize;
+		this->offset = src.offset;
+		this->format = src.format;
+		this->size = src.size;
+		this->nameOffset = src.nameOffset;
+		this->nameSize = src.nameSize;
+		this->name = src.name;
+		this->md5sum = src.md5sum;
+		this->ownedName = std::move(src.ownedName);
+		this->dataBlock = std::move(src.dataBlock);
+		src.name = "";
+		src.nameSize = 0;
 	}
 }
 
@@ -232,24 +330,14 @@ bool treFileRecord::operator==(const treFileRecord& src) const
 
 bool treFileRecord::readMD5(std::istream& file)
 {
-	md5sum.clear();
-	for (int j = 0; j < 16; ++j)
-	{
-		char c;
-		file.read(&c, 1);
-		md5sum.push_back(c);
-	}
+	file.read(reinterpret_cast<char*>(md5sum.data()), md5sum.size());
 
 	return true;
 }
 
 bool treFileRecord::writeMD5(std::ostream& file) const
 {
-	std::vector<unsigned char>::const_iterator j;
-	for (j = md5sum.begin(); j < md5sum.end(); ++j)
-	{
-		file.write((char*)&(*j), 1);
-	}
+	file.write(reinterpret_cast<const char*>(md5sum.data()), md5sum.size());
 
 	return true;
 }
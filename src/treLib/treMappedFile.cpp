@@ -0,0 +1,253 @@
+/** -*-c++-*-
+ *  \class  treMappedFile
+ *  \file   treMappedFile.cpp
+ *  \author Ken Sewell
+
+ treLib is used for the creation and deconstruction of .TRE files.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of treLib.
+
+ treLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ treLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with treLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <treLib/treMappedFile.hpp>
+#include <cstring> // For memcpy
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h> // For mmap()
+#include <sys/stat.h> // For fstat()
+#include <fcntl.h> // For open()
+#include <unistd.h> // For close(), pread()
+#include <cerrno>
+#endif
+
+treMappedFile::treMappedFile()
+	:
+	mapData(nullptr),
+	mapSize(0),
+#ifdef WIN32
+	fileHandle(INVALID_HANDLE_VALUE),
+	mapHandle(nullptr)
+#else
+	fd(-1)
+#endif
+{
+}
+
+treMappedFile::~treMappedFile()
+{
+	close();
+}
+
+#ifdef WIN32
+
+bool treMappedFile::open(const std::string& filename, const bool map)
+{
+	close();
+
+	fileHandle = CreateFileA(filename.c_str(),
+		GENERIC_READ,
+		FILE_SHARE_READ,
+		NULL,
+		OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL,
+		NULL);
+	if (INVALID_HANDLE_VALUE == fileHandle)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(fileHandle, &size) || (0 == size.QuadPart))
+	{
+		close();
+		return false;
+	}
+	mapSize = static_cast<uint64_t>(size.QuadPart);
+
+	if (!map)
+	{
+		return true;
+	}
+
+	mapHandle = CreateFileMappingA(fileHandle, NULL, PAGE_READONLY,
+		0, 0, NULL);
+	if (nullptr == mapHandle)
+	{
+		close();
+		return false;
+	}
+
+	mapData = static_cast<const char*>(
+		MapViewOfFile(mapHandle, FILE_MAP_READ, 0, 0, 0));
+	if (nullptr == mapData)
+	{
+		close();
+		return false;
+	}
+
+	return true;
+}
+
+bool treMappedFile::isOpen() const
+{
+	return (INVALID_HANDLE_VALUE != fileHandle);
+}
+
+bool treMappedFile::readAt(const uint64_t& offset, char* buffer,
+	const uint32_t& size) const
+{
+	if ((offset + size) > mapSize)
+	{
+		return false;
+	}
+
+	if (nullptr != mapData)
+	{
+		memcpy(buffer, mapData + offset, size);
+		return true;
+	}
+
+	// Overlapped offset keeps reads independent of the file pointer
+	OVERLAPPED ov;
+	memset(&ov, 0, sizeof(ov));
+	ov.Offset = static_cast<DWORD>(offset & 0xffffffff);
+	ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+	DWORD bytesRead = 0;
+	if (!ReadFile(fileHandle, buffer, size, &bytesRead, &ov))
+	{
+		return false;
+	}
+
+	return (bytesRead == size);
+}
+
+void treMappedFile::close()
+{
+	if (nullptr != mapData)
+	{
+		UnmapViewOfFile(mapData);
+		mapData = nullptr;
+	}
+	if (nullptr != mapHandle)
+	{
+		CloseHandle(mapHandle);
+		mapHandle = nullptr;
+	}
+	if (INVALID_HANDLE_VALUE != fileHandle)
+	{
+		CloseHandle(fileHandle);
+		fileHandle = INVALID_HANDLE_VALUE;
+	}
+	mapSize = 0;
+}
+
+#else
+
+bool treMappedFile::open(const std::string& filename, const bool map)
+{
+	close();
+
+	fd = ::open(filename.c_str(), O_RDONLY);
+	if (fd < 0)
+	{
+		return false;
+	}
+
+	// mmap() can not map an empty file...
+	struct stat st;
+	if ((0 != fstat(fd, &st)) || (0 == st.st_size))
+	{
+		close();
+		return false;
+	}
+	mapSize = static_cast<uint64_t>(st.st_size);
+
+	if (!map)
+	{
+		return true;
+	}
+
+	void* ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	if (MAP_FAILED == ptr)
+	{
+		close();
+		return false;
+	}
+
+	mapData = static_cast<const char*>(ptr);
+
+	return true;
+}
+
+bool treMappedFile::isOpen() const
+{
+	return (fd >= 0);
+}
+
+bool treMappedFile::readAt(const uint64_t& offset, char* buffer,
+	const uint32_t& size) const
+{
+	if ((offset + size) > mapSize)
+	{
+		return false;
+	}
+
+	if (nullptr != mapData)
+	{
+		memcpy(buffer, mapData + offset, size);
+		return true;
+	}
+
+	// pread() does not touch the shared file offset
+	uint32_t total = 0;
+	while (total < size)
+	{
+		const ssize_t result = pread(fd, buffer + total, size - total,
+			static_cast<off_t>(offset + total));
+		if ((result < 0) && (EINTR == errno))
+		{
+			continue;
+		}
+		if (result <= 0)
+		{
+			return false;
+		}
+		total += static_cast<uint32_t>(result);
+	}
+
+	return true;
+}
+
+void treMappedFile::close()
+{
+	if (nullptr != mapData)
+	{
+		munmap(const_cast<char*>(mapData), mapSize);
+		mapData = nullptr;
+	}
+	if (fd >= 0)
+	{
+		::close(fd);
+		fd = -1;
+	}
+	mapSize = 0;
+}
+
+#endif
@@ -0,0 +1,150 @@
+/** -*-c++-*-
+ *  \class  treRecordCache
+ *  \file   treRecordCache.cpp
+ *  \author Ken Sewell
+
+ treLib is used for the creation and deconstruction of .TRE files.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of treLib.
+
+ treLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ treLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with treLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <treLib/treRecordCache.hpp>
+
+treRecordCache::treRecordCache()
+	:
+	maxSize(0),
+	size(0),
+	hits(0),
+	misses(0),
+	evictions(0)
+{
+}
+
+treRecordCache::~treRecordCache()
+{
+}
+
+void treRecordCache::setMaxSize(const uint64_t& bytes)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	maxSize = bytes;
+	evict();
+}
+
+uint64_t treRecordCache::getSize() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return size;
+}
+
+treRecordCache::blockPtr
+treRecordCache::find(const treClass* tre, const uint32_t& index)
+{
+	key k;
+	k.tre = tre;
+	k.index = index;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	auto entry = entries.find(k);
+	if (entries.end() == entry)
+	{
+		++misses;
+		return blockPtr();
+	}
+
+	// Move to front of LRU list...
+	lru.splice(lru.begin(), lru, entry->second);
+	++hits;
+
+	return entry->second->second;
+}
+
+bool treRecordCache::contains(const treClass* tre,
+	const uint32_t& index) const
+{
+	key k;
+	k.tre = tre;
+	k.index = index;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	return (entries.end() != entries.find(k));
+}
+
+treRecordCache::blockPtr
+treRecordCache::insert(const treClass* tre, const uint32_t& index,
+	const blockPtr& block)
+{
+	if (!block)
+	{
+		return block;
+	}
+
+	key k;
+	k.tre = tre;
+	k.index = index;
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	// Never cache something that alone is larger than the budget
+	if (block->getUncompressedSize() > maxSize)
+	{
+		return block;
+	}
+
+	auto entry = entries.find(k);
+	if (entries.end() != entry)
+	{
+		// Someone else loaded it first, share theirs...
+		lru.splice(lru.begin(), lru, entry->second);
+		return entry->second->second;
+	}
+
+	lru.push_front(std::make_pair(k, block));
+	entries[k] = lru.begin();
+	size += block->getUncompressedSize();
+	evict();
+
+	return block;
+}
+
+void treRecordCache::evict()
+{
+	// Drop least recently used records until under budget...
+	while ((size > maxSize) && !lru.empty())
+	{
+		size -= lru.back().second->getUncompressedSize();
+		entries.erase(lru.back().first);
+		lru.pop_back();
+		++evictions;
+	}
+}
+
+void treRecordCache::clear()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	entries.clear();
+	lru.clear();
+	size = 0;
+}
+
+void treRecordCache::resetCounters()
+{
+	hits = 0;
+	misses = 0;
+	evictions = 0;
+}
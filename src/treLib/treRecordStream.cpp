@@ -0,0 +1,316 @@
+/** -*-c++-*-
+ *  \class  treRecordStream
+ *  \file   treRecordStream.cpp
+ *  \author Ken Sewell
+
+ treLib is used for the creation and deconstruction of .TRE files.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of treLib.
+
+ treLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ treLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with treLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <treLib/treRecordStream.hpp>
+#include <swgLib/logger.hpp>
+#include <treLib/treClass.hpp>
+#include <algorithm>
+#include <cstring> // For memmove
+#include <iostream>
+#include <zlib.h>
+
+class treRecordStreambuf::inflater
+{
+public:
+	inflater() : initialized(false)
+	{
+		memset(&strm, 0, sizeof(strm));
+	}
+	~inflater()
+	{
+		end();
+	}
+
+	bool reset()
+	{
+		end();
+		memset(&strm, 0, sizeof(strm));
+		initialized = (Z_OK == inflateInit(&strm));
+		return initialized;
+	}
+
+	void end()
+	{
+		if (initialized)
+		{
+			inflateEnd(&strm);
+			initialized = false;
+		}
+	}
+
+	z_stream strm;
+	bool initialized;
+};
+
+treRecordStreambuf::treRecordStreambuf(const treClass& t,
+	const uint32_t& recordNum)
+	:
+	tre(t),
+	record(recordNum),
+	format(0),
+	size(0),
+	storedSize(0),
+	consumed(0),
+	produced(0),
+	open(false)
+{
+	if (recordNum >= tre.getFileRecordList().size())
+	{
+		SWG_LOG(LOG_ERROR) << "Record out of range" << std::endl;
+		return;
+	}
+
+	const treFileRecord& rec = tre.getFileRecordList()[recordNum];
+	format = rec.getFormat();
+	size = rec.getUncompressedSize();
+
+	if (2 == format)
+	{
+		storedSize = rec.getSize();
+		input.resize(INPUT_SIZE);
+		zstream.reset(new inflater);
+	}
+	else if (0 == format)
+	{
+		storedSize = size;
+	}
+	else
+	{
+		SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+			<< ": Unknown format: " << format << std::endl;
+		return;
+	}
+
+	window.resize(WINDOW_SIZE);
+	open = restart();
+}
+
+treRecordStreambuf::~treRecordStreambuf()
+{
+}
+
+bool treRecordStreambuf::restart()
+{
+	consumed = 0;
+	produced = 0;
+	setg(&window[0], &window[0], &window[0]);
+
+	if (2 == format)
+	{
+		return zstream->reset();
+	}
+
+	return true;
+}
+
+bool treRecordStreambuf::fill()
+{
+	if (produced >= size)
+	{
+		return false;
+	}
+
+	// Keep the tail of the old data so small seeks back are cheap...
+	const size_t keep =
+		std::min<size_t>(PUTBACK_SIZE, gptr() - eback());
+	memmove(&window[0], gptr() - keep, keep);
+
+	char* dst = &window[0] + keep;
+	const uint32_t avail = static_cast<uint32_t>(WINDOW_SIZE - keep);
+	uint32_t count = 0;
+
+	if (0 == format)
+	{
+		// Uncompressed, read straight into the window...
+		count = std::min<uint32_t>(avail, size - uint32_t(produced));
+		if (!tre.readStoredData(record, uint32_t(produced), dst, count))
+		{
+			SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+				<< ": Failed to read record!" << std::endl;
+			open = false;
+			return false;
+		}
+		consumed += count;
+	}
+	else
+	{
+		z_stream& strm = zstream->strm;
+		strm.next_out = (Bytef*)dst;
+		strm.avail_out = avail;
+
+		// Inflate until at least some output is produced...
+		while (strm.avail_out == avail)
+		{
+			if ((0 == strm.avail_in) && (consumed < storedSize))
+			{
+				const uint32_t n =
+					std::min<uint32_t>(INPUT_SIZE, storedSize - consumed);
+				if (!tre.readStoredData(record, consumed, &input[0], n))
+				{
+					SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+						<< ": Failed to read record!" << std::endl;
+					open = false;
+					return false;
+				}
+				consumed += n;
+				strm.next_in = (Bytef*)&input[0];
+				strm.avail_in = n;
+			}
+
+			const int result = inflate(&strm, Z_NO_FLUSH);
+			if (Z_STREAM_END == result)
+			{
+				break;
+			}
+			else if (Z_OK != result)
+			{
+				SWG_LOG(LOG_ERROR) << __FILE__ << ": " << __LINE__
+					<< ": inflate error: " << result << std::endl;
+				open = false;
+				return false;
+			}
+		}
+
+		count = avail - strm.avail_out;
+	}
+
+	setg(&window[0], dst, dst + count);
+	produced += count;
+
+	return (count > 0);
+}
+
+treRecordStreambuf::int_type treRecordStreambuf::underflow()
+{
+	if (gptr() < egptr())
+	{
+		return traits_type::to_int_type(*gptr());
+	}
+
+	if (!open || !fill())
+	{
+		return traits_type::eof();
+	}
+
+	return traits_type::to_int_type(*gptr());
+}
+
+std::streamsize treRecordStreambuf::showmanyc()
+{
+	const uint64_t position = produced - (egptr() - gptr());
+	if (position >= size)
+	{
+		return -1;
+	}
+
+	return static_cast<std::streamsize>(size - position);
+}
+
+treRecordStreambuf::pos_type
+treRecordStreambuf::seekoff(off_type off, std::ios_base::seekdir dir,
+	std::ios_base::openmode which)
+{
+	if (!open || (0 == (which & std::ios_base::in)))
+	{
+		return pos_type(off_type(-1));
+	}
+
+	const int64_t current = int64_t(produced) - (egptr() - gptr());
+	int64_t target = off;
+	if (std::ios_base::cur == dir)
+	{
+		target += current;
+	}
+	else if (std::ios_base::end == dir)
+	{
+		target += size;
+	}
+
+	if ((target < 0) || (target > int64_t(size)))
+	{
+		return pos_type(off_type(-1));
+	}
+
+	// Still inside the window...
+	const int64_t windowStart = int64_t(produced) - (egptr() - eback());
+	if ((target >= windowStart) && (target <= int64_t(produced)))
+	{
+		setg(eback(), eback() + (target - windowStart), egptr());
+		return pos_type(target);
+	}
+
+	if (0 == format)
+	{
+		// Uncompressed data can be read from anywhere...
+		produced = consumed = uint32_t(target);
+		setg(&window[0], &window[0], &window[0]);
+		return pos_type(target);
+	}
+
+	// Compressed data has to be inflated from the start...
+	if ((target < windowStart) && !restart())
+	{
+		open = false;
+		return pos_type(off_type(-1));
+	}
+
+	// ...and forward to the target, discarding what is skipped.
+	while (int64_t(produced) < target)
+	{
+		setg(eback(), egptr(), egptr());
+		if (!fill())
+		{
+			return pos_type(off_type(-1));
+		}
+	}
+
+	const int64_t start = int64_t(produced) - (egptr() - eback());
+	setg(eback(), eback() + (target - start), egptr());
+
+	return pos_type(target);
+}
+
+treRecordStreambuf::pos_type
+treRecordStreambuf::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+	return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+treRecordStream::treRecordStream(const treClass& t,
+	const uint32_t& recordNum)
+	:
+	std::istream(nullptr),
+	buffer(t, recordNum)
+{
+	rdbuf(&buffer);
+	if (!buffer.isOpen())
+	{
+		setstate(std::ios_base::failbit);
+	}
+}
+
+treRecordStream::~treRecordStream()
+{
+}
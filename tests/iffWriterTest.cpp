@@ -0,0 +1,210 @@
+/** -*-c++-*-
+ *  \class  iffWriterTest
+ *  \file   iffWriterTest.cpp
+ *  \author Ken Sewell
+
+ swgLib is used for the parsing and exporting SWG models.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of swgLib.
+
+ swgLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ swgLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with swgLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <swgLib/iffIndex.hpp>
+#include <swgLib/iffWriter.hpp>
+#include <swgLib/logger.hpp>
+#include <treLib/treClass.hpp>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Images built with iffWriter, read back with iffIndex and from a TRE.
+
+static int failures = 0;
+
+#define CHECK(x) \
+	do \
+	{ \
+		if (!(x)) \
+		{ \
+			std::cout << __FILE__ << ": " << __LINE__ << ": " << #x << std::endl; \
+			++failures; \
+		} \
+	} while (0)
+
+// Payload of a record chunk.
+static std::string recordData(const ml::iffIndex& index, const uint32_t& chunk)
+{
+	const ml::iffIndex::chunk& c = index.at(chunk);
+	return std::string(index.data() + c.offset + 8, c.size);
+}
+
+// SKMG/0004 with a scalar record, an appended record and an empty FORM.
+static bool buildImage(ml::iffWriter& writer, const std::string& external)
+{
+	writer.beginForm("SKMG");
+	writer.beginForm("0004");
+	writer.beginRecord("INFO");
+	writer.write(uint32_t(0x01020304));
+	writer.write(std::string("bone"));
+	writer.endRecord();
+	writer.record("DATA", external.data(), external.size());
+	writer.beginForm("EMPT");
+	writer.endForm();
+	writer.endForm();
+	return writer.endForm();
+}
+
+static void testIndex()
+{
+	const std::string external(1000, 'x');
+	ml::iffWriter writer;
+	CHECK(buildImage(writer, external));
+	CHECK(!writer.fail());
+	CHECK(0 == writer.depth());
+
+	std::stringstream stream;
+	CHECK(writer.write(stream));
+	CHECK(stream.str().size() == writer.size());
+
+	ml::iffIndex index;
+	CHECK(index.load(stream));
+	CHECK(index.good());
+	CHECK(5 == index.size());
+	if (5 != index.size())
+	{
+		return;
+	}
+
+	CHECK(index.at(0).isForm());
+	CHECK(ml::iffIndex::tagFromStr("SKMG") == index.at(0).name());
+	CHECK(index.at(0).totalSize() == writer.size());
+
+	const uint32_t info = index.find("SKMG/0004/INFO");
+	CHECK(ml::iffIndex::npos != info);
+	if (ml::iffIndex::npos != info)
+	{
+		const std::string data = recordData(index, info);
+		uint32_t value = 0;
+		CHECK(9 == data.size());
+		std::memcpy(&value, data.data(), sizeof(value));
+		CHECK(0x01020304 == value);
+		CHECK(0 == std::strcmp(data.c_str() + 4, "bone"));
+	}
+
+	const uint32_t data = index.find("SKMG/0004/DATA");
+	CHECK(ml::iffIndex::npos != data);
+	if (ml::iffIndex::npos != data)
+	{
+		CHECK(external == recordData(index, data));
+	}
+
+	const uint32_t empty = index.find("SKMG/0004/EMPT");
+	CHECK(ml::iffIndex::npos != empty);
+	if (ml::iffIndex::npos != empty)
+	{
+		CHECK(4 == index.at(empty).size);
+	}
+
+	// An existing chunk copied into a new image is unchanged.
+	ml::iffWriter copy;
+	copy.beginForm("COPY");
+	copy.append(index, data);
+	CHECK(copy.endForm());
+	std::vector<char> image;
+	CHECK(copy.copyTo(image));
+	ml::iffIndex copyIndex;
+	CHECK(copyIndex.build(image.data(), image.size()));
+	const uint32_t copied = copyIndex.find("COPY/DATA");
+	CHECK(ml::iffIndex::npos != copied);
+	if (ml::iffIndex::npos != copied)
+	{
+		CHECK(external == recordData(copyIndex, copied));
+	}
+}
+
+static void testMisuse()
+{
+	ml::iffWriter writer;
+	writer.beginRecord("DATA");
+	CHECK(!writer.beginForm("FORM"));
+	CHECK(writer.fail());
+
+	std::stringstream stream;
+	CHECK(!writer.write(stream));
+
+	ml::iffWriter open;
+	open.beginForm("OPEN");
+	std::vector<char> image;
+	CHECK(!open.copyTo(image));
+}
+
+static void testTre()
+{
+	const std::string external(100000, 'y');
+	ml::iffWriter writer;
+	CHECK(buildImage(writer, external));
+	std::vector<char> image;
+	CHECK(writer.copyTo(image));
+
+	const std::string name("iffWriterTest.tre");
+	{
+		treClass tre;
+		tre.setVersion("5000");
+		tre.setFileBlockCompression(2);
+		tre.setNameBlockCompression(2);
+		CHECK(tre.beginWrite(name));
+		CHECK(writer.addTo(tre, "appearance/mesh/test.mgn", 2));
+		CHECK(writer.addTo(tre, "appearance/mesh/stored.mgn", 0));
+		CHECK(tre.endWrite());
+	}
+
+	treClass tre;
+	CHECK(tre.readFile(name));
+	CHECK(2 == tre.getFileRecordList().size());
+	for (const std::string recordName :
+		{ "appearance/mesh/test.mgn", "appearance/mesh/stored.mgn" })
+	{
+		uint32_t index = 0;
+		CHECK(tre.getFileRecordIndex(recordName, index));
+		treDataBlock block;
+		CHECK(tre.readRecord(index, block));
+		CHECK(block.getUncompressedSize() == image.size());
+		CHECK((block.getUncompressedSize() == image.size())
+			&& (0 == std::memcmp(block.getUncompressedDataPtr(),
+				image.data(), image.size())));
+	}
+	std::remove(name.c_str());
+}
+
+int main()
+{
+	ml::logger::setLevel(ml::logger::LOG_ERROR);
+
+	testIndex();
+	testMisuse();
+	testTre();
+
+	if (failures > 0)
+	{
+		std::cout << failures << " checks failed" << std::endl;
+		return 1;
+	}
+	return 0;
+}
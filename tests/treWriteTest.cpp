@@ -0,0 +1,254 @@
+/** -*-c++-*-
+ *  \class  treWriteTest
+ *  \file   treWriteTest.cpp
+ *  \author Ken Sewell
+
+ swgLib is used for the parsing and exporting SWG models.
+ Copyright (C) 2006-2021 Ken Sewell
+
+ This file is part of swgLib.
+
+ swgLib is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ swgLib is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with swgLib; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <swgLib/logger.hpp>
+#include <treLib/treArchive.hpp>
+#include <treLib/treClass.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Archives written with treClass and treArchive, read back: deduplicated
+// payloads, records reused from a base archive and repacking.
+
+static int failures = 0;
+
+#define CHECK(x) \
+	do \
+	{ \
+		if (!(x)) \
+		{ \
+			std::cout << __FILE__ << ": " << __LINE__ << ": " << #x << std::endl; \
+			++failures; \
+		} \
+	} while (0)
+
+static void setupWriter(treClass& tre)
+{
+	tre.setVersion("5000");
+	tre.setFileBlockCompression(2);
+	tre.setNameBlockCompression(2);
+}
+
+// Compressible payload that differs with seed.
+static std::string makeData(const char& seed, const std::size_t& size)
+{
+	std::string data(size, seed);
+	for (std::size_t i = 0; i < size; i += 97)
+	{
+		data[i] = char(i / 97);
+	}
+	return data;
+}
+
+static bool writeTre(const std::string& name,
+	const std::vector<std::pair<std::string, std::string>>& records)
+{
+	treClass tre;
+	setupWriter(tre);
+	if (!tre.beginWrite(name))
+	{
+		return false;
+	}
+	for (const auto& record : records)
+	{
+		if (!tre.addRecord(record.first, record.second.data(),
+			uint32_t(record.second.size()), 2))
+		{
+			return false;
+		}
+	}
+	return tre.endWrite();
+}
+
+static bool readRecord(const treClass& tre,
+	const std::string& name,
+	std::string& data,
+	uint32_t& offset)
+{
+	uint32_t index = 0;
+	treDataBlock block;
+	if (!tre.getFileRecordIndex(name, index) || !tre.readRecord(index, block))
+	{
+		return false;
+	}
+	offset = tre.getFileRecordList()[index].getOffset();
+	data.assign(block.getUncompressedDataPtr(), block.getUncompressedSize());
+	return true;
+}
+
+static bool writeFile(const std::string& name, const std::string& data)
+{
+	std::ofstream file(name.c_str(), std::ios_base::binary);
+	file.write(data.data(), data.size());
+	return file.good();
+}
+
+static void testDeduplicate()
+{
+	const std::string same = makeData('a', 50000);
+	const std::string other = makeData('b', 50000);
+	const std::string name("dedupTest.tre");
+
+	treClass writer;
+	setupWriter(writer);
+	writer.setDeduplicate(true);
+	CHECK(writer.beginWrite(name));
+	CHECK(writer.addRecord("a/first.bin", same.data(), uint32_t(same.size()), 2));
+	CHECK(writer.addRecord("b/second.bin", same.data(), uint32_t(same.size()), 2));
+	CHECK(writer.addRecord("c/other.bin", other.data(), uint32_t(other.size()), 2));
+	CHECK(writer.endWrite());
+	CHECK(1 == writer.getDeduplicatedRecords());
+	CHECK(writer.getDeduplicatedBytes() > 0);
+
+	treClass tre;
+	CHECK(tre.readFile(name));
+	std::string first, second, third;
+	uint32_t firstOffset = 0, secondOffset = 0, thirdOffset = 0;
+	CHECK(readRecord(tre, "a/first.bin", first, firstOffset));
+	CHECK(readRecord(tre, "b/second.bin", second, secondOffset));
+	CHECK(readRecord(tre, "c/other.bin", third, thirdOffset));
+	CHECK(same == first);
+	CHECK(same == second);
+	CHECK(other == third);
+	CHECK(firstOffset == secondOffset);
+	CHECK(firstOffset != thirdOffset);
+	std::remove(name.c_str());
+}
+
+static void testBaseArchive()
+{
+	const std::string kept = makeData('k', 40000);
+	const std::string changed = makeData('c', 40000);
+	const std::string added = makeData('n', 1000);
+	const std::string baseName("baseTest.tre");
+	const std::string outName("baseTestNew.tre");
+
+	// Record names are the input file names.
+	CHECK(writeTre(baseName, { { "kept.bin", kept },
+		{ "changed.bin", makeData('o', 40000) } }));
+	CHECK(writeFile("kept.bin", kept));
+	CHECK(writeFile("changed.bin", changed));
+	CHECK(writeFile("added.bin", added));
+
+	treClass writer;
+	setupWriter(writer);
+	CHECK(writer.setBaseArchive(baseName));
+	for (const char* input : { "kept.bin", "changed.bin", "added.bin" })
+	{
+		treFileRecord record;
+		record.setFileName(input);
+		record.setFormat(2);
+		writer.getFileRecordList().push_back(record);
+	}
+	CHECK(writer.writeFile(outName));
+	CHECK(1 == writer.getReusedRecords());
+	CHECK(kept.size() == writer.getReusedBytes());
+
+	// Writing over the base archive is refused.
+	treClass overwrite;
+	setupWriter(overwrite);
+	CHECK(overwrite.setBaseArchive(baseName));
+	CHECK(!overwrite.beginWrite(baseName));
+	CHECK(!overwrite.beginWrite("./" + baseName));
+
+	treClass tre;
+	CHECK(tre.readFile(outName));
+	std::string data;
+	uint32_t offset = 0;
+	CHECK(readRecord(tre, "kept.bin", data, offset) && (kept == data));
+	CHECK(readRecord(tre, "changed.bin", data, offset) && (changed == data));
+	CHECK(readRecord(tre, "added.bin", data, offset) && (added == data));
+
+	for (const char* file :
+		{ "kept.bin", "changed.bin", "added.bin", "baseTest.tre", "baseTestNew.tre" })
+	{
+		std::remove(file);
+	}
+}
+
+static void testRepack()
+{
+	const std::string shared = makeData('s', 30000);
+	const std::string oldData = makeData('o', 20000);
+	const std::string newData = makeData('n', 20000);
+	const std::string only = makeData('x', 10000);
+
+	CHECK(writeTre("repackLow.tre", { { "dir/override.bin", oldData },
+		{ "dir/low.bin", only }, { "copy/one.bin", shared } }));
+	CHECK(writeTre("repackHigh.tre", { { "dir/override.bin", newData },
+		{ "copy/two.bin", shared } }));
+
+	treArchive archive;
+	CHECK(archive.addFile("repackLow.tre"));
+	CHECK(archive.addFile("repackHigh.tre"));
+	CHECK(5 == archive.getNumRecords());
+
+	// Output over an input is refused and the input is left alone.
+	std::vector<std::string> outputFiles;
+	CHECK(!archive.repack("repackLow.tre", outputFiles));
+	CHECK(outputFiles.empty());
+	treClass low;
+	CHECK(low.readFile("repackLow.tre"));
+	CHECK(3 == low.getFileRecordList().size());
+
+	CHECK(archive.repack("repackOut.tre", outputFiles, 0, true));
+	CHECK((1 == outputFiles.size()) && ("repackOut.tre" == outputFiles[0]));
+
+	treClass tre;
+	CHECK(tre.readFile("repackOut.tre"));
+	CHECK(4 == tre.getFileRecordList().size());
+	std::string data;
+	uint32_t offset = 0, copyOffset = 0;
+	CHECK(readRecord(tre, "dir/override.bin", data, offset) && (newData == data));
+	CHECK(readRecord(tre, "dir/low.bin", data, offset) && (only == data));
+	CHECK(readRecord(tre, "copy/one.bin", data, copyOffset) && (shared == data));
+	CHECK(readRecord(tre, "copy/two.bin", data, offset) && (shared == data));
+	CHECK(offset == copyOffset);
+
+	for (const char* file : { "repackLow.tre", "repackHigh.tre", "repackOut.tre" })
+	{
+		std::remove(file);
+	}
+}
+
+int main()
+{
+	ml::logger::setLevel(ml::logger::LOG_ERROR);
+
+	testDeduplicate();
+	testBaseArchive();
+	testRepack();
+
+	if (failures > 0)
+	{
+		std::cout << failures << " checks failed" << std::endl;
+		return 1;
+	}
+	return 0;
+}